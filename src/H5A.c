@@ -33,6 +33,8 @@
 #include "H5Sprivate.h"         /* Dataspace functions                      */
 #include "H5VLprivate.h"        /* Virtual Object Layer                     */
 
+#include "H5VLnative_private.h" /* Native VOL connector                     */
+
 
 /****************/
 /* Local Macros */
@@ -724,6 +726,82 @@ done:
     FUNC_LEAVE_API(ret_value)
 } /* H5Aread() */
 
+
+/*--------------------------------------------------------------------------
+ NAME
+    H5Aread_bulk
+ PURPOSE
+    Read many attributes of an object at once
+ USAGE
+    ssize_t H5Aread_bulk (obj_id, names, nnames, info, ninfo, buf, buf_size)
+        hid_t obj_id;           IN: Object whose attributes are read
+        const char *names[];    IN: Names of the attributes to read, or NULL for all
+        size_t nnames;          IN: Number of names
+        H5A_bulk_info_t info[]; OUT: Information about each attribute read
+        size_t ninfo;           IN: Number of elements in INFO
+        void *buf;              OUT: Arena for attribute names and data
+        size_t *buf_size;       IN/OUT: Size of arena / size of arena used
+ RETURNS
+    Number of attributes read on success, negative on failure
+
+ DESCRIPTION
+        This function reads the attributes named in NAMES, or all the
+    object's attributes (in increasing name order) when NAMES is NULL, in
+    a single pass over the object header.  This avoids opening, reading
+    and closing each attribute.
+
+        For each attribute, INFO gets its name and data, which are placed
+    in the arena BUF, and a copy of its datatype in memory form, which
+    must be closed with H5Tclose.  With NAMES, INFO[i] describes NAMES[i]
+    and has a NULL name and an invalid datatype ID if the object has no
+    such attribute.  Names and data are aligned to 16 bytes from the
+    start of the arena.  Variable-length data is allocated as by H5Aread
+    and must be released by the application.
+
+        When INFO or BUF is NULL nothing is read, but the number of
+    attributes and the arena size a read would need are still returned,
+    in the return value and *BUF_SIZE.  It is an error for the arena or
+    INFO to be too small.
+--------------------------------------------------------------------------*/
+ssize_t
+H5Aread_bulk(hid_t obj_id, const char *names[], size_t nnames,
+    H5A_bulk_info_t info[], size_t ninfo, void *buf, size_t *buf_size)
+{
+    H5VL_object_t   *vol_obj;           /* Object of obj_id */
+    size_t          nfound = 0;         /* Number of attributes found */
+    size_t          u;                  /* Local index variable */
+    ssize_t         ret_value = -1;     /* Return value */
+
+    FUNC_ENTER_API((-1))
+    H5TRACE7("Zs", "i**sz*xz*x*z", obj_id, names, nnames, info, ninfo, buf, buf_size);
+
+    /* Check arguments */
+    if(H5I_ATTR == H5I_get_type(obj_id))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, (-1), "location is not valid for an attribute")
+    if(NULL == (vol_obj = H5VL_vol_object(obj_id)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, (-1), "invalid location identifier")
+    if(!buf_size)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, (-1), "buf_size parameter can't be NULL")
+    if(names) {
+        if(0 == nnames)
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, (-1), "no attribute names")
+        for(u = 0; u < nnames; u++)
+            if(!names[u] || !*names[u])
+                HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, (-1), "no attribute name")
+        if(info && buf && ninfo < nnames)
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, (-1), "attribute info array is too small")
+    } /* end if */
+
+    /* Read the attributes */
+    if(H5VL_attr_optional(vol_obj, H5P_DATASET_XFER_DEFAULT, H5_REQUEST_NULL, H5VL_NATIVE_ATTR_READ_BULK, obj_id, names, nnames, info, ninfo, buf, buf_size, &nfound) < 0)
+        HGOTO_ERROR(H5E_ATTR, H5E_READERROR, (-1), "unable to read attributes")
+
+    ret_value = (ssize_t)nfound;
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* H5Aread_bulk() */
+
 
 /*--------------------------------------------------------------------------
  NAME
@@ -41,6 +41,7 @@
 #include "H5Iprivate.h"         /* IDs                                      */
 #include "H5MMprivate.h"        /* Memory management                        */
 #include "H5Opkg.h"             /* Object headers                           */
+#include "H5SLprivate.h"        /* Skip Lists                               */
 #include "H5SMprivate.h"        /* Shared Object Header Messages            */
 #include "H5VLprivate.h"        /* Virtual Object Layer                     */
 
@@ -49,6 +50,10 @@
 /* Local Macros */
 /****************/
 
+/* Alignment of the names and data placed in the arena by H5A__read_bulk() */
+#define H5A_BULK_ALIGN          16
+#define H5A_BULK_ALIGN_SIZE(S)  (((S) + (H5A_BULK_ALIGN - 1)) & ~((size_t)H5A_BULK_ALIGN - 1))
+
 
 /******************/
 /* Local Typedefs */
@@ -78,6 +83,18 @@ typedef struct {
     H5O_loc_t *oloc_dst;
 } H5A_dense_file_cp_ud_t;
 
+/* Data exchange structure for reading many attributes at once */
+typedef struct {
+    H5F_t *f;                   /* File the object is in */
+    H5SL_t *names;              /* Requested names, mapped to their index (NULL for all) */
+    H5A_bulk_info_t *info;      /* Array of attribute info to fill (NULL for query) */
+    size_t ninfo;               /* Number of elements in info array */
+    uint8_t *buf;               /* Arena for names and data (NULL for query) */
+    size_t buf_size;            /* Size of the arena */
+    size_t buf_used;            /* Bytes of the arena used (or needed) */
+    size_t nfound;              /* Number of attributes found */
+} H5A_bulk_ud_t;
+
 
 /********************/
 /* Package Typedefs */
@@ -99,6 +116,7 @@ static herr_t H5A__attr_sort_table(H5A_attr_table_t *atable, H5_index_t idx_type
     H5_iter_order_t order);
 static herr_t H5A__iterate_common(hid_t loc_id, H5_index_t idx_type,
     H5_iter_order_t order, hsize_t *idx, H5A_attr_iter_op_t *attr_op, void *op_data);
+static herr_t H5A__read_bulk_cb(const H5A_t *attr, void *_udata);
 
 /*********************/
 /* Package Variables */
@@ -2720,6 +2738,203 @@ H5A__iterate_old(hid_t loc_id, unsigned *attr_num, H5A_operator1_t op,
 #endif /* H5_NO_DEPRECATED_SYMBOLS */
 
 
+/*-------------------------------------------------------------------------
+ * Function:    H5A__read_bulk_cb
+ *
+ * Purpose:     Attribute iteration callback for H5A__read_bulk(): place
+ *              the name and data of a requested attribute in the arena.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5A__read_bulk_cb(const H5A_t *attr, void *_udata)
+{
+    H5A_bulk_ud_t *udata = (H5A_bulk_ud_t *)_udata;   /* User data for callback */
+    H5A_bulk_info_t *curr = NULL;       /* Info for this attribute */
+    H5T_t       *mem_type = NULL;       /* Memory form of the attribute's datatype */
+    hssize_t    snelmts;                /* Number of elements in attribute */
+    size_t      name_size;              /* Space for the name in the arena */
+    size_t      data_size;              /* Size of the data */
+    size_t      idx;                    /* Index of the attribute in the info array */
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Skip attributes that weren't asked for */
+    if(udata->names) {
+        size_t *name_idx;               /* Index of the requested name */
+
+        if(NULL == (name_idx = (size_t *)H5SL_search(udata->names, attr->shared->name)))
+            HGOTO_DONE(SUCCEED)
+        idx = *name_idx;
+    } /* end if */
+    else
+        idx = udata->nfound;
+
+    /* Mark the datatype as being on disk, as when the attribute is opened */
+    if(H5T_set_loc(attr->shared->dt, udata->f, H5T_LOC_DISK) < 0)
+        HGOTO_ERROR(H5E_ATTR, H5E_CANTINIT, FAIL, "invalid datatype location")
+
+    /* Get the memory form of the datatype, which determines the data size */
+    if(H5T_patch_file(attr->shared->dt, udata->f) < 0)
+        HGOTO_ERROR(H5E_ATTR, H5E_CANTINIT, FAIL, "unable to patch datatype's file pointer")
+    if(NULL == (mem_type = H5T_copy(attr->shared->dt, H5T_COPY_REOPEN)))
+        HGOTO_ERROR(H5E_ATTR, H5E_CANTCOPY, FAIL, "unable to copy datatype")
+    if(H5T_set_loc(mem_type, NULL, H5T_LOC_MEMORY) < 0)
+        HGOTO_ERROR(H5E_ATTR, H5E_CANTINIT, FAIL, "invalid datatype location")
+    if((snelmts = H5S_GET_EXTENT_NPOINTS(attr->shared->ds)) < 0)
+        HGOTO_ERROR(H5E_ATTR, H5E_CANTCOUNT, FAIL, "dataspace is invalid")
+    data_size = (size_t)snelmts * H5T_GET_SIZE(mem_type);
+    name_size = H5A_BULK_ALIGN_SIZE(HDstrlen(attr->shared->name) + 1);
+
+    /* Fill in the info, unless this is only a query */
+    if(udata->info) {
+        if(idx >= udata->ninfo)
+            HGOTO_ERROR(H5E_ATTR, H5E_NOSPACE, FAIL, "attribute info array is too small")
+        if(udata->buf_used + name_size + H5A_BULK_ALIGN_SIZE(data_size) > udata->buf_size)
+            HGOTO_ERROR(H5E_ATTR, H5E_NOSPACE, FAIL, "arena is too small")
+        curr = &udata->info[idx];
+
+        /* Copy the name */
+        curr->name = (char *)udata->buf + udata->buf_used;
+        HDstrcpy(curr->name, attr->shared->name);
+
+        /* Read the data, converting it to its memory form */
+        curr->data = udata->buf + udata->buf_used + name_size;
+        curr->data_size = data_size;
+        curr->nelmts = (hsize_t)snelmts;
+        if(data_size > 0) {
+            if(attr->shared->data) {
+                if(H5A__read(attr, mem_type, curr->data) < 0)
+                    HGOTO_ERROR(H5E_ATTR, H5E_READERROR, FAIL, "unable to read attribute")
+            } /* end if */
+            else
+                HDmemset(curr->data, 0, data_size);
+        } /* end if */
+
+        /* Hand the datatype to the application */
+        if(H5T_lock(mem_type, FALSE) < 0)
+            HGOTO_ERROR(H5E_ATTR, H5E_CANTINIT, FAIL, "unable to lock transient datatype")
+        if(H5T_is_named(mem_type)) {
+            if((curr->type_id = H5VL_wrap_register(H5I_DATATYPE, mem_type, TRUE)) < 0)
+                HGOTO_ERROR(H5E_ATOM, H5E_CANTREGISTER, FAIL, "unable to register datatype")
+        } /* end if */
+        else {
+            if((curr->type_id = H5I_register(H5I_DATATYPE, mem_type, TRUE)) < 0)
+                HGOTO_ERROR(H5E_ATOM, H5E_CANTREGISTER, FAIL, "unable to register datatype")
+        } /* end else */
+        mem_type = NULL;
+    } /* end if */
+
+    udata->buf_used += name_size + H5A_BULK_ALIGN_SIZE(data_size);
+    udata->nfound++;
+
+done:
+    if(mem_type && H5T_close(mem_type) < 0)
+        HDONE_ERROR(H5E_ATTR, H5E_CANTRELEASE, FAIL, "unable to release datatype")
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5A__read_bulk_cb() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5A__read_bulk
+ *
+ * Purpose:     Private version of H5Aread_bulk: read the attributes of
+ *              the object at LOC (those in NAMES, or all of them when
+ *              NAMES is NULL) in one pass over the object header and
+ *              place their names and data in the arena BUF.
+ *
+ *              When INFO or BUF is NULL, nothing is read, but *BUF_SIZE
+ *              and *NFOUND are set to the arena size and the number of
+ *              attributes a read would need.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5A__read_bulk(const H5G_loc_t *loc, const char * const names[], size_t nnames,
+    H5A_bulk_info_t info[], size_t ninfo, void *buf, size_t *buf_size,
+    size_t *nfound)
+{
+    H5A_attr_iter_op_t attr_op;         /* Attribute operator */
+    H5A_bulk_ud_t udata;                /* User data for callback */
+    size_t      *name_idx = NULL;       /* Index of each requested name */
+    size_t      u;                      /* Local index variable */
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    HDassert(loc);
+    HDassert(buf_size);
+    HDassert(nfound);
+
+    /* Set up user data */
+    HDmemset(&udata, 0, sizeof(udata));
+    udata.f = loc->oloc->file;
+    if(info && buf) {
+        /* Each requested name needs an entry in the info array */
+        if(names && ninfo < nnames)
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "attribute info array is too small")
+
+        udata.info = info;
+        udata.ninfo = ninfo;
+        udata.buf = (uint8_t *)buf;
+        udata.buf_size = *buf_size;
+
+        /* Info for requested attributes that aren't found stays empty */
+        for(u = 0; u < (names ? MIN(nnames, ninfo) : ninfo); u++) {
+            info[u].name = NULL;
+            info[u].type_id = H5I_INVALID_HID;
+            info[u].nelmts = 0;
+            info[u].data_size = 0;
+            info[u].data = NULL;
+        } /* end for */
+    } /* end if */
+
+    /* Map the requested names to their position in the info array */
+    if(names) {
+        if(NULL == (udata.names = H5SL_create(H5SL_TYPE_STR, NULL)))
+            HGOTO_ERROR(H5E_ATTR, H5E_CANTCREATE, FAIL, "can't create skip list for names")
+        if(NULL == (name_idx = (size_t *)H5MM_malloc(nnames * sizeof(size_t))))
+            HGOTO_ERROR(H5E_ATTR, H5E_CANTALLOC, FAIL, "can't allocate name indices")
+        for(u = 0; u < nnames; u++) {
+            name_idx[u] = u;
+            if(H5SL_insert(udata.names, &name_idx[u], names[u]) < 0)
+                HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "duplicate attribute name requested")
+        } /* end for */
+    } /* end if */
+
+    /* Visit the attributes, in one pass over the object header */
+    attr_op.op_type = H5A_ATTR_OP_LIB;
+    attr_op.u.lib_op = H5A__read_bulk_cb;
+    if(H5O_attr_iterate_real(H5I_INVALID_HID, loc->oloc, H5_INDEX_NAME, H5_ITER_INC, (hsize_t)0, NULL, &attr_op, &udata) < 0)
+        HGOTO_ERROR(H5E_ATTR, H5E_BADITER, FAIL, "error iterating over attributes")
+
+    *buf_size = udata.buf_used;
+    *nfound = udata.nfound;
+
+done:
+    /* Don't leave datatype IDs behind on failure */
+    if(ret_value < 0 && udata.info)
+        for(u = 0; u < (names ? MIN(nnames, ninfo) : ninfo); u++)
+            if(info[u].type_id >= 0) {
+                if(H5I_dec_app_ref(info[u].type_id) < 0)
+                    HDONE_ERROR(H5E_ATTR, H5E_CANTDEC, FAIL, "unable to close datatype")
+                info[u].type_id = H5I_INVALID_HID;
+            } /* end if */
+    if(udata.names && H5SL_close(udata.names) < 0)
+        HDONE_ERROR(H5E_ATTR, H5E_CANTCLOSEOBJ, FAIL, "can't close skip list for names")
+    if(name_idx)
+        name_idx = (size_t *)H5MM_xfree(name_idx);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5A__read_bulk() */
+
+
 /*-------------------------------------------------------------------------
  * Function:	H5A__delete_by_name
  *
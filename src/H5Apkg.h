@@ -216,6 +216,9 @@ H5_DLL herr_t H5A__delete_by_idx(const H5G_loc_t *loc, const char *obj_name,
 H5_DLL htri_t H5A__exists_by_name(H5G_loc_t loc, const char *obj_name, const char *attr_name);
 H5_DLL herr_t H5A__write(H5A_t *attr, const H5T_t *mem_type, const void *buf);
 H5_DLL herr_t H5A__read(const H5A_t *attr, const H5T_t *mem_type, void *buf);
+H5_DLL herr_t H5A__read_bulk(const H5G_loc_t *loc, const char * const names[],
+    size_t nnames, H5A_bulk_info_t info[], size_t ninfo, void *buf,
+    size_t *buf_size, size_t *nfound);
 H5_DLL ssize_t H5A__get_name(H5A_t *attr, size_t buf_size, char *buf);
 
 /* Attribute "dense" storage routines */
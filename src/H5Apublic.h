@@ -30,6 +30,15 @@ typedef struct {
     hsize_t             data_size;      /* Size of raw data		  */
 } H5A_info_t;
 
+/* Information about an attribute read by H5Aread_bulk() */
+typedef struct {
+    char                *name;          /* Name of the attribute, in the arena */
+    hid_t               type_id;        /* Memory datatype of the data; close with H5Tclose() */
+    hsize_t             nelmts;         /* Number of elements in the data */
+    size_t              data_size;      /* Size of the data, in bytes */
+    void                *data;          /* Data of the attribute, in the arena */
+} H5A_bulk_info_t;
+
 /* Typedef for H5Aiterate2() callbacks */
 typedef herr_t (*H5A_operator2_t)(hid_t location_id/*in*/,
     const char *attr_name/*in*/, const H5A_info_t *ainfo/*in*/, void *op_data/*in,out*/);
@@ -59,6 +68,8 @@ H5_DLL hid_t   H5Aopen_by_idx(hid_t loc_id, const char *obj_name,
     hid_t lapl_id);
 H5_DLL herr_t  H5Awrite(hid_t attr_id, hid_t type_id, const void *buf);
 H5_DLL herr_t  H5Aread(hid_t attr_id, hid_t type_id, void *buf);
+H5_DLL ssize_t H5Aread_bulk(hid_t obj_id, const char *names[], size_t nnames,
+    H5A_bulk_info_t info[], size_t ninfo, void *buf, size_t *buf_size);
 H5_DLL herr_t  H5Aclose(hid_t attr_id);
 H5_DLL hid_t   H5Aget_space(hid_t attr_id);
 H5_DLL hid_t   H5Aget_type(hid_t attr_id);
@@ -2025,17 +2025,18 @@ H5C_resize_entry(void *thing, size_t new_size)
             }
         }
 
-        /* update the pinned and/or protected entry list */
-        if(entry_ptr->is_pinned) {
-            H5C__DLL_UPDATE_FOR_SIZE_CHANGE((cache_ptr->pel_len), \
-                                            (cache_ptr->pel_size), \
-                                            (entry_ptr->size), (new_size))
-        } /* end if */
+        /* update the pinned or protected entry list (a pinned entry is
+         * taken off the pinned entry list while it's protected) */
         if(entry_ptr->is_protected) {
             H5C__DLL_UPDATE_FOR_SIZE_CHANGE((cache_ptr->pl_len), \
                                             (cache_ptr->pl_size), \
                                             (entry_ptr->size), (new_size))
         } /* end if */
+        else if(entry_ptr->is_pinned) {
+            H5C__DLL_UPDATE_FOR_SIZE_CHANGE((cache_ptr->pel_len), \
+                                            (cache_ptr->pel_size), \
+                                            (entry_ptr->size), (new_size))
+        } /* end else-if */
 
 #ifdef H5_HAVE_PARALLEL
         if(entry_ptr->coll_access) {
@@ -2508,6 +2509,10 @@ H5C_protect(H5F_t *		f,
 
     H5C__UPDATE_STATS_FOR_PROTECT(cache_ptr, entry_ptr, hit)
 
+    /* Count the lookup, if the file is being profiled */
+    if(f->shared->prof && f->shared->prof->on)
+        H5F_prof_mdc(f->shared->prof, type->id, type->name, hit);
+
     ret_value = thing;
 
     if ( ( cache_ptr->evictions_enabled ) &&
@@ -240,6 +240,32 @@ H5CS_pop(void)
     FUNC_LEAVE_NOAPI_NOFS(SUCCEED);
 } /* end H5CS_pop() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	H5CS_get_api_name
+ *
+ * Purpose:	Retrieves the name of the outermost function on the current
+ *		thread's function stack, which is the API routine that was
+ *		called.
+ *
+ * Return:	Name of the routine, or NULL if the stack is empty
+ *
+ *-------------------------------------------------------------------------
+ */
+const char *
+H5CS_get_api_name(void)
+{
+    H5CS_t	*fstack = H5CS_get_my_stack();
+
+    /* Don't push this function on the function stack... :-) */
+    FUNC_ENTER_NOAPI_NOERR_NOFS
+
+    /* Sanity check */
+    HDassert(fstack);
+
+    FUNC_LEAVE_NOAPI_NOFS(fstack->nused > 0 ? fstack->rec[0] : NULL);
+} /* end H5CS_get_api_name() */
+
 
 /*-------------------------------------------------------------------------
  * Function:	H5CS_copy_stack
@@ -28,6 +28,7 @@
 struct H5CS_t;
 H5_DLL herr_t H5CS_push(const char *func_name);
 H5_DLL herr_t H5CS_pop(void);
+H5_DLL const char *H5CS_get_api_name(void);
 H5_DLL herr_t H5CS_print_stack(const struct H5CS_t *stack, FILE *stream);
 H5_DLL struct H5CS_t *H5CS_copy_stack(void);
 H5_DLL herr_t H5CS_close_stack(struct H5CS_t *stack);
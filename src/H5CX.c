@@ -56,14 +56,20 @@
  * In order for this macro to work, H5CX_get_my_context() must be preceeded
  * by "H5CX_node_t *ctx =".
  */
-#define H5CX_get_my_context()  H5CX__get_context()
+#define H5CX_get_my_thread()   H5CX__get_thread()
+#define H5CX_get_my_context()  (&H5CX__get_thread()->head)
 #else /* H5_HAVE_THREADSAFE */
 /*
  * The current API context.
  */
-#define H5CX_get_my_context() (&H5CX_head_g)
+#define H5CX_get_my_thread()   (&H5CX_thread_g)
+#define H5CX_get_my_context()  (&H5CX_thread_g.head)
 #endif /* H5_HAVE_THREADSAFE */
 
+/* Number of context nodes kept for re-use by each thread */
+/* (API calls nested deeper than this allocate their nodes) */
+#define H5CX_NODES_PER_THREAD   4
+
 /* Common macro for the retrieving the pointer to a property list */
 #define H5CX_RETRIEVE_PLIST(PL, FAILVAL)                                      \
     /* Check if the property list is already available */                     \
@@ -96,6 +102,26 @@
         H5CX_RETRIEVE_PROP_COMMON(PL, DEF_PL, PROP_NAME, PROP_FIELD)          \
     } /* end if */
 
+/* Macro for the duplicated code to retrieve properties from the DXPL */
+/* (The values come from the cached values for the DXPL, instead of being
+ *      looked up in the property list for each API call)
+ */
+#define H5CX_RETRIEVE_DXPL_PROP_VALID(PROP_FIELD)                             \
+    /* Check if the value has been retrieved already */                       \
+    if(!(*head)->ctx.H5_GLUE(PROP_FIELD,_valid)) {                            \
+        const H5CX_dxpl_cache_t *dxpl_cache;                                  \
+                                                                              \
+        /* Get the cached values for the DXPL */                              \
+        if(NULL == (dxpl_cache = H5CX__get_dxpl_cache(*head)))                \
+            HGOTO_ERROR(H5E_CONTEXT, H5E_CANTGET, FAIL, "can't retrieve value from API context") \
+                                                                              \
+        /* Get the property */                                                \
+        H5MM_memcpy(&(*head)->ctx.PROP_FIELD, &dxpl_cache->PROP_FIELD, sizeof(dxpl_cache->PROP_FIELD)); \
+                                                                              \
+        /* Mark the field as valid */                                         \
+        (*head)->ctx.H5_GLUE(PROP_FIELD,_valid) = TRUE;                       \
+    } /* end if */
+
 #ifdef H5_HAVE_PARALLEL
 /* Macro for the duplicated code to retrieve possibly set properties from a property list */
 #define H5CX_RETRIEVE_PROP_VALID_SET(PL, DEF_PL, PROP_NAME, PROP_FIELD)       \
@@ -203,6 +229,16 @@ typedef struct H5CX_t {
     /* Internal: Metadata cache info */
     H5AC_ring_t ring;           /* Current metadata cache ring for entries */
 
+    /* Internal: Concurrent raw data reads */
+    hbool_t concurrent_read;    /* Whether the operation's IDs are held, so raw data reads may let other threads run */
+    hbool_t release_api_lock;   /* Whether the file driver may release the API lock for the current raw data read */
+
+    /* Internal: Profiling counters */
+    H5F_prof_t *prof;           /* Counters for the file whose raw data is being accessed, if it's being profiled */
+
+    /* Internal: API call number */
+    uint64_t api_call;          /* Serial number of the API call, for tracing the file I/O it causes */
+
 #ifdef H5_HAVE_PARALLEL
     /* Internal: Parallel I/O settings */
     hbool_t coll_metadata_read; /* Whether to use collective I/O for metadata read */
@@ -245,6 +281,8 @@ typedef struct H5CX_t {
     hbool_t data_transform_valid; /* Whether data transform info is valid */
     H5T_vlen_alloc_info_t vl_alloc_info; /* VL datatype alloc info (H5D_XFER_VLEN_*_NAME) */
     hbool_t vl_alloc_info_valid; /* Whether VL datatype alloc info is valid */
+    H5T_vlen_arena_t vlen_arena; /* VL datatype arena, and how much of it is used (H5D_XFER_VLEN_ARENA_NAME) */
+    hbool_t vlen_arena_valid;   /* Whether VL datatype arena is valid */
     H5T_conv_cb_t dt_conv_cb;   /* Datatype conversion struct (H5D_XFER_CONV_CB_NAME) */
     hbool_t dt_conv_cb_valid;   /* Whether datatype conversion struct is valid */
 
@@ -343,6 +381,7 @@ typedef struct H5CX_dxpl_cache_t {
     H5Z_cb_t filter_cb;             /* Filter callback function (H5D_XFER_FILTER_CB_NAME) */
     H5Z_data_xform_t *data_transform; /* Data transform info (H5D_XFER_XFORM_NAME) */
     H5T_vlen_alloc_info_t vl_alloc_info; /* VL datatype alloc info (H5D_XFER_VLEN_*_NAME) */
+    H5T_vlen_arena_t vlen_arena;    /* VL datatype arena (H5D_XFER_VLEN_ARENA_NAME) */
     H5T_conv_cb_t dt_conv_cb;       /* Datatype conversion struct (H5D_XFER_CONV_CB_NAME) */
 } H5CX_dxpl_cache_t;
 
@@ -372,12 +411,36 @@ typedef struct H5CX_fapl_cache_t {
     H5F_libver_t high_bound;    /* high_bound property for H5Pset_libver_bounds */
 } H5CX_fapl_cache_t;
 
+/* Typedef for the API context information kept for each thread */
+/* (In threadsafe builds, this is allocated with a single call, so that the
+ *      thread-specific key destructor can release it.)
+ */
+typedef struct H5CX_thread_t {
+    H5CX_node_t *head;          /* Head of the API context stack (must be first) */
+
+    /* Context nodes for the outermost API calls, re-used without allocating */
+    unsigned nodes_used;        /* Number of nodes in use, from the start of the array */
+    H5CX_node_t nodes[H5CX_NODES_PER_THREAD];  /* Nodes to re-use */
+
+    /* Values from the most recently used non-default DXPL */
+    /* (Repeated calls with the same DXPL copy these, the same as the values
+     *      for the default DXPL, until the DXPL is modified.)
+     */
+    hid_t dxpl_id;              /* ID of the DXPL the values are from */
+    H5P_genplist_t *dxpl;       /* DXPL the values are from */
+    unsigned dxpl_mod_count;    /* Modification count of the DXPL when the values were retrieved */
+    unsigned dxpl_epoch;        /* Value of H5CX_dxpl_epoch_g when the values were retrieved */
+    H5CX_dxpl_cache_t dxpl_cache;   /* Values from the DXPL */
+} H5CX_thread_t;
+
 /********************/
 /* Local Prototypes */
 /********************/
 #ifdef H5_HAVE_THREADSAFE
-static H5CX_node_t **H5CX__get_context(void);
+static H5CX_thread_t *H5CX__get_thread(void);
 #endif /* H5_HAVE_THREADSAFE */
+static herr_t H5CX__fill_dxpl_cache(H5P_genplist_t *dx_plist, H5CX_dxpl_cache_t *dxpl_cache);
+static const H5CX_dxpl_cache_t *H5CX__get_dxpl_cache(H5CX_node_t *cnode);
 static void H5CX__push_common(H5CX_node_t *cnode);
 static H5CX_node_t *H5CX__pop_common(void);
 
@@ -395,12 +458,21 @@ hbool_t H5_PKG_INIT_VAR = FALSE;
 /*******************/
 
 #ifndef H5_HAVE_THREADSAFE
-static H5CX_node_t *H5CX_head_g = NULL;         /* Pointer to head of context stack */
+static H5CX_thread_t H5CX_thread_g;             /* API context stack & per-thread information */
 #endif /* H5_HAVE_THREADSAFE */
 
 /* Define a "default" dataset transfer property list cache structure to use for default DXPLs */
 static H5CX_dxpl_cache_t H5CX_def_dxpl_cache;
 
+/* Number of times the package has been shut down, to invalidate the values
+ * that threads have cached from non-default DXPLs (starts at 1, so that
+ * zeroed per-thread information is never valid)
+ */
+static unsigned H5CX_dxpl_epoch_g = 1;
+
+/* Number of API contexts pushed, to give each API call a serial number */
+static uint64_t H5CX_api_calls_g = 0;
+
 /* Define a "default" link access property list cache structure to use for default LAPLs */
 static H5CX_lapl_cache_t H5CX_def_lapl_cache;
 
@@ -443,87 +515,15 @@ H5CX__init_package(void)
 
     FUNC_ENTER_STATIC
 
-    /* Reset the "default DXPL cache" information */
-    HDmemset(&H5CX_def_dxpl_cache, 0, sizeof(H5CX_dxpl_cache_t));
-
     /* Get the default DXPL cache information */
 
     /* Get the default dataset transfer property list */
     if(NULL == (dx_plist = (H5P_genplist_t *)H5I_object(H5P_DATASET_XFER_DEFAULT)))
         HGOTO_ERROR(H5E_CONTEXT, H5E_BADTYPE, FAIL, "not a dataset transfer property list")
 
-    /* Get B-tree split ratios */
-    if(H5P_get(dx_plist, H5D_XFER_BTREE_SPLIT_RATIO_NAME, &H5CX_def_dxpl_cache.btree_split_ratio) < 0)
-        HGOTO_ERROR(H5E_CONTEXT, H5E_CANTGET, FAIL, "Can't retrieve B-tree split ratios")
-
-    /* Get maximum temporary buffer size value */
-    if(H5P_get(dx_plist, H5D_XFER_MAX_TEMP_BUF_NAME, &H5CX_def_dxpl_cache.max_temp_buf) < 0)
-        HGOTO_ERROR(H5E_CONTEXT, H5E_CANTGET, FAIL, "Can't retrieve maximum temporary buffer size")
-
-    /* Get temporary buffer pointer */
-    if(H5P_get(dx_plist, H5D_XFER_TCONV_BUF_NAME, &H5CX_def_dxpl_cache.tconv_buf) < 0)
-        HGOTO_ERROR(H5E_CONTEXT, H5E_CANTGET, FAIL, "Can't retrieve temporary buffer pointer")
-
-    /* Get background buffer pointer */
-    if(H5P_get(dx_plist, H5D_XFER_BKGR_BUF_NAME, &H5CX_def_dxpl_cache.bkgr_buf) < 0)
-        HGOTO_ERROR(H5E_CONTEXT, H5E_CANTGET, FAIL, "Can't retrieve background buffer pointer")
-
-    /* Get background buffer type */
-    if(H5P_get(dx_plist, H5D_XFER_BKGR_BUF_TYPE_NAME, &H5CX_def_dxpl_cache.bkgr_buf_type) < 0)
-        HGOTO_ERROR(H5E_CONTEXT, H5E_CANTGET, FAIL, "Can't retrieve background buffer type")
-
-    /* Get I/O vector size */
-    if(H5P_get(dx_plist, H5D_XFER_HYPER_VECTOR_SIZE_NAME, &H5CX_def_dxpl_cache.vec_size) < 0)
-        HGOTO_ERROR(H5E_CONTEXT, H5E_CANTGET, FAIL, "Can't retrieve I/O vector size")
-
-#ifdef H5_HAVE_PARALLEL
-    /* Collect Parallel I/O information for possible later use */
-    if(H5P_get(dx_plist, H5D_XFER_IO_XFER_MODE_NAME, &H5CX_def_dxpl_cache.io_xfer_mode) < 0)
-        HGOTO_ERROR(H5E_CONTEXT, H5E_CANTGET, FAIL, "Can't retrieve parallel transfer method")
-    if(H5P_get(dx_plist, H5D_XFER_MPIO_COLLECTIVE_OPT_NAME, &H5CX_def_dxpl_cache.mpio_coll_opt) < 0)
-        HGOTO_ERROR(H5E_CONTEXT, H5E_CANTGET, FAIL, "Can't retrieve collective transfer option")
-    if(H5P_get(dx_plist, H5D_XFER_MPIO_CHUNK_OPT_HARD_NAME, &H5CX_def_dxpl_cache.mpio_chunk_opt_mode) < 0)
-        HGOTO_ERROR(H5E_CONTEXT, H5E_CANTGET, FAIL, "Can't retrieve chunk optimization option")
-    if(H5P_get(dx_plist, H5D_XFER_MPIO_CHUNK_OPT_NUM_NAME, &H5CX_def_dxpl_cache.mpio_chunk_opt_num) < 0)
-        HGOTO_ERROR(H5E_CONTEXT, H5E_CANTGET, FAIL, "Can't retrieve chunk optimization threshold")
-    if(H5P_get(dx_plist, H5D_XFER_MPIO_CHUNK_OPT_RATIO_NAME, &H5CX_def_dxpl_cache.mpio_chunk_opt_ratio) < 0)
-        HGOTO_ERROR(H5E_CONTEXT, H5E_CANTGET, FAIL, "Can't retrieve chunk optimization ratio")
-
-    /* Get the local & global reasons for breaking collective I/O values */
-    if(H5P_get(dx_plist, H5D_MPIO_LOCAL_NO_COLLECTIVE_CAUSE_NAME, &H5CX_def_dxpl_cache.mpio_local_no_coll_cause) < 0)
-        HGOTO_ERROR(H5E_CONTEXT, H5E_CANTGET, FAIL, "Can't retrieve local cause for breaking collective I/O")
-    if(H5P_get(dx_plist, H5D_MPIO_GLOBAL_NO_COLLECTIVE_CAUSE_NAME, &H5CX_def_dxpl_cache.mpio_global_no_coll_cause) < 0)
-        HGOTO_ERROR(H5E_CONTEXT, H5E_CANTGET, FAIL, "Can't retrieve global cause for breaking collective I/O")
-#endif /* H5_HAVE_PARALLEL */
-
-    /* Get error detection properties */
-    if(H5P_get(dx_plist, H5D_XFER_EDC_NAME, &H5CX_def_dxpl_cache.err_detect) < 0)
-        HGOTO_ERROR(H5E_CONTEXT, H5E_CANTGET, FAIL, "Can't retrieve error detection info")
-
-    /* Get filter callback function */
-    if(H5P_get(dx_plist, H5D_XFER_FILTER_CB_NAME, &H5CX_def_dxpl_cache.filter_cb) < 0)
-        HGOTO_ERROR(H5E_CONTEXT, H5E_CANTGET, FAIL, "Can't retrieve filter callback function")
-
-    /* Look at the data transform property */
-    /* (Note: 'peek', not 'get' - if this turns out to be a problem, we may need
-     *          to copy it and free this in the H5CX terminate routine. -QAK)
-     */
-    if(H5P_peek(dx_plist, H5D_XFER_XFORM_NAME, &H5CX_def_dxpl_cache.data_transform) < 0)
-        HGOTO_ERROR(H5E_CONTEXT, H5E_CANTGET, FAIL, "Can't retrieve data transform info")
-
-    /* Get VL datatype alloc info */
-    if(H5P_get(dx_plist, H5D_XFER_VLEN_ALLOC_NAME, &H5CX_def_dxpl_cache.vl_alloc_info.alloc_func) < 0)
-        HGOTO_ERROR(H5E_CONTEXT, H5E_CANTGET, FAIL, "Can't retrieve VL datatype alloc info")
-    if(H5P_get(dx_plist, H5D_XFER_VLEN_ALLOC_INFO_NAME, &H5CX_def_dxpl_cache.vl_alloc_info.alloc_info) < 0)
-        HGOTO_ERROR(H5E_CONTEXT, H5E_CANTGET, FAIL, "Can't retrieve VL datatype alloc info")
-    if(H5P_get(dx_plist, H5D_XFER_VLEN_FREE_NAME, &H5CX_def_dxpl_cache.vl_alloc_info.free_func) < 0)
-        HGOTO_ERROR(H5E_CONTEXT, H5E_CANTGET, FAIL, "Can't retrieve VL datatype alloc info")
-    if(H5P_get(dx_plist, H5D_XFER_VLEN_FREE_INFO_NAME, &H5CX_def_dxpl_cache.vl_alloc_info.free_info) < 0)
-        HGOTO_ERROR(H5E_CONTEXT, H5E_CANTGET, FAIL, "Can't retrieve VL datatype alloc info")
-
-    /* Get datatype conversion struct */
-    if(H5P_get(dx_plist, H5D_XFER_CONV_CB_NAME, &H5CX_def_dxpl_cache.dt_conv_cb) < 0)
-        HGOTO_ERROR(H5E_CONTEXT, H5E_CANTGET, FAIL, "Can't retrieve datatype conversion exception callback")
+    /* Get the values */
+    if(H5CX__fill_dxpl_cache(dx_plist, &H5CX_def_dxpl_cache) < 0)
+        HGOTO_ERROR(H5E_CONTEXT, H5E_CANTGET, FAIL, "Can't retrieve default DXPL values")
 
     /* Reset the "default LAPL cache" information */
     HDmemset(&H5CX_def_lapl_cache, 0, sizeof(H5CX_lapl_cache_t));
@@ -589,6 +589,111 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5CX__init_package() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    H5CX__fill_dxpl_cache
+ *
+ * Purpose:     Retrieves the values from a DXPL that API contexts use.
+ *
+ * Return:      Non-negative on success / Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5CX__fill_dxpl_cache(H5P_genplist_t *dx_plist, H5CX_dxpl_cache_t *dxpl_cache)
+{
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity check */
+    HDassert(dx_plist);
+    HDassert(dxpl_cache);
+
+    /* Reset the cached information */
+    HDmemset(dxpl_cache, 0, sizeof(H5CX_dxpl_cache_t));
+
+    /* Get B-tree split ratios */
+    if(H5P_get(dx_plist, H5D_XFER_BTREE_SPLIT_RATIO_NAME, &dxpl_cache->btree_split_ratio) < 0)
+        HGOTO_ERROR(H5E_CONTEXT, H5E_CANTGET, FAIL, "Can't retrieve B-tree split ratios")
+
+    /* Get maximum temporary buffer size value */
+    if(H5P_get(dx_plist, H5D_XFER_MAX_TEMP_BUF_NAME, &dxpl_cache->max_temp_buf) < 0)
+        HGOTO_ERROR(H5E_CONTEXT, H5E_CANTGET, FAIL, "Can't retrieve maximum temporary buffer size")
+
+    /* Get temporary buffer pointer */
+    if(H5P_get(dx_plist, H5D_XFER_TCONV_BUF_NAME, &dxpl_cache->tconv_buf) < 0)
+        HGOTO_ERROR(H5E_CONTEXT, H5E_CANTGET, FAIL, "Can't retrieve temporary buffer pointer")
+
+    /* Get background buffer pointer */
+    if(H5P_get(dx_plist, H5D_XFER_BKGR_BUF_NAME, &dxpl_cache->bkgr_buf) < 0)
+        HGOTO_ERROR(H5E_CONTEXT, H5E_CANTGET, FAIL, "Can't retrieve background buffer pointer")
+
+    /* Get background buffer type */
+    if(H5P_get(dx_plist, H5D_XFER_BKGR_BUF_TYPE_NAME, &dxpl_cache->bkgr_buf_type) < 0)
+        HGOTO_ERROR(H5E_CONTEXT, H5E_CANTGET, FAIL, "Can't retrieve background buffer type")
+
+    /* Get I/O vector size */
+    if(H5P_get(dx_plist, H5D_XFER_HYPER_VECTOR_SIZE_NAME, &dxpl_cache->vec_size) < 0)
+        HGOTO_ERROR(H5E_CONTEXT, H5E_CANTGET, FAIL, "Can't retrieve I/O vector size")
+
+#ifdef H5_HAVE_PARALLEL
+    /* Collect Parallel I/O information for possible later use */
+    if(H5P_get(dx_plist, H5D_XFER_IO_XFER_MODE_NAME, &dxpl_cache->io_xfer_mode) < 0)
+        HGOTO_ERROR(H5E_CONTEXT, H5E_CANTGET, FAIL, "Can't retrieve parallel transfer method")
+    if(H5P_get(dx_plist, H5D_XFER_MPIO_COLLECTIVE_OPT_NAME, &dxpl_cache->mpio_coll_opt) < 0)
+        HGOTO_ERROR(H5E_CONTEXT, H5E_CANTGET, FAIL, "Can't retrieve collective transfer option")
+    if(H5P_get(dx_plist, H5D_XFER_MPIO_CHUNK_OPT_HARD_NAME, &dxpl_cache->mpio_chunk_opt_mode) < 0)
+        HGOTO_ERROR(H5E_CONTEXT, H5E_CANTGET, FAIL, "Can't retrieve chunk optimization option")
+    if(H5P_get(dx_plist, H5D_XFER_MPIO_CHUNK_OPT_NUM_NAME, &dxpl_cache->mpio_chunk_opt_num) < 0)
+        HGOTO_ERROR(H5E_CONTEXT, H5E_CANTGET, FAIL, "Can't retrieve chunk optimization threshold")
+    if(H5P_get(dx_plist, H5D_XFER_MPIO_CHUNK_OPT_RATIO_NAME, &dxpl_cache->mpio_chunk_opt_ratio) < 0)
+        HGOTO_ERROR(H5E_CONTEXT, H5E_CANTGET, FAIL, "Can't retrieve chunk optimization ratio")
+
+    /* Get the local & global reasons for breaking collective I/O values */
+    if(H5P_get(dx_plist, H5D_MPIO_LOCAL_NO_COLLECTIVE_CAUSE_NAME, &dxpl_cache->mpio_local_no_coll_cause) < 0)
+        HGOTO_ERROR(H5E_CONTEXT, H5E_CANTGET, FAIL, "Can't retrieve local cause for breaking collective I/O")
+    if(H5P_get(dx_plist, H5D_MPIO_GLOBAL_NO_COLLECTIVE_CAUSE_NAME, &dxpl_cache->mpio_global_no_coll_cause) < 0)
+        HGOTO_ERROR(H5E_CONTEXT, H5E_CANTGET, FAIL, "Can't retrieve global cause for breaking collective I/O")
+#endif /* H5_HAVE_PARALLEL */
+
+    /* Get error detection properties */
+    if(H5P_get(dx_plist, H5D_XFER_EDC_NAME, &dxpl_cache->err_detect) < 0)
+        HGOTO_ERROR(H5E_CONTEXT, H5E_CANTGET, FAIL, "Can't retrieve error detection info")
+
+    /* Get filter callback function */
+    if(H5P_get(dx_plist, H5D_XFER_FILTER_CB_NAME, &dxpl_cache->filter_cb) < 0)
+        HGOTO_ERROR(H5E_CONTEXT, H5E_CANTGET, FAIL, "Can't retrieve filter callback function")
+
+    /* Look at the data transform property */
+    /* (Note: 'peek', not 'get' - if this turns out to be a problem, we may need
+     *          to copy it and free this in the H5CX terminate routine. -QAK)
+     */
+    if(H5P_peek(dx_plist, H5D_XFER_XFORM_NAME, &dxpl_cache->data_transform) < 0)
+        HGOTO_ERROR(H5E_CONTEXT, H5E_CANTGET, FAIL, "Can't retrieve data transform info")
+
+    /* Get VL datatype alloc info */
+    if(H5P_get(dx_plist, H5D_XFER_VLEN_ALLOC_NAME, &dxpl_cache->vl_alloc_info.alloc_func) < 0)
+        HGOTO_ERROR(H5E_CONTEXT, H5E_CANTGET, FAIL, "Can't retrieve VL datatype alloc info")
+    if(H5P_get(dx_plist, H5D_XFER_VLEN_ALLOC_INFO_NAME, &dxpl_cache->vl_alloc_info.alloc_info) < 0)
+        HGOTO_ERROR(H5E_CONTEXT, H5E_CANTGET, FAIL, "Can't retrieve VL datatype alloc info")
+    if(H5P_get(dx_plist, H5D_XFER_VLEN_FREE_NAME, &dxpl_cache->vl_alloc_info.free_func) < 0)
+        HGOTO_ERROR(H5E_CONTEXT, H5E_CANTGET, FAIL, "Can't retrieve VL datatype alloc info")
+    if(H5P_get(dx_plist, H5D_XFER_VLEN_FREE_INFO_NAME, &dxpl_cache->vl_alloc_info.free_info) < 0)
+        HGOTO_ERROR(H5E_CONTEXT, H5E_CANTGET, FAIL, "Can't retrieve VL datatype alloc info")
+
+    /* Get VL datatype arena */
+    if(H5P_get(dx_plist, H5D_XFER_VLEN_ARENA_NAME, &dxpl_cache->vlen_arena) < 0)
+        HGOTO_ERROR(H5E_CONTEXT, H5E_CANTGET, FAIL, "Can't retrieve VL datatype arena")
+
+    /* Get datatype conversion struct */
+    if(H5P_get(dx_plist, H5D_XFER_CONV_CB_NAME, &dxpl_cache->dt_conv_cb) < 0)
+        HGOTO_ERROR(H5E_CONTEXT, H5E_CANTGET, FAIL, "Can't retrieve datatype conversion exception callback")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5CX__fill_dxpl_cache() */
+
 
 /*-------------------------------------------------------------------------
  * Function: H5CX_term_package
@@ -621,9 +726,14 @@ H5CX_term_package(void)
         HDfree(cnode);
 
 #ifndef H5_HAVE_THREADSAFE
-        H5CX_head_g = NULL;
+        H5CX_thread_g.head = NULL;
 #endif /* H5_HAVE_THREADSAFE */
 
+        /* Forget the values cached from DXPLs in all threads, as property
+         * lists (and their IDs) may be re-used if the library is re-opened
+         */
+        H5CX_dxpl_epoch_g++;
+
         H5_PKG_INIT_VAR = FALSE;
     } /* end if */
 
@@ -633,12 +743,12 @@ H5CX_term_package(void)
 
 #ifdef H5_HAVE_THREADSAFE
 /*-------------------------------------------------------------------------
- * Function:	H5CX__get_context
+ * Function:	H5CX__get_thread
  *
  * Purpose:	Support function for H5CX_get_my_context() to initialize and
- *              acquire per-thread API context stack.
+ *              acquire per-thread API context stack and information.
  *
- * Return:	Success: Non-NULL pointer to head pointer of API context stack for thread
+ * Return:	Success: Non-NULL pointer to API context information for thread
  *		Failure: NULL
  *
  * Programmer:	Quincey Koziol
@@ -646,44 +756,100 @@ H5CX_term_package(void)
  *
  *-------------------------------------------------------------------------
  */
-static H5CX_node_t **
-H5CX__get_context(void)
+static H5CX_thread_t *
+H5CX__get_thread(void)
 {
-    H5CX_node_t **ctx = NULL;
+    H5CX_thread_t *thread = NULL;
 
     FUNC_ENTER_STATIC_NOERR
 
-    ctx = (H5CX_node_t **)H5TS_get_thread_local_value(H5TS_apictx_key_g);
+    thread = (H5CX_thread_t *)H5TS_get_thread_local_value(H5TS_apictx_key_g);
 
-    if(!ctx) {
+    if(!thread) {
         /* No associated value with current thread - create one */
+        /* (Zeroed, which resets the thread-specific info) */
 #ifdef H5_HAVE_WIN_THREADS
         /* Win32 has to use LocalAlloc to match the LocalFree in DllMain */
-        ctx = (H5CX_node_t **)LocalAlloc(LPTR, sizeof(H5CX_node_t *)); 
+        thread = (H5CX_thread_t *)LocalAlloc(LPTR, sizeof(H5CX_thread_t));
 #else
-        /* Use HDmalloc here since this has to match the HDfree in the
+        /* Use HDcalloc here since this has to match the HDfree in the
          * destructor and we want to avoid the codestack there.
          */
-        ctx = (H5CX_node_t **)HDmalloc(sizeof(H5CX_node_t *));
+        thread = (H5CX_thread_t *)HDcalloc(1, sizeof(H5CX_thread_t));
 #endif /* H5_HAVE_WIN_THREADS */
-        HDassert(ctx);
-
-        /* Reset the thread-specific info */
-        *ctx = NULL;
+        HDassert(thread);
 
         /* (It's not necessary to release this in this API, it is
          *      released by the "key destructor" set up in the H5TS
          *      routines.  See calls to pthread_key_create() in H5TS.c -QAK)
          */
-        H5TS_set_thread_local_value(H5TS_apictx_key_g, (void *)ctx);
+        H5TS_set_thread_local_value(H5TS_apictx_key_g, (void *)thread);
     } /* end if */
 
     /* Set return value */
-    FUNC_LEAVE_NOAPI(ctx)
-} /* end H5CX__get_context() */
+    FUNC_LEAVE_NOAPI(thread)
+} /* end H5CX__get_thread() */
 #endif  /* H5_HAVE_THREADSAFE */
 
 
+/*-------------------------------------------------------------------------
+ * Function:    H5CX__get_dxpl_cache
+ *
+ * Purpose:     Gets the values an API context uses from its DXPL.  The
+ *              values for the default DXPL are retrieved when the package
+ *              is initialized, and the values for the last non-default
+ *              DXPL each thread used are kept until that DXPL is modified.
+ *
+ * Return:      Success:    Pointer to the DXPL's values
+ *              Failure:    NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+static const H5CX_dxpl_cache_t *
+H5CX__get_dxpl_cache(H5CX_node_t *cnode)
+{
+    H5CX_thread_t *thread = H5CX_get_my_thread();  /* Get the API context information for this thread */
+    const H5CX_dxpl_cache_t *ret_value = NULL;  /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity check */
+    HDassert(cnode);
+
+    /* Check for default DXPL */
+    if(cnode->ctx.dxpl_id == H5P_DATASET_XFER_DEFAULT)
+        HGOTO_DONE(&H5CX_def_dxpl_cache)
+
+    /* Check if the property list is already available */
+    if(NULL == cnode->ctx.dxpl)
+        /* Get the dataset transfer property list pointer */
+        if(NULL == (cnode->ctx.dxpl = (H5P_genplist_t *)H5I_object(cnode->ctx.dxpl_id)))
+            HGOTO_ERROR(H5E_CONTEXT, H5E_BADTYPE, NULL, "can't get dataset transfer property list")
+
+    /* Retrieve the values again, unless the thread has them already */
+    if(thread->dxpl_epoch != H5CX_dxpl_epoch_g || thread->dxpl_id != cnode->ctx.dxpl_id
+            || thread->dxpl != cnode->ctx.dxpl
+            || thread->dxpl_mod_count != H5P_get_mod_count(cnode->ctx.dxpl)) {
+        /* Forget the old values, in case this fails */
+        thread->dxpl_epoch = 0;
+
+        if(H5CX__fill_dxpl_cache(cnode->ctx.dxpl, &thread->dxpl_cache) < 0)
+            HGOTO_ERROR(H5E_CONTEXT, H5E_CANTGET, NULL, "can't retrieve values from dataset transfer property list")
+
+        thread->dxpl_id = cnode->ctx.dxpl_id;
+        thread->dxpl = cnode->ctx.dxpl;
+        thread->dxpl_mod_count = H5P_get_mod_count(cnode->ctx.dxpl);
+        thread->dxpl_epoch = H5CX_dxpl_epoch_g;
+    } /* end if */
+
+    /* Set return value */
+    ret_value = &thread->dxpl_cache;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5CX__get_dxpl_cache() */
+
+
 /*-------------------------------------------------------------------------
  * Function:    H5CX__push_common
  *
@@ -714,6 +880,7 @@ H5CX__push_common(H5CX_node_t *cnode)
     cnode->ctx.fapl_id = H5P_FILE_ACCESS_DEFAULT;
     cnode->ctx.tag = H5AC__INVALID_TAG;
     cnode->ctx.ring = H5AC_RING_USER;
+    cnode->ctx.api_call = ++H5CX_api_calls_g;
 
     /* Push context node onto stack */
     cnode->next = *head;
@@ -738,14 +905,21 @@ H5CX__push_common(H5CX_node_t *cnode)
 herr_t
 H5CX_push(void)
 {
+    H5CX_thread_t *thread = H5CX_get_my_thread();  /* Get the API context information for this thread */
     H5CX_node_t *cnode = NULL;          /* Context node */
     herr_t ret_value = SUCCEED;         /* Return value */
 
     FUNC_ENTER_NOAPI(FAIL)
 
-    /* Allocate & clear API context node */
-    if(NULL == (cnode = H5FL_CALLOC(H5CX_node_t)))
-        HGOTO_ERROR(H5E_CONTEXT, H5E_CANTALLOC, FAIL, "unable to allocate new struct")
+    /* Re-use one of the thread's context nodes, if there's one free */
+    if(thread->nodes_used < H5CX_NODES_PER_THREAD) {
+        cnode = &thread->nodes[thread->nodes_used++];
+        HDmemset(cnode, 0, sizeof(H5CX_node_t));
+    } /* end if */
+    else
+        /* Allocate & clear API context node */
+        if(NULL == (cnode = H5FL_CALLOC(H5CX_node_t)))
+            HGOTO_ERROR(H5E_CONTEXT, H5E_CANTALLOC, FAIL, "unable to allocate new struct")
 
     /* Set context info */
     H5CX__push_common(cnode);
@@ -1574,6 +1748,105 @@ H5CX_get_ring(void)
     FUNC_LEAVE_NOAPI((*head)->ctx.ring)
 } /* end H5CX_get_ring() */
 
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5CX_get_concurrent_read
+ *
+ * Purpose:     Retrieves whether raw data reads for the current API call
+ *              context may let other threads into the library.
+ *
+ * Return:      TRUE / FALSE
+ *
+ *-------------------------------------------------------------------------
+ */
+hbool_t
+H5CX_get_concurrent_read(void)
+{
+    H5CX_node_t **head = H5CX_get_my_context();  /* Get the pointer to the head of the API context, for this thread */
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    /* Sanity check */
+    HDassert(head && *head);
+
+    FUNC_LEAVE_NOAPI((*head)->ctx.concurrent_read)
+} /* end H5CX_get_concurrent_read() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5CX_get_release_api_lock
+ *
+ * Purpose:     Retrieves whether the file driver may release the API lock
+ *              while it waits on the current raw data read.
+ *
+ * Return:      TRUE / FALSE
+ *
+ *-------------------------------------------------------------------------
+ */
+hbool_t
+H5CX_get_release_api_lock(void)
+{
+    H5CX_node_t **head = H5CX_get_my_context();  /* Get the pointer to the head of the API context, for this thread */
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    /* Sanity check */
+    HDassert(head && *head);
+
+    FUNC_LEAVE_NOAPI((*head)->ctx.release_api_lock)
+} /* end H5CX_get_release_api_lock() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5CX_get_api_call
+ *
+ * Purpose:     Retrieves the serial number of the current API call.
+ *
+ * Return:      The API call's number, or 0 if there's no API call in
+ *              progress
+ *
+ *-------------------------------------------------------------------------
+ */
+uint64_t
+H5CX_get_api_call(void)
+{
+    H5CX_node_t **head = H5CX_get_my_context();  /* Get the pointer to the head of the API context, for this thread */
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    /* Sanity check */
+    HDassert(head);
+
+    FUNC_LEAVE_NOAPI(*head ? (*head)->ctx.api_call : 0)
+} /* end H5CX_get_api_call() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5CX_get_prof
+ *
+ * Purpose:     Retrieves the profiling counters for the file whose raw data
+ *              is being accessed by the current API call.
+ *
+ * Return:      Pointer to the counters, or NULL if the file isn't being
+ *              profiled (or there's no API call in progress, as during
+ *              library shutdown)
+ *
+ *-------------------------------------------------------------------------
+ */
+H5F_prof_t *
+H5CX_get_prof(void)
+{
+    H5CX_node_t **head = H5CX_get_my_context();  /* Get the pointer to the head of the API context, for this thread */
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    /* Sanity check */
+    HDassert(head);
+
+    FUNC_LEAVE_NOAPI(*head ? (*head)->ctx.prof : NULL)
+} /* end H5CX_get_prof() */
+
 #ifdef H5_HAVE_PARALLEL
 
 /*-------------------------------------------------------------------------
@@ -1716,7 +1989,7 @@ H5CX_get_btree_split_ratios(double split_ratio[3])
     HDassert(head && *head);
     HDassert(H5P_DEFAULT != (*head)->ctx.dxpl_id);
 
-    H5CX_RETRIEVE_PROP_VALID(dxpl, H5P_DATASET_XFER_DEFAULT, H5D_XFER_BTREE_SPLIT_RATIO_NAME, btree_split_ratio)
+    H5CX_RETRIEVE_DXPL_PROP_VALID(btree_split_ratio)
 
     /* Get the B-tree split ratio values */
     H5MM_memcpy(split_ratio, &(*head)->ctx.btree_split_ratio, sizeof((*head)->ctx.btree_split_ratio));
@@ -1751,7 +2024,7 @@ H5CX_get_max_temp_buf(size_t *max_temp_buf)
     HDassert(head && *head);
     HDassert(H5P_DEFAULT != (*head)->ctx.dxpl_id);
 
-    H5CX_RETRIEVE_PROP_VALID(dxpl, H5P_DATASET_XFER_DEFAULT, H5D_XFER_MAX_TEMP_BUF_NAME, max_temp_buf)
+    H5CX_RETRIEVE_DXPL_PROP_VALID(max_temp_buf)
 
     /* Get the value */
     *max_temp_buf = (*head)->ctx.max_temp_buf;
@@ -1786,7 +2059,7 @@ H5CX_get_tconv_buf(void **tconv_buf)
     HDassert(head && *head);
     HDassert(H5P_DEFAULT != (*head)->ctx.dxpl_id);
 
-    H5CX_RETRIEVE_PROP_VALID(dxpl, H5P_DATASET_XFER_DEFAULT, H5D_XFER_TCONV_BUF_NAME, tconv_buf)
+    H5CX_RETRIEVE_DXPL_PROP_VALID(tconv_buf)
 
     /* Get the value */
     *tconv_buf = (*head)->ctx.tconv_buf;
@@ -1821,7 +2094,7 @@ H5CX_get_bkgr_buf(void **bkgr_buf)
     HDassert(head && *head);
     HDassert(H5P_DEFAULT != (*head)->ctx.dxpl_id);
 
-    H5CX_RETRIEVE_PROP_VALID(dxpl, H5P_DATASET_XFER_DEFAULT, H5D_XFER_BKGR_BUF_NAME, bkgr_buf)
+    H5CX_RETRIEVE_DXPL_PROP_VALID(bkgr_buf)
 
     /* Get the value */
     *bkgr_buf = (*head)->ctx.bkgr_buf;
@@ -1856,7 +2129,7 @@ H5CX_get_bkgr_buf_type(H5T_bkg_t *bkgr_buf_type)
     HDassert(head && *head);
     HDassert(H5P_DEFAULT != (*head)->ctx.dxpl_id);
 
-    H5CX_RETRIEVE_PROP_VALID(dxpl, H5P_DATASET_XFER_DEFAULT, H5D_XFER_BKGR_BUF_TYPE_NAME, bkgr_buf_type)
+    H5CX_RETRIEVE_DXPL_PROP_VALID(bkgr_buf_type)
 
     /* Get the value */
     *bkgr_buf_type = (*head)->ctx.bkgr_buf_type;
@@ -1891,7 +2164,7 @@ H5CX_get_vec_size(size_t *vec_size)
     HDassert(head && *head);
     HDassert(H5P_DEFAULT != (*head)->ctx.dxpl_id);
 
-    H5CX_RETRIEVE_PROP_VALID(dxpl, H5P_DATASET_XFER_DEFAULT, H5D_XFER_HYPER_VECTOR_SIZE_NAME, vec_size)
+    H5CX_RETRIEVE_DXPL_PROP_VALID(vec_size)
 
     /* Get the value */
     *vec_size = (*head)->ctx.vec_size;
@@ -1927,7 +2200,7 @@ H5CX_get_io_xfer_mode(H5FD_mpio_xfer_t *io_xfer_mode)
     HDassert(head && *head);
     HDassert(H5P_DEFAULT != (*head)->ctx.dxpl_id);
 
-    H5CX_RETRIEVE_PROP_VALID(dxpl, H5P_DATASET_XFER_DEFAULT, H5D_XFER_IO_XFER_MODE_NAME, io_xfer_mode)
+    H5CX_RETRIEVE_DXPL_PROP_VALID(io_xfer_mode)
 
     /* Get the value */
     *io_xfer_mode = (*head)->ctx.io_xfer_mode;
@@ -1962,7 +2235,7 @@ H5CX_get_mpio_coll_opt(H5FD_mpio_collective_opt_t *mpio_coll_opt)
     HDassert(head && *head);
     HDassert(H5P_DEFAULT != (*head)->ctx.dxpl_id);
 
-    H5CX_RETRIEVE_PROP_VALID(dxpl, H5P_DATASET_XFER_DEFAULT, H5D_XFER_MPIO_COLLECTIVE_OPT_NAME, mpio_coll_opt)
+    H5CX_RETRIEVE_DXPL_PROP_VALID(mpio_coll_opt)
 
     /* Get the value */
     *mpio_coll_opt = (*head)->ctx.mpio_coll_opt;
@@ -2067,7 +2340,7 @@ H5CX_get_mpio_chunk_opt_mode(H5FD_mpio_chunk_opt_t *mpio_chunk_opt_mode)
     HDassert(head && *head);
     HDassert(H5P_DEFAULT != (*head)->ctx.dxpl_id);
 
-    H5CX_RETRIEVE_PROP_VALID(dxpl, H5P_DATASET_XFER_DEFAULT, H5D_XFER_MPIO_CHUNK_OPT_HARD_NAME, mpio_chunk_opt_mode)
+    H5CX_RETRIEVE_DXPL_PROP_VALID(mpio_chunk_opt_mode)
 
     /* Get the value */
     *mpio_chunk_opt_mode = (*head)->ctx.mpio_chunk_opt_mode;
@@ -2102,7 +2375,7 @@ H5CX_get_mpio_chunk_opt_num(unsigned *mpio_chunk_opt_num)
     HDassert(head && *head);
     HDassert(H5P_DEFAULT != (*head)->ctx.dxpl_id);
 
-    H5CX_RETRIEVE_PROP_VALID(dxpl, H5P_DATASET_XFER_DEFAULT, H5D_XFER_MPIO_CHUNK_OPT_NUM_NAME, mpio_chunk_opt_num)
+    H5CX_RETRIEVE_DXPL_PROP_VALID(mpio_chunk_opt_num)
 
     /* Get the value */
     *mpio_chunk_opt_num = (*head)->ctx.mpio_chunk_opt_num;
@@ -2137,7 +2410,7 @@ H5CX_get_mpio_chunk_opt_ratio(unsigned *mpio_chunk_opt_ratio)
     HDassert(head && *head);
     HDassert(H5P_DEFAULT != (*head)->ctx.dxpl_id);
 
-    H5CX_RETRIEVE_PROP_VALID(dxpl, H5P_DATASET_XFER_DEFAULT, H5D_XFER_MPIO_CHUNK_OPT_RATIO_NAME, mpio_chunk_opt_ratio)
+    H5CX_RETRIEVE_DXPL_PROP_VALID(mpio_chunk_opt_ratio)
 
     /* Get the value */
     *mpio_chunk_opt_ratio = (*head)->ctx.mpio_chunk_opt_ratio;
@@ -2173,7 +2446,7 @@ H5CX_get_err_detect(H5Z_EDC_t *err_detect)
     HDassert(head && *head);
     HDassert(H5P_DEFAULT != (*head)->ctx.dxpl_id);
 
-    H5CX_RETRIEVE_PROP_VALID(dxpl, H5P_DATASET_XFER_DEFAULT, H5D_XFER_EDC_NAME, err_detect)
+    H5CX_RETRIEVE_DXPL_PROP_VALID(err_detect)
 
     /* Get the value */
     *err_detect = (*head)->ctx.err_detect;
@@ -2208,7 +2481,7 @@ H5CX_get_filter_cb(H5Z_cb_t *filter_cb)
     HDassert(head && *head);
     HDassert(H5P_DEFAULT != (*head)->ctx.dxpl_id);
 
-    H5CX_RETRIEVE_PROP_VALID(dxpl, H5P_DATASET_XFER_DEFAULT, H5D_XFER_FILTER_CB_NAME, filter_cb)
+    H5CX_RETRIEVE_DXPL_PROP_VALID(filter_cb)
 
     /* Get the value */
     *filter_cb = (*head)->ctx.filter_cb;
@@ -2243,29 +2516,11 @@ H5CX_get_data_transform(H5Z_data_xform_t **data_transform)
     HDassert(head && *head);
     HDassert(H5P_DEFAULT != (*head)->ctx.dxpl_id);
 
-    /* Check if the value has been retrieved already */
-    if(!(*head)->ctx.data_transform_valid) {
-        /* Check for default DXPL */
-        if((*head)->ctx.dxpl_id == H5P_DATASET_XFER_DEFAULT)
-            (*head)->ctx.data_transform = H5CX_def_dxpl_cache.data_transform;
-        else {
-            /* Check if the property list is already available */
-            if(NULL == (*head)->ctx.dxpl)
-                /* Get the dataset transfer property list pointer */
-                if(NULL == ((*head)->ctx.dxpl = (H5P_genplist_t *)H5I_object((*head)->ctx.dxpl_id)))
-                    HGOTO_ERROR(H5E_CONTEXT, H5E_BADTYPE, FAIL, "can't get default dataset transfer property list")
-
-            /* Get data transform info value */
-            /* (Note: 'peek', not 'get' - if this turns out to be a problem, we may need
-             *          to copy it and free this in the H5CX pop routine. -QAK)
-             */
-            if(H5P_peek((*head)->ctx.dxpl, H5D_XFER_XFORM_NAME, &(*head)->ctx.data_transform) < 0)
-                HGOTO_ERROR(H5E_CONTEXT, H5E_CANTGET, FAIL, "Can't retrieve data transform info")
-        } /* end else */
-
-        /* Mark the value as valid */
-        (*head)->ctx.data_transform_valid = TRUE;
-    } /* end if */
+    /* Get the data transform info value */
+    /* (Note: 'peek', not 'get' - if this turns out to be a problem, we may need
+     *          to copy it and free this in the H5CX pop routine. -QAK)
+     */
+    H5CX_RETRIEVE_DXPL_PROP_VALID(data_transform)
 
     /* Get the value */
     *data_transform = (*head)->ctx.data_transform;
@@ -2280,6 +2535,12 @@ done:
  *
  * Purpose:     Retrieves the VL datatype alloc info for the current API call context.
  *
+ *              If the DXPL has a VL arena set, the arena's allocation
+ *              routines are returned instead of the VL memory manager's.
+ *              The arena's fill level is kept in the API context, so all
+ *              the VL data for one API call is packed into the arena,
+ *              even across several datasets.
+ *
  * Return:      Non-negative on success / Negative on failure
  *
  * Programmer:  Quincey Koziol
@@ -2302,26 +2563,22 @@ H5CX_get_vlen_alloc_info(H5T_vlen_alloc_info_t *vl_alloc_info)
 
     /* Check if the value has been retrieved already */
     if(!(*head)->ctx.vl_alloc_info_valid) {
-        /* Check for default DXPL */
-        if((*head)->ctx.dxpl_id == H5P_DATASET_XFER_DEFAULT)
-            (*head)->ctx.vl_alloc_info = H5CX_def_dxpl_cache.vl_alloc_info;
-        else {
-            /* Check if the property list is already available */
-            if(NULL == (*head)->ctx.dxpl)
-                /* Get the dataset transfer property list pointer */
-                if(NULL == ((*head)->ctx.dxpl = (H5P_genplist_t *)H5I_object((*head)->ctx.dxpl_id)))
-                    HGOTO_ERROR(H5E_CONTEXT, H5E_BADTYPE, FAIL, "can't get default dataset transfer property list")
-
-            /* Get VL datatype alloc info values */
-            if(H5P_get((*head)->ctx.dxpl, H5D_XFER_VLEN_ALLOC_NAME, &(*head)->ctx.vl_alloc_info.alloc_func) < 0)
-                HGOTO_ERROR(H5E_CONTEXT, H5E_CANTGET, FAIL, "Can't retrieve VL datatype alloc info")
-            if(H5P_get((*head)->ctx.dxpl, H5D_XFER_VLEN_ALLOC_INFO_NAME, &(*head)->ctx.vl_alloc_info.alloc_info) < 0)
-                HGOTO_ERROR(H5E_CONTEXT, H5E_CANTGET, FAIL, "Can't retrieve VL datatype alloc info")
-            if(H5P_get((*head)->ctx.dxpl, H5D_XFER_VLEN_FREE_NAME, &(*head)->ctx.vl_alloc_info.free_func) < 0)
-                HGOTO_ERROR(H5E_CONTEXT, H5E_CANTGET, FAIL, "Can't retrieve VL datatype alloc info")
-            if(H5P_get((*head)->ctx.dxpl, H5D_XFER_VLEN_FREE_INFO_NAME, &(*head)->ctx.vl_alloc_info.free_info) < 0)
-                HGOTO_ERROR(H5E_CONTEXT, H5E_CANTGET, FAIL, "Can't retrieve VL datatype alloc info")
-        } /* end else */
+        const H5CX_dxpl_cache_t *dxpl_cache;    /* Cached values for the DXPL */
+
+        /* Get VL datatype alloc info values */
+        if(NULL == (dxpl_cache = H5CX__get_dxpl_cache(*head)))
+            HGOTO_ERROR(H5E_CONTEXT, H5E_CANTGET, FAIL, "Can't retrieve VL datatype alloc info")
+        (*head)->ctx.vl_alloc_info = dxpl_cache->vl_alloc_info;
+
+        /* Check for an arena to place VL data in */
+        H5CX_RETRIEVE_DXPL_PROP_VALID(vlen_arena)
+        if((*head)->ctx.vlen_arena.buf) {
+            (*head)->ctx.vlen_arena.used = 0;
+            (*head)->ctx.vl_alloc_info.alloc_func = H5T_vlen_arena_alloc;
+            (*head)->ctx.vl_alloc_info.alloc_info = &(*head)->ctx.vlen_arena;
+            (*head)->ctx.vl_alloc_info.free_func = H5T_vlen_arena_free;
+            (*head)->ctx.vl_alloc_info.free_info = NULL;
+        } /* end if */
 
         /* Mark the value as valid */
         (*head)->ctx.vl_alloc_info_valid = TRUE;
@@ -2360,7 +2617,7 @@ H5CX_get_dt_conv_cb(H5T_conv_cb_t *dt_conv_cb)
     HDassert(head && *head);
     HDassert(H5P_DEFAULT != (*head)->ctx.dxpl_id);
 
-    H5CX_RETRIEVE_PROP_VALID(dxpl, H5P_DATASET_XFER_DEFAULT, H5D_XFER_CONV_CB_NAME, dt_conv_cb)
+    H5CX_RETRIEVE_DXPL_PROP_VALID(dt_conv_cb)
 
     /* Get the value */
     *dt_conv_cb = (*head)->ctx.dt_conv_cb;
@@ -2647,6 +2904,89 @@ H5CX_set_ring(H5AC_ring_t ring)
     FUNC_LEAVE_NOAPI_VOID
 } /* end H5CX_set_ring() */
 
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5CX_set_concurrent_read
+ *
+ * Purpose:     Sets whether raw data reads for the current API call
+ *              context may let other threads into the library.  Only set
+ *              by API routines that hold references to all of their IDs
+ *              for the duration of the call.
+ *
+ * Return:      <none>
+ *
+ *-------------------------------------------------------------------------
+ */
+void
+H5CX_set_concurrent_read(hbool_t concurrent_read)
+{
+    H5CX_node_t **head = H5CX_get_my_context();  /* Get the pointer to the head of the API context, for this thread */
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    /* Sanity check */
+    HDassert(head && *head);
+
+    (*head)->ctx.concurrent_read = concurrent_read;
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5CX_set_concurrent_read() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5CX_set_release_api_lock
+ *
+ * Purpose:     Sets whether the file driver may release the API lock while
+ *              it waits on the current raw data read.  Only set around
+ *              reads into buffers that are private to the operation.
+ *
+ * Return:      <none>
+ *
+ *-------------------------------------------------------------------------
+ */
+void
+H5CX_set_release_api_lock(hbool_t release_api_lock)
+{
+    H5CX_node_t **head = H5CX_get_my_context();  /* Get the pointer to the head of the API context, for this thread */
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    /* Sanity check */
+    HDassert(head && *head);
+
+    (*head)->ctx.release_api_lock = release_api_lock;
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5CX_set_release_api_lock() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5CX_set_prof
+ *
+ * Purpose:     Sets the profiling counters that filters, datatype
+ *              conversions and selection iteration add their time to, for
+ *              the current API call.
+ *
+ * Return:      <none>
+ *
+ *-------------------------------------------------------------------------
+ */
+void
+H5CX_set_prof(H5F_prof_t *prof)
+{
+    H5CX_node_t **head = H5CX_get_my_context();  /* Get the pointer to the head of the API context, for this thread */
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    /* Sanity check */
+    HDassert(head && *head);
+
+    (*head)->ctx.prof = prof;
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5CX_set_prof() */
+
 #ifdef H5_HAVE_PARALLEL
 
 /*-------------------------------------------------------------------------
@@ -3353,6 +3693,7 @@ done:
 herr_t
 H5CX_pop(void)
 {
+    H5CX_thread_t *thread = H5CX_get_my_thread();  /* Get the API context information for this thread */
     H5CX_node_t *cnode;                 /* Context node */
     herr_t ret_value = SUCCEED;         /* Return value */
 
@@ -3362,8 +3703,13 @@ H5CX_pop(void)
     if(NULL == (cnode = H5CX__pop_common()))
         HGOTO_ERROR(H5E_CONTEXT, H5E_CANTGET, FAIL, "error getting API context node")
 
-    /* Free the context node */
-    cnode = H5FL_FREE(H5CX_node_t, cnode);
+    /* Give the context node back to the thread, or free it */
+    if(cnode >= thread->nodes && cnode < (thread->nodes + H5CX_NODES_PER_THREAD)) {
+        HDassert(cnode == &thread->nodes[thread->nodes_used - 1]);
+        thread->nodes_used--;
+    } /* end if */
+    else
+        cnode = H5FL_FREE(H5CX_node_t, cnode);
 
 done:
     FUNC_LEAVE_NOAPI(ret_value)
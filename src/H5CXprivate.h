@@ -93,6 +93,10 @@ H5_DLL herr_t H5CX_get_vol_wrap_ctx(void **wrap_ctx);
 H5_DLL herr_t H5CX_get_vol_connector_prop(H5VL_connector_prop_t *vol_connector_prop);
 H5_DLL haddr_t H5CX_get_tag(void);
 H5_DLL H5AC_ring_t H5CX_get_ring(void);
+H5_DLL hbool_t H5CX_get_concurrent_read(void);
+H5_DLL hbool_t H5CX_get_release_api_lock(void);
+H5_DLL H5F_prof_t *H5CX_get_prof(void);
+H5_DLL uint64_t H5CX_get_api_call(void);
 #ifdef H5_HAVE_PARALLEL
 H5_DLL hbool_t H5CX_get_coll_metadata_read(void);
 H5_DLL herr_t H5CX_get_mpi_coll_datatypes(MPI_Datatype *btype, MPI_Datatype *ftype);
@@ -138,6 +142,9 @@ H5_DLL herr_t H5CX_get_libver_bounds(H5F_libver_t *low_bound, H5F_libver_t *high
 /* "Setter" routines for API context info */
 H5_DLL void H5CX_set_tag(haddr_t tag);
 H5_DLL void H5CX_set_ring(H5AC_ring_t ring);
+H5_DLL void H5CX_set_concurrent_read(hbool_t concurrent_read);
+H5_DLL void H5CX_set_release_api_lock(hbool_t release_api_lock);
+H5_DLL void H5CX_set_prof(H5F_prof_t *prof);
 #ifdef H5_HAVE_PARALLEL
 H5_DLL void H5CX_set_coll_metadata_read(hbool_t cmdr);
 H5_DLL herr_t H5CX_set_mpi_coll_datatypes(MPI_Datatype btype, MPI_Datatype ftype);
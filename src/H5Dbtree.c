@@ -571,9 +571,11 @@ H5D__btree_insert(H5F_t *f, haddr_t addr, void *_lt_key, hbool_t *lt_key_changed
             udata->common.scaled, lt_key->scaled) && lt_key->nbytes > 0) {
         /*
          * Already exists.  If the new size is not the same as the old size
-         * then we should reallocate storage.
+         * then we should reallocate storage.  The chunk may also have been
+         * moved without changing size.
          */
-        if(lt_key->nbytes != udata->chunk_block.length) {
+        if(lt_key->nbytes != udata->chunk_block.length ||
+                !H5F_addr_eq(addr, udata->chunk_block.offset)) {
 	    /* Set node's address (already re-allocated by main chunk routines) */
 	    HDassert(H5F_addr_defined(udata->chunk_block.offset));
             *new_node_p = udata->chunk_block.offset;
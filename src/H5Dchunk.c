@@ -67,11 +67,6 @@
 /* Local Macros */
 /****************/
 
-/* Macros for iterating over chunks to operate on */
-#define H5D_CHUNK_GET_FIRST_NODE(map) (map->use_single ? (H5SL_node_t *)(1) : H5SL_first(map->sel_chunks))
-#define H5D_CHUNK_GET_NODE_INFO(map, node)  (map->use_single ? map->single_chunk_info : (H5D_chunk_info_t *)H5SL_item(node))
-#define H5D_CHUNK_GET_NEXT_NODE(map, node)  (map->use_single ? (H5SL_node_t *)NULL : H5SL_next(node))
-
 /* Sanity check on chunk index types: commonly used by a lot of routines in this file */
 #define H5D_CHUNK_STORAGE_INDEX_CHK(storage)                                                    \
     HDassert((H5D_CHUNK_IDX_EARRAY == storage->idx_type && H5D_COPS_EARRAY == storage->ops) ||  \
@@ -210,6 +205,12 @@ typedef struct H5D_chunk_it_ud5_t {
     hsize_t       	*dset_dims;             /* Dataset dimensions */
 } H5D_chunk_it_ud5_t;
 
+/* Callback info for iteration over the blocks of chunk data in the file */
+typedef struct H5D_chunk_it_ud6_t {
+    H5D_raw_block_op_t  op;                     /* Operator for each chunk */
+    void                *op_data;               /* Operator's user data */
+} H5D_chunk_it_ud6_t;
+
 /* Callback info for nonexistent readvv operation */
 typedef struct H5D_chunk_readvv_ud_t {
     unsigned char *rbuf;        /* Read buffer to initialize */
@@ -224,6 +225,15 @@ typedef struct H5D_chunk_file_iter_ud_t {
 #endif /* H5_HAVE_PARALLEL */
 } H5D_chunk_file_iter_ud_t;
 
+/* Chunk selections gathered in increasing chunk index order, to be put in
+ * the map's skip list all at once */
+typedef struct H5D_chunk_sel_list_t {
+    void **infos;               /* Chunk information (H5D_chunk_info_t *) */
+    const void **keys;          /* Chunk indices, keys for the skip list */
+    size_t nused;               /* Number of chunks gathered */
+    size_t nalloc;              /* Number of entries allocated */
+} H5D_chunk_sel_list_t;
+
 #ifdef H5_HAVE_PARALLEL
 /* information to construct a collective I/O operation for filling chunks */
 typedef struct H5D_chunk_coll_info_t {
@@ -260,6 +270,7 @@ H5D__nonexistent_readvv(const H5D_io_info_t *io_info,
 
 /* format convert cb */
 static int H5D__chunk_format_convert_cb(const H5D_chunk_rec_t *chunk_rec, void *_udata);
+static int H5D__chunk_iterate_blocks_cb(const H5D_chunk_rec_t *chunk_rec, void *_udata);
 
 /* Helper routines */
 static herr_t H5D__chunk_set_info_real(H5O_layout_chunk_t *layout, unsigned ndims,
@@ -274,8 +285,23 @@ static herr_t H5D__chunk_cinfo_cache_update(H5D_chunk_cached_t *last,
 static hbool_t H5D__chunk_cinfo_cache_found(const H5D_chunk_cached_t *last,
     H5D_chunk_ud_t *udata);
 static herr_t H5D__free_chunk_info(void *item, void *key, void *opdata);
+static herr_t H5D__chunk_sel_list_append(H5D_chunk_sel_list_t *list,
+    H5D_chunk_info_t *chunk_info);
+static herr_t H5D__chunk_sel_list_build(H5D_chunk_map_t *fm,
+    H5D_chunk_sel_list_t *list);
+static void H5D__chunk_sel_list_free(H5D_chunk_sel_list_t *list);
+static herr_t H5D__chunk_map_single_init(H5D_chunk_map_t *fm,
+    const H5D_t *dataset, const H5S_t *file_space);
 static herr_t H5D__create_chunk_map_single(H5D_chunk_map_t *fm,
     const H5D_io_info_t *io_info);
+static htri_t H5D__create_chunk_map_stream(H5D_chunk_map_t *fm,
+    const H5D_io_info_t *io_info);
+static hbool_t H5D__chunk_stream_next_dim(const H5S_hyper_dim_t *sel,
+    hsize_t chunk_dim, hsize_t *scaled);
+static herr_t H5D__chunk_stream_next(H5D_chunk_map_t *fm, hbool_t first,
+    hbool_t *found);
+static herr_t H5D__chunk_map_next(H5D_chunk_map_t *fm, H5SL_node_t **chunk_node,
+    H5D_chunk_info_t **chunk_info);
 static herr_t H5D__create_chunk_file_map_all(H5D_chunk_map_t *fm,
     const H5D_io_info_t *io_info);
 static herr_t H5D__create_chunk_file_map_hyper(H5D_chunk_map_t *fm,
@@ -330,6 +356,13 @@ const H5D_layout_ops_t H5D_LOPS_CHUNK[1] = {{
     H5D__chunk_dest
 }};
 
+/* Whether chunk selections of regular selections are computed as needed */
+/* (Only turned off for testing) */
+hbool_t H5D_chunk_stream_g = TRUE;
+
+/* Number of I/O operations whose chunk selections were computed as needed */
+unsigned H5D_chunk_nstreams_g = 0;
+
 
 /*******************/
 /* Local Variables */
@@ -1093,6 +1126,11 @@ H5D__chunk_io_init(const H5D_io_info_t *io_info, const H5D_type_info_t *type_inf
     fm->layout = &(dataset->shared->layout);
     fm->nelmts = nelmts;
 
+    /* Reads that let other threads into the library while they wait on the
+     * file can't share the dataset's chunk selection structures
+     */
+    fm->own_scratch = H5CX_get_concurrent_read();
+
     /* Check if the memory space is scalar & make equivalent memory space */
     if((sm_ndims = H5S_GET_EXTENT_NDIMS(mem_space)) < 0)
         HGOTO_ERROR(H5E_DATASPACE, H5E_CANTGET, FAIL, "unable to get dimension number")
@@ -1147,29 +1185,9 @@ H5D__chunk_io_init(const H5D_io_info_t *io_info, const H5D_type_info_t *type_inf
         fm->sel_chunks = NULL;
         fm->use_single = TRUE;
 
-        /* Initialize single chunk dataspace */
-        if(NULL == dataset->shared->cache.chunk.single_space) {
-            /* Make a copy of the dataspace for the dataset */
-            if((dataset->shared->cache.chunk.single_space = H5S_copy(file_space, TRUE, FALSE)) == NULL)
-                HGOTO_ERROR(H5E_DATASPACE, H5E_CANTCOPY, FAIL, "unable to copy file space")
-
-            /* Resize chunk's dataspace dimensions to size of chunk */
-            if(H5S_set_extent_real(dataset->shared->cache.chunk.single_space, fm->chunk_dim) < 0)
-                HGOTO_ERROR(H5E_DATASPACE, H5E_CANTSET, FAIL, "can't adjust chunk dimensions")
-
-            /* Set the single chunk dataspace to 'all' selection */
-            if(H5S_select_all(dataset->shared->cache.chunk.single_space, TRUE) < 0)
-                HGOTO_ERROR(H5E_DATASET, H5E_CANTSELECT, FAIL, "unable to set all selection")
-        } /* end if */
-        fm->single_space = dataset->shared->cache.chunk.single_space;
-        HDassert(fm->single_space);
-
-        /* Allocate the single chunk information */
-        if(NULL == dataset->shared->cache.chunk.single_chunk_info)
-            if(NULL == (dataset->shared->cache.chunk.single_chunk_info = H5FL_MALLOC(H5D_chunk_info_t)))
-                HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "can't allocate chunk info")
-        fm->single_chunk_info = dataset->shared->cache.chunk.single_chunk_info;
-        HDassert(fm->single_chunk_info);
+        /* Set up the single chunk dataspace & information */
+        if(H5D__chunk_map_single_init(fm, dataset, file_space) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "unable to initialize single chunk information")
 
         /* Reset chunk template information */
         fm->mchunk_tmpl = NULL;
@@ -1180,12 +1198,25 @@ H5D__chunk_io_init(const H5D_io_info_t *io_info, const H5D_type_info_t *type_inf
     } /* end if */
     else {
         hbool_t sel_hyper_flag;         /* Whether file selection is a hyperslab */
+        htri_t use_stream;              /* Whether to compute chunk selections as they are needed */
+
+        /* Regular selections don't need the chunk selections built up front */
+        if((use_stream = H5D__create_chunk_map_stream(fm, io_info)) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "unable to set up chunk selections")
+        if(use_stream)
+            HGOTO_DONE(SUCCEED)
 
         /* Initialize skip list for chunk selections */
-        if(NULL == dataset->shared->cache.chunk.sel_chunks)
-            if(NULL == (dataset->shared->cache.chunk.sel_chunks = H5SL_create(H5SL_TYPE_HSIZE, NULL)))
+        if(fm->own_scratch) {
+            if(NULL == (fm->sel_chunks = H5SL_create(H5SL_TYPE_HSIZE, NULL)))
                 HGOTO_ERROR(H5E_DATASET, H5E_CANTCREATE, FAIL, "can't create skip list for chunk selections")
-        fm->sel_chunks = dataset->shared->cache.chunk.sel_chunks;
+        } /* end if */
+        else {
+            if(NULL == dataset->shared->cache.chunk.sel_chunks)
+                if(NULL == (dataset->shared->cache.chunk.sel_chunks = H5SL_create(H5SL_TYPE_HSIZE, NULL)))
+                    HGOTO_ERROR(H5E_DATASET, H5E_CANTCREATE, FAIL, "can't create skip list for chunk selections")
+            fm->sel_chunks = dataset->shared->cache.chunk.sel_chunks;
+        } /* end else */
         HDassert(fm->sel_chunks);
 
         /* We are not using single element mode */
@@ -1458,7 +1489,177 @@ H5D__free_chunk_info(void *item, void H5_ATTR_UNUSED *key, void H5_ATTR_UNUSED *
     FUNC_LEAVE_NOAPI(0)
 }   /* H5D__free_chunk_info() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__chunk_sel_list_append
+ *
+ * Purpose:	Add a chunk's information to the end of a list of chunk
+ *		selections.  Chunks must be added in increasing index order.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__chunk_sel_list_append(H5D_chunk_sel_list_t *list, H5D_chunk_info_t *chunk_info)
+{
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(list);
+    HDassert(chunk_info);
+    HDassert(list->nused == 0 ||
+            ((const H5D_chunk_info_t *)list->infos[list->nused - 1])->index < chunk_info->index);
+
+    /* Make room for the chunk, if necessary */
+    if(list->nused == list->nalloc) {
+        size_t new_nalloc = MAX(64, list->nalloc * 2);
+        void **new_infos;
+        const void **new_keys;
+
+        if(NULL == (new_infos = (void **)H5MM_realloc(list->infos, new_nalloc * sizeof(void *))))
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "can't grow list of chunk selections")
+        list->infos = new_infos;
+        if(NULL == (new_keys = (const void **)H5MM_realloc(list->keys, new_nalloc * sizeof(void *))))
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "can't grow list of chunk selections")
+        list->keys = new_keys;
+        list->nalloc = new_nalloc;
+    } /* end if */
+
+    list->infos[list->nused] = chunk_info;
+    list->keys[list->nused] = &chunk_info->index;
+    list->nused++;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__chunk_sel_list_append() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__chunk_sel_list_build
+ *
+ * Purpose:	Put the gathered chunk selections into the map's (empty)
+ *		skip list in one pass, instead of inserting them one at a
+ *		time.  On success the skip list owns the chunk information.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__chunk_sel_list_build(H5D_chunk_map_t *fm, H5D_chunk_sel_list_t *list)
+{
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(fm);
+    HDassert(fm->sel_chunks);
+    HDassert(list);
+
+    if(H5SL_build(fm->sel_chunks, list->nused, list->infos, list->keys) < 0)
+        HGOTO_ERROR(H5E_DATASPACE, H5E_CANTINSERT, FAIL, "can't insert chunks into skip list")
+    list->nused = 0;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__chunk_sel_list_build() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__chunk_sel_list_free
+ *
+ * Purpose:	Release a list of chunk selections, along with any chunk
+ *		information not yet put in a skip list.
+ *
+ * Return:	None
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5D__chunk_sel_list_free(H5D_chunk_sel_list_t *list)
+{
+    size_t u;                           /* Local index variable */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    HDassert(list);
+
+    for(u = 0; u < list->nused; u++)
+        (void)H5D__free_chunk_info(list->infos[u], NULL, NULL);
+    list->infos = (void **)H5MM_xfree(list->infos);
+    list->keys = (const void **)H5MM_xfree(list->keys);
+    list->nused = list->nalloc = 0;
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5D__chunk_sel_list_free() */
+
 
+/*-------------------------------------------------------------------------
+ * Function:	H5D__chunk_map_single_init
+ *
+ * Purpose:	Set up the chunk information & chunk dataspace that are
+ *		shared by I/O operations which only need one chunk selection
+ *		at a time.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__chunk_map_single_init(H5D_chunk_map_t *fm, const H5D_t *dataset,
+    const H5S_t *file_space)
+{
+    herr_t	ret_value = SUCCEED;        /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Set up a private single chunk dataspace & information, if the map
+     * can't use the dataset's
+     */
+    if(fm->own_scratch) {
+        if(NULL == (fm->single_space = H5S_copy(file_space, TRUE, FALSE)))
+            HGOTO_ERROR(H5E_DATASPACE, H5E_CANTCOPY, FAIL, "unable to copy file space")
+        if(H5S_set_extent_real(fm->single_space, fm->chunk_dim) < 0)
+            HGOTO_ERROR(H5E_DATASPACE, H5E_CANTSET, FAIL, "can't adjust chunk dimensions")
+        if(H5S_select_all(fm->single_space, TRUE) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTSELECT, FAIL, "unable to set all selection")
+        if(NULL == (fm->single_chunk_info = H5FL_MALLOC(H5D_chunk_info_t)))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "can't allocate chunk info")
+
+        HGOTO_DONE(SUCCEED)
+    } /* end if */
+
+    /* Initialize single chunk dataspace */
+    if(NULL == dataset->shared->cache.chunk.single_space) {
+        /* Make a copy of the dataspace for the dataset */
+        if((dataset->shared->cache.chunk.single_space = H5S_copy(file_space, TRUE, FALSE)) == NULL)
+            HGOTO_ERROR(H5E_DATASPACE, H5E_CANTCOPY, FAIL, "unable to copy file space")
+
+        /* Resize chunk's dataspace dimensions to size of chunk */
+        if(H5S_set_extent_real(dataset->shared->cache.chunk.single_space, fm->chunk_dim) < 0)
+            HGOTO_ERROR(H5E_DATASPACE, H5E_CANTSET, FAIL, "can't adjust chunk dimensions")
+
+        /* Set the single chunk dataspace to 'all' selection */
+        if(H5S_select_all(dataset->shared->cache.chunk.single_space, TRUE) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTSELECT, FAIL, "unable to set all selection")
+    } /* end if */
+    fm->single_space = dataset->shared->cache.chunk.single_space;
+    HDassert(fm->single_space);
+
+    /* Allocate the single chunk information */
+    if(NULL == dataset->shared->cache.chunk.single_chunk_info)
+        if(NULL == (dataset->shared->cache.chunk.single_chunk_info = H5FL_MALLOC(H5D_chunk_info_t)))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "can't allocate chunk info")
+    fm->single_chunk_info = dataset->shared->cache.chunk.single_chunk_info;
+    HDassert(fm->single_chunk_info);
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__chunk_map_single_init() */
+
+
 /*-------------------------------------------------------------------------
  * Function:	H5D__create_chunk_map_single
  *
@@ -1543,6 +1744,349 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5D__create_chunk_map_single() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__create_chunk_map_stream
+ *
+ * Purpose:	Check if the chunk selections for an I/O operation can be
+ *		computed one at a time from the file & memory selections, as
+ *		the chunks are operated on, and set up for that if so.
+ *
+ *		This is possible when the file & memory selections are
+ *		regular hyperslabs (or "all" selections) of the same shape,
+ *		whose blocks are never split by a chunk boundary.  Each chunk
+ *		selection is then a regular hyperslab also, which is set in
+ *		a dataspace that is reused for all the chunks, instead of
+ *		building a skip list with copies of the dataspaces for all
+ *		the chunks before any I/O is done.
+ *
+ * Return:	TRUE if the chunk selections are computed as they are
+ *		needed, FALSE if they must be built up front, negative on
+ *		failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static htri_t
+H5D__create_chunk_map_stream(H5D_chunk_map_t *fm, const H5D_io_info_t *io_info)
+{
+    H5S_hyper_dim_t mem_sel[H5S_MAX_RANK];  /* Regular selection in memory */
+    hsize_t     scaled;                     /* Scaled coordinate of a chunk */
+    hbool_t     single_chunk = TRUE;        /* Whether only one chunk is selected */
+    htri_t      is_regular;                 /* Whether a selection is regular */
+    unsigned    u;                          /* Local index variable */
+    htri_t	ret_value = FALSE;          /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity check */
+    HDassert(fm->f_ndims > 0);
+
+    if(!H5D_chunk_stream_g)
+        HGOTO_DONE(FALSE)
+
+#ifdef H5_HAVE_PARALLEL
+    /* Collective I/O needs all the chunk selections */
+    if(io_info->using_mpi_vfd)
+        HGOTO_DONE(FALSE)
+#endif /* H5_HAVE_PARALLEL */
+
+    /* Both selections must be regular, with the same rank */
+    if(fm->m_ndims != fm->f_ndims)
+        HGOTO_DONE(FALSE)
+    if((is_regular = H5S_select_get_regular(fm->file_space, fm->stream_sel)) < 0)
+        HGOTO_ERROR(H5E_DATASPACE, H5E_CANTGET, FAIL, "can't get file selection pattern")
+    if(!is_regular)
+        HGOTO_DONE(FALSE)
+    if((is_regular = H5S_select_get_regular(fm->mem_space, mem_sel)) < 0)
+        HGOTO_ERROR(H5E_DATASPACE, H5E_CANTGET, FAIL, "can't get memory selection pattern")
+    if(!is_regular)
+        HGOTO_DONE(FALSE)
+
+    for(u = 0; u < fm->f_ndims; u++) {
+        H5S_hyper_dim_t *file_sel = &fm->stream_sel[u];     /* File selection in this dimension */
+        hsize_t chunk_dim = fm->chunk_dim[u];               /* Chunk size in this dimension */
+
+        /* Leave empty selections to the general code */
+        if(0 == file_sel->count || 0 == file_sel->block)
+            HGOTO_DONE(FALSE)
+
+        /* Treat adjoining blocks as one block */
+        if(file_sel->count > 1 && file_sel->stride == file_sel->block) {
+            file_sel->block *= file_sel->count;
+            file_sel->count = 1;
+        } /* end if */
+        if(mem_sel[u].count > 1 && mem_sel[u].stride == mem_sel[u].block) {
+            mem_sel[u].block *= mem_sel[u].count;
+            mem_sel[u].count = 1;
+        } /* end if */
+
+        /* The selections must have the same shape */
+        if(file_sel->count != mem_sel[u].count || file_sel->block != mem_sel[u].block
+                || (file_sel->count > 1 && file_sel->stride != mem_sel[u].stride))
+            HGOTO_DONE(FALSE)
+
+        /* No block may be split by a chunk boundary */
+        /* (Blocks start at the same offsets within chunks again after
+         *  'chunk_dim / gcd(chunk_dim, stride)' blocks, so only that many
+         *  need to be checked)
+         */
+        if(file_sel->count > 1) {
+            hsize_t a = chunk_dim, b = file_sel->stride;    /* Values for computing gcd */
+            hsize_t nblocks;                /* # of blocks to check */
+            hsize_t v;                      /* Local index variable */
+
+            if(file_sel->block > chunk_dim)
+                HGOTO_DONE(FALSE)
+            while(b) {
+                hsize_t t = a % b;
+
+                a = b;
+                b = t;
+            } /* end while */
+            nblocks = MIN(file_sel->count, chunk_dim / a);
+            for(v = 0; v < nblocks; v++)
+                if(((file_sel->start + v * file_sel->stride) % chunk_dim) + file_sel->block > chunk_dim)
+                    HGOTO_DONE(FALSE)
+        } /* end if */
+
+        /* Find the first chunk selected, and whether there's another one */
+        fm->stream_first[u] = 0;
+        if(!H5D__chunk_stream_next_dim(file_sel, chunk_dim, &fm->stream_first[u]))
+            HGOTO_DONE(FALSE)
+        scaled = fm->stream_first[u] + 1;
+        if(H5D__chunk_stream_next_dim(file_sel, chunk_dim, &scaled))
+            single_chunk = FALSE;
+
+        fm->stream_mem_start[u] = mem_sel[u].start;
+    } /* end for */
+
+    /* Set up the chunk information & file dataspace to reuse for each chunk */
+    if(H5D__chunk_map_single_init(fm, io_info->dset, fm->file_space) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "unable to initialize single chunk information")
+    fm->single_chunk_info->fspace = fm->single_space;
+    fm->single_chunk_info->fspace_shared = TRUE;
+
+    /* Use the memory dataspace directly when there's only one chunk, or
+     *  a copy of it to set each chunk's memory selection in otherwise.
+     */
+    if(single_chunk) {
+        fm->mchunk_tmpl = NULL;
+
+        /* (Casting away const OK -QAK) */
+        fm->single_chunk_info->mspace = (H5S_t *)fm->mem_space;
+    } /* end if */
+    else {
+        if(NULL == (fm->mchunk_tmpl = H5S_copy(fm->mem_space, TRUE, FALSE)))
+            HGOTO_ERROR(H5E_DATASPACE, H5E_CANTCOPY, FAIL, "unable to copy memory space")
+        fm->single_chunk_info->mspace = fm->mchunk_tmpl;
+    } /* end else */
+    fm->single_chunk_info->mspace_shared = TRUE;
+
+    /* Chunk selections are computed as they are needed */
+    fm->fsel_type = H5S_GET_SELECT_TYPE(fm->file_space);
+    fm->msel_type = H5S_GET_SELECT_TYPE(fm->mem_space);
+    fm->sel_chunks = NULL;
+    fm->use_stream = TRUE;
+    H5D_chunk_nstreams_g++;
+    ret_value = TRUE;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__create_chunk_map_stream() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__chunk_stream_next_dim
+ *
+ * Purpose:	Find the first chunk at or after the scaled coordinate
+ *		SCALED which a regular selection in one dimension intersects.
+ *
+ * Return:	TRUE if there's such a chunk, with SCALED updated, FALSE if
+ *		there isn't
+ *
+ *-------------------------------------------------------------------------
+ */
+static hbool_t
+H5D__chunk_stream_next_dim(const H5S_hyper_dim_t *sel, hsize_t chunk_dim,
+    hsize_t *scaled)
+{
+    hsize_t     chunk_start = *scaled * chunk_dim;  /* Offset of the chunk */
+    hbool_t     ret_value = FALSE;          /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Single block */
+    if(sel->count == 1) {
+        if(chunk_start < sel->start)
+            *scaled = sel->start / chunk_dim;
+        ret_value = (*scaled <= (sel->start + sel->block - 1) / chunk_dim);
+    } /* end if */
+    else {
+        hsize_t first_block = 0;    /* First block at or after the chunk */
+
+        /* (Blocks aren't split by chunk boundaries, so any block that
+         *  intersects the chunk starts in it)
+         */
+        if(chunk_start > sel->start)
+            first_block = ((chunk_start - sel->start) + sel->stride - 1) / sel->stride;
+        if(first_block < sel->count) {
+            *scaled = (sel->start + first_block * sel->stride) / chunk_dim;
+            ret_value = TRUE;
+        } /* end if */
+    } /* end else */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__chunk_stream_next_dim() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__chunk_stream_next
+ *
+ * Purpose:	Advance to the first (when FIRST is set) or next chunk
+ *		selected for streamed I/O, and set its file & memory
+ *		selections in the reused chunk information.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__chunk_stream_next(H5D_chunk_map_t *fm, hbool_t first, hbool_t *found)
+{
+    H5D_chunk_info_t *chunk_info = fm->single_chunk_info;   /* Chunk information */
+    hsize_t     fstart[H5S_MAX_RANK];       /* Start of selection in chunk */
+    hsize_t     mstart[H5S_MAX_RANK];       /* Start of selection in memory */
+    hsize_t     stride[H5S_MAX_RANK];       /* Stride of selection */
+    hsize_t     count[H5S_MAX_RANK];        /* Count of selection */
+    hsize_t     block[H5S_MAX_RANK];        /* Block of selection */
+    hsize_t     chunk_points = 1;           /* # of elements selected in chunk */
+    unsigned    u;                          /* Local index variable */
+    herr_t	ret_value = SUCCEED;        /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity check */
+    HDassert(fm->use_stream);
+    HDassert(chunk_info);
+
+    /* Find the chunk's scaled coordinates */
+    if(first)
+        H5MM_memcpy(chunk_info->scaled, fm->stream_first, sizeof(hsize_t) * fm->f_ndims);
+    else {
+        int curr_dim = (int)fm->f_ndims - 1;    /* Current dimension to increment */
+
+        /* Move to the next chunk selected in the fastest changing dimension,
+         *  wrapping around into the slower changing dimensions
+         */
+        while(1) {
+            chunk_info->scaled[curr_dim]++;
+            if(H5D__chunk_stream_next_dim(&fm->stream_sel[curr_dim], fm->chunk_dim[curr_dim], &chunk_info->scaled[curr_dim]))
+                break;
+            chunk_info->scaled[curr_dim] = fm->stream_first[curr_dim];
+            if(--curr_dim < 0) {
+                *found = FALSE;
+                HGOTO_DONE(SUCCEED)
+            } /* end if */
+        } /* end while */
+    } /* end else */
+    chunk_info->scaled[fm->f_ndims] = 0;
+
+    /* Compute the selection in the chunk */
+    for(u = 0; u < fm->f_ndims; u++) {
+        const H5S_hyper_dim_t *sel = &fm->stream_sel[u];    /* Selection in this dimension */
+        hsize_t chunk_start = chunk_info->scaled[u] * fm->chunk_dim[u];    /* Offset of chunk */
+        hsize_t chunk_end = (chunk_start + fm->chunk_dim[u]) - 1;          /* Last element in chunk */
+        hsize_t sel_start;          /* Start of selection in chunk, in dataset coordinates */
+
+        if(sel->count == 1) {
+            hsize_t sel_end = (sel->start + sel->block) - 1;    /* End of block */
+
+            sel_start = MAX(sel->start, chunk_start);
+            stride[u] = 1;
+            count[u] = 1;
+            block[u] = (MIN(sel_end, chunk_end) - sel_start) + 1;
+        } /* end if */
+        else {
+            hsize_t first_block = 0;    /* First block in chunk */
+            hsize_t last_block;         /* Last block in chunk */
+
+            if(chunk_start > sel->start)
+                first_block = ((chunk_start - sel->start) + sel->stride - 1) / sel->stride;
+            last_block = MIN(sel->count - 1, (chunk_end - sel->start) / sel->stride);
+            HDassert(first_block <= last_block);
+
+            sel_start = sel->start + first_block * sel->stride;
+            stride[u] = sel->stride;
+            count[u] = (last_block - first_block) + 1;
+            block[u] = sel->block;
+        } /* end else */
+
+        fstart[u] = sel_start - chunk_start;
+        mstart[u] = fm->stream_mem_start[u] + (sel_start - sel->start);
+        chunk_points *= count[u] * block[u];
+    } /* end for */
+
+    /* Set the chunk's selections */
+    if(H5S_select_hyperslab(chunk_info->fspace, H5S_SELECT_SET, fstart, stride, count, block) < 0)
+        HGOTO_ERROR(H5E_DATASPACE, H5E_CANTSELECT, FAIL, "can't create chunk file selection")
+    if(fm->mchunk_tmpl)
+        if(H5S_select_hyperslab(chunk_info->mspace, H5S_SELECT_SET, mstart, stride, count, block) < 0)
+            HGOTO_ERROR(H5E_DATASPACE, H5E_CANTSELECT, FAIL, "can't create chunk memory selection")
+
+    /* Set the rest of the chunk information */
+    chunk_info->index = H5VM_array_offset_pre(fm->f_ndims, fm->layout->u.chunk.down_chunks, chunk_info->scaled);
+    H5_CHECKED_ASSIGN(chunk_info->chunk_points, uint32_t, chunk_points, hsize_t);
+    *found = TRUE;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__chunk_stream_next() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__chunk_map_next
+ *
+ * Purpose:	Iterate over the chunks selected for an I/O operation.
+ *		Starts with the first chunk when *CHUNK_INFO is NULL, and
+ *		sets *CHUNK_INFO to NULL after the last chunk.  (*CHUNK_NODE
+ *		is the position in the skip list of chunk selections, when
+ *		they were built up front.)
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__chunk_map_next(H5D_chunk_map_t *fm, H5SL_node_t **chunk_node,
+    H5D_chunk_info_t **chunk_info)
+{
+    herr_t	ret_value = SUCCEED;        /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity check */
+    HDassert(fm);
+    HDassert(chunk_node);
+    HDassert(chunk_info);
+
+    if(fm->use_single)
+        *chunk_info = (*chunk_info ? NULL : fm->single_chunk_info);
+    else if(fm->use_stream) {
+        hbool_t found;      /* Whether there's another chunk */
+
+        if(H5D__chunk_stream_next(fm, (NULL == *chunk_info), &found) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTNEXT, FAIL, "can't compute chunk selection")
+        *chunk_info = (found ? fm->single_chunk_info : NULL);
+    } /* end if */
+    else {
+        *chunk_node = (*chunk_info ? H5SL_next(*chunk_node) : H5SL_first(fm->sel_chunks));
+        *chunk_info = (*chunk_node ? (H5D_chunk_info_t *)H5SL_item(*chunk_node) : NULL);
+    } /* end else */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__chunk_map_next() */
+
 
 /*-------------------------------------------------------------------------
  * Function:	H5D__create_chunk_file_map_all
@@ -1564,6 +2108,7 @@ H5D__create_chunk_file_map_all(H5D_chunk_map_t *fm, const H5D_io_info_t
     *io_info)
 {
     H5S_t       *tmp_fchunk = NULL;         /* Temporary file dataspace */
+    H5D_chunk_sel_list_t sel_list = {NULL, NULL, 0, 0}; /* Chunk selections, in index order */
     hsize_t     file_dims[H5S_MAX_RANK];    /* File dataspace dims */
     hsize_t     sel_points;                 /* Number of elements in file selection */
     hsize_t     zeros[H5S_MAX_RANK];        /* All zero vector (for start parameter to setting hyperslab on partial chunks) */
@@ -1663,10 +2208,10 @@ H5D__create_chunk_file_map_all(H5D_chunk_map_t *fm, const H5D_io_info_t
         H5MM_memcpy(new_chunk_info->scaled, scaled, sizeof(hsize_t) * fm->f_ndims);
         new_chunk_info->scaled[fm->f_ndims] = 0;
 
-        /* Insert the new chunk into the skip list */
-        if(H5SL_insert(fm->sel_chunks, new_chunk_info, &new_chunk_info->index) < 0) {
+        /* Add the new chunk to the list of chunks */
+        if(H5D__chunk_sel_list_append(&sel_list, new_chunk_info) < 0) {
             H5D__free_chunk_info(new_chunk_info, NULL, NULL);
-            HGOTO_ERROR(H5E_DATASPACE, H5E_CANTINSERT, FAIL, "can't insert chunk into skip list")
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTINSERT, FAIL, "can't add chunk to list of chunk selections")
         } /* end if */
 
         /* Get number of elements selected in chunk */
@@ -1740,10 +2285,15 @@ H5D__create_chunk_file_map_all(H5D_chunk_map_t *fm, const H5D_io_info_t
         } /* end if */
     } /* end while */
 
+    /* Put the chunks in the skip list */
+    if(H5D__chunk_sel_list_build(fm, &sel_list) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTINSERT, FAIL, "can't build skip list of chunk selections")
+
 done:
     /* Clean up */
     if(tmp_fchunk && H5S_close(tmp_fchunk) < 0)
         HDONE_ERROR(H5E_DATASET, H5E_CANTRELEASE, FAIL, "can't release temporary dataspace")
+    H5D__chunk_sel_list_free(&sel_list);
 
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5D__create_chunk_file_map_all() */
@@ -1769,6 +2319,7 @@ H5D__create_chunk_file_map_hyper(H5D_chunk_map_t *fm, const H5D_io_info_t
     *io_info)
 {
     H5S_t       *tmp_fchunk = NULL;         /* Temporary file dataspace */
+    H5D_chunk_sel_list_t sel_list = {NULL, NULL, 0, 0}; /* Chunk selections, in index order */
     hsize_t     sel_start[H5O_LAYOUT_NDIMS]; /* Offset of low bound of file selection */
     hsize_t     sel_end[H5O_LAYOUT_NDIMS];  /* Offset of high bound of file selection */
     hsize_t     sel_points;                 /* Number of elements in file selection */
@@ -1859,10 +2410,10 @@ H5D__create_chunk_file_map_hyper(H5D_chunk_map_t *fm, const H5D_io_info_t
 	    H5MM_memcpy(new_chunk_info->scaled, scaled, sizeof(hsize_t) * fm->f_ndims);
             new_chunk_info->scaled[fm->f_ndims] = 0;
 
-            /* Insert the new chunk into the skip list */
-            if(H5SL_insert(fm->sel_chunks, new_chunk_info, &new_chunk_info->index) < 0) {
+            /* Add the new chunk to the list of chunks */
+            if(H5D__chunk_sel_list_append(&sel_list, new_chunk_info) < 0) {
                 H5D__free_chunk_info(new_chunk_info, NULL, NULL);
-                HGOTO_ERROR(H5E_DATASPACE, H5E_CANTINSERT, FAIL, "can't insert chunk into skip list")
+                HGOTO_ERROR(H5E_DATASET, H5E_CANTINSERT, FAIL, "can't add chunk to list of chunk selections")
             } /* end if */
 
             /* Get number of elements selected in chunk */
@@ -1875,7 +2426,7 @@ H5D__create_chunk_file_map_hyper(H5D_chunk_map_t *fm, const H5D_io_info_t
 
             /* Leave if we are done */
             if(sel_points == 0)
-                HGOTO_DONE(SUCCEED)
+                break;
         } /* end if */
 
         /* Increment chunk index */
@@ -1914,11 +2465,16 @@ H5D__create_chunk_file_map_hyper(H5D_chunk_map_t *fm, const H5D_io_info_t
         } /* end if */
     } /* end while */
 
+    /* Put the chunks in the skip list */
+    if(H5D__chunk_sel_list_build(fm, &sel_list) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTINSERT, FAIL, "can't build skip list of chunk selections")
+
 done:
     /* Clean up on failure */
     if(ret_value < 0)
         if(tmp_fchunk && H5S_close(tmp_fchunk) < 0)
             HDONE_ERROR(H5E_DATASET, H5E_CANTRELEASE, FAIL, "can't release temporary dataspace")
+    H5D__chunk_sel_list_free(&sel_list);
 
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5D__create_chunk_file_map_hyper() */
@@ -2362,7 +2918,8 @@ H5D__chunk_read(H5D_io_info_t *io_info, const H5D_type_info_t *type_info,
     hsize_t H5_ATTR_UNUSED nelmts, const H5S_t H5_ATTR_UNUSED *file_space, const H5S_t H5_ATTR_UNUSED *mem_space,
     H5D_chunk_map_t *fm)
 {
-    H5SL_node_t *chunk_node;            /* Current node in chunk skip list */
+    H5SL_node_t *chunk_node = NULL;     /* Current node in chunk skip list */
+    H5D_chunk_info_t *chunk_info = NULL;    /* Chunk information */
     H5D_io_info_t nonexistent_io_info;  /* "nonexistent" I/O info object */
     H5D_io_info_t ctg_io_info;          /* Contiguous I/O info object */
     H5D_storage_t ctg_store;            /* Chunk storage information as contiguous dataset */
@@ -2419,15 +2976,12 @@ H5D__chunk_read(H5D_io_info_t *io_info, const H5D_type_info_t *type_info,
             skip_missing_chunks = TRUE;
     }
 
-    /* Iterate through nodes in chunk skip list */
-    chunk_node = H5D_CHUNK_GET_FIRST_NODE(fm);
-    while(chunk_node) {
-        H5D_chunk_info_t *chunk_info;   /* Chunk information */
+    /* Iterate through the chunks selected */
+    if(H5D__chunk_map_next(fm, &chunk_node, &chunk_info) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTNEXT, FAIL, "can't get chunk selection")
+    while(chunk_info) {
         H5D_chunk_ud_t udata;		/* Chunk index pass-through	*/
 
-        /* Get the actual chunk information from the skip list node */
-        chunk_info = H5D_CHUNK_GET_NODE_INFO(fm, chunk_node);
-
         /* Get the info for the chunk in the file */
         if(H5D__chunk_lookup(io_info->dset, chunk_info->scaled, &udata) < 0)
             HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "error looking up chunk address")
@@ -2488,8 +3042,9 @@ H5D__chunk_read(H5D_io_info_t *io_info, const H5D_type_info_t *type_info,
                 HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "unable to unlock raw data chunk")
         } /* end if */
 
-        /* Advance to next chunk in list */
-        chunk_node = H5D_CHUNK_GET_NEXT_NODE(fm, chunk_node);
+        /* Advance to next chunk selected */
+        if(H5D__chunk_map_next(fm, &chunk_node, &chunk_info) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTNEXT, FAIL, "can't get chunk selection")
     } /* end while */
 
 done:
@@ -2514,7 +3069,8 @@ H5D__chunk_write(H5D_io_info_t *io_info, const H5D_type_info_t *type_info,
     hsize_t H5_ATTR_UNUSED nelmts, const H5S_t H5_ATTR_UNUSED *file_space, const H5S_t H5_ATTR_UNUSED *mem_space,
     H5D_chunk_map_t *fm)
 {
-    H5SL_node_t *chunk_node;            /* Current node in chunk skip list */
+    H5SL_node_t *chunk_node = NULL;     /* Current node in chunk skip list */
+    H5D_chunk_info_t *chunk_info = NULL;    /* Chunk information */
     H5D_io_info_t ctg_io_info;          /* Contiguous I/O info object */
     H5D_storage_t ctg_store;            /* Chunk storage information as contiguous dataset */
     H5D_io_info_t cpt_io_info;          /* Compact I/O info object */
@@ -2547,10 +3103,10 @@ H5D__chunk_write(H5D_io_info_t *io_info, const H5D_type_info_t *type_info,
     /* Initialize temporary compact storage info */
     cpt_store.compact.dirty = &cpt_dirty;
 
-    /* Iterate through nodes in chunk skip list */
-    chunk_node = H5D_CHUNK_GET_FIRST_NODE(fm);
-    while(chunk_node) {
-        H5D_chunk_info_t *chunk_info;   /* Chunk information */
+    /* Iterate through the chunks selected */
+    if(H5D__chunk_map_next(fm, &chunk_node, &chunk_info) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTNEXT, FAIL, "can't get chunk selection")
+    while(chunk_info) {
 	H5D_chk_idx_info_t idx_info;    /* Chunked index info */
         H5D_io_info_t *chk_io_info;     /* Pointer to I/O info object for this chunk */
         void *chunk;                    /* Pointer to locked chunk buffer */
@@ -2558,9 +3114,6 @@ H5D__chunk_write(H5D_io_info_t *io_info, const H5D_type_info_t *type_info,
         htri_t cacheable;               /* Whether the chunk is cacheable */
         hbool_t need_insert = FALSE;    /* Whether the chunk needs to be inserted into the index */
 
-        /* Get the actual chunk information from the skip list node */
-        chunk_info = H5D_CHUNK_GET_NODE_INFO(fm, chunk_node);
-
         /* Look up the chunk */
         if(H5D__chunk_lookup(io_info->dset, chunk_info->scaled, &udata) < 0)
             HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "error looking up chunk address")
@@ -2650,8 +3203,9 @@ H5D__chunk_write(H5D_io_info_t *io_info, const H5D_type_info_t *type_info,
                     HGOTO_ERROR(H5E_DATASET, H5E_CANTINSERT, FAIL, "unable to insert chunk addr into index")
 	} /* end else */
 
-        /* Advance to next chunk in list */
-        chunk_node = H5D_CHUNK_GET_NEXT_NODE(fm, chunk_node);
+        /* Advance to next chunk selected */
+        if(H5D__chunk_map_next(fm, &chunk_node, &chunk_info) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTNEXT, FAIL, "can't get chunk selection")
     } /* end while */
 
 done:
@@ -2718,15 +3272,15 @@ H5D__chunk_io_term(const H5D_chunk_map_t *fm)
 
     FUNC_ENTER_STATIC
 
-    /* Single element I/O vs. multiple element I/O cleanup */
-    if(fm->use_single) {
+    /* Single element or streamed I/O vs. multiple element I/O cleanup */
+    if(fm->use_single || fm->use_stream) {
         /* Sanity checks */
         HDassert(fm->sel_chunks == NULL);
         HDassert(fm->single_chunk_info);
         HDassert(fm->single_chunk_info->fspace_shared);
         HDassert(fm->single_chunk_info->mspace_shared);
 
-        /* Reset the selection for the single element I/O */
+        /* Reset the selection for the single chunk dataspace */
         H5S_select_all(fm->single_space, TRUE);
     } /* end if */
     else {
@@ -2736,6 +3290,16 @@ H5D__chunk_io_term(const H5D_chunk_map_t *fm)
                 HGOTO_ERROR(H5E_PLIST, H5E_CANTNEXT, FAIL, "can't iterate over chunks")
     } /* end else */
 
+    /* Release the map's own chunk selection structures */
+    if(fm->own_scratch) {
+        if(fm->sel_chunks && H5SL_close(fm->sel_chunks) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTCLOSEOBJ, FAIL, "can't close chunk selection skip list")
+        if(fm->single_space && H5S_close(fm->single_space) < 0)
+            HGOTO_ERROR(H5E_DATASPACE, H5E_CANTRELEASE, FAIL, "can't release single chunk dataspace")
+        if(fm->single_chunk_info)
+            H5FL_FREE(H5D_chunk_info_t, fm->single_chunk_info);
+    } /* end if */
+
     /* Free the memory chunk dataspace template */
     if(fm->mchunk_tmpl)
         if(H5S_close(fm->mchunk_tmpl) < 0)
@@ -3249,6 +3813,9 @@ H5D__chunk_flush_entry(const H5D_t *dset, H5D_rdcc_ent_t *ent, hbool_t reset)
             H5Z_cb_t filter_cb;         /* I/O filter callback function */
             size_t alloc = udata.chunk_block.length;        /* Bytes allocated for BUF	*/
             size_t nbytes;              /* Chunk size (in bytes) */
+            H5F_prof_t *prof;           /* File's profiling counters */
+            H5F_prof_t *prev_prof = NULL; /* Profiling counters in the API context on entry */
+            herr_t status;              /* Result of running the pipeline */
 
             /* Retrieve filter settings from API context */
             if(H5CX_get_err_detect(&err_detect) < 0)
@@ -3278,8 +3845,20 @@ H5D__chunk_flush_entry(const H5D_t *dset, H5D_rdcc_ent_t *ent, hbool_t reset)
                 ent->chunk = NULL;
             } /* end else */
             H5_CHECKED_ASSIGN(nbytes, size_t, udata.chunk_block.length, hsize_t);
-            if(H5Z_pipeline(&(dset->shared->dcpl_cache.pline), 0, &(udata.filter_mask),
-                    err_detect, filter_cb, &nbytes, &alloc, &buf) < 0)
+
+            /* Chunks may be flushed outside of H5Dwrite (e.g. when the
+             * dataset is closed), so point the filters at this file's
+             * counters here
+             */
+            if(NULL != (prof = H5F_get_prof(dset->oloc.file))) {
+                prev_prof = H5CX_get_prof();
+                H5CX_set_prof(prof);
+            } /* end if */
+            status = H5Z_pipeline(&(dset->shared->dcpl_cache.pline), 0, &(udata.filter_mask),
+                    err_detect, filter_cb, &nbytes, &alloc, &buf);
+            if(prof)
+                H5CX_set_prof(prev_prof);
+            if(status < 0)
                 HGOTO_ERROR(H5E_DATASET, H5E_CANTFILTER, FAIL, "output pipeline failed")
 #if H5_SIZEOF_SIZE_T > 4
             /* Check for the chunk expanding too much to encode in a 32-bit value */
@@ -3612,6 +4191,7 @@ H5D__chunk_lock(const H5D_io_info_t *io_info, H5D_chunk_ud_t *udata,
     hbool_t             fb_info_init = FALSE;   /* Whether the fill value buffer has been initialized */
     H5D_rdcc_t		*rdcc = &(dset->shared->cache.chunk); /*raw data chunk cache*/
     H5D_rdcc_ent_t	*ent;		        /*cache entry		*/
+    H5F_prof_t          *prof = H5F_get_prof(dset->oloc.file); /* File's profiling counters */
     size_t		chunk_size;		/*size of a chunk	*/
     hbool_t             disable_filters = FALSE; /* Whether to disable filters (when adding to cache) */
     void		*chunk = NULL;		/*the file chunk	*/
@@ -3654,6 +4234,8 @@ H5D__chunk_lock(const H5D_io_info_t *io_info, H5D_chunk_ud_t *udata,
          * Already in the cache.  Count a hit.
          */
         rdcc->stats.nhits++;
+        if(prof)
+            H5F_prof_chunk(prof, TRUE);
 
         /* Make adjustments if the edge chunk status changed recently */
         if(pline->nused) {
@@ -3784,6 +4366,8 @@ H5D__chunk_lock(const H5D_io_info_t *io_info, H5D_chunk_ud_t *udata,
              * miss because we saved ourselves lots of work.
              */
             rdcc->stats.nhits++;
+            if(prof)
+                H5F_prof_chunk(prof, TRUE);
 
             if(NULL == (chunk = H5D__chunk_mem_alloc(chunk_size, pline)))
                 HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, NULL, "memory allocation failed for raw data chunk")
@@ -3839,6 +4423,8 @@ H5D__chunk_lock(const H5D_io_info_t *io_info, H5D_chunk_ud_t *udata,
 
                 /* Increment # of cache misses */
                 rdcc->stats.nmisses++;
+                if(prof)
+                    H5F_prof_chunk(prof, FALSE);
             } /* end if */
             else {
                 H5D_fill_value_t	fill_status;
@@ -4164,6 +4750,160 @@ done:
 } /* end H5D__chunk_allocated() */
 
 
+/*-------------------------------------------------------------------------
+ * Function:	H5D__chunk_iterate_blocks_cb
+ *
+ * Purpose:	Call the operator for the block of file space used by a chunk
+ *
+ * Return:	H5_ITER_CONT / H5_ITER_ERROR
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5D__chunk_iterate_blocks_cb(const H5D_chunk_rec_t *chunk_rec, void *_udata)
+{
+    H5D_chunk_it_ud6_t *udata = (H5D_chunk_it_ud6_t *)_udata;  /* User data */
+    int ret_value = H5_ITER_CONT;       /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    if(H5F_addr_defined(chunk_rec->chunk_addr) && chunk_rec->nbytes > 0)
+        if((udata->op)(chunk_rec->chunk_addr, (hsize_t)chunk_rec->nbytes, chunk_rec->scaled, udata->op_data) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CALLBACK, H5_ITER_ERROR, "chunk block operator failed")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5D__chunk_iterate_blocks_cb() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__chunk_iterate_blocks
+ *
+ * Purpose:	Iterate over the chunks of a dataset that have file space
+ *		allocated, calling OP with the address, size and scaled
+ *		offset of each one.
+ *
+ *		Chunks of datasets using the implicit index are skipped,
+ *		since their locations are computed and can't be moved
+ *		individually.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5D__chunk_iterate_blocks(const H5D_t *dset, H5D_raw_block_op_t op, void *op_data)
+{
+    H5D_chk_idx_info_t idx_info;        /* Chunked index info */
+    const H5D_rdcc_t   *rdcc = &(dset->shared->cache.chunk);	/* Raw data chunk cache */
+    H5D_rdcc_ent_t     *ent;            /* Cache entry  */
+    H5D_chunk_it_ud6_t udata;           /* User data for iteration callback */
+    H5O_storage_chunk_t *sc = &(dset->shared->layout.storage.u.chunk);
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    HDassert(dset);
+    HDassert(dset->shared);
+    HDassert(op);
+    H5D_CHUNK_STORAGE_INDEX_CHK(sc);
+
+    /* Chunks using the implicit index can't be moved individually */
+    if(H5D_CHUNK_IDX_NONE == sc->idx_type)
+        HGOTO_DONE(SUCCEED)
+
+    /* Flush cached chunks, so the index has their current locations */
+    for(ent = rdcc->head; ent; ent = ent->next)
+        if(H5D__chunk_flush_entry(dset, ent, FALSE) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "cannot flush indexed storage buffer")
+
+    /* Check for no chunks allocated */
+    if(!(sc->ops->is_space_alloc)(sc))
+        HGOTO_DONE(SUCCEED)
+
+    /* Compose chunked index info struct */
+    idx_info.f = dset->oloc.file;
+    idx_info.pline = &dset->shared->dcpl_cache.pline;
+    idx_info.layout = &dset->shared->layout.u.chunk;
+    idx_info.storage = sc;
+
+    /* Iterate over the chunks */
+    udata.op = op;
+    udata.op_data = op_data;
+    if((sc->ops->iterate)(&idx_info, H5D__chunk_iterate_blocks_cb, &udata) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_BADITER, FAIL, "unable to iterate over chunk index")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__chunk_iterate_blocks() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__chunk_relocate
+ *
+ * Purpose:	Point the index entry for the chunk at SCALED to NEW_ADDR.
+ *		The caller has already copied the chunk's data to its new
+ *		location and is responsible for the old space.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5D__chunk_relocate(const H5D_t *dset, const hsize_t *scaled, haddr_t new_addr)
+{
+    H5D_chk_idx_info_t idx_info;        /* Chunked index info */
+    H5D_chunk_ud_t udata;               /* Information about the chunk */
+    H5O_storage_chunk_t *sc = &(dset->shared->layout.storage.u.chunk);
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    HDassert(dset);
+    HDassert(scaled);
+    HDassert(H5F_addr_defined(new_addr));
+    H5D_CHUNK_STORAGE_INDEX_CHK(sc);
+
+    if(H5D_CHUNK_IDX_NONE == sc->idx_type || NULL == sc->ops->insert)
+        HGOTO_ERROR(H5E_DATASET, H5E_UNSUPPORTED, FAIL, "chunk index doesn't support relocating chunks")
+
+    /* Find the chunk's current location */
+    if(H5D__chunk_lookup(dset, scaled, &udata) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "error looking up chunk address")
+
+    /* Evict a cached copy of the chunk, so it isn't written back to the old
+     * location, then look the chunk up in the index itself.
+     */
+    if(UINT_MAX != udata.idx_hint) {
+        if(H5D__chunk_cache_evict(dset, dset->shared->cache.chunk.slot[udata.idx_hint], TRUE) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTREMOVE, FAIL, "unable to evict chunk from cache")
+        if(H5D__chunk_lookup(dset, scaled, &udata) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "error looking up chunk address")
+    } /* end if */
+    HDassert(UINT_MAX == udata.idx_hint);
+    if(!H5F_addr_defined(udata.chunk_block.offset))
+        HGOTO_ERROR(H5E_DATASET, H5E_NOTFOUND, FAIL, "chunk has no file space allocated")
+
+    /* Compose chunked index info struct */
+    idx_info.f = dset->oloc.file;
+    idx_info.pline = &dset->shared->dcpl_cache.pline;
+    idx_info.layout = &dset->shared->layout.u.chunk;
+    idx_info.storage = sc;
+
+    /* Update the chunk's address in the index */
+    udata.chunk_block.offset = new_addr;
+    if((sc->ops->insert)(&idx_info, &udata, dset) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTINSERT, FAIL, "unable to update chunk address in index")
+
+    /* Keep the "last chunk" info consistent with the index */
+    if(H5D__chunk_cinfo_cache_update(&dset->shared->cache.chunk.last, &udata) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTSET, FAIL, "unable to update cached chunk info")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__chunk_relocate() */
+
+
 /*-------------------------------------------------------------------------
  * Function:	H5D__chunk_allocate
  *
@@ -3525,6 +3525,117 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5D_get_access_plist() */
 
+
+/*-------------------------------------------------------------------------
+ * Function: H5D_raw_block_iterate
+ *
+ * Purpose:  Call OP for each block of raw data the dataset stores in
+ *           its file.  SCALED is the chunk's scaled offset for chunked
+ *           datasets and NULL for contiguous datasets.
+ *
+ *           Compact, virtual and external storage has no blocks that can
+ *           be moved, so no blocks are reported for them.
+ *
+ * Return:   Non-negative on success/Negative on failure
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5D_raw_block_iterate(const H5D_t *dset, H5D_raw_block_op_t op, void *op_data)
+{
+    const H5O_layout_t *layout;         /* Dataset's layout */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_NOAPI_TAG(dset->oloc.addr, FAIL)
+
+    /* Check args */
+    HDassert(dset);
+    HDassert(op);
+
+    layout = &dset->shared->layout;
+    switch(layout->type) {
+        case H5D_CONTIGUOUS:
+            if(0 == dset->shared->dcpl_cache.efl.nused
+                    && H5F_addr_defined(layout->storage.u.contig.addr)
+                    && layout->storage.u.contig.size > 0)
+                if((op)(layout->storage.u.contig.addr, layout->storage.u.contig.size, NULL, op_data) < 0)
+                    HGOTO_ERROR(H5E_DATASET, H5E_CALLBACK, FAIL, "raw data block operator failed")
+            break;
+
+        case H5D_CHUNKED:
+            if(H5D__chunk_iterate_blocks(dset, op, op_data) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_BADITER, FAIL, "unable to iterate over chunks")
+            break;
+
+        case H5D_COMPACT:
+        case H5D_VIRTUAL:
+            break;
+
+        case H5D_LAYOUT_ERROR:
+        case H5D_NLAYOUTS:
+        default:
+            HGOTO_ERROR(H5E_DATASET, H5E_UNSUPPORTED, FAIL, "unknown dataset layout type")
+    } /* end switch */
+
+done:
+    FUNC_LEAVE_NOAPI_TAG(ret_value)
+} /* end H5D_raw_block_iterate() */
+
+
+/*-------------------------------------------------------------------------
+ * Function: H5D_raw_block_relocate
+ *
+ * Purpose:  Point the dataset's block of raw data at SCALED (or its
+ *           contiguous storage, when SCALED is NULL) to NEW_ADDR.
+ *
+ *           The caller copies the data to the new location beforehand
+ *           and releases the old space afterwards.
+ *
+ * Return:   Non-negative on success/Negative on failure
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5D_raw_block_relocate(H5D_t *dset, const hsize_t *scaled, haddr_t new_addr)
+{
+    H5O_layout_t *layout;               /* Dataset's layout */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_NOAPI_TAG(dset->oloc.addr, FAIL)
+
+    /* Check args */
+    HDassert(dset);
+    HDassert(H5F_addr_defined(new_addr));
+
+    layout = &dset->shared->layout;
+    if(H5D_CONTIGUOUS == layout->type && NULL == scaled) {
+        HDassert(H5F_addr_defined(layout->storage.u.contig.addr));
+
+        /* Drop any data sieve buffer, which caches the old address */
+        if(H5D__flush_sieve_buf(dset) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTFLUSH, FAIL, "unable to flush sieve buffer")
+        dset->shared->cache.contig.sieve_loc = HADDR_UNDEF;
+        dset->shared->cache.contig.sieve_size = 0;
+
+        layout->storage.u.contig.addr = new_addr;
+    } /* end if */
+    else if(H5D_CHUNKED == layout->type && NULL != scaled) {
+        if(H5D__chunk_relocate(dset, scaled, new_addr) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTMODIFY, FAIL, "unable to relocate chunk")
+
+        /* The address of the only chunk is kept in the layout message */
+        if(H5D_CHUNK_IDX_SINGLE != layout->storage.u.chunk.idx_type)
+            HGOTO_DONE(SUCCEED)
+    } /* end if */
+    else
+        HGOTO_ERROR(H5E_DATASET, H5E_BADVALUE, FAIL, "no such raw data block")
+
+    /* Write the new address to the layout message */
+    if(H5D__mark(dset, H5D_MARK_LAYOUT) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTSET, FAIL, "unable to update layout message")
+
+done:
+    FUNC_LEAVE_NOAPI_TAG(ret_value)
+} /* end H5D_raw_block_relocate() */
+
 
 /*-------------------------------------------------------------------------
  * Function: H5D__get_space
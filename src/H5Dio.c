@@ -47,6 +47,20 @@
 /* Local Typedefs */
 /******************/
 
+/* Information about one dataset's part of a multi-dataset transfer, when
+ * the transfer is a single run of bytes in the file and in memory.
+ */
+typedef struct H5D_multi_piece_t {
+    H5D_t *dset;                /* Dataset for the piece */
+    haddr_t addr;               /* File address of the piece */
+    size_t len;                 /* Length of the piece, in bytes */
+    size_t idx;                 /* Index of the piece in the caller's arrays */
+    union {
+        void *rbuf;             /* Application buffer for a read */
+        const void *wbuf;       /* Application buffer for a write */
+    } u;
+} H5D_multi_piece_t;
+
 
 /********************/
 /* Local Prototypes */
@@ -63,6 +77,24 @@ static herr_t H5D__ioinfo_adjust(H5D_io_info_t *io_info, const H5D_t *dset,
 #endif /* H5_HAVE_PARALLEL */
 static herr_t H5D__typeinfo_term(const H5D_type_info_t *type_info);
 
+/* Multi-dataset I/O routines */
+static htri_t H5D__multi_sel_range(const H5S_t *space, size_t elmt_size,
+    hsize_t *off, size_t *len);
+static htri_t H5D__multi_piece_init(H5D_t *dset, hid_t mem_type_id,
+    const H5S_t *mem_space, const H5S_t *file_space, hbool_t do_write,
+    H5D_multi_piece_t *piece, hsize_t *mem_off);
+static int H5D__multi_piece_cmp(const void *_piece1, const void *_piece2);
+static herr_t H5D__multi_contig_io(H5D_io_op_type_t op_type, size_t npieces,
+    H5D_multi_piece_t *piece);
+
+/* Concurrent read routines */
+static herr_t H5D__concurrent_read_hold(size_t count, const hid_t dset_id[],
+    const hid_t mem_type_id[], const hid_t mem_space_id[],
+    const hid_t file_space_id[], hid_t dxpl_id, hbool_t *held);
+static herr_t H5D__concurrent_read_release(size_t count, const hid_t dset_id[],
+    const hid_t mem_type_id[], const hid_t mem_space_id[],
+    const hid_t file_space_id[], hid_t dxpl_id);
+
 
 /*********************/
 /* Package Variables */
@@ -79,6 +111,12 @@ H5FL_BLK_DEFINE(type_conv);
 /* Declare a free list to manage the H5D_chunk_map_t struct */
 H5FL_DEFINE(H5D_chunk_map_t);
 
+/* Declare a free list to manage blocks of combined multi-dataset I/O */
+H5FL_BLK_DEFINE_STATIC(multi_io);
+
+/* Declare extern the free list to manage the H5S_sel_iter_t struct */
+H5FL_EXTERN(H5S_sel_iter_t);
+
 
 
 /*-------------------------------------------------------------------------
@@ -166,6 +204,7 @@ H5Dread(hid_t dset_id, hid_t mem_type_id, hid_t mem_space_id,
     hid_t file_space_id, hid_t dxpl_id, void *buf/*out*/)
 {
     H5VL_object_t  *vol_obj     = NULL;
+    hbool_t         ids_held    = FALSE;        /* Whether the IDs are held for a concurrent read */
     herr_t          ret_value   = SUCCEED;      /* Return value */
 
     FUNC_ENTER_API(FAIL)
@@ -192,14 +231,293 @@ H5Dread(hid_t dset_id, hid_t mem_type_id, hid_t mem_space_id,
     /* Set DXPL for operation */
     H5CX_set_dxpl(dxpl_id);
 
+    /* Hold the IDs, if the read may let other threads into the library */
+    if (H5D__concurrent_read_hold((size_t)1, &dset_id, &mem_type_id, &mem_space_id, &file_space_id, dxpl_id, &ids_held) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTINC, FAIL, "can't hold IDs for read")
+
     /* Read the data */
     if ((ret_value = H5VL_dataset_read(vol_obj, mem_type_id, mem_space_id, file_space_id, dxpl_id, buf, H5_REQUEST_NULL)) < 0)
         HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "can't read data")
 
 done:
+    if (ids_held && H5D__concurrent_read_release((size_t)1, &dset_id, &mem_type_id, &mem_space_id, &file_space_id, dxpl_id) < 0)
+        HDONE_ERROR(H5E_DATASET, H5E_CANTDEC, FAIL, "can't release IDs held for read")
+
     FUNC_LEAVE_API(ret_value)
 } /* end H5Dread() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Dread_multi
+ *
+ * Purpose:     Multi-version of H5Dread(), which reads selections from
+ *              multiple datasets from a file into application memory
+ *              BUFS.  Each of the arrays has COUNT entries, and entry U
+ *              describes the same transfer as the corresponding arguments
+ *              of H5Dread() would.  All the datasets share the transfer
+ *              properties in DXPL_ID.
+ *
+ *              When every dataset is accessed through the native VOL
+ *              connector, the raw data I/O for the datasets is combined
+ *              where possible, instead of being issued one dataset at a
+ *              time.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Dread_multi(size_t count, const hid_t dset_id[], const hid_t mem_type_id[],
+    const hid_t mem_space_id[], const hid_t file_space_id[], hid_t dxpl_id,
+    void *buf[]/*out*/)
+{
+    H5VL_object_t  *vol_obj = NULL;         /* Dataset for the current entry */
+    H5VL_object_t  *first_vol_obj = NULL;   /* Dataset for the first entry */
+    hbool_t         is_native = TRUE;       /* Whether all datasets use the native connector */
+    hbool_t         ids_held = FALSE;       /* Whether the IDs are held for a concurrent read */
+    size_t          u;                      /* Local index variable */
+    herr_t          ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE7("e", "z*i*i*i*iix", count, dset_id, mem_type_id, mem_space_id,
+             file_space_id, dxpl_id, buf);
+
+    /* Nothing to do */
+    if(0 == count)
+        HGOTO_DONE(SUCCEED)
+
+    /* Check arguments */
+    if(!dset_id)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "dset_id array not provided")
+    if(!mem_type_id)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "mem_type_id array not provided")
+    if(!mem_space_id)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "mem_space_id array not provided")
+    if(!file_space_id)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "file_space_id array not provided")
+    if(!buf)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "buf array not provided")
+    for(u = 0; u < count; u++) {
+        if(mem_space_id[u] < 0)
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "invalid memory dataspace ID")
+        if(file_space_id[u] < 0)
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "invalid file dataspace ID")
+
+        /* Get dataset pointer */
+        if(NULL == (vol_obj = (H5VL_object_t *)H5I_object_verify(dset_id[u], H5I_DATASET)))
+            HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "dset_id is not a dataset ID")
+        if(vol_obj->connector->cls->value != H5_VOL_NATIVE)
+            is_native = FALSE;
+        if(0 == u)
+            first_vol_obj = vol_obj;
+    } /* end for */
+
+    /* Get the default dataset transfer property list if the user didn't provide one */
+    if(H5P_DEFAULT == dxpl_id)
+        dxpl_id = H5P_DATASET_XFER_DEFAULT;
+    else
+        if(TRUE != H5P_isa_class(dxpl_id, H5P_DATASET_XFER))
+            HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not xfer parms")
+
+    /* Set DXPL for operation */
+    H5CX_set_dxpl(dxpl_id);
+
+    /* Hold the IDs, if the reads may let other threads into the library */
+    if(H5D__concurrent_read_hold(count, dset_id, mem_type_id, mem_space_id, file_space_id, dxpl_id, &ids_held) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTINC, FAIL, "can't hold IDs for read")
+
+    /* Read the data */
+    if(is_native) {
+        if(H5VL_dataset_optional(first_vol_obj, dxpl_id, H5_REQUEST_NULL, H5VL_NATIVE_DATASET_READ_MULTI, count, dset_id, mem_type_id, mem_space_id, file_space_id, buf) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "can't read data")
+    } /* end if */
+    else
+        /* Other connectors get one read per dataset */
+        for(u = 0; u < count; u++) {
+            vol_obj = (H5VL_object_t *)H5I_object(dset_id[u]);
+            if(H5VL_dataset_read(vol_obj, mem_type_id[u], mem_space_id[u], file_space_id[u], dxpl_id, buf[u], H5_REQUEST_NULL) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "can't read data")
+        } /* end for */
+
+done:
+    if(ids_held && H5D__concurrent_read_release(count, dset_id, mem_type_id, mem_space_id, file_space_id, dxpl_id) < 0)
+        HDONE_ERROR(H5E_DATASET, H5E_CANTDEC, FAIL, "can't release IDs held for read")
+
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Dread_multi() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__concurrent_read_hold
+ *
+ * Purpose:     Checks if the raw data reads for H5Dread() or
+ *              H5Dread_multi() may let other threads into the library,
+ *              and if so, takes references to all the IDs the read uses.
+ *
+ *              Other threads can then close the IDs without the objects
+ *              being freed underneath the read.  The files' counts of
+ *              concurrent reads keep them from being closed with the
+ *              "strong" close degree in the meantime, and the datatype
+ *              package's count keeps the conversion paths the reads use
+ *              from being replaced or removed.
+ *
+ *              Reads are only allowed to run concurrently for native
+ *              contiguous and chunked datasets in files that allow it
+ *              (see H5F_open()).  All the datasets must qualify, and
+ *              invalid IDs are left for the read itself to report.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__concurrent_read_hold(size_t count, const hid_t dset_id[],
+    const hid_t mem_type_id[], const hid_t mem_space_id[],
+    const hid_t file_space_id[], hid_t dxpl_id, hbool_t *held)
+{
+    size_t          nfiles = 0;             /* Number of files counted */
+    size_t          ndsets = 0;             /* Number of dataset IDs held */
+    size_t          ntypes = 0;             /* Number of datatype IDs held */
+    size_t          nmem_spaces = 0;        /* Number of memory dataspace IDs held */
+    size_t          nfile_spaces = 0;       /* Number of file dataspace IDs held */
+    size_t          u;                      /* Local index variable */
+    herr_t          ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(held);
+
+    *held = FALSE;
+
+    /* Check that all the reads qualify */
+    for(u = 0; u < count; u++) {
+        H5VL_object_t *vol_obj;             /* Dataset's VOL object */
+        const H5D_t *dset;                  /* Dataset */
+
+        if(NULL == (vol_obj = (H5VL_object_t *)H5I_object(dset_id[u])))
+            HGOTO_DONE(SUCCEED)
+        if(vol_obj->connector->cls->value != H5_VOL_NATIVE)
+            HGOTO_DONE(SUCCEED)
+        dset = (const H5D_t *)vol_obj->data;
+        if(!H5F_concurrent_read(dset->oloc.file))
+            HGOTO_DONE(SUCCEED)
+        if(H5D_CONTIGUOUS != dset->shared->layout.type && H5D_CHUNKED != dset->shared->layout.type)
+            HGOTO_DONE(SUCCEED)
+        if(H5I_DATATYPE != H5I_get_type(mem_type_id[u]))
+            HGOTO_DONE(SUCCEED)
+        if(H5S_ALL != mem_space_id[u] && H5I_DATASPACE != H5I_get_type(mem_space_id[u]))
+            HGOTO_DONE(SUCCEED)
+        if(H5S_ALL != file_space_id[u] && H5I_DATASPACE != H5I_get_type(file_space_id[u]))
+            HGOTO_DONE(SUCCEED)
+    } /* end for */
+
+    /* Take references to the IDs, counting each one as it's taken so a
+     * failure can undo exactly what was done
+     */
+    for(u = 0; u < count; u++) {
+        H5VL_object_t *vol_obj = (H5VL_object_t *)H5I_object(dset_id[u]);
+
+        H5F_incr_nconcurrent_reads(((H5D_t *)vol_obj->data)->oloc.file);
+        nfiles++;
+        if(H5I_inc_ref(dset_id[u], FALSE) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTINC, FAIL, "can't increment dataset ID ref count")
+        ndsets++;
+        if(H5I_inc_ref(mem_type_id[u], FALSE) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTINC, FAIL, "can't increment datatype ID ref count")
+        ntypes++;
+        if(H5S_ALL != mem_space_id[u] && H5I_inc_ref(mem_space_id[u], FALSE) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTINC, FAIL, "can't increment dataspace ID ref count")
+        nmem_spaces++;
+        if(H5S_ALL != file_space_id[u] && H5I_inc_ref(file_space_id[u], FALSE) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTINC, FAIL, "can't increment dataspace ID ref count")
+        nfile_spaces++;
+    } /* end for */
+    if(H5P_DATASET_XFER_DEFAULT != dxpl_id && H5I_inc_ref(dxpl_id, FALSE) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTINC, FAIL, "can't increment property list ID ref count")
+
+    /* Keep the conversion paths from changing, and let the raw data reads
+     * release the API lock
+     */
+    H5T_incr_nconcurrent_reads();
+    H5CX_set_concurrent_read(TRUE);
+    *held = TRUE;
+
+done:
+    /* Undo a partial hold */
+    if(ret_value < 0) {
+        for(u = 0; u < nfiles; u++) {
+            H5VL_object_t *vol_obj = (H5VL_object_t *)H5I_object(dset_id[u]);
+
+            HDassert(vol_obj);
+            H5F_decr_nconcurrent_reads(((H5D_t *)vol_obj->data)->oloc.file);
+        } /* end for */
+        for(u = 0; u < ndsets; u++)
+            if(H5I_dec_ref(dset_id[u]) < 0)
+                HDONE_ERROR(H5E_DATASET, H5E_CANTDEC, FAIL, "can't decrement dataset ID ref count")
+        for(u = 0; u < ntypes; u++)
+            if(H5I_dec_ref(mem_type_id[u]) < 0)
+                HDONE_ERROR(H5E_DATASET, H5E_CANTDEC, FAIL, "can't decrement datatype ID ref count")
+        for(u = 0; u < nmem_spaces; u++)
+            if(H5S_ALL != mem_space_id[u] && H5I_dec_ref(mem_space_id[u]) < 0)
+                HDONE_ERROR(H5E_DATASET, H5E_CANTDEC, FAIL, "can't decrement dataspace ID ref count")
+        for(u = 0; u < nfile_spaces; u++)
+            if(H5S_ALL != file_space_id[u] && H5I_dec_ref(file_space_id[u]) < 0)
+                HDONE_ERROR(H5E_DATASET, H5E_CANTDEC, FAIL, "can't decrement dataspace ID ref count")
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__concurrent_read_hold() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__concurrent_read_release
+ *
+ * Purpose:     Drops the references taken by H5D__concurrent_read_hold().
+ *              Objects whose IDs were closed by other threads during the
+ *              read are closed now.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__concurrent_read_release(size_t count, const hid_t dset_id[],
+    const hid_t mem_type_id[], const hid_t mem_space_id[],
+    const hid_t file_space_id[], hid_t dxpl_id)
+{
+    size_t          u;                      /* Local index variable */
+    herr_t          ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    H5CX_set_concurrent_read(FALSE);
+    H5T_decr_nconcurrent_reads();
+
+    /* The reads are done, so the files may be closed again */
+    for(u = 0; u < count; u++) {
+        H5VL_object_t *vol_obj = (H5VL_object_t *)H5I_object(dset_id[u]);
+
+        HDassert(vol_obj);
+        H5F_decr_nconcurrent_reads(((H5D_t *)vol_obj->data)->oloc.file);
+    } /* end for */
+
+    /* Drop the references, even if some of them fail */
+    for(u = 0; u < count; u++) {
+        if(H5I_dec_ref(dset_id[u]) < 0)
+            HDONE_ERROR(H5E_DATASET, H5E_CANTDEC, FAIL, "can't decrement dataset ID ref count")
+        if(H5I_dec_ref(mem_type_id[u]) < 0)
+            HDONE_ERROR(H5E_DATASET, H5E_CANTDEC, FAIL, "can't decrement datatype ID ref count")
+        if(H5S_ALL != mem_space_id[u] && H5I_dec_ref(mem_space_id[u]) < 0)
+            HDONE_ERROR(H5E_DATASET, H5E_CANTDEC, FAIL, "can't decrement dataspace ID ref count")
+        if(H5S_ALL != file_space_id[u] && H5I_dec_ref(file_space_id[u]) < 0)
+            HDONE_ERROR(H5E_DATASET, H5E_CANTDEC, FAIL, "can't decrement dataspace ID ref count")
+    } /* end for */
+    if(H5P_DATASET_XFER_DEFAULT != dxpl_id && H5I_dec_ref(dxpl_id) < 0)
+        HDONE_ERROR(H5E_DATASET, H5E_CANTDEC, FAIL, "can't decrement property list ID ref count")
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__concurrent_read_release() */
+
 
 /*-------------------------------------------------------------------------
  * Function:    H5Dread_chunk
@@ -322,6 +640,101 @@ done:
     FUNC_LEAVE_API(ret_value)
 } /* end H5Dwrite() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Dwrite_multi
+ *
+ * Purpose:     Multi-version of H5Dwrite(), which writes selections from
+ *              application memory BUFS to multiple datasets in a file.
+ *              Each of the arrays has COUNT entries, and entry U
+ *              describes the same transfer as the corresponding arguments
+ *              of H5Dwrite() would.  All the datasets share the transfer
+ *              properties in DXPL_ID.
+ *
+ *              When every dataset is accessed through the native VOL
+ *              connector, the raw data I/O for the datasets is combined
+ *              where possible, instead of being issued one dataset at a
+ *              time.
+ *
+ *              The writes may be applied in any order, so the same
+ *              elements should not be written more than once in a call.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Dwrite_multi(size_t count, const hid_t dset_id[], const hid_t mem_type_id[],
+    const hid_t mem_space_id[], const hid_t file_space_id[], hid_t dxpl_id,
+    const void *buf[])
+{
+    H5VL_object_t  *vol_obj = NULL;         /* Dataset for the current entry */
+    H5VL_object_t  *first_vol_obj = NULL;   /* Dataset for the first entry */
+    hbool_t         is_native = TRUE;       /* Whether all datasets use the native connector */
+    size_t          u;                      /* Local index variable */
+    herr_t          ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE7("e", "z*i*i*i*ii**x", count, dset_id, mem_type_id, mem_space_id,
+             file_space_id, dxpl_id, buf);
+
+    /* Nothing to do */
+    if(0 == count)
+        HGOTO_DONE(SUCCEED)
+
+    /* Check arguments */
+    if(!dset_id)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "dset_id array not provided")
+    if(!mem_type_id)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "mem_type_id array not provided")
+    if(!mem_space_id)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "mem_space_id array not provided")
+    if(!file_space_id)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "file_space_id array not provided")
+    if(!buf)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "buf array not provided")
+    for(u = 0; u < count; u++) {
+        if(mem_space_id[u] < 0)
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "invalid memory dataspace ID")
+        if(file_space_id[u] < 0)
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "invalid file dataspace ID")
+
+        /* Get dataset pointer */
+        if(NULL == (vol_obj = (H5VL_object_t *)H5I_object_verify(dset_id[u], H5I_DATASET)))
+            HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "dset_id is not a dataset ID")
+        if(vol_obj->connector->cls->value != H5_VOL_NATIVE)
+            is_native = FALSE;
+        if(0 == u)
+            first_vol_obj = vol_obj;
+    } /* end for */
+
+    /* Get the default dataset transfer property list if the user didn't provide one */
+    if(H5P_DEFAULT == dxpl_id)
+        dxpl_id = H5P_DATASET_XFER_DEFAULT;
+    else
+        if(TRUE != H5P_isa_class(dxpl_id, H5P_DATASET_XFER))
+            HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not xfer parms")
+
+    /* Set DXPL for operation */
+    H5CX_set_dxpl(dxpl_id);
+
+    /* Write the data */
+    if(is_native) {
+        if(H5VL_dataset_optional(first_vol_obj, dxpl_id, H5_REQUEST_NULL, H5VL_NATIVE_DATASET_WRITE_MULTI, count, dset_id, mem_type_id, mem_space_id, file_space_id, buf) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "can't write data")
+    } /* end if */
+    else
+        /* Other connectors get one write per dataset */
+        for(u = 0; u < count; u++) {
+            vol_obj = (H5VL_object_t *)H5I_object(dset_id[u]);
+            if(H5VL_dataset_write(vol_obj, mem_type_id[u], mem_space_id[u], file_space_id[u], dxpl_id, buf[u], H5_REQUEST_NULL) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "can't write data")
+        } /* end for */
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Dwrite_multi() */
+
 
 /*-------------------------------------------------------------------------
  * Function:    H5Dwrite_chunk
@@ -419,6 +832,7 @@ H5D__read(H5D_t *dataset, hid_t mem_type_id, const H5S_t *mem_space,
     hsize_t	nelmts;                 /*total number of elmts	*/
     hbool_t     io_op_init = FALSE;     /* Whether the I/O op has been initialized */
     char        fake_char;              /* Temporary variable for NULL buffer pointers */
+    H5F_prof_t *prev_prof;              /* Profiling counters in the API context on entry */
     herr_t	ret_value = SUCCEED;	/* Return value	*/
 
     FUNC_ENTER_PACKAGE_TAG(dataset->oloc.addr)
@@ -426,6 +840,14 @@ H5D__read(H5D_t *dataset, hid_t mem_type_id, const H5S_t *mem_space,
     /* check args */
     HDassert(dataset && dataset->oloc.file);
 
+    /* Let filters, datatype conversions and selection iterators count
+     * against this file, if it's being profiled.  (Virtual datasets read
+     * from other files underneath, so keep the caller's counters to put
+     * back.)
+     */
+    prev_prof = H5CX_get_prof();
+    H5CX_set_prof(H5F_get_prof(dataset->oloc.file));
+
     if(!file_space)
         file_space = dataset->shared->space;
     if(!mem_space)
@@ -590,6 +1012,9 @@ done:
         if(H5S_close(projected_mem_space) < 0)
             HDONE_ERROR(H5E_DATASET, H5E_CANTCLOSEOBJ, FAIL, "unable to shut down projected memory dataspace")
 
+    /* Put back the caller's profiling counters */
+    H5CX_set_prof(prev_prof);
+
     FUNC_LEAVE_NOAPI_TAG(ret_value)
 } /* end H5D__read() */
 
@@ -633,6 +1058,7 @@ H5D__write(H5D_t *dataset, hid_t mem_type_id, const H5S_t *mem_space,
     hsize_t	nelmts;                 /*total number of elmts	*/
     hbool_t     io_op_init = FALSE;     /* Whether the I/O op has been initialized */
     char        fake_char;              /* Temporary variable for NULL buffer pointers */
+    H5F_prof_t *prev_prof;              /* Profiling counters in the API context on entry */
     herr_t	ret_value = SUCCEED;	/* Return value	*/
 
     FUNC_ENTER_PACKAGE_TAG(dataset->oloc.addr)
@@ -640,6 +1066,14 @@ H5D__write(H5D_t *dataset, hid_t mem_type_id, const H5S_t *mem_space,
     /* check args */
     HDassert(dataset && dataset->oloc.file);
 
+    /* Let filters, datatype conversions and selection iterators count
+     * against this file, if it's being profiled.  (Virtual datasets read
+     * from other files underneath, so keep the caller's counters to put
+     * back.)
+     */
+    prev_prof = H5CX_get_prof();
+    H5CX_set_prof(H5F_get_prof(dataset->oloc.file));
+
     /* All filters in the DCPL must have encoding enabled. */
     if(!dataset->shared->checked_filters) {
         if(H5Z_can_apply(dataset->shared->dcpl_id, dataset->shared->type_id) < 0)
@@ -825,9 +1259,450 @@ done:
         if(H5S_close(projected_mem_space) < 0)
             HDONE_ERROR(H5E_DATASET, H5E_CANTCLOSEOBJ, FAIL, "unable to shut down projected memory dataspace")
 
+    /* Put back the caller's profiling counters */
+    H5CX_set_prof(prev_prof);
+
     FUNC_LEAVE_NOAPI_TAG(ret_value)
 } /* end H5D__write() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__read_multi
+ *
+ * Purpose:	Reads (part of) COUNT datasets from a file into application
+ *		memory.  See H5Dread_multi() for complete details.
+ *
+ *		Datasets whose transfer is a single run of bytes in a
+ *		contiguous dataset without type conversion are read
+ *		together, with adjacent runs in the file combined into one
+ *		read.  Every other dataset is read with H5D__read().
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5D__read_multi(size_t count, H5D_t *dset[], const hid_t mem_type_id[],
+    const H5S_t *mem_space[], const H5S_t *file_space[], void *buf[]/*out*/)
+{
+    H5D_multi_piece_t *piece = NULL;    /* Pieces read together */
+    hbool_t *done_io = NULL;            /* Whether each dataset was read with the pieces */
+    size_t npieces = 0;                 /* Number of pieces */
+    size_t u;                           /* Local index variable */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Check args */
+    HDassert(count > 0);
+    HDassert(dset && mem_type_id && mem_space && file_space && buf);
+
+    /* Allocate space for the pieces */
+    if(NULL == (piece = (H5D_multi_piece_t *)H5MM_malloc(count * sizeof(H5D_multi_piece_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for I/O pieces")
+    if(NULL == (done_io = (hbool_t *)H5MM_calloc(count * sizeof(hbool_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for I/O flags")
+
+    /* Collect the datasets that can be read as a single run of bytes */
+    for(u = 0; u < count; u++) {
+        hsize_t mem_off;        /* Offset of the piece in the buffer */
+        htri_t is_piece;        /* Whether the dataset's transfer is a piece */
+
+        if(NULL == buf[u])
+            continue;
+        if((is_piece = H5D__multi_piece_init(dset[u], mem_type_id[u], mem_space[u], file_space[u], FALSE, &piece[npieces], &mem_off)) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "unable to set up I/O piece")
+        if(is_piece) {
+            piece[npieces].idx = u;
+            piece[npieces].u.rbuf = (uint8_t *)buf[u] + mem_off;
+            done_io[u] = TRUE;
+            npieces++;
+        } /* end if */
+    } /* end for */
+
+    /* Read the pieces */
+    if(npieces > 0 && H5D__multi_contig_io(H5D_IO_OP_READ, npieces, piece) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "can't read data")
+
+    /* Read the other datasets one at a time */
+    for(u = 0; u < count; u++)
+        if(!done_io[u])
+            if(H5D__read(dset[u], mem_type_id[u], mem_space[u], file_space[u], buf[u]) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "can't read data")
+
+done:
+    H5MM_xfree(piece);
+    H5MM_xfree(done_io);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__read_multi() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__write_multi
+ *
+ * Purpose:	Writes (part of) COUNT datasets to a file from application
+ *		memory.  See H5Dwrite_multi() for complete details.
+ *
+ *		Datasets are grouped the same way as in H5D__read_multi().
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5D__write_multi(size_t count, H5D_t *dset[], const hid_t mem_type_id[],
+    const H5S_t *mem_space[], const H5S_t *file_space[], const void *buf[])
+{
+    H5D_multi_piece_t *piece = NULL;    /* Pieces written together */
+    hbool_t *done_io = NULL;            /* Whether each dataset was written with the pieces */
+    size_t npieces = 0;                 /* Number of pieces */
+    size_t u;                           /* Local index variable */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Check args */
+    HDassert(count > 0);
+    HDassert(dset && mem_type_id && mem_space && file_space && buf);
+
+    /* Allocate space for the pieces */
+    if(NULL == (piece = (H5D_multi_piece_t *)H5MM_malloc(count * sizeof(H5D_multi_piece_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for I/O pieces")
+    if(NULL == (done_io = (hbool_t *)H5MM_calloc(count * sizeof(hbool_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for I/O flags")
+
+    /* Collect the datasets that can be written as a single run of bytes */
+    for(u = 0; u < count; u++) {
+        hsize_t mem_off;        /* Offset of the piece in the buffer */
+        htri_t is_piece;        /* Whether the dataset's transfer is a piece */
+
+        if(NULL == buf[u])
+            continue;
+        if((is_piece = H5D__multi_piece_init(dset[u], mem_type_id[u], mem_space[u], file_space[u], TRUE, &piece[npieces], &mem_off)) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "unable to set up I/O piece")
+        if(is_piece) {
+            piece[npieces].idx = u;
+            piece[npieces].u.wbuf = (const uint8_t *)buf[u] + mem_off;
+            done_io[u] = TRUE;
+            npieces++;
+        } /* end if */
+    } /* end for */
+
+    /* Write the pieces */
+    if(npieces > 0 && H5D__multi_contig_io(H5D_IO_OP_WRITE, npieces, piece) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "can't write data")
+
+    /* Write the other datasets one at a time */
+    for(u = 0; u < count; u++)
+        if(!done_io[u])
+            if(H5D__write(dset[u], mem_type_id[u], mem_space[u], file_space[u], buf[u]) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "can't write data")
+
+done:
+    H5MM_xfree(piece);
+    H5MM_xfree(done_io);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__write_multi() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__multi_sel_range
+ *
+ * Purpose:	Checks if the selection in SPACE is a single run of
+ *		elements and, if so, retrieves the offset and length of
+ *		the run in bytes.
+ *
+ * Return:	TRUE/FALSE/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static htri_t
+H5D__multi_sel_range(const H5S_t *space, size_t elmt_size, hsize_t *off,
+    size_t *len)
+{
+    H5S_sel_iter_t *iter = NULL;        /* Selection iterator */
+    hbool_t iter_init = FALSE;          /* Selection iteration info has been initialized */
+    hssize_t snelmts;                   /* Number of elements selected */
+    size_t nseq;                        /* Number of sequences retrieved */
+    size_t nelem;                       /* Number of elements retrieved */
+    htri_t ret_value = FALSE;           /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Check args */
+    HDassert(space);
+    HDassert(off);
+    HDassert(len);
+
+    /* Leave empty and scattered selections to the general code */
+    if((snelmts = H5S_GET_SELECT_NPOINTS(space)) <= 0)
+        HGOTO_DONE(FALSE)
+    if(TRUE != H5S_SELECT_IS_CONTIGUOUS(space))
+        HGOTO_DONE(FALSE)
+    if((hsize_t)snelmts > (hsize_t)(((size_t)-1) / elmt_size))
+        HGOTO_DONE(FALSE)
+
+    /* Get the single sequence for the selection */
+    if(NULL == (iter = H5FL_MALLOC(H5S_sel_iter_t)))
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "can't allocate selection iterator")
+    if(H5S_select_iter_init(iter, space, elmt_size, H5S_SEL_ITER_SHARE_WITH_DATASPACE) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "unable to initialize selection iterator")
+    iter_init = TRUE;
+    if(H5S_SELECT_ITER_GET_SEQ_LIST(iter, (size_t)1, (size_t)snelmts, &nseq, &nelem, off, len) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_UNSUPPORTED, FAIL, "sequence length generation failed")
+
+    ret_value = (htri_t)(1 == nseq && nelem == (size_t)snelmts);
+
+done:
+    if(iter_init && H5S_SELECT_ITER_RELEASE(iter) < 0)
+        HDONE_ERROR(H5E_DATASET, H5E_CANTRELEASE, FAIL, "unable to release selection iterator")
+    if(iter)
+        iter = H5FL_FREE(H5S_sel_iter_t, iter);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__multi_sel_range() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__multi_piece_init
+ *
+ * Purpose:	Checks if a dataset's part of a multi-dataset transfer can
+ *		be done as a single run of bytes, i.e. the dataset is
+ *		contiguous with its storage allocated, no type conversion
+ *		or data transform is needed, and both selections are one
+ *		run of elements.  If so, fills in the file location of the
+ *		piece and the offset of the piece in the application
+ *		buffer.
+ *
+ *		Anything the general I/O path would report an error for is
+ *		left to the general path, so the errors stay the same.
+ *
+ * Return:	TRUE/FALSE/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static htri_t
+H5D__multi_piece_init(H5D_t *dset, hid_t mem_type_id, const H5S_t *mem_space,
+    const H5S_t *file_space, hbool_t do_write, H5D_multi_piece_t *piece,
+    hsize_t *mem_off)
+{
+    H5D_type_info_t type_info;          /* Datatype info for operation */
+    hbool_t type_info_init = FALSE;     /* Whether the datatype info has been initialized */
+    hsize_t file_off;                   /* Offset of the selection in the dataset */
+    size_t file_len;                    /* Length of the selection in the dataset */
+    size_t mem_len;                     /* Length of the selection in memory */
+    htri_t is_range;                    /* Whether a selection is a single run */
+    htri_t ret_value = FALSE;           /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Check args */
+    HDassert(dset && dset->oloc.file);
+    HDassert(piece);
+    HDassert(mem_off);
+
+    /* Only allocated, contiguous storage in the file itself */
+    if(H5D_CONTIGUOUS != dset->shared->layout.type || dset->shared->dcpl_cache.efl.nused > 0 ||
+            !(*dset->shared->layout.ops->is_space_alloc)(&dset->shared->layout.storage))
+        HGOTO_DONE(FALSE)
+#ifdef H5_HAVE_PARALLEL
+    /* Leave MPI-based I/O to the dataset's own parallel I/O routines */
+    if(H5F_HAS_FEATURE(dset->oloc.file, H5FD_FEAT_HAS_MPI))
+        HGOTO_DONE(FALSE)
+    else {
+        H5FD_mpio_xfer_t io_xfer_mode;      /* MPI I/O transfer mode */
+
+        /* Get I/O transfer mode */
+        if(H5CX_get_io_xfer_mode(&io_xfer_mode) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get MPI-I/O transfer mode")
+        if(io_xfer_mode == H5FD_MPIO_COLLECTIVE)
+            HGOTO_DONE(FALSE)
+    } /* end else */
+#endif /*H5_HAVE_PARALLEL*/
+    if(do_write && 0 == (H5F_INTENT(dset->oloc.file) & H5F_ACC_RDWR))
+        HGOTO_DONE(FALSE)
+
+    /* Only transfers without type conversion or data transform */
+    if(H5D__typeinfo_init(dset, mem_type_id, do_write, &type_info) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "unable to set up type info")
+    type_info_init = TRUE;
+    if(!type_info.is_conv_noop || !type_info.is_xform_noop)
+        HGOTO_DONE(FALSE)
+
+    /* Only selections that are a single run of the same length */
+    /* (the element size is the same in the file and in memory without conversion) */
+    if(!file_space)
+        file_space = dset->shared->space;
+    if(!mem_space)
+        mem_space = file_space;
+    if((is_range = H5D__multi_sel_range(file_space, type_info.src_type_size, &file_off, &file_len)) <= 0)
+        HGOTO_DONE(is_range)
+    if((is_range = H5D__multi_sel_range(mem_space, type_info.src_type_size, mem_off, &mem_len)) <= 0)
+        HGOTO_DONE(is_range)
+    if(file_len != mem_len || file_off + file_len > dset->shared->layout.storage.u.contig.size)
+        HGOTO_DONE(FALSE)
+
+    /* Set up the piece */
+    piece->dset = dset;
+    piece->addr = dset->shared->layout.storage.u.contig.addr + file_off;
+    piece->len = file_len;
+    ret_value = TRUE;
+
+done:
+    /* Shut down datatype info for operation */
+    if(type_info_init && H5D__typeinfo_term(&type_info) < 0)
+        HDONE_ERROR(H5E_DATASET, H5E_CANTCLOSEOBJ, FAIL, "unable to shut down type info")
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__multi_piece_init() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__multi_piece_cmp
+ *
+ * Purpose:	Compares two pieces of a multi-dataset transfer by file
+ *		address, for HDqsort.  Pieces at the same address keep the
+ *		order the application gave them in.
+ *
+ * Return:	-1, 0, 1
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5D__multi_piece_cmp(const void *_piece1, const void *_piece2)
+{
+    const H5D_multi_piece_t *piece1 = (const H5D_multi_piece_t *)_piece1;
+    const H5D_multi_piece_t *piece2 = (const H5D_multi_piece_t *)_piece2;
+    int ret_value = 0;                  /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    if(H5F_addr_lt(piece1->addr, piece2->addr))
+        ret_value = -1;
+    else if(H5F_addr_gt(piece1->addr, piece2->addr))
+        ret_value = 1;
+    else
+        ret_value = (piece1->idx > piece2->idx) - (piece1->idx < piece2->idx);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__multi_piece_cmp() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__multi_contig_io
+ *
+ * Purpose:	Transfers the pieces of a multi-dataset transfer in file
+ *		address order.  Pieces in the same file that follow each
+ *		other without a gap are transferred with one block I/O
+ *		call through a temporary buffer, up to the file's sieve
+ *		buffer size.
+ *
+ *		Any dirty sieve buffers of the datasets are flushed first,
+ *		and a write drops sieve buffers that overlap the data it
+ *		wrote.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__multi_contig_io(H5D_io_op_type_t op_type, size_t npieces,
+    H5D_multi_piece_t *piece)
+{
+    uint8_t *io_buf = NULL;             /* Buffer for combined pieces */
+    size_t io_buf_size = 0;             /* Size of buffer for combined pieces */
+    size_t u, v;                        /* Local index variables */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Check args */
+    HDassert(npieces > 0);
+    HDassert(piece);
+
+    /* Make the file current with respect to the datasets' sieve buffers */
+    for(u = 0; u < npieces; u++)
+        if(H5D__flush_sieve_buf(piece[u].dset) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTFLUSH, FAIL, "unable to flush sieve buffer")
+
+    /* Put the pieces in file address order */
+    if(npieces > 1)
+        HDqsort(piece, npieces, sizeof(H5D_multi_piece_t), H5D__multi_piece_cmp);
+
+    for(u = 0; u < npieces; u = v) {
+        H5F_t *f = piece[u].dset->oloc.file;    /* File for the pieces */
+        size_t max_len = H5F_SIEVE_BUF_SIZE(f); /* Largest combined transfer */
+        size_t len = piece[u].len;              /* Length of the combined pieces */
+
+        /* Find the pieces that follow on from this one */
+        for(v = u + 1; v < npieces; v++) {
+            if(!H5F_SAME_SHARED(f, piece[v].dset->oloc.file))
+                break;
+            if(!H5F_addr_eq(piece[u].addr + len, piece[v].addr))
+                break;
+            if(len + piece[v].len > max_len)
+                break;
+            len += piece[v].len;
+        } /* end for */
+
+        if(v == u + 1) {
+            /* A single piece goes straight to or from the application's buffer */
+            if(H5D_IO_OP_READ == op_type) {
+                if(H5F_block_read_direct(f, piece[u].addr, piece[u].len, piece[u].u.rbuf) < 0)
+                    HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "block read failed")
+            } /* end if */
+            else
+                if(H5F_block_write(f, H5FD_MEM_DRAW, piece[u].addr, piece[u].len, piece[u].u.wbuf) < 0)
+                    HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "block write failed")
+        } /* end if */
+        else {
+            size_t w;                   /* Local index variable */
+            uint8_t *p;                 /* Pointer into the buffer */
+
+            /* Make sure the buffer is large enough */
+            if(len > io_buf_size) {
+                if(NULL == (io_buf = H5FL_BLK_REALLOC(multi_io, io_buf, len)))
+                    HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for I/O buffer")
+                io_buf_size = len;
+            } /* end if */
+
+            if(H5D_IO_OP_READ == op_type) {
+                if(H5F_block_read_direct(f, piece[u].addr, len, io_buf) < 0)
+                    HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "block read failed")
+                for(w = u, p = io_buf; w < v; p += piece[w].len, w++)
+                    H5MM_memcpy(piece[w].u.rbuf, p, piece[w].len);
+            } /* end if */
+            else {
+                for(w = u, p = io_buf; w < v; p += piece[w].len, w++)
+                    H5MM_memcpy(p, piece[w].u.wbuf, piece[w].len);
+                if(H5F_block_write(f, H5FD_MEM_DRAW, piece[u].addr, len, io_buf) < 0)
+                    HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "block write failed")
+            } /* end else */
+        } /* end else */
+    } /* end for */
+
+    /* Drop sieve buffers that hold data which was just written */
+    if(H5D_IO_OP_WRITE == op_type)
+        for(u = 0; u < npieces; u++) {
+            H5D_rdcdc_t *contig = &piece[u].dset->shared->cache.contig;
+
+            if(contig->sieve_buf && H5F_addr_defined(contig->sieve_loc) &&
+                    H5F_addr_lt(piece[u].addr, contig->sieve_loc + contig->sieve_size) &&
+                    H5F_addr_lt(contig->sieve_loc, piece[u].addr + piece[u].len)) {
+                contig->sieve_loc = HADDR_UNDEF;
+                contig->sieve_size = 0;
+            } /* end if */
+        } /* end for */
+
+done:
+    if(io_buf)
+        io_buf = H5FL_BLK_FREE(multi_io, io_buf);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__multi_contig_io() */
+
 
 /*-------------------------------------------------------------------------
  * Function:	H5D__ioinfo_init
@@ -1043,6 +1918,11 @@ H5D__typeinfo_init(const H5D_t *dset, hid_t mem_type_id, hbool_t do_write,
                 HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for type conversion")
             type_info->tconv_buf_allocated = TRUE;
         } /* end if */
+        else
+            /* The application's buffer could be in use by other threads, so
+             * don't read into it without the API lock
+             */
+            H5CX_set_concurrent_read(FALSE);
         if(type_info->need_bkg && NULL == (type_info->bkg_buf = (uint8_t *)bkgr_buf)) {
             size_t	bkg_size;		/* Desired background buffer size	*/
 
@@ -357,6 +357,16 @@ typedef struct H5D_chunk_map_t {
     H5S_t  *single_space;       /* Dataspace for single chunk */
     H5D_chunk_info_t *single_chunk_info;  /* Pointer to single chunk's info */
     hbool_t use_single;         /* Whether I/O is on a single element */
+    hbool_t own_scratch;        /* Whether the skip list & single chunk info belong to this map, rather than the dataset */
+
+    /* Chunk selections computed as they are needed, for regular selections */
+    /* (uses the 'single' chunk info & dataspace, and 'mchunk_tmpl' for the
+     *  memory dataspace when more than one chunk is selected)
+     */
+    hbool_t use_stream;         /* Whether chunk selections are computed as they are needed */
+    H5S_hyper_dim_t stream_sel[H5O_LAYOUT_NDIMS];   /* Regular selection in file dataspace */
+    hsize_t stream_mem_start[H5O_LAYOUT_NDIMS];     /* Start of selection in memory dataspace */
+    hsize_t stream_first[H5O_LAYOUT_NDIMS];         /* Scaled coordinates of first chunk selected */
 
     hsize_t last_index;         /* Index of last chunk operated on */
     H5D_chunk_info_t *last_chunk_info;  /* Pointer to last chunk's info */
@@ -545,6 +555,10 @@ H5_DLLVAR const H5D_chunk_ops_t H5D_COPS_BT2[1];
 H5_DLLVAR const H5B2_class_t H5D_BT2[1];
 H5_DLLVAR const H5B2_class_t H5D_BT2_FILT[1];
 
+/* Computing the chunk selections of regular selections as they are needed */
+H5_DLLVAR hbool_t H5D_chunk_stream_g;
+H5_DLLVAR unsigned H5D_chunk_nstreams_g;
+
 /*  Array of versions for Layout */
 H5_DLLVAR const unsigned H5O_layout_ver_bounds[H5F_LIBVER_NBOUNDS];
 
@@ -584,6 +598,12 @@ H5_DLL herr_t H5D__read(H5D_t *dataset, hid_t mem_type_id,
     const H5S_t *mem_space, const H5S_t *file_space, void *buf/*out*/);
 H5_DLL herr_t H5D__write(H5D_t *dataset, hid_t mem_type_id,
     const H5S_t *mem_space, const H5S_t *file_space, const void *buf);
+H5_DLL herr_t H5D__read_multi(size_t count, H5D_t *dset[],
+    const hid_t mem_type_id[], const H5S_t *mem_space[],
+    const H5S_t *file_space[], void *buf[]/*out*/);
+H5_DLL herr_t H5D__write_multi(size_t count, H5D_t *dset[],
+    const hid_t mem_type_id[], const H5S_t *mem_space[],
+    const H5S_t *file_space[], const void *buf[]);
 
 /* Functions that perform direct serial I/O operations */
 H5_DLL herr_t H5D__select_read(const H5D_io_info_t *io_info,
@@ -644,6 +664,10 @@ H5_DLL hbool_t H5D__chunk_is_data_cached(const H5D_shared_t *shared_dset);
 H5_DLL herr_t H5D__chunk_lookup(const H5D_t *dset, const hsize_t *scaled,
     H5D_chunk_ud_t *udata);
 H5_DLL herr_t H5D__chunk_allocated(const H5D_t *dset, hsize_t *nbytes);
+H5_DLL herr_t H5D__chunk_iterate_blocks(const H5D_t *dset, H5D_raw_block_op_t op,
+    void *op_data);
+H5_DLL herr_t H5D__chunk_relocate(const H5D_t *dset, const hsize_t *scaled,
+    haddr_t new_addr);
 H5_DLL herr_t H5D__chunk_allocate(const H5D_io_info_t *io_info, hbool_t full_overwrite, hsize_t old_dim[]);
 H5_DLL herr_t H5D__chunk_file_alloc(const H5D_chk_idx_info_t *idx_info, const H5F_block_t *old_chunk,
     H5F_block_t *new_chunk, hbool_t *need_insert, const hsize_t *scaled);
@@ -758,6 +782,7 @@ H5_DLL herr_t H5D__layout_compact_dirty_test(hid_t did, hbool_t *dirty);
 H5_DLL herr_t H5D__layout_idx_type_test(hid_t did, H5D_chunk_index_t *idx_type);
 H5_DLL herr_t H5D__layout_type_test(hid_t did, H5D_layout_t *layout_type);
 H5_DLL herr_t H5D__current_cache_size_test(hid_t did, size_t *nbytes_used, int *nused);
+H5_DLL herr_t H5D__chunk_stream_test(hbool_t enable, unsigned *nstreams);
 #endif /* H5D_TESTING */
 
 #endif /*_H5Dpkg_H*/
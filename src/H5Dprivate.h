@@ -67,6 +67,7 @@
 #define H5D_XFER_VLEN_ALLOC_INFO_NAME   "vlen_alloc_info" /* Vlen allocation info */
 #define H5D_XFER_VLEN_FREE_NAME         "vlen_free"     /* Vlen free function */
 #define H5D_XFER_VLEN_FREE_INFO_NAME    "vlen_free_info" /* Vlen free info */
+#define H5D_XFER_VLEN_ARENA_NAME        "vlen_arena"    /* Vlen arena buffer */
 #define H5D_XFER_VFL_ID_NAME            "vfl_id"        /* File driver ID */
 #define H5D_XFER_VFL_INFO_NAME          "vfl_info"      /* File driver info */
 #define H5D_XFER_HYPER_VECTOR_SIZE_NAME "vec_size"      /* Hyperslab vector size */
@@ -149,6 +150,11 @@ typedef struct H5D_append_flush_t {
     void *udata;            /* User data */
 } H5D_append_flush_t;
 
+/* Callback for iterating over the blocks of raw data a dataset has in the file */
+/* (SCALED is the chunk's scaled offset, or NULL for contiguous storage) */
+typedef herr_t (*H5D_raw_block_op_t)(haddr_t addr, hsize_t size,
+    const hsize_t *scaled, void *op_data);
+
 
 /*****************************/
 /* Library Private Variables */
@@ -169,6 +175,10 @@ H5_DLL H5G_name_t *H5D_nameof(const H5D_t *dataset);
 H5_DLL herr_t H5D_flush_all(H5F_t *f);
 H5_DLL hid_t H5D_get_create_plist(const H5D_t *dset);
 H5_DLL hid_t H5D_get_access_plist(const H5D_t *dset);
+H5_DLL herr_t H5D_raw_block_iterate(const H5D_t *dset, H5D_raw_block_op_t op,
+    void *op_data);
+H5_DLL herr_t H5D_raw_block_relocate(H5D_t *dset, const hsize_t *scaled,
+    haddr_t new_addr);
 
 /* Functions that operate on vlen data */
 H5_DLL herr_t H5D_vlen_reclaim(hid_t type_id, H5S_t *space, void *buf);
@@ -147,6 +147,12 @@ H5_DLL herr_t H5Dread(hid_t dset_id, hid_t mem_type_id, hid_t mem_space_id,
 			hid_t file_space_id, hid_t plist_id, void *buf/*out*/);
 H5_DLL herr_t H5Dwrite(hid_t dset_id, hid_t mem_type_id, hid_t mem_space_id,
 			 hid_t file_space_id, hid_t plist_id, const void *buf);
+H5_DLL herr_t H5Dread_multi(size_t count, const hid_t dset_id[],
+            const hid_t mem_type_id[], const hid_t mem_space_id[],
+            const hid_t file_space_id[], hid_t dxpl_id, void *buf[]/*out*/);
+H5_DLL herr_t H5Dwrite_multi(size_t count, const hid_t dset_id[],
+            const hid_t mem_type_id[], const hid_t mem_space_id[],
+            const hid_t file_space_id[], hid_t dxpl_id, const void *buf[]);
 H5_DLL herr_t H5Dwrite_chunk(hid_t dset_id, hid_t dxpl_id, uint32_t filters, 
             const hsize_t *offset, size_t data_size, const void *buf);
 H5_DLL herr_t H5Dread_chunk(hid_t dset_id, hid_t dxpl_id,
@@ -34,6 +34,9 @@
 /* Local Macros */
 /****************/
 
+/* Number of strided runs to generate at a time for memory selections */
+#define H5D_IO_RUN_SIZE         64
+
 
 /******************/
 /* Local Typedefs */
@@ -306,6 +309,37 @@ H5D__scatter_mem(const void *_tscat_buf, H5S_sel_iter_t *iter, size_t nelmts,
     HDassert(nelmts > 0);
     HDassert(buf);
 
+    /* Use strided runs, when the selection can be described with them */
+    while(nelmts > 0) {
+        H5S_sel_run_t run[H5D_IO_RUN_SIZE];    /* Strided runs of sequences */
+        size_t nrun;                /* Number of runs generated */
+        size_t curr_run;            /* Current run being processed */
+        htri_t have_runs;           /* Whether runs were generated */
+
+        if((have_runs = H5S_select_iter_get_run_list(iter, (size_t)H5D_IO_RUN_SIZE, nelmts, &nrun, &nelem, run)) < 0)
+            HGOTO_ERROR(H5E_INTERNAL, H5E_UNSUPPORTED, FAIL, "run list generation failed")
+        if(!have_runs)
+            break;
+
+        /* Loop, while runs left to process */
+        for(curr_run = 0; curr_run < nrun; curr_run++) {
+            uint8_t *dst = buf + run[curr_run].off;
+            size_t u;
+
+            curr_len = run[curr_run].len;
+            for(u = 0; u < run[curr_run].count; u++) {
+                H5MM_memcpy(dst, tscat_buf, curr_len);
+                dst += run[curr_run].stride;
+                tscat_buf += curr_len;
+            } /* end for */
+        } /* end for */
+
+        /* Decrement number of elements left to process */
+        nelmts -= nelem;
+    } /* end while */
+    if(0 == nelmts)
+        HGOTO_DONE(SUCCEED)
+
     /* Get info from API context */
     if(H5CX_get_vec_size(&dxpl_vec_size) < 0)
         HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't retrieve I/O vector size")
@@ -393,6 +427,37 @@ H5D__gather_mem(const void *_buf, H5S_sel_iter_t *iter, size_t nelmts,
     HDassert(nelmts > 0);
     HDassert(tgath_buf);
 
+    /* Use strided runs, when the selection can be described with them */
+    while(nelmts > 0) {
+        H5S_sel_run_t run[H5D_IO_RUN_SIZE];    /* Strided runs of sequences */
+        size_t nrun;                /* Number of runs generated */
+        size_t curr_run;            /* Current run being processed */
+        htri_t have_runs;           /* Whether runs were generated */
+
+        if((have_runs = H5S_select_iter_get_run_list(iter, (size_t)H5D_IO_RUN_SIZE, nelmts, &nrun, &nelem, run)) < 0)
+            HGOTO_ERROR(H5E_INTERNAL, H5E_UNSUPPORTED, 0, "run list generation failed")
+        if(!have_runs)
+            break;
+
+        /* Loop, while runs left to process */
+        for(curr_run = 0; curr_run < nrun; curr_run++) {
+            const uint8_t *src = buf + run[curr_run].off;
+            size_t u;
+
+            curr_len = run[curr_run].len;
+            for(u = 0; u < run[curr_run].count; u++) {
+                H5MM_memcpy(tgath_buf, src, curr_len);
+                src += run[curr_run].stride;
+                tgath_buf += curr_len;
+            } /* end for */
+        } /* end for */
+
+        /* Decrement number of elements left to process */
+        nelmts -= nelem;
+    } /* end while */
+    if(0 == nelmts)
+        HGOTO_DONE(ret_value)
+
     /* Get info from API context */
     if(H5CX_get_vec_size(&dxpl_vec_size) < 0)
         HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, 0, "can't retrieve I/O vector size")
@@ -744,7 +809,9 @@ done:
  *                                                 TYPE5 E;
  *                                             };
  *              The optimization is simply moving data to the appropriate
- *              places in the buffer.
+ *              places in the buffer.  When the members that are copied
+ *              are reordered, moved or nested, the runs of bytes in the
+ *              conversion's copy plan are copied instead.
  *
  * Return:	Non-negative on success/Negative on failure
  *
@@ -774,7 +841,8 @@ H5D__compound_opt_read(size_t nelmts, H5S_sel_iter_t *iter,
     HDassert(type_info);
     HDassert(type_info->cmpd_subset);
     HDassert(H5T_SUBSET_SRC == type_info->cmpd_subset->subset ||
-        H5T_SUBSET_DST == type_info->cmpd_subset->subset);
+        H5T_SUBSET_DST == type_info->cmpd_subset->subset ||
+        H5T_SUBSET_RUNS == type_info->cmpd_subset->subset);
     HDassert(user_buf);
 
     /* Get info from API context */
@@ -827,13 +895,28 @@ H5D__compound_opt_read(size_t nelmts, H5S_sel_iter_t *iter,
             xubuf = ubuf + curr_off;
 
             /* Copy the data into the right place. */
-            for(i = 0; i < curr_nelmts; i++) {
-                HDmemmove(xubuf, xdbuf, copy_size);
-
-                /* Update pointers */
-                xdbuf += src_stride;
-                xubuf += dst_stride;
-            } /* end for */
+            if(H5T_SUBSET_RUNS == type_info->cmpd_subset->subset) {
+                const H5T_subset_run_t *run = type_info->cmpd_subset->run;
+                size_t nruns = type_info->cmpd_subset->nruns;
+                size_t r;               /* Local index variable */
+
+                for(i = 0; i < curr_nelmts; i++) {
+                    for(r = 0; r < nruns; r++)
+                        H5MM_memcpy(xubuf + run[r].dst_off, xdbuf + run[r].src_off, run[r].len);
+
+                    /* Update pointers */
+                    xdbuf += src_stride;
+                    xubuf += dst_stride;
+                } /* end for */
+            } /* end if */
+            else
+                for(i = 0; i < curr_nelmts; i++) {
+                    HDmemmove(xubuf, xdbuf, copy_size);
+
+                    /* Update pointers */
+                    xdbuf += src_stride;
+                    xubuf += dst_stride;
+                } /* end for */
         } /* end for */
 
         /* Decrement number of elements left to process */
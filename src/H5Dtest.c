@@ -309,3 +309,39 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 }   /* H5D__current_cache_size_test() */
 
+
+/*--------------------------------------------------------------------------
+ NAME
+    H5D__chunk_stream_test
+ PURPOSE
+    Turn computing chunk selections as they are needed on or off
+ USAGE
+    herr_t H5D__chunk_stream_test(enable, nstreams)
+        hbool_t enable;         IN: Whether to compute chunk selections as needed
+        unsigned *nstreams;     OUT: Number of I/O operations which did so
+ RETURNS
+    Non-negative on success, negative on failure
+ DESCRIPTION
+    Chunked I/O on regular selections normally computes the selection in
+    each chunk as the chunk is reached.  When ENABLE is FALSE, the chunk
+    selections are built up front instead, as for other selections.  The
+    number of I/O operations which computed their chunk selections as
+    they were needed so far is returned in *NSTREAMS, if it's non-NULL.
+ GLOBAL VARIABLES
+ COMMENTS, BUGS, ASSUMPTIONS
+    DO NOT USE THIS FUNCTION FOR ANYTHING EXCEPT TESTING
+ EXAMPLES
+ REVISION LOG
+--------------------------------------------------------------------------*/
+herr_t
+H5D__chunk_stream_test(hbool_t enable, unsigned *nstreams)
+{
+    FUNC_ENTER_PACKAGE_NOERR
+
+    H5D_chunk_stream_g = enable;
+    if(nstreams)
+        *nstreams = H5D_chunk_nstreams_g;
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+}   /* H5D__chunk_stream_test() */
+
@@ -989,31 +989,10 @@ H5E__get_current_stack(void)
         HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, NULL, "memory allocation failed")
 
     /* Make a copy of current error stack */
-    estack_copy->nused = current_stack->nused;
     for(u = 0; u < current_stack->nused; u++) {
-        H5E_error2_t *current_error, *new_error; /* Pointers to errors on each stack */
-
-        /* Get pointers into the current error stack location */
-        current_error = &(current_stack->slot[u]);
-        new_error = &(estack_copy->slot[u]);
-
-        /* Increment the IDs to indicate that they are used in this stack */
-        if(H5I_inc_ref(current_error->cls_id, FALSE) < 0)
-            HGOTO_ERROR(H5E_ERROR, H5E_CANTINC, NULL, "unable to increment ref count on error class")
-        new_error->cls_id = current_error->cls_id;
-        if(H5I_inc_ref(current_error->maj_num, FALSE) < 0)
-            HGOTO_ERROR(H5E_ERROR, H5E_CANTINC, NULL, "unable to increment ref count on error message")
-        new_error->maj_num = current_error->maj_num;
-        if(H5I_inc_ref(current_error->min_num, FALSE) < 0)
-            HGOTO_ERROR(H5E_ERROR, H5E_CANTINC, NULL, "unable to increment ref count on error message")
-        new_error->min_num = current_error->min_num;
-        if(NULL == (new_error->func_name = H5MM_xstrdup(current_error->func_name)))
-            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, NULL, "memory allocation failed")
-        if(NULL == (new_error->file_name = H5MM_xstrdup(current_error->file_name)))
-            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, NULL, "memory allocation failed")
-        new_error->line = current_error->line;
-        if(NULL == (new_error->desc = H5MM_xstrdup(current_error->desc)))
-            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, NULL, "memory allocation failed")
+        if(H5E__copy_entry(&estack_copy->slot[u], &estack_copy->own[u], &current_stack->slot[u], current_stack->own[u]) < 0)
+            HGOTO_ERROR(H5E_ERROR, H5E_CANTCOPY, NULL, "can't copy error record")
+        estack_copy->nused++;
     } /* end for */
 
     /* Copy the "automatic" error reporting information */
@@ -1028,8 +1007,12 @@ H5E__get_current_stack(void)
 
 done:
     if(ret_value == NULL)
-        if(estack_copy)
+        if(estack_copy) {
+            /* Release the records copied so far */
+            if(H5E_clear_stack(estack_copy) < 0)
+                HDONE_ERROR(H5E_ERROR, H5E_CANTRELEASE, NULL, "can't clear error stack")
             estack_copy = H5FL_FREE(H5E_t, estack_copy);
+        } /* end if */
 
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5E__get_current_stack() */
@@ -1110,31 +1093,10 @@ H5E__set_current_stack(H5E_t *estack)
     H5E_clear_stack(current_stack);
 
     /* Copy new stack to current error stack */
-    current_stack->nused = estack->nused;
-    for(u = 0; u < current_stack->nused; u++) {
-        H5E_error2_t *current_error, *new_error; /* Pointers to errors on each stack */
-
-        /* Get pointers into the current error stack location */
-        current_error = &(current_stack->slot[u]);
-        new_error = &(estack->slot[u]);
-
-        /* Increment the IDs to indicate that they are used in this stack */
-        if(H5I_inc_ref(new_error->cls_id, FALSE) < 0)
-            HGOTO_ERROR(H5E_ERROR, H5E_CANTINC, FAIL, "unable to increment ref count on error class")
-        current_error->cls_id = new_error->cls_id;
-        if(H5I_inc_ref(new_error->maj_num, FALSE) < 0)
-            HGOTO_ERROR(H5E_ERROR, H5E_CANTINC, FAIL, "unable to increment ref count on error class")
-        current_error->maj_num = new_error->maj_num;
-        if(H5I_inc_ref(new_error->min_num, FALSE) < 0)
-            HGOTO_ERROR(H5E_ERROR, H5E_CANTINC, FAIL, "unable to increment ref count on error class")
-        current_error->min_num = new_error->min_num;
-        if(NULL == (current_error->func_name = H5MM_xstrdup(new_error->func_name)))
-            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed")
-        if(NULL == (current_error->file_name = H5MM_xstrdup(new_error->file_name)))
-            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed")
-        current_error->line = new_error->line;
-        if(NULL == (current_error->desc = H5MM_xstrdup(new_error->desc)))
-            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed")
+    for(u = 0; u < estack->nused; u++) {
+        if(H5E__copy_entry(&current_stack->slot[u], &current_stack->own[u], &estack->slot[u], estack->own[u]) < 0)
+            HGOTO_ERROR(H5E_ERROR, H5E_CANTCOPY, FAIL, "can't copy error record")
+        current_stack->nused++;
     } /* end for */
 
 done:
@@ -69,6 +69,9 @@ static herr_t H5E__walk1_cb(int n, H5E_error1_t *err_desc,
 #endif /* H5_NO_DEPRECATED_SYMBOLS */
 static herr_t H5E__walk2_cb(unsigned n, const H5E_error2_t *err_desc,
     void *client_data);
+static herr_t H5E__push_entry(H5E_t *estack, const char *file, const char *func,
+    unsigned line, hid_t cls_id, hid_t maj_id, hid_t min_id, const char *desc,
+    unsigned own);
 static herr_t H5E__clear_entries(H5E_t *estack, size_t nentries);
 
 
@@ -698,6 +701,25 @@ H5E_printf_stack(H5E_t *estack, const char *file, const char *func, unsigned lin
     HDassert(min_id > 0);
     HDassert(fmt);
 
+    /* Check for 'default' error stack */
+    if(estack == NULL)
+    	if(NULL == (estack = H5E__get_my_stack())) /*lint !e506 !e774 Make lint 'constant value Boolean' in non-threaded case */
+            HGOTO_DONE(FAIL)
+
+    /* Don't format a description for an error that won't fit on the stack */
+    if(estack->nused >= H5E_NSLOTS)
+        HGOTO_DONE(SUCCEED)
+
+    /* A description without any conversions is used as it is.  It, the
+     *  function name and the file name are all string constants in the
+     *  library, so the error record just points to them.
+     */
+    if(NULL == HDstrchr(fmt, '%')) {
+        if(H5E__push_entry(estack, file, func, line, cls_id, maj_id, min_id, fmt, 0) < 0)
+            HGOTO_DONE(FAIL)
+        HGOTO_DONE(SUCCEED)
+    } /* end if */
+
 /* Note that the variable-argument parsing for the format is identical in
  *      the H5Epush2() routine - correct errors and make changes in both
  *      places. -QAK
@@ -733,8 +755,8 @@ H5E_printf_stack(H5E_t *estack, const char *file, const char *func, unsigned lin
     } /* end while */
 #endif /* H5_HAVE_VASPRINTF */
 
-    /* Push the error on the stack */
-    if(H5E__push_stack(estack, file, func, line, cls_id, maj_id, min_id, tmp) < 0)
+    /* Push the error on the stack, with a copy of the formatted description */
+    if(H5E__push_entry(estack, file, func, line, cls_id, maj_id, min_id, tmp, H5E_OWN_DESC) < 0)
         HGOTO_DONE(FAIL)
 
 done:
@@ -763,10 +785,8 @@ done:
  *              MIN_ID, the name of a function where the error was detected,
  *              the name of the file where the error was detected, the
  *              line within that file, and an error description string.  The
- *              function name, file name, and error description strings must
- *              be statically allocated (the FUNC_ENTER() macro takes care of
- *              the function name and file name automatically, but the
- *              programmer is responsible for the description string).
+ *              function name, file name, and error description strings are
+ *              copied.
  *
  * Return:      SUCCEED/FAIL
  *
@@ -790,11 +810,6 @@ H5E__push_stack(H5E_t *estack, const char *file, const char *func, unsigned line
      */
     FUNC_ENTER_PACKAGE_NOERR
 
-    /* Sanity check */
-    HDassert(cls_id > 0);
-    HDassert(maj_id > 0);
-    HDassert(min_id > 0);
-
     /* Check for 'default' error stack */
     if(estack == NULL)
     	if(NULL == (estack = H5E__get_my_stack())) /*lint !e506 !e774 Make lint 'constant value Boolean' in non-threaded case */
@@ -811,37 +826,184 @@ H5E__push_stack(H5E_t *estack, const char *file, const char *func, unsigned line
     if(!desc)
         desc = "No description given";
 
+    /* Push the error, with copies of the strings */
+    if(H5E__push_entry(estack, file, func, line, cls_id, maj_id, min_id, desc, H5E_OWN_ALL) < 0)
+        HGOTO_DONE(FAIL)
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5E__push_stack() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5E__push_entry
+ *
+ * Purpose:     Pushes a new error record onto an error stack, if there's
+ *              room.  The strings named in OWN (H5E_OWN_*) are copied and
+ *              released with the record, the others must be string
+ *              constants.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5E__push_entry(H5E_t *estack, const char *file, const char *func, unsigned line,
+    hid_t cls_id, hid_t maj_id, hid_t min_id, const char *desc, unsigned own)
+{
+    H5E_error2_t *error;        /* Pointer to the new error record */
+    herr_t	ret_value = SUCCEED;      /* Return value */
+
     /*
-     * Push the error if there's room.  Otherwise just forget it.
+     * WARNING: We cannot call HERROR() from within this function or else we
+     *		could enter infinite recursion.  Furthermore, we also cannot
+     *		call any other HDF5 macro or function which might call
+     *		HERROR().  HERROR() is called by HRETURN_ERROR() which could
+     *		be called by FUNC_ENTER().
      */
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Sanity check */
     HDassert(estack);
+    HDassert(cls_id > 0);
+    HDassert(maj_id > 0);
+    HDassert(min_id > 0);
+    HDassert(file && func && desc);
 
+    /*
+     * Push the error if there's room.  Otherwise just forget it.
+     */
     if(estack->nused < H5E_NSLOTS) {
+        error = &estack->slot[estack->nused];
+
         /* Increment the IDs to indicate that they are used in this stack */
         if(H5I_inc_ref(cls_id, FALSE) < 0)
             HGOTO_DONE(FAIL)
-	estack->slot[estack->nused].cls_id = cls_id;
+	error->cls_id = cls_id;
         if(H5I_inc_ref(maj_id, FALSE) < 0)
             HGOTO_DONE(FAIL)
-	estack->slot[estack->nused].maj_num = maj_id;
+	error->maj_num = maj_id;
         if(H5I_inc_ref(min_id, FALSE) < 0)
             HGOTO_DONE(FAIL)
-	estack->slot[estack->nused].min_num = min_id;
-	if(NULL == (estack->slot[estack->nused].func_name = H5MM_xstrdup(func)))
-            HGOTO_DONE(FAIL)
-	if(NULL == (estack->slot[estack->nused].file_name = H5MM_xstrdup(file)))
-            HGOTO_DONE(FAIL)
-	estack->slot[estack->nused].line = line;
-	if(NULL == (estack->slot[estack->nused].desc = H5MM_xstrdup(desc)))
-            HGOTO_DONE(FAIL)
+	error->min_num = min_id;
+	error->line = line;
+
+        /* Set the strings, copying the ones the record will own */
+        if(own & H5E_OWN_FUNC) {
+            if(NULL == (error->func_name = H5MM_xstrdup(func)))
+                HGOTO_DONE(FAIL)
+        } /* end if */
+        else
+            error->func_name = func;
+        if(own & H5E_OWN_FILE) {
+            if(NULL == (error->file_name = H5MM_xstrdup(file)))
+                HGOTO_DONE(FAIL)
+        } /* end if */
+        else
+            error->file_name = file;
+        if(own & H5E_OWN_DESC) {
+            if(NULL == (error->desc = H5MM_xstrdup(desc)))
+                HGOTO_DONE(FAIL)
+        } /* end if */
+        else
+            error->desc = desc;
+        estack->own[estack->nused] = own;
+
 	estack->nused++;
     } /* end if */
 
 done:
     FUNC_LEAVE_NOAPI(ret_value)
-} /* end H5E__push_stack() */
+} /* end H5E__push_entry() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5E__copy_entry
+ *
+ * Purpose:     Copies an error record from one error stack to another.
+ *              The strings the source record owns are copied, and the
+ *              string constants are shared.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5E__copy_entry(H5E_error2_t *dst, unsigned *dst_own, const H5E_error2_t *src,
+    unsigned src_own)
+{
+    unsigned    nids = 0;                 /* Number of IDs whose ref counts were incremented */
+    herr_t	ret_value = SUCCEED;      /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Sanity check */
+    HDassert(dst);
+    HDassert(dst_own);
+    HDassert(src);
+
+    /* Don't release anything from the destination if this fails part way */
+    dst->func_name = dst->file_name = dst->desc = NULL;
+    *dst_own = src_own;
+
+    /* Increment the IDs to indicate that they are used in this stack */
+    if(H5I_inc_ref(src->cls_id, FALSE) < 0)
+        HGOTO_ERROR(H5E_ERROR, H5E_CANTINC, FAIL, "unable to increment ref count on error class")
+    dst->cls_id = src->cls_id;
+    nids++;
+    if(H5I_inc_ref(src->maj_num, FALSE) < 0)
+        HGOTO_ERROR(H5E_ERROR, H5E_CANTINC, FAIL, "unable to increment ref count on error message")
+    dst->maj_num = src->maj_num;
+    nids++;
+    if(H5I_inc_ref(src->min_num, FALSE) < 0)
+        HGOTO_ERROR(H5E_ERROR, H5E_CANTINC, FAIL, "unable to increment ref count on error message")
+    dst->min_num = src->min_num;
+    nids++;
+    dst->line = src->line;
+
+    /* Copy or share the strings */
+    if(src_own & H5E_OWN_FUNC) {
+        if(NULL == (dst->func_name = H5MM_xstrdup(src->func_name)))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed")
+    } /* end if */
+    else
+        dst->func_name = src->func_name;
+    if(src_own & H5E_OWN_FILE) {
+        if(NULL == (dst->file_name = H5MM_xstrdup(src->file_name)))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed")
+    } /* end if */
+    else
+        dst->file_name = src->file_name;
+    if(src_own & H5E_OWN_DESC) {
+        if(NULL == (dst->desc = H5MM_xstrdup(src->desc)))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed")
+    } /* end if */
+    else
+        dst->desc = src->desc;
+
+done:
+    /* Undo a partial copy */
+    if(ret_value < 0) {
+        if(nids > 2 && H5I_dec_ref(src->min_num) < 0)
+            HDONE_ERROR(H5E_ERROR, H5E_CANTDEC, FAIL, "unable to decrement ref count on error message")
+        if(nids > 1 && H5I_dec_ref(src->maj_num) < 0)
+            HDONE_ERROR(H5E_ERROR, H5E_CANTDEC, FAIL, "unable to decrement ref count on error message")
+        if(nids > 0 && H5I_dec_ref(src->cls_id) < 0)
+            HDONE_ERROR(H5E_ERROR, H5E_CANTDEC, FAIL, "unable to decrement ref count on error class")
+        if(src_own & H5E_OWN_FUNC)
+            H5MM_xfree((void *)dst->func_name);     /* Casting away const OK */
+        if(src_own & H5E_OWN_FILE)
+            H5MM_xfree((void *)dst->file_name);     /* Casting away const OK */
+        if(src_own & H5E_OWN_DESC)
+            H5MM_xfree((void *)dst->desc);          /* Casting away const OK */
+        dst->func_name = dst->file_name = dst->desc = NULL;
+        *dst_own = 0;
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5E__copy_entry() */
+
 
-
 /*-------------------------------------------------------------------------
  * Function:    H5E__clear_entries
  *
@@ -859,6 +1021,7 @@ static herr_t
 H5E__clear_entries(H5E_t *estack, size_t nentries)
 {
     H5E_error2_t *error;        /* Pointer to error stack entry to clear */
+    unsigned own;               /* Strings owned by the entry */
     unsigned u;                 /* Local index variable */
     herr_t ret_value = SUCCEED; /* Return value */
 
@@ -881,13 +1044,15 @@ H5E__clear_entries(H5E_t *estack, size_t nentries)
         if(H5I_dec_ref(error->cls_id) < 0)
             HGOTO_ERROR(H5E_ERROR, H5E_CANTDEC, FAIL, "unable to decrement ref count on error class")
 
-        /* Release strings */
-        if(error->func_name)
-            error->func_name = (const char *) H5MM_xfree((void *)error->func_name);        /* Casting away const OK - QAK */
-        if(error->file_name)
-            error->file_name = (const char *) H5MM_xfree((void *)error->file_name);        /* Casting away const OK - QAK */
-        if(error->desc)
-            error->desc = (const char *) H5MM_xfree((void *)error->desc);     /* Casting away const OK - QAK */
+        /* Release the strings the record owns */
+        own = estack->own[estack->nused - (u + 1)];
+        if(error->func_name && (own & H5E_OWN_FUNC))
+            H5MM_xfree((void *)error->func_name);        /* Casting away const OK - QAK */
+        if(error->file_name && (own & H5E_OWN_FILE))
+            H5MM_xfree((void *)error->file_name);        /* Casting away const OK - QAK */
+        if(error->desc && (own & H5E_OWN_DESC))
+            H5MM_xfree((void *)error->desc);     /* Casting away const OK - QAK */
+        error->func_name = error->file_name = error->desc = NULL;
     } /* end for */
 
     /* Decrement number of errors on stack */
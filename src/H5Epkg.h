@@ -42,6 +42,14 @@
 /* Number of slots in an error stack */
 #define H5E_NSLOTS	        32
 
+/* Which strings in an error record were copied for the stack, and are
+ * released with it (the others are string constants from the library)
+ */
+#define H5E_OWN_FUNC            0x01
+#define H5E_OWN_FILE            0x02
+#define H5E_OWN_DESC            0x04
+#define H5E_OWN_ALL             (H5E_OWN_FUNC | H5E_OWN_FILE | H5E_OWN_DESC)
+
 #ifdef H5_HAVE_THREADSAFE
 /*
  * The per-thread error stack. pthread_once() initializes a special
@@ -110,6 +118,7 @@ typedef struct H5E_msg_t {
 struct H5E_t {
     size_t nused;		        /* Num slots currently used in stack  */
     H5E_error2_t slot[H5E_NSLOTS];	/* Array of error records	     */
+    unsigned own[H5E_NSLOTS];           /* Strings owned by each record (H5E_OWN_*) */
     H5E_auto_op_t auto_op;              /* Operator for 'automatic' error reporting */
     void *auto_data;                    /* Callback data for 'automatic error reporting */
 };
@@ -136,6 +145,8 @@ H5_DLL H5E_t *H5E__get_stack(void);
 #endif /* H5_HAVE_THREADSAFE */
 H5_DLL herr_t H5E__push_stack(H5E_t *estack, const char *file, const char *func,
     unsigned line, hid_t cls_id, hid_t maj_id, hid_t min_id, const char *desc);
+H5_DLL herr_t H5E__copy_entry(H5E_error2_t *dst, unsigned *dst_own,
+    const H5E_error2_t *src, unsigned src_own);
 H5_DLL ssize_t H5E__get_msg(const H5E_msg_t *msg_ptr, H5E_type_t *type,
     char *msg, size_t size);
 H5_DLL herr_t H5E__print(const H5E_t *estack, FILE *stream, hbool_t bk_compat);
@@ -1833,6 +1833,256 @@ done:
     FUNC_LEAVE_API(ret_value)
 } /* H5Fget_page_buffering_stats() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Freset_metadata_accum_stats
+ *
+ * Purpose:     Resets statistics for the metadata accumulator.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Freset_metadata_accum_stats(hid_t file_id)
+{
+    H5VL_object_t  *vol_obj;                        /* File to reset stats on */
+    herr_t          ret_value = SUCCEED;            /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE1("e", "i", file_id);
+
+    /* Check args */
+    if(NULL == (vol_obj = (H5VL_object_t *)H5I_object_verify(file_id, H5I_FILE)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "invalid file identifier")
+
+    /* Reset the statistics */
+    if(H5VL_file_optional(vol_obj, H5P_DATASET_XFER_DEFAULT, H5_REQUEST_NULL, H5VL_NATIVE_FILE_RESET_ACCUM_STATS) < 0)
+        HGOTO_ERROR(H5E_FILE, H5E_CANTSET, FAIL, "can't reset stats for metadata accumulator")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+}   /* H5Freset_metadata_accum_stats() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Fget_metadata_accum_stats
+ *
+ * Purpose:     Retrieves hit/miss and region replacement statistics for
+ *              the metadata accumulator.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Fget_metadata_accum_stats(hid_t file_id, H5F_accum_stats_t *stats)
+{
+    H5VL_object_t   *vol_obj;                       /* File object */
+    herr_t          ret_value = SUCCEED;            /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "i*x", file_id, stats);
+
+    /* Check args */
+    if(!stats)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "no stats struct")
+    if(NULL == (vol_obj = (H5VL_object_t *)H5I_object_verify(file_id, H5I_FILE)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "not a file ID")
+
+    /* Get the statistics */
+    if(H5VL_file_optional(vol_obj, H5P_DATASET_XFER_DEFAULT, H5_REQUEST_NULL, H5VL_NATIVE_FILE_GET_ACCUM_STATS, stats) < 0)
+        HGOTO_ERROR(H5E_FILE, H5E_CANTGET, FAIL, "can't retrieve stats for metadata accumulator")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* H5Fget_metadata_accum_stats() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Fcompact
+ *
+ * Purpose:     Reduces the size of a file by moving blocks of raw data
+ *              from the end of the file into free space earlier in the
+ *              file and truncating the file afterwards.
+ *
+ *              At most MAX_BYTES bytes of raw data are moved, or as much
+ *              as possible when MAX_BYTES is 0, so that a large file can
+ *              be compacted in several steps.  The number of bytes moved
+ *              is returned in BYTES_MOVED, if it's not NULL.
+ *
+ *              Only raw data is moved, and only into space that the
+ *              library knows is free: space released while the file is
+ *              open, or space tracked by persistent free-space managers.
+ *              No datasets in the file may be open.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Fcompact(hid_t file_id, hsize_t max_bytes, hsize_t *bytes_moved)
+{
+    H5VL_object_t   *vol_obj;                       /* File object */
+    herr_t          ret_value = SUCCEED;            /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE3("e", "ih*h", file_id, max_bytes, bytes_moved);
+
+    /* Check args */
+    if(NULL == (vol_obj = (H5VL_object_t *)H5I_object_verify(file_id, H5I_FILE)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "not a file ID")
+
+    /* Compact the file */
+    if(H5VL_file_optional(vol_obj, H5P_DATASET_XFER_DEFAULT, H5_REQUEST_NULL, H5VL_NATIVE_FILE_COMPACT, max_bytes, bytes_moved) < 0)
+        HGOTO_ERROR(H5E_FILE, H5E_CANTMODIFY, FAIL, "unable to compact file")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* H5Fcompact() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Fstart_counters
+ *
+ * Purpose:     Resets the profiling counters for a file and starts
+ *              collecting them: the reads and writes made by the file
+ *              driver, metadata and chunk cache lookups, and the time
+ *              spent in I/O filters, datatype conversions and selection
+ *              iteration for the file's datasets.
+ *
+ *              The counters are kept for the file, not the file ID, so
+ *              they include I/O done through any ID for the same file.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Fstart_counters(hid_t file_id)
+{
+    H5VL_object_t   *vol_obj;                       /* File object */
+    herr_t          ret_value = SUCCEED;            /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE1("e", "i", file_id);
+
+    /* Check args */
+    if(NULL == (vol_obj = (H5VL_object_t *)H5I_object_verify(file_id, H5I_FILE)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "not a file ID")
+
+    /* Start the counters */
+    if(H5VL_file_optional(vol_obj, H5P_DATASET_XFER_DEFAULT, H5_REQUEST_NULL, H5VL_NATIVE_FILE_START_COUNTERS) < 0)
+        HGOTO_ERROR(H5E_FILE, H5E_CANTSET, FAIL, "can't start counters")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* H5Fstart_counters() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Fstop_counters
+ *
+ * Purpose:     Stops collecting the profiling counters for a file.  The
+ *              values collected so far can still be retrieved.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Fstop_counters(hid_t file_id)
+{
+    H5VL_object_t   *vol_obj;                       /* File object */
+    herr_t          ret_value = SUCCEED;            /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE1("e", "i", file_id);
+
+    /* Check args */
+    if(NULL == (vol_obj = (H5VL_object_t *)H5I_object_verify(file_id, H5I_FILE)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "not a file ID")
+
+    /* Stop the counters */
+    if(H5VL_file_optional(vol_obj, H5P_DATASET_XFER_DEFAULT, H5_REQUEST_NULL, H5VL_NATIVE_FILE_STOP_COUNTERS) < 0)
+        HGOTO_ERROR(H5E_FILE, H5E_CANTSET, FAIL, "can't stop counters")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* H5Fstop_counters() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Fget_counters
+ *
+ * Purpose:     Retrieves the totals of the profiling counters for a
+ *              file.  The counters are all zero if H5Fstart_counters()
+ *              was never called for the file.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Fget_counters(hid_t file_id, H5F_counters_t *counters)
+{
+    H5VL_object_t   *vol_obj;                       /* File object */
+    herr_t          ret_value = SUCCEED;            /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "i*x", file_id, counters);
+
+    /* Check args */
+    if(NULL == (vol_obj = (H5VL_object_t *)H5I_object_verify(file_id, H5I_FILE)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "not a file ID")
+    if(NULL == counters)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "NULL counters pointer")
+
+    /* Get the counters */
+    if(H5VL_file_optional(vol_obj, H5P_DATASET_XFER_DEFAULT, H5_REQUEST_NULL, H5VL_NATIVE_FILE_GET_COUNTERS, counters) < 0)
+        HGOTO_ERROR(H5E_FILE, H5E_CANTGET, FAIL, "can't retrieve counters")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* H5Fget_counters() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Fprint_counters
+ *
+ * Purpose:     Writes the profiling counters for a file to STREAM as a
+ *              JSON object.  Besides the totals from H5Fget_counters(),
+ *              the metadata cache lookups are broken down by client
+ *              class, and the time in filters and datatype conversions
+ *              by filter ID and conversion path.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Fprint_counters(hid_t file_id, FILE *stream)
+{
+    H5VL_object_t   *vol_obj;                       /* File object */
+    herr_t          ret_value = SUCCEED;            /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "i*x", file_id, stream);
+
+    /* Check args */
+    if(NULL == (vol_obj = (H5VL_object_t *)H5I_object_verify(file_id, H5I_FILE)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "not a file ID")
+    if(NULL == stream)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "NULL stream")
+
+    /* Write the counters */
+    if(H5VL_file_optional(vol_obj, H5P_DATASET_XFER_DEFAULT, H5_REQUEST_NULL, H5VL_NATIVE_FILE_PRINT_COUNTERS, stream) < 0)
+        HGOTO_ERROR(H5E_FILE, H5E_WRITEERROR, FAIL, "can't print counters")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* H5Fprint_counters() */
+
 
 /*-------------------------------------------------------------------------
  * Function:    H5Fget_mdc_image_info
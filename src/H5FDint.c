@@ -395,3 +395,53 @@ H5FD_driver_query(const H5FD_class_t *driver, unsigned long *flags/*out*/)
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5FD_driver_query() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_try_release_api_lock
+ *
+ * Purpose:     Lets other threads into the library while a driver waits on
+ *              a raw data read, if the read was marked as safe for that by
+ *              H5F_block_read_direct().  The lock is only released when
+ *              this thread holds it once, i.e. not from a callback.
+ *
+ *              The driver must not touch any library state (including
+ *              pushing errors) until it calls H5FD_reacquire_api_lock().
+ *
+ * Return:      TRUE if the lock was released, FALSE otherwise
+ *
+ *-------------------------------------------------------------------------
+ */
+hbool_t
+H5FD_try_release_api_lock(void)
+{
+    hbool_t ret_value = FALSE;          /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    if(H5CX_get_release_api_lock())
+        ret_value = H5_API_LOCK_TRY_RELEASE;
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_try_release_api_lock() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_reacquire_api_lock
+ *
+ * Purpose:     Takes back the API lock released by
+ *              H5FD_try_release_api_lock().
+ *
+ * Return:      <none>
+ *
+ *-------------------------------------------------------------------------
+ */
+void
+H5FD_reacquire_api_lock(void)
+{
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    H5_API_LOCK_REACQUIRE
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5FD_reacquire_api_lock() */
+
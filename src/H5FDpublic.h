@@ -257,6 +257,13 @@ typedef enum H5F_mem_t	H5FD_mem_t;
      * the canonical HDF5 file format.
      */
 #define H5FD_FEAT_DEFAULT_VFD_COMPATIBLE        0x00008000
+    /*
+     * Defining H5FD_FEAT_CONCURRENT_READ for a VFL driver means that its
+     * read callback may release the library's lock in thread-safe builds
+     * while it waits on raw data reads from files opened read-only.  The
+     * callback must not touch any library state while the lock is released.
+     */
+#define H5FD_FEAT_CONCURRENT_READ               0x00010000
 
 
 /* Forward declaration */
@@ -530,6 +530,9 @@ H5FD_sec2_query(const H5FD_t *_file, unsigned long *flags /* out */)
         *flags |= H5FD_FEAT_POSIX_COMPAT_HANDLE;    /* get_handle callback returns a POSIX file descriptor              */
         *flags |= H5FD_FEAT_SUPPORTS_SWMR_IO;       /* VFD supports the single-writer/multiple-readers (SWMR) pattern   */
         *flags |= H5FD_FEAT_DEFAULT_VFD_COMPATIBLE; /* VFD creates a file which can be opened with the default VFD      */
+#ifdef H5_HAVE_PREADWRITE
+        *flags |= H5FD_FEAT_CONCURRENT_READ;        /* OK to release the API lock while waiting on raw data reads       */
+#endif /* H5_HAVE_PREADWRITE */
 
         /* Check for flags that are set by h5repart */
         if(file && file->fam_to_single)
@@ -669,6 +672,11 @@ H5FD_sec2_read(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, hid_t H5_ATTR_UNUS
     haddr_t addr, size_t size, void *buf /*out*/)
 {
     H5FD_sec2_t     *file       = (H5FD_sec2_t *)_file;
+    h5_posix_io_t       bytes_in        = 0;    /* # of bytes to read       */
+    h5_posix_io_ret_t   bytes_read      = 0;    /* # of bytes actually read */
+#ifdef H5_HAVE_PREADWRITE
+    hbool_t         api_lock_released = FALSE;  /* Whether other threads may be in the library */
+#endif /* H5_HAVE_PREADWRITE */
     herr_t          ret_value   = SUCCEED;                  /* Return value */
 
     FUNC_ENTER_NOAPI_NOINIT
@@ -682,7 +690,13 @@ H5FD_sec2_read(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, hid_t H5_ATTR_UNUS
     if(REGION_OVERFLOW(addr, size))
         HGOTO_ERROR(H5E_ARGS, H5E_OVERFLOW, FAIL, "addr overflow, addr = %llu", (unsigned long long)addr)
 
-#ifndef H5_HAVE_PREADWRITE
+#ifdef H5_HAVE_PREADWRITE
+    /* Let other threads into the library while waiting on the read, if
+     * the caller allows it.  Nothing may touch library state (including
+     * pushing errors) until the lock is taken back.
+     */
+    api_lock_released = H5FD_try_release_api_lock();
+#else
     /* Seek to the correct location (if we don't have pread) */
     if(addr != file->pos || OP_READ != file->op) {
         if(HDlseek(file->fd, (HDoff_t)addr, SEEK_SET) < 0)
@@ -694,10 +708,9 @@ H5FD_sec2_read(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, hid_t H5_ATTR_UNUS
      * and the end of the file.
      */
     while(size > 0) {
-
-        h5_posix_io_t       bytes_in        = 0;    /* # of bytes to read       */
-        h5_posix_io_ret_t   bytes_read      = -1;   /* # of bytes actually read */
+#ifdef H5_HAVE_PREADWRITE
         HDoff_t             offset          = (HDoff_t)addr;
+#endif /* H5_HAVE_PREADWRITE */
 
         /* Trying to read more bytes than the return type can handle is
          * undefined behavior in POSIX.
@@ -715,15 +728,10 @@ H5FD_sec2_read(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, hid_t H5_ATTR_UNUS
             bytes_read = HDread(file->fd, buf, bytes_in);
 #endif /* H5_HAVE_PREADWRITE */
         } while(-1 == bytes_read && EINTR == errno);
-        
-        if(-1 == bytes_read) { /* error */
-            int myerrno = errno;
-            time_t mytime = HDtime(NULL);
-
-            offset = HDlseek(file->fd, (HDoff_t)0, SEEK_CUR);
 
-            HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "file read failed: time = %s, filename = '%s', file descriptor = %d, errno = %d, error message = '%s', buf = %p, total read size = %llu, bytes this sub-read = %llu, bytes actually read = %llu, offset = %llu", HDctime(&mytime), file->filename, file->fd, myerrno, HDstrerror(myerrno), buf, (unsigned long long)size, (unsigned long long)bytes_in, (unsigned long long)bytes_read, (unsigned long long)offset);
-        } /* end if */
+        /* Errors are reported below, once the API lock is held again */
+        if(-1 == bytes_read)
+            break;
         
         if(0 == bytes_read) {
             /* end of file but not end of format address space */
@@ -739,9 +747,31 @@ H5FD_sec2_read(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, hid_t H5_ATTR_UNUS
         buf = (char *)buf + bytes_read;
     } /* end while */
 
-    /* Update current position */
+#ifdef H5_HAVE_PREADWRITE
+    /* Take the API lock back, keeping the read's errno */
+    if(api_lock_released) {
+        int myerrno = errno;
+
+        H5FD_reacquire_api_lock();
+        errno = myerrno;
+    } /* end if */
+#endif /* H5_HAVE_PREADWRITE */
+
+    if(-1 == bytes_read) { /* error */
+        int myerrno = errno;
+        time_t mytime = HDtime(NULL);
+        HDoff_t offset = HDlseek(file->fd, (HDoff_t)0, SEEK_CUR);
+
+        HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "file read failed: time = %s, filename = '%s', file descriptor = %d, errno = %d, error message = '%s', buf = %p, total read size = %llu, bytes this sub-read = %llu, bytes actually read = %llu, offset = %llu", HDctime(&mytime), file->filename, file->fd, myerrno, HDstrerror(myerrno), buf, (unsigned long long)size, (unsigned long long)bytes_in, (unsigned long long)bytes_read, (unsigned long long)offset);
+    } /* end if */
+
+#ifndef H5_HAVE_PREADWRITE
+    /* Update current position (pread doesn't use it, and other threads
+     * may be reading from the file at the same time)
+     */
     file->pos = addr;
     file->op = OP_READ;
+#endif /* H5_HAVE_PREADWRITE */
 
 done:
     if(ret_value < 0) {
@@ -0,0 +1,1071 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://support.hdfgroup.org/ftp/HDF5/releases.  *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+ * Purpose:	A driver that stacks on top of another driver, passing every
+ *		operation down to it and appending a record of each open,
+ *		close, read, write, flush and truncate to a binary trace
+ *		file.  Each record holds the operation's address, size, type
+ *		of data, start time and duration, and the API call that
+ *		caused it, so the I/O an application makes can be studied
+ *		or replayed (see the h5replay tool) without the application.
+ *
+ *		The file written is exactly the file the underlying driver
+ *		would have written, so it can be re-opened without tracing.
+ *
+ *		The underlying driver is only called while this thread holds
+ *		the library's API lock: the driver doesn't advertise
+ *		H5FD_FEAT_CONCURRENT_READ, since the trace file isn't
+ *		protected by a lock of its own.
+ */
+
+#include "H5FDdrvr_module.h" /* This source code file is part of the H5FD driver module */
+
+
+#include "H5private.h"		/* Generic Functions			*/
+#include "H5CSprivate.h"	/* Function stacks			*/
+#include "H5CXprivate.h"        /* API Contexts                         */
+#include "H5Eprivate.h"		/* Error handling		  	*/
+#include "H5Fprivate.h"		/* File access				*/
+#include "H5FDprivate.h"	/* File drivers				*/
+#include "H5FDtrace.h"          /* Trace file driver                    */
+#include "H5Iprivate.h"		/* IDs			  		*/
+#include "H5MMprivate.h"	/* Memory management			*/
+#include "H5Pprivate.h"		/* Property lists			*/
+
+/* The driver identification number, initialized at runtime */
+static hid_t H5FD_TRACE_g = 0;
+
+/* The number of files opened with the driver, for their serial numbers */
+static unsigned H5FD_trace_nopens_g = 0;
+
+/* Number of records the trace file's stream buffers.  Buffering a whole
+ * number of records means the stream only writes whole records, so the
+ * records of files traced to the same trace file at once aren't split.
+ */
+#define H5FD_TRACE_BUF_NRECS    64
+
+/* Feature flags of the underlying driver that this driver can't pass on */
+#define H5FD_TRACE_MASKED_FEATURES (H5FD_FEAT_HAS_MPI                   \
+                                    | H5FD_FEAT_ALLOW_FILE_IMAGE        \
+                                    | H5FD_FEAT_CAN_USE_FILE_IMAGE_CALLBACKS \
+                                    | H5FD_FEAT_CONCURRENT_READ)
+
+/* The description of a file belonging to this driver. */
+typedef struct H5FD_trace_t {
+    H5FD_t	pub;		/*public stuff, must be first		*/
+    H5FD_t	*under;		/*file opened with the underlying driver */
+    hid_t	under_fapl_id;	/*file access property list for 'under'	*/
+    char	*trace_file;	/*name of the trace file		*/
+    FILE	*tracefp;	/*trace file pointer			*/
+    unsigned	serial;		/*serial number of the open		*/
+    double	open_time;	/*time the file was opened		*/
+    hbool_t	trace_err;	/*whether writing a record has failed	*/
+} H5FD_trace_t;
+
+/* Driver-specific file access properties */
+typedef struct H5FD_trace_fapl_t {
+    char	*trace_file;	/*name of the trace file		*/
+    hid_t	under_fapl_id;	/*file access property list for the underlying driver */
+} H5FD_trace_fapl_t;
+
+/* Callback prototypes */
+static herr_t H5FD_trace_term(void);
+static void *H5FD_trace_fapl_get(H5FD_t *_file);
+static void *H5FD_trace_fapl_copy(const void *_old_fa);
+static herr_t H5FD_trace_fapl_free(void *_fa);
+static hsize_t H5FD_trace_sb_size(H5FD_t *_file);
+static herr_t H5FD_trace_sb_encode(H5FD_t *_file, char *name/*out*/,
+                    unsigned char *buf/*out*/);
+static herr_t H5FD_trace_sb_decode(H5FD_t *_file, const char *name,
+                    const unsigned char *buf);
+static H5FD_t *H5FD_trace_open(const char *name, unsigned flags,
+                    hid_t fapl_id, haddr_t maxaddr);
+static herr_t H5FD_trace_close(H5FD_t *_file);
+static int H5FD_trace_cmp(const H5FD_t *_f1, const H5FD_t *_f2);
+static herr_t H5FD_trace_query(const H5FD_t *_f1, unsigned long *flags);
+static herr_t H5FD_trace_get_type_map(const H5FD_t *_file, H5FD_mem_t *type_map);
+static haddr_t H5FD_trace_get_eoa(const H5FD_t *_file, H5FD_mem_t type);
+static herr_t H5FD_trace_set_eoa(H5FD_t *_file, H5FD_mem_t type, haddr_t addr);
+static haddr_t H5FD_trace_get_eof(const H5FD_t *_file, H5FD_mem_t type);
+static herr_t H5FD_trace_get_handle(H5FD_t *_file, hid_t fapl, void** file_handle);
+static herr_t H5FD_trace_read(H5FD_t *_file, H5FD_mem_t type, hid_t dxpl_id, haddr_t addr,
+                    size_t size, void *buf/*out*/);
+static herr_t H5FD_trace_write(H5FD_t *_file, H5FD_mem_t type, hid_t dxpl_id, haddr_t addr,
+                    size_t size, const void *buf);
+static herr_t H5FD_trace_flush(H5FD_t *_file, hid_t dxpl_id, hbool_t closing);
+static herr_t H5FD_trace_truncate(H5FD_t *_file, hid_t dxpl_id, hbool_t closing);
+static herr_t H5FD_trace_lock(H5FD_t *_file, hbool_t rw);
+static herr_t H5FD_trace_unlock(H5FD_t *_file);
+
+/* Helper routines */
+static void H5FD_trace_record(H5FD_trace_t *file, H5FD_trace_op_t op,
+                    H5FD_mem_t type, haddr_t addr, hsize_t size, double start);
+
+/* The class struct */
+static const H5FD_class_t H5FD_trace_g = {
+    "trace",					/*name			*/
+    HADDR_MAX,					/*maxaddr		*/
+    H5F_CLOSE_WEAK,				/*fc_degree		*/
+    H5FD_trace_term,                            /*terminate             */
+    H5FD_trace_sb_size,				/*sb_size		*/
+    H5FD_trace_sb_encode,			/*sb_encode		*/
+    H5FD_trace_sb_decode,			/*sb_decode		*/
+    sizeof(H5FD_trace_fapl_t),			/*fapl_size		*/
+    H5FD_trace_fapl_get,			/*fapl_get		*/
+    H5FD_trace_fapl_copy,			/*fapl_copy		*/
+    H5FD_trace_fapl_free,			/*fapl_free		*/
+    0,						/*dxpl_size		*/
+    NULL,					/*dxpl_copy		*/
+    NULL,					/*dxpl_free		*/
+    H5FD_trace_open,				/*open			*/
+    H5FD_trace_close,				/*close			*/
+    H5FD_trace_cmp,				/*cmp			*/
+    H5FD_trace_query,		                /*query			*/
+    H5FD_trace_get_type_map,			/*get_type_map		*/
+    NULL,					/*alloc			*/
+    NULL,					/*free			*/
+    H5FD_trace_get_eoa,				/*get_eoa		*/
+    H5FD_trace_set_eoa,				/*set_eoa		*/
+    H5FD_trace_get_eof,				/*get_eof		*/
+    H5FD_trace_get_handle,                      /*get_handle            */
+    H5FD_trace_read,				/*read			*/
+    H5FD_trace_write,				/*write			*/
+    H5FD_trace_flush,				/*flush			*/
+    H5FD_trace_truncate,			/*truncate		*/
+    H5FD_trace_lock,                            /*lock                  */
+    H5FD_trace_unlock,                          /*unlock                */
+    H5FD_FLMAP_DICHOTOMY                        /*fl_map                */
+};
+
+
+/*--------------------------------------------------------------------------
+NAME
+   H5FD__init_package -- Initialize interface-specific information
+USAGE
+    herr_t H5FD__init_package()
+RETURNS
+    Non-negative on success/Negative on failure
+DESCRIPTION
+    Initializes any interface-specific data or routines.  (Just calls
+    H5FD_trace_init currently).
+
+--------------------------------------------------------------------------*/
+static herr_t
+H5FD__init_package(void)
+{
+    herr_t ret_value = SUCCEED;
+
+    FUNC_ENTER_STATIC
+
+    if(H5FD_trace_init() < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_CANTINIT, FAIL, "unable to initialize trace VFD")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5FD__init_package() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_trace_init
+ *
+ * Purpose:     Initialize this driver by registering the driver with the
+ *              library.
+ *
+ * Return:      Success:    The driver ID for the trace driver
+ *              Failure:    H5I_INVALID_HID
+ *
+ *-------------------------------------------------------------------------
+ */
+hid_t
+H5FD_trace_init(void)
+{
+    hid_t ret_value = H5I_INVALID_HID;   /* Return value */
+
+    FUNC_ENTER_NOAPI(H5I_INVALID_HID)
+
+    if(H5I_VFL != H5I_get_type(H5FD_TRACE_g))
+        H5FD_TRACE_g = H5FD_register(&H5FD_trace_g, sizeof(H5FD_class_t), FALSE);
+
+    /* Set return value */
+    ret_value = H5FD_TRACE_g;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5FD_trace_init() */
+
+
+/*---------------------------------------------------------------------------
+ * Function:	H5FD_trace_term
+ *
+ * Purpose:	Shut down the VFD
+ *
+ * Returns:     Non-negative on success or negative on failure
+ *
+ *---------------------------------------------------------------------------
+ */
+static herr_t
+H5FD_trace_term(void)
+{
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    /* Reset VFL ID */
+    H5FD_TRACE_g = 0;
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5FD_trace_term() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Pset_fapl_trace
+ *
+ * Purpose:	Sets the file access property list FAPL_ID to use the trace
+ *		driver.  Files are opened with the driver set in
+ *		UNDER_FAPL_ID, and a record of each operation on them is
+ *		appended to TRACE_FILE.
+ *
+ * Return:	Success:	Non-negative
+ *
+ *		Failure:	Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pset_fapl_trace(hid_t fapl_id, const char *trace_file, hid_t under_fapl_id)
+{
+    H5FD_trace_fapl_t fa;
+    H5P_genplist_t *plist;      /* Property list pointer */
+    herr_t ret_value;
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE3("e", "i*si", fapl_id, trace_file, under_fapl_id);
+
+    /* Check arguments */
+    if(NULL == (plist = H5P_object_verify(fapl_id, H5P_FILE_ACCESS)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a file access property list")
+    if(!trace_file || !*trace_file)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "invalid trace file name")
+    if(H5P_DEFAULT == under_fapl_id)
+        under_fapl_id = H5P_FILE_ACCESS_DEFAULT;
+    else
+        if(TRUE != H5P_isa_class(under_fapl_id, H5P_FILE_ACCESS))
+            HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a file access list")
+
+    /* Initialize driver specific information.  The driver makes its own
+     * copies of both, in H5FD_trace_fapl_copy().
+     */
+    fa.trace_file = (char *)trace_file;
+    fa.under_fapl_id = under_fapl_id;
+
+    ret_value = H5P_set_driver(plist, H5FD_TRACE, &fa);
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pset_fapl_trace() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Pget_fapl_trace
+ *
+ * Purpose:	Returns information about the trace file access property
+ *		list though the function arguments.  At most SIZE bytes of
+ *		the trace file's name are copied into TRACE_FILE, and
+ *		UNDER_FAPL_ID is set to a copy of the property list for the
+ *		underlying driver, which the caller must close.
+ *
+ * Return:	Success:	Non-negative
+ *
+ *		Failure:	Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pget_fapl_trace(hid_t fapl_id, char *trace_file/*out*/, size_t size,
+    hid_t *under_fapl_id/*out*/)
+{
+    H5P_genplist_t *plist;      /* Property list pointer */
+    const H5FD_trace_fapl_t *fa;
+    herr_t      ret_value = SUCCEED;       /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE4("e", "ixzx", fapl_id, trace_file, size, under_fapl_id);
+
+    if(NULL == (plist = H5P_object_verify(fapl_id, H5P_FILE_ACCESS)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a file access list")
+    if(H5FD_TRACE != H5P_peek_driver(plist))
+        HGOTO_ERROR(H5E_PLIST, H5E_BADVALUE, FAIL, "incorrect VFL driver")
+    if(NULL == (fa = (const H5FD_trace_fapl_t *)H5P_peek_driver_info(plist)))
+        HGOTO_ERROR(H5E_PLIST, H5E_BADVALUE, FAIL, "bad VFL driver info")
+    if(trace_file && size > 0) {
+        HDstrncpy(trace_file, fa->trace_file, size);
+        trace_file[size - 1] = '\0';
+    } /* end if */
+    if(under_fapl_id) {
+        if(NULL == (plist = (H5P_genplist_t *)H5I_object(fa->under_fapl_id)))
+            HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a file access list")
+        *under_fapl_id = H5P_copy_plist(plist, TRUE);
+    } /* end if */
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pget_fapl_trace() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5FD_trace_fapl_get
+ *
+ * Purpose:	Gets a file access property list which could be used to
+ *		create an identical file.
+ *
+ * Return:	Success:	Ptr to new file access property list.
+ *
+ *		Failure:	NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+static void *
+H5FD_trace_fapl_get(H5FD_t *_file)
+{
+    H5FD_trace_t *file = (H5FD_trace_t *)_file;
+    H5FD_trace_fapl_t fa;
+    void *ret_value = NULL;     /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    fa.trace_file = file->trace_file;
+    fa.under_fapl_id = file->under_fapl_id;
+
+    /* Copy the trace file properties */
+    ret_value = H5FD_trace_fapl_copy(&fa);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_trace_fapl_get() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5FD_trace_fapl_copy
+ *
+ * Purpose:	Copies the trace-specific file access properties.
+ *
+ * Return:	Success:	Ptr to a new property list
+ *
+ *		Failure:	NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+static void *
+H5FD_trace_fapl_copy(const void *_old_fa)
+{
+    const H5FD_trace_fapl_t *old_fa = (const H5FD_trace_fapl_t *)_old_fa;
+    H5FD_trace_fapl_t *new_fa = NULL;
+    H5P_genplist_t *plist;      /* Property list pointer */
+    void *ret_value = NULL;     /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    if(NULL == (new_fa = (H5FD_trace_fapl_t *)H5MM_calloc(sizeof(H5FD_trace_fapl_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, NULL, "memory allocation failed")
+    new_fa->under_fapl_id = H5I_INVALID_HID;
+
+    /* Deep copy the trace file name and the property list for the
+     * underlying driver
+     */
+    if(NULL == (new_fa->trace_file = H5MM_xstrdup(old_fa->trace_file)))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, NULL, "unable to copy trace file name")
+    if(old_fa->under_fapl_id == H5P_FILE_ACCESS_DEFAULT) {
+        if(H5I_inc_ref(old_fa->under_fapl_id, FALSE) < 0)
+            HGOTO_ERROR(H5E_VFL, H5E_CANTINC, NULL, "unable to increment ref count on VFL driver")
+        new_fa->under_fapl_id = old_fa->under_fapl_id;
+    } /* end if */
+    else {
+        if(NULL == (plist = (H5P_genplist_t *)H5I_object(old_fa->under_fapl_id)))
+            HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, NULL, "not a file access property list")
+        if((new_fa->under_fapl_id = H5P_copy_plist(plist, FALSE)) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTCOPY, NULL, "unable to copy file access property list")
+    } /* end else */
+
+    /* Set return value */
+    ret_value = new_fa;
+
+done:
+    if(NULL == ret_value && new_fa) {
+        H5MM_xfree(new_fa->trace_file);
+        H5MM_xfree(new_fa);
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_trace_fapl_copy() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5FD_trace_fapl_free
+ *
+ * Purpose:	Frees the trace-specific file access properties.
+ *
+ * Return:	Success:	0
+ *
+ *		Failure:	-1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD_trace_fapl_free(void *_fa)
+{
+    H5FD_trace_fapl_t *fa = (H5FD_trace_fapl_t *)_fa;
+    herr_t ret_value = SUCCEED;   /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    if(H5I_dec_ref(fa->under_fapl_id) < 0)
+        HDONE_ERROR(H5E_VFL, H5E_CANTDEC, FAIL, "can't close driver ID")
+    H5MM_xfree(fa->trace_file);
+    H5MM_xfree(fa);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_trace_fapl_free() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5FD_trace_sb_size
+ *
+ * Purpose:	Returns the size of the underlying driver's private
+ *		information to be stored in the superblock.  The trace driver
+ *		stores nothing of its own, so files it writes can be opened
+ *		with the underlying driver alone.
+ *
+ * Return:	Success:	The super block driver data size.
+ *
+ *		Failure:	never fails
+ *
+ *-------------------------------------------------------------------------
+ */
+static hsize_t
+H5FD_trace_sb_size(H5FD_t *_file)
+{
+    H5FD_trace_t *file = (H5FD_trace_t *)_file;
+    hsize_t ret_value = 0;      /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    ret_value = H5FD_sb_size(file->under);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_trace_sb_size() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5FD_trace_sb_encode
+ *
+ * Purpose:	Encodes the underlying driver's information for the
+ *		superblock.
+ *
+ * Return:	SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD_trace_sb_encode(H5FD_t *_file, char *name/*out*/, unsigned char *buf/*out*/)
+{
+    H5FD_trace_t *file = (H5FD_trace_t *)_file;
+    herr_t ret_value = SUCCEED;   /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    if(H5FD_sb_encode(file->under, name, buf) < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_CANTENCODE, FAIL, "unable to encode driver information")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_trace_sb_encode() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5FD_trace_sb_decode
+ *
+ * Purpose:	Passes the driver information from the superblock to the
+ *		underlying driver, which checks that it's the driver the
+ *		file was written with.
+ *
+ * Return:	SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD_trace_sb_decode(H5FD_t *_file, const char *name, const unsigned char *buf)
+{
+    H5FD_trace_t *file = (H5FD_trace_t *)_file;
+    herr_t ret_value = SUCCEED;   /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    if(H5FD_sb_load(file->under, name, buf) < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_CANTDECODE, FAIL, "unable to decode driver information")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_trace_sb_decode() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5FD_trace_record
+ *
+ * Purpose:	Appends a record of an operation that started at START, and
+ *		has just finished, to the trace file.  A record that can't
+ *		be written doesn't fail the operation; the failure is
+ *		reported when the file is closed.
+ *
+ * Return:	<none>
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5FD_trace_record(H5FD_trace_t *file, H5FD_trace_op_t op, H5FD_mem_t type,
+    haddr_t addr, hsize_t size, double start)
+{
+    H5FD_trace_rec_t rec;
+#ifdef H5_HAVE_CODESTACK
+    const char *api_name;
+#endif /* H5_HAVE_CODESTACK */
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    HDmemset(&rec, 0, sizeof(rec));
+    rec.start = start - file->open_time;
+    rec.elapsed = H5_get_time() - start;
+    rec.addr = addr;
+    rec.size = size;
+    rec.api_call = (hsize_t)H5CX_get_api_call();
+    rec.file = file->serial;
+    rec.op = (unsigned)op;
+    rec.type = (int)type;
+#ifdef H5_HAVE_CODESTACK
+    if(NULL != (api_name = H5CS_get_api_name()))
+        HDstrncpy(rec.api_name, api_name, sizeof(rec.api_name) - 1);
+#endif /* H5_HAVE_CODESTACK */
+
+    if(1 != HDfwrite(&rec, sizeof(rec), (size_t)1, file->tracefp))
+        file->trace_err = TRUE;
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5FD_trace_record() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5FD_trace_open
+ *
+ * Purpose:	Opens the file with the underlying driver and opens the
+ *		trace file for appending, writing the trace file's header
+ *		if it's new.
+ *
+ * Return:	Success:	A pointer to a new file data structure. The
+ *				public fields will be initialized by the
+ *				caller, which is always H5FD_open().
+ *
+ *		Failure:	NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+static H5FD_t *
+H5FD_trace_open(const char *name, unsigned flags, hid_t fapl_id,
+    haddr_t maxaddr)
+{
+    H5FD_trace_t *file = NULL;
+    H5P_genplist_t *plist;      /* Property list pointer */
+    const H5FD_trace_fapl_t *fa;
+    H5FD_t *ret_value = NULL;   /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    /* Check arguments */
+    if(!name || !*name)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, NULL, "invalid file name")
+    if(0 == maxaddr || HADDR_UNDEF == maxaddr)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADRANGE, NULL, "bogus maxaddr")
+    if(NULL == (plist = (H5P_genplist_t *)H5I_object(fapl_id)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, NULL, "not a file access property list")
+    if(NULL == (fa = (const H5FD_trace_fapl_t *)H5P_peek_driver_info(plist)))
+        HGOTO_ERROR(H5E_PLIST, H5E_BADVALUE, NULL, "bad VFL driver info")
+
+    /* Create the new file struct, with its own copies of the properties */
+    if(NULL == (file = (H5FD_trace_t *)H5MM_calloc(sizeof(H5FD_trace_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, NULL, "unable to allocate file struct")
+    file->under_fapl_id = H5I_INVALID_HID;
+    if(NULL == (fa = (const H5FD_trace_fapl_t *)H5FD_trace_fapl_copy(fa)))
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTCOPY, NULL, "unable to copy VFL driver info")
+    file->trace_file = fa->trace_file;
+    file->under_fapl_id = fa->under_fapl_id;
+    H5MM_xfree((void *)fa);
+
+    /* Open the file with the underlying driver */
+    file->open_time = H5_get_time();
+    if(NULL == (file->under = H5FD_open(name, flags, file->under_fapl_id, HADDR_UNDEF)))
+        HGOTO_ERROR(H5E_VFL, H5E_CANTOPENFILE, NULL, "unable to open file with the underlying driver")
+
+    /* The library only asks drivers without an 'alloc' callback for space
+     * by moving their EOA, which this driver passes on, so drivers that
+     * allocate space themselves (i.e. the multi driver) can't be traced.
+     */
+    if(file->under->cls->alloc)
+        HGOTO_ERROR(H5E_VFL, H5E_UNSUPPORTED, NULL, "can't trace a driver that allocates file space itself")
+
+    /* Open the trace file, and start it if it's new */
+    if(NULL == (file->tracefp = HDfopen(file->trace_file, "ab")))
+        HSYS_GOTO_ERROR(H5E_FILE, H5E_CANTOPENFILE, NULL, "unable to open trace file")
+    if(HDsetvbuf(file->tracefp, NULL, _IOFBF, H5FD_TRACE_BUF_NRECS * sizeof(H5FD_trace_rec_t)) != 0)
+        HGOTO_ERROR(H5E_FILE, H5E_CANTINIT, NULL, "unable to set trace file buffer")
+    if(HDfseek(file->tracefp, (HDoff_t)0, SEEK_END) < 0)
+        HSYS_GOTO_ERROR(H5E_FILE, H5E_SEEKERROR, NULL, "unable to seek to the end of the trace file")
+    if(0 == HDftell(file->tracefp)) {
+        H5FD_trace_header_t header;
+
+        HDmemset(&header, 0, sizeof(header));
+        HDstrncpy(header.magic, H5FD_TRACE_MAGIC, sizeof(header.magic));
+        header.version = H5FD_TRACE_VERSION;
+        header.rec_size = (unsigned)sizeof(H5FD_trace_rec_t);
+        if(1 != HDfwrite(&header, sizeof(header), (size_t)1, file->tracefp))
+            HSYS_GOTO_ERROR(H5E_FILE, H5E_WRITEERROR, NULL, "unable to write trace file header")
+
+        /* Keep the buffer to whole records */
+        if(HDfflush(file->tracefp) < 0)
+            HSYS_GOTO_ERROR(H5E_FILE, H5E_WRITEERROR, NULL, "unable to write trace file header")
+    } /* end if */
+
+    /* Record the open, with the size of the file that was opened */
+    file->serial = ++H5FD_trace_nopens_g;
+    H5FD_trace_record(file, H5FD_TRACE_OPEN, H5FD_MEM_DEFAULT, (haddr_t)0,
+            (hsize_t)H5FD_get_eof(file->under, H5FD_MEM_DEFAULT), file->open_time);
+
+    /* Set return value */
+    ret_value = (H5FD_t *)file;
+
+done:
+    if(NULL == ret_value && file) {
+        if(file->tracefp)
+            HDfclose(file->tracefp);
+        if(file->under && H5FD_close(file->under) < 0)
+            HDONE_ERROR(H5E_VFL, H5E_CANTCLOSEFILE, NULL, "unable to close file with the underlying driver")
+        if(file->under_fapl_id >= 0 && H5I_dec_ref(file->under_fapl_id) < 0)
+            HDONE_ERROR(H5E_VFL, H5E_CANTDEC, NULL, "can't close driver ID")
+        H5MM_xfree(file->trace_file);
+        H5MM_xfree(file);
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_trace_open() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5FD_trace_close
+ *
+ * Purpose:	Closes the file with the underlying driver, records the
+ *		close and closes the trace file.
+ *
+ * Return:	Success:	Non-negative
+ *
+ *		Failure:	Negative, with the file and the trace file
+ *				closed as far as possible.
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD_trace_close(H5FD_t *_file)
+{
+    H5FD_trace_t *file = (H5FD_trace_t *)_file;
+    double start = H5_get_time();
+    herr_t ret_value = SUCCEED;   /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    if(H5FD_close(file->under) < 0)
+        HDONE_ERROR(H5E_VFL, H5E_CANTCLOSEFILE, FAIL, "unable to close file with the underlying driver")
+    H5FD_trace_record(file, H5FD_TRACE_CLOSE, H5FD_MEM_DEFAULT, (haddr_t)0, (hsize_t)0, start);
+
+    if(HDfclose(file->tracefp) < 0)
+        file->trace_err = TRUE;
+    if(file->trace_err)
+        HDONE_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "unable to write all records to the trace file")
+    if(H5I_dec_ref(file->under_fapl_id) < 0)
+        HDONE_ERROR(H5E_VFL, H5E_CANTDEC, FAIL, "can't close driver ID")
+
+    H5MM_xfree(file->trace_file);
+    H5MM_xfree(file);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_trace_close() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5FD_trace_cmp
+ *
+ * Purpose:	Compares two files by comparing the files they're stacked
+ *		on.
+ *
+ * Return:	Success:	A value like strcmp()
+ *
+ *		Failure:	never fails (arguments were checked by the
+ *				caller).
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5FD_trace_cmp(const H5FD_t *_f1, const H5FD_t *_f2)
+{
+    const H5FD_trace_t *f1 = (const H5FD_trace_t *)_f1;
+    const H5FD_trace_t *f2 = (const H5FD_trace_t *)_f2;
+    int ret_value = 0;          /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    ret_value = H5FD_cmp(f1->under, f2->under);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_trace_cmp() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5FD_trace_query
+ *
+ * Purpose:	Set the flags that this VFL driver is capable of supporting.
+ *              (listed in H5FDpublic.h).  Once a file is open, these are
+ *              the underlying driver's flags, less the ones this driver
+ *              can't pass on.
+ *
+ * Return:	SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD_trace_query(const H5FD_t *_file, unsigned long *flags /* out */)
+{
+    const H5FD_trace_t *file = (const H5FD_trace_t *)_file;
+    herr_t ret_value = SUCCEED;   /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    if(flags) {
+        if(file) {
+            if(H5FD_get_feature_flags(file->under, flags) < 0)
+                HGOTO_ERROR(H5E_VFL, H5E_CANTGET, FAIL, "unable to get underlying driver's feature flags")
+            *flags &= ~(unsigned long)H5FD_TRACE_MASKED_FEATURES;
+        } /* end if */
+        else {
+            *flags = 0;
+            *flags |= H5FD_FEAT_AGGREGATE_METADATA; /* OK to aggregate metadata allocations */
+            *flags |= H5FD_FEAT_ACCUMULATE_METADATA; /* OK to accumulate metadata for faster writes. */
+            *flags |= H5FD_FEAT_DATA_SIEVE;       /* OK to perform data sieving for faster raw data reads & writes */
+            *flags |= H5FD_FEAT_AGGREGATE_SMALLDATA; /* OK to aggregate "small" raw data allocations */
+        } /* end else */
+    } /* end if */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_trace_query() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5FD_trace_get_type_map
+ *
+ * Purpose:	Retrieves the underlying driver's memory type mapping.
+ *
+ * Return:	SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD_trace_get_type_map(const H5FD_t *_file, H5FD_mem_t *type_map)
+{
+    const H5FD_trace_t *file = (const H5FD_trace_t *)_file;
+    herr_t ret_value = SUCCEED;   /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    if(H5FD_get_fs_type_map(file->under, type_map) < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_CANTGET, FAIL, "unable to get underlying driver's type map")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_trace_get_type_map() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5FD_trace_get_eoa
+ *
+ * Purpose:	Gets the end-of-address marker for the file.
+ *
+ * Return:	Success:	The end-of-address marker
+ *
+ *		Failure:	HADDR_UNDEF
+ *
+ *-------------------------------------------------------------------------
+ */
+static haddr_t
+H5FD_trace_get_eoa(const H5FD_t *_file, H5FD_mem_t type)
+{
+    const H5FD_trace_t *file = (const H5FD_trace_t *)_file;
+    haddr_t ret_value = HADDR_UNDEF;    /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    if(HADDR_UNDEF == (ret_value = H5FD_get_eoa(file->under, type)))
+        HGOTO_ERROR(H5E_VFL, H5E_CANTGET, HADDR_UNDEF, "unable to get underlying driver's eoa")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_trace_get_eoa() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5FD_trace_set_eoa
+ *
+ * Purpose:	Sets the end-of-address marker for the file.
+ *
+ * Return:	SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD_trace_set_eoa(H5FD_t *_file, H5FD_mem_t type, haddr_t addr)
+{
+    H5FD_trace_t *file = (H5FD_trace_t *)_file;
+    herr_t ret_value = SUCCEED;   /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    if(H5FD_set_eoa(file->under, type, addr) < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_CANTSET, FAIL, "unable to set underlying driver's eoa")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_trace_set_eoa() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5FD_trace_get_eof
+ *
+ * Purpose:	Returns the end-of-file marker of the underlying file.
+ *
+ * Return:	Success:	The end-of-file marker
+ *
+ *		Failure:	HADDR_UNDEF
+ *
+ *-------------------------------------------------------------------------
+ */
+static haddr_t
+H5FD_trace_get_eof(const H5FD_t *_file, H5FD_mem_t type)
+{
+    const H5FD_trace_t *file = (const H5FD_trace_t *)_file;
+    haddr_t ret_value = HADDR_UNDEF;    /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    if(HADDR_UNDEF == (ret_value = H5FD_get_eof(file->under, type)))
+        HGOTO_ERROR(H5E_VFL, H5E_CANTGET, HADDR_UNDEF, "unable to get underlying driver's eof")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_trace_get_eof() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5FD_trace_get_handle
+ *
+ * Purpose:	Returns the underlying driver's file handle.
+ *
+ * Return:	SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD_trace_get_handle(H5FD_t *_file, hid_t fapl, void **file_handle)
+{
+    H5FD_trace_t *file = (H5FD_trace_t *)_file;
+    herr_t ret_value = SUCCEED;   /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    if(H5FD_get_vfd_handle(file->under, fapl, file_handle) < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_CANTGET, FAIL, "unable to get underlying driver's file handle")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_trace_get_handle() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5FD_trace_read
+ *
+ * Purpose:	Reads SIZE bytes of data from FILE beginning at address ADDR
+ *		into buffer BUF, and records the read.
+ *
+ * Return:	Success:	SUCCEED. Result is stored in caller-supplied
+ *				buffer BUF.
+ *
+ *		Failure:	FAIL, Contents of buffer BUF are undefined.
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD_trace_read(H5FD_t *_file, H5FD_mem_t type, hid_t H5_ATTR_UNUSED dxpl_id,
+    haddr_t addr, size_t size, void *buf/*out*/)
+{
+    H5FD_trace_t *file = (H5FD_trace_t *)_file;
+    double start = H5_get_time();
+    herr_t ret_value = SUCCEED;   /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    if(H5FD_read(file->under, type, addr, size, buf) < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_READERROR, FAIL, "underlying driver read request failed")
+    H5FD_trace_record(file, H5FD_TRACE_READ, type, addr, (hsize_t)size, start);
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_trace_read() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5FD_trace_write
+ *
+ * Purpose:	Writes SIZE bytes of data to FILE beginning at address ADDR
+ *		from buffer BUF, and records the write.
+ *
+ * Return:	SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD_trace_write(H5FD_t *_file, H5FD_mem_t type, hid_t H5_ATTR_UNUSED dxpl_id,
+    haddr_t addr, size_t size, const void *buf)
+{
+    H5FD_trace_t *file = (H5FD_trace_t *)_file;
+    double start = H5_get_time();
+    herr_t ret_value = SUCCEED;   /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    if(H5FD_write(file->under, type, addr, size, buf) < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_WRITEERROR, FAIL, "underlying driver write request failed")
+    H5FD_trace_record(file, H5FD_TRACE_WRITE, type, addr, (hsize_t)size, start);
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_trace_write() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5FD_trace_flush
+ *
+ * Purpose:	Flushes the underlying file, records the flush and flushes
+ *		the trace file.
+ *
+ * Return:	SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD_trace_flush(H5FD_t *_file, hid_t H5_ATTR_UNUSED dxpl_id, hbool_t closing)
+{
+    H5FD_trace_t *file = (H5FD_trace_t *)_file;
+    double start = H5_get_time();
+    herr_t ret_value = SUCCEED;   /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    if(H5FD_flush(file->under, closing) < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_CANTFLUSH, FAIL, "underlying driver flush request failed")
+    H5FD_trace_record(file, H5FD_TRACE_FLUSH, H5FD_MEM_DEFAULT, (haddr_t)0, (hsize_t)0, start);
+    if(HDfflush(file->tracefp) < 0)
+        file->trace_err = TRUE;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_trace_flush() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5FD_trace_truncate
+ *
+ * Purpose:	Truncates the underlying file to its EOA, and records the
+ *		truncation with the EOA as its address.
+ *
+ * Return:	SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD_trace_truncate(H5FD_t *_file, hid_t H5_ATTR_UNUSED dxpl_id, hbool_t closing)
+{
+    H5FD_trace_t *file = (H5FD_trace_t *)_file;
+    double start = H5_get_time();
+    herr_t ret_value = SUCCEED;   /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    if(H5FD_truncate(file->under, closing) < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_CANTUPDATE, FAIL, "underlying driver truncate request failed")
+    H5FD_trace_record(file, H5FD_TRACE_TRUNCATE, H5FD_MEM_DEFAULT,
+            H5FD_get_eoa(file->under, H5FD_MEM_DEFAULT), (hsize_t)0, start);
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_trace_truncate() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_trace_lock
+ *
+ * Purpose:     Places an advisory lock on the underlying file.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD_trace_lock(H5FD_t *_file, hbool_t rw)
+{
+    H5FD_trace_t *file = (H5FD_trace_t *)_file;
+    herr_t ret_value = SUCCEED;   /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    if(H5FD_lock(file->under, rw) < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_CANTLOCK, FAIL, "unable to lock file")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_trace_lock() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_trace_unlock
+ *
+ * Purpose:     Removes the lock on the underlying file.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD_trace_unlock(H5FD_t *_file)
+{
+    H5FD_trace_t *file = (H5FD_trace_t *)_file;
+    herr_t ret_value = SUCCEED;   /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    if(H5FD_unlock(file->under) < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_CANTUNLOCK, FAIL, "unable to unlock file")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_trace_unlock() */
+
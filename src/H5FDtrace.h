@@ -0,0 +1,81 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://support.hdfgroup.org/ftp/HDF5/releases.  *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+ * Purpose:	The public header file for the trace driver, which passes
+ *		every operation on to another driver and records the
+ *		operation in a binary trace file.
+ */
+#ifndef H5FDtrace_H
+#define H5FDtrace_H
+
+#define H5FD_TRACE	(H5FD_trace_init())
+
+/* Trace file layout: an H5FD_trace_header_t, then H5FD_trace_rec_t records
+ * in the order the operations were made.  Each time a file is opened with
+ * the driver, its records are appended, starting with an H5FD_TRACE_OPEN
+ * record.  Every record carries the serial number of the open it belongs
+ * to, so several files may be traced to the same trace file at once.
+ * Serial numbers start at 1 in each process, so only one process at a
+ * time should write to a trace file.  Records are written in the native
+ * byte order and layout, so traces are meant to be read on the platform
+ * that wrote them.
+ */
+#define H5FD_TRACE_MAGIC        "H5FDTRC"       /* Including the null terminator */
+#define H5FD_TRACE_VERSION      2
+#define H5FD_TRACE_NAME_LEN     32
+
+/* Operations recorded in a trace */
+typedef enum H5FD_trace_op_t {
+    H5FD_TRACE_OPEN = 0,        /* File opened */
+    H5FD_TRACE_CLOSE,           /* File closed */
+    H5FD_TRACE_READ,            /* Bytes read */
+    H5FD_TRACE_WRITE,           /* Bytes written */
+    H5FD_TRACE_FLUSH,           /* File flushed */
+    H5FD_TRACE_TRUNCATE,        /* File truncated to its EOA */
+    H5FD_TRACE_NOPS             /* Number of operations (must be last) */
+} H5FD_trace_op_t;
+
+/* Start of a trace file */
+typedef struct H5FD_trace_header_t {
+    char        magic[8];       /* H5FD_TRACE_MAGIC */
+    unsigned    version;        /* H5FD_TRACE_VERSION */
+    unsigned    rec_size;       /* Size of each record, to catch traces from other platforms */
+} H5FD_trace_header_t;
+
+/* One operation */
+typedef struct H5FD_trace_rec_t {
+    double      start;          /* Seconds from the file's open to the start of the operation */
+    double      elapsed;        /* Seconds the operation took */
+    haddr_t     addr;           /* Address read or written */
+    hsize_t     size;           /* Number of bytes read or written */
+    hsize_t     api_call;       /* Serial number of the API call that caused the operation */
+    unsigned    file;           /* Serial number of the file's open */
+    unsigned    op;             /* Operation (H5FD_trace_op_t) */
+    int         type;           /* Type of data read or written (H5FD_mem_t) */
+    char        api_name[H5FD_TRACE_NAME_LEN];  /* Name of the API routine, if the library keeps a function stack */
+} H5FD_trace_rec_t;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+H5_DLL hid_t H5FD_trace_init(void);
+H5_DLL herr_t H5Pset_fapl_trace(hid_t fapl_id, const char *trace_file, hid_t under_fapl_id);
+H5_DLL herr_t H5Pget_fapl_trace(hid_t fapl_id, char *trace_file/*out*/, size_t size,
+    hid_t *under_fapl_id/*out*/);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
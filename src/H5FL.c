@@ -23,6 +23,9 @@
  *      from different datasets and an attempt is made to optimize access to
  *      the proper free list of blocks by using these priority queues to
  *      move frequently accessed free lists to the head of the queue.
+ *      Block sizes are rounded up to a size class (eight per power of two)
+ *      so that blocks of nearby sizes share a free list, which keeps the
+ *      queues short and lets freed blocks be re-used more often.
  */
 
 #include "H5FLmodule.h"         /* This source code file is part of the H5FL module */
@@ -34,6 +37,7 @@
 #include "H5Eprivate.h"		/* Error handling		  	*/
 #include "H5FLprivate.h"	/* Free Lists                           */
 #include "H5MMprivate.h"	/* Memory management			*/
+#include "H5VMprivate.h"	/* Vectors and arrays 			*/
 
 /*
  * Private type definitions
@@ -52,6 +56,14 @@ static size_t H5FL_blk_lst_mem_lim=1024*1024;   /* Default to 1024KB (1MB) limit
 static size_t H5FL_fac_glb_mem_lim=16*1024*1024; /* Default to 16MB limit on all factory free lists */
 static size_t H5FL_fac_lst_mem_lim=1024*1024;     /* Default to 1024KB (1MB) limit on each factory free list */
 
+/* Size classes for block free lists: blocks up to H5FL_BLK_SMALL_SIZE bytes
+ * are rounded up to a multiple of H5FL_BLK_SMALL_ALIGN, larger ones to one of
+ * 2^H5FL_BLK_CLASS_BITS steps between consecutive powers of two.
+ */
+#define H5FL_BLK_SMALL_SIZE     128
+#define H5FL_BLK_SMALL_ALIGN    16
+#define H5FL_BLK_CLASS_BITS     3
+
 /* A garbage collection node for regular free lists */
 typedef struct H5FL_reg_gc_node_t {
     H5FL_reg_head_t *list;              /* Pointer to the head of the list to garbage collect */
@@ -138,6 +150,7 @@ static herr_t H5FL__arr_gc_list(H5FL_arr_head_t *head);
 static int H5FL__arr_term(void);
 static herr_t H5FL__blk_gc(void);
 static herr_t H5FL__blk_gc_list(H5FL_blk_head_t *head);
+static size_t H5FL__blk_size_class(size_t size);
 static int H5FL__blk_term(void);
 static herr_t H5FL__fac_gc(void);
 static herr_t H5FL__fac_gc_list(H5FL_fac_head_t *head);
@@ -669,6 +682,39 @@ HDprintf("%s: head->name = %s, head->allocated = %d\n", FUNC, H5FL_reg_gc_head.f
 }   /* end H5FL__reg_term() */
 
 
+/*-------------------------------------------------------------------------
+ * Function:	H5FL__blk_size_class
+ *
+ * Purpose:	Rounds a block size up to its size class.  Blocks are
+ *      allocated, and kept on the free lists, at their class size, which
+ *      wastes at most 1/8th of a large block.
+ *
+ * Return:	The class size for blocks of SIZE bytes (never fails)
+ *
+ *-------------------------------------------------------------------------
+ */
+static size_t
+H5FL__blk_size_class(size_t size)
+{
+    size_t step;                /* Distance between classes around SIZE */
+    size_t ret_value = 0;       /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    if(size <= H5FL_BLK_SMALL_SIZE)
+        step = H5FL_BLK_SMALL_ALIGN;
+    else
+        step = (size_t)1 << (H5VM_log2_gen((uint64_t)size) - H5FL_BLK_CLASS_BITS);
+    ret_value = (size + (step - 1)) & ~(step - 1);
+
+    /* Don't round past the largest representable size */
+    if(ret_value < size)
+        ret_value = size;
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FL__blk_size_class() */
+
+
 /*-------------------------------------------------------------------------
  * Function:	H5FL_blk_find_list
  *
@@ -856,7 +902,7 @@ H5FL_blk_free_block_avail(H5FL_blk_head_t *head, size_t size)
 
     /* check if there is a free list for blocks of this size */
     /* and if there are any blocks available on the list */
-    if((free_list = H5FL_blk_find_list(&(head->head), size)) != NULL && free_list->list != NULL)
+    if((free_list = H5FL_blk_find_list(&(head->head), H5FL__blk_size_class(size))) != NULL && free_list->list != NULL)
         ret_value = TRUE;
     else
         ret_value = FALSE;
@@ -900,6 +946,9 @@ H5FL_blk_malloc(H5FL_blk_head_t *head, size_t size H5FL_TRACK_PARAMS)
         if(H5FL_blk_init(head)<0)
             HGOTO_ERROR(H5E_RESOURCE, H5E_CANTINIT, NULL, "can't initialize 'block' list")
 
+    /* Blocks are handed out, and recycled, at their class size */
+    size = H5FL__blk_size_class(size);
+
     /* check if there is a free list for blocks of this size */
     /* and if there are any blocks available on the list */
     if((free_list=H5FL_blk_find_list(&(head->head),size))!=NULL && free_list->list!=NULL) {
@@ -1135,8 +1184,8 @@ H5FL_blk_realloc(H5FL_blk_head_t *head, void *block, size_t new_size H5FL_TRACK_
         /* Get the pointer to the chunk info header in front of the chunk to free */
         temp = (H5FL_blk_list_t *)((void *)((unsigned char *)block - (sizeof(H5FL_blk_list_t) + H5FL_TRACK_SIZE))); /*lint !e826 Pointer-to-pointer cast is appropriate here */
 
-        /* check if we are actually changing the size of the buffer */
-        if(new_size!=temp->size) {
+        /* check if we are actually changing the size class of the buffer */
+        if(H5FL__blk_size_class(new_size)!=temp->size) {
             size_t blk_size;           /* Temporary block size */
 
             if((ret_value=H5FL_blk_malloc(head,new_size H5FL_TRACK_INFO_INT))==NULL)
@@ -2531,3 +2580,118 @@ H5FL_set_free_list_limits(int reg_global_lim, int reg_list_lim, int arr_global_l
     FUNC_LEAVE_NOAPI(ret_value)
 }   /* end H5FL_set_free_list_limits() */
 
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5FL_iterate_stats
+ *
+ * Purpose:	Calls OP with the statistics of each free list that has been
+ *      used, for reporting how much memory is held by the free lists and
+ *      which lists hold it.
+ *
+ * Return:	Success:	non-negative
+ *
+ *		Failure:	negative
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5FL_iterate_stats(H5FL_stats_op_t op, void *op_data)
+{
+    H5FL_reg_gc_node_t *reg_node;   /* Pointer into the list of regular free lists */
+    H5FL_gc_arr_node_t *arr_node;   /* Pointer into the list of array free lists */
+    H5FL_blk_gc_node_t *blk_node;   /* Pointer into the list of block free lists */
+    H5FL_fac_gc_node_t *fac_node;   /* Pointer into the list of factory free lists */
+    H5FL_stats_t stats;             /* Statistics for the current list */
+    herr_t ret_value = SUCCEED;     /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    HDassert(op);
+
+    /* Regular free lists */
+    stats.kind = H5FL_KIND_REG;
+    for(reg_node = H5FL_reg_gc_head.first; reg_node; reg_node = reg_node->next) {
+        stats.name = reg_node->list->name;
+        stats.allocated = reg_node->list->allocated;
+        stats.onlist = reg_node->list->onlist;
+        stats.list_mem = reg_node->list->onlist * reg_node->list->size;
+        if((op)(&stats, op_data) < 0)
+            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTNEXT, FAIL, "iteration over regular free lists failed")
+    } /* end for */
+
+    /* Array free lists */
+    stats.kind = H5FL_KIND_ARR;
+    for(arr_node = H5FL_arr_gc_head.first; arr_node; arr_node = arr_node->next) {
+        H5FL_arr_head_t *head = arr_node->list;
+        int u;
+
+        stats.name = head->name;
+        stats.allocated = head->allocated;
+        stats.onlist = 0;
+        for(u = 0; u < head->maxelem; u++)
+            stats.onlist += head->list_arr[u].onlist;
+        stats.list_mem = head->list_mem;
+        if((op)(&stats, op_data) < 0)
+            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTNEXT, FAIL, "iteration over array free lists failed")
+    } /* end for */
+
+    /* Block free lists */
+    stats.kind = H5FL_KIND_BLK;
+    for(blk_node = H5FL_blk_gc_head.first; blk_node; blk_node = blk_node->next) {
+        stats.name = blk_node->pq->name;
+        stats.allocated = blk_node->pq->allocated;
+        stats.onlist = blk_node->pq->onlist;
+        stats.list_mem = blk_node->pq->list_mem;
+        if((op)(&stats, op_data) < 0)
+            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTNEXT, FAIL, "iteration over block free lists failed")
+    } /* end for */
+
+    /* Factory free lists */
+    stats.kind = H5FL_KIND_FAC;
+    stats.name = NULL;
+    for(fac_node = H5FL_fac_gc_head.first; fac_node; fac_node = fac_node->next) {
+        stats.allocated = fac_node->list->allocated;
+        stats.onlist = fac_node->list->onlist;
+        stats.list_mem = fac_node->list->onlist * fac_node->list->size;
+        if((op)(&stats, op_data) < 0)
+            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTNEXT, FAIL, "iteration over factory free lists failed")
+    } /* end for */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+}   /* end H5FL_iterate_stats() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5FL_get_free_list_sizes
+ *
+ * Purpose:	Gets the current size of the different kinds of free lists.
+ *      Any of the output pointers may be NULL.
+ *
+ * Return:	Success:	non-negative
+ *
+ *		Failure:	negative (never fails)
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5FL_get_free_list_sizes(size_t *reg_size, size_t *arr_size, size_t *blk_size,
+    size_t *fac_size)
+{
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_NOAPI_NOERR
+
+    /* The global counts are kept up to date by the allocation routines */
+    if(reg_size)
+        *reg_size = H5FL_reg_gc_head.mem_freed;
+    if(arr_size)
+        *arr_size = H5FL_arr_gc_head.mem_freed;
+    if(blk_size)
+        *blk_size = H5FL_blk_gc_head.mem_freed;
+    if(fac_size)
+        *fac_size = H5FL_fac_gc_head.mem_freed;
+
+    FUNC_LEAVE_NOAPI(ret_value)
+}   /* end H5FL_get_free_list_sizes() */
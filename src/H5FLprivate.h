@@ -384,6 +384,26 @@ typedef struct H5FL_fac_head_t {
 #define H5FL_FAC_FREE(f, obj) H5MM_xfree(obj)
 #endif /* H5_NO_FAC_FREE_LISTS */
 
+/* Kinds of free lists, for reporting statistics */
+typedef enum H5FL_kind_t {
+    H5FL_KIND_REG,      /* Regular free lists */
+    H5FL_KIND_ARR,      /* Array (and sequence) free lists */
+    H5FL_KIND_BLK,      /* Block free lists */
+    H5FL_KIND_FAC       /* Factory free lists */
+} H5FL_kind_t;
+
+/* Statistics for a single free list */
+typedef struct H5FL_stats_t {
+    H5FL_kind_t kind;   /* Kind of free list */
+    const char *name;   /* Name of the type (NULL for factories) */
+    unsigned allocated; /* Number of blocks allocated (in use or on the free list) */
+    unsigned onlist;    /* Number of blocks on the free list */
+    size_t list_mem;    /* Amount of memory in blocks on the free list */
+} H5FL_stats_t;
+
+/* Callback for iterating over the statistics of the free lists */
+typedef herr_t (*H5FL_stats_op_t)(const H5FL_stats_t *stats, void *op_data);
+
 /*
  * Library prototypes.
  */
@@ -423,6 +443,9 @@ H5_DLL herr_t H5FL_garbage_coll(void);
 H5_DLL herr_t H5FL_set_free_list_limits(int reg_global_lim, int reg_list_lim,
     int arr_global_lim, int arr_list_lim, int blk_global_lim, int blk_list_lim,
     int fac_global_lim, int fac_list_lim);
+H5_DLL herr_t H5FL_iterate_stats(H5FL_stats_op_t op, void *op_data);
+H5_DLL herr_t H5FL_get_free_list_sizes(size_t *reg_size, size_t *arr_size,
+    size_t *blk_size, size_t *fac_size);
 H5_DLL int   H5FL_term_interface(void);
 
 #endif
@@ -1888,6 +1888,107 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* H5FS_sect_find() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FS_sect_find_below
+ *
+ * Purpose:     Locate the section of free space with the lowest address
+ *              that is large enough to fulfill request and starts before
+ *              MAX_ADDR.  Unlike H5FS_sect_find(), which picks the best
+ *              fit by size, this only considers sections below MAX_ADDR,
+ *              so a suitable low section is found even when larger
+ *              sections exist higher in the file.
+ *
+ *              Sections that aren't tracked on the address-ordered merge
+ *              list are never returned.
+ *
+ * Return:      TRUE if a section was found, FALSE if not, FAIL on error
+ *
+ *-------------------------------------------------------------------------
+ */
+htri_t
+H5FS_sect_find_below(H5F_t *f, H5FS_t *fspace, hsize_t request, haddr_t max_addr,
+    H5FS_section_info_t **node)
+{
+    hbool_t sinfo_valid = FALSE;        /* Whether the section info is valid */
+    hbool_t sinfo_modified = FALSE;     /* Whether the section info was modified */
+    htri_t ret_value = FALSE;           /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    /* Check arguments. */
+    HDassert(fspace);
+    HDassert(fspace->nclasses);
+    HDassert(request);
+    HDassert(node);
+
+    /* Check for any sections on free space list */
+    if(fspace->tot_sect_count > 0) {
+        H5SL_node_t *curr_sect_node;    /* Current section in the merge list */
+        hsize_t alignment;              /* Alignment for the request */
+
+        /* Get a pointer to the section info */
+        if(H5FS__sinfo_lock(f, fspace, H5AC__NO_FLAGS_SET) < 0)
+            HGOTO_ERROR(H5E_FSPACE, H5E_CANTGET, FAIL, "can't get section info")
+        sinfo_valid = TRUE;
+
+        alignment = fspace->alignment;
+        if(!((alignment > 1) && (request >= fspace->align_thres)))
+            alignment = 0; /* no alignment */
+
+        /* Walk the sections in address order, stopping at MAX_ADDR */
+        curr_sect_node = fspace->sinfo->merge_list ? H5SL_first(fspace->sinfo->merge_list) : NULL;
+        while(curr_sect_node != NULL) {
+            H5FS_section_info_t *curr_sect;     /* Current section */
+            const H5FS_section_class_t *cls;    /* Class of section */
+            hsize_t frag_size = 0;              /* Size of fragment for alignment */
+
+            curr_sect = (H5FS_section_info_t *)H5SL_item(curr_sect_node);
+            HDassert(H5F_addr_defined(curr_sect->addr));
+            if(H5F_addr_ge(curr_sect->addr, max_addr))
+                break;
+
+            cls = &fspace->sect_cls[curr_sect->type];
+            if(alignment && (curr_sect->addr % alignment))
+                frag_size = alignment - (curr_sect->addr % alignment);
+
+            if(curr_sect->size >= (request + frag_size) && (0 == frag_size || cls->split)
+                    && H5F_addr_lt(curr_sect->addr + frag_size, max_addr)) {
+                /* Remove the section from the free space manager */
+                if(H5FS__sect_remove_real(fspace, curr_sect) < 0)
+                    HGOTO_ERROR(H5E_FSPACE, H5E_CANTRELEASE, FAIL, "can't remove section")
+                sinfo_modified = TRUE;
+                *node = curr_sect;
+
+                /* Give the fragment in front of the aligned space back */
+                if(frag_size) {
+                    H5FS_section_info_t *split_sect;    /* Unused fragment for aligning section */
+
+                    split_sect = cls->split(*node, frag_size);
+                    if(H5FS__sect_link(fspace, split_sect, 0) < 0)
+                        HGOTO_ERROR(H5E_FSPACE, H5E_CANTINSERT, FAIL, "can't insert free space section into skip list")
+                    HDassert(split_sect->addr < (*node)->addr);
+                    HDassert(request <= (*node)->size);
+                } /* end if */
+
+                HGOTO_DONE(TRUE)
+            } /* end if */
+
+            curr_sect_node = H5SL_next(curr_sect_node);
+        } /* end while */
+    } /* end if */
+
+done:
+    /* Release the section info */
+    if(sinfo_valid && H5FS__sinfo_unlock(f, fspace, sinfo_modified) < 0)
+        HDONE_ERROR(H5E_FSPACE, H5E_CANTRELEASE, FAIL, "can't release section info")
+
+#ifdef H5FS_DEBUG_ASSERT
+    H5FS__assert(fspace);
+#endif /* H5FS_DEBUG_ASSERT */
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5FS_sect_find_below() */
+
 
 /*-------------------------------------------------------------------------
  * Function:    H5FS_iterate_sect_cb
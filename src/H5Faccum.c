@@ -71,6 +71,15 @@ typedef enum {
 /********************/
 /* Local Prototypes */
 /********************/
+static int H5F__accum_lru_find(const H5F_file_t *f_sh, haddr_t addr,
+    size_t size, hbool_t contained);
+static void H5F__accum_lru_touch(H5F_file_t *f_sh, unsigned idx);
+static void H5F__accum_lru_remove(H5F_file_t *f_sh, unsigned idx);
+static void H5F__accum_lru_update(H5F_file_t *f_sh, haddr_t addr, size_t size,
+    const void *buf);
+static void H5F__accum_lru_evict(H5F_file_t *f_sh, haddr_t addr, hsize_t size);
+static herr_t H5F__accum_park(H5F_file_t *f_sh);
+static herr_t H5F__accum_reactivate(H5F_file_t *f_sh, unsigned idx);
 
 
 /*********************/
@@ -114,7 +123,6 @@ herr_t
 H5F__accum_read(H5F_t *f, H5FD_mem_t map_type, haddr_t addr,
     size_t size, void *buf/*out*/)
 {
-    H5FD_t *file;                       /* File driver pointer */
     herr_t ret_value = SUCCEED;         /* Return value */
 
     FUNC_ENTER_PACKAGE
@@ -123,9 +131,6 @@ H5F__accum_read(H5F_t *f, H5FD_mem_t map_type, haddr_t addr,
     HDassert(f);
     HDassert(buf);
 
-    /* Translate to file driver I/O info object */
-    file = f->shared->lf;
-
     /* Check if this information is in the metadata accumulator */
     if((f->shared->feature_flags & H5FD_FEAT_ACCUMULATE_METADATA) && map_type != H5FD_MEM_DRAW) {
         H5F_meta_accum_t *accum;     /* Alias for file's metadata accumulator */
@@ -134,6 +139,8 @@ H5F__accum_read(H5F_t *f, H5FD_mem_t map_type, haddr_t addr,
         accum = &f->shared->accum;
 
         if(size < H5F_ACCUM_MAX_SIZE) {
+            int idx;                        /* Index of parked region */
+
             /* Sanity check */
             HDassert(!accum->buf || (accum->alloc_size >= accum->size));
 
@@ -145,6 +152,12 @@ H5F__accum_read(H5F_t *f, H5FD_mem_t map_type, haddr_t addr,
                 haddr_t new_addr;           /* New address of the accumulator buffer */
                 size_t new_size;            /* New size of the accumulator buffer */
 
+                /* Track whether the read is entirely within the accumulator */
+                if(H5F_addr_le(accum->loc, addr) && H5F_addr_le(addr + size, accum->loc + accum->size))
+                    f->shared->accum_stats.read_hits++;
+                else
+                    f->shared->accum_stats.read_misses++;
+
                 /* Compute new values for accumulator */
                 new_addr = MIN(addr, accum->loc);
                 new_size = (size_t)(MAX((addr + size), (accum->loc + accum->size)) - new_addr);
@@ -180,7 +193,7 @@ H5F__accum_read(H5F_t *f, H5FD_mem_t map_type, haddr_t addr,
                         accum->dirty_off += amount_before;
 
                     /* Dispatch to driver */
-                    if(H5FD_read(file, map_type, addr, amount_before, accum->buf) < 0)
+                    if(H5F__fd_read(f->shared, map_type, addr, amount_before, accum->buf) < 0)
                         HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "driver read request failed")
                 } /* end if */
                 else
@@ -194,7 +207,7 @@ H5F__accum_read(H5F_t *f, H5FD_mem_t map_type, haddr_t addr,
                     H5_CHECKED_ASSIGN(amount_after, size_t, ((addr + size) - (accum->loc + accum->size)), hsize_t);
 
                     /* Dispatch to driver */
-                    if(H5FD_read(file, map_type, (accum->loc + accum->size), amount_after, (accum->buf + accum->size + amount_before)) < 0)
+                    if(H5F__fd_read(f->shared, map_type, (accum->loc + accum->size), amount_after, (accum->buf + accum->size + amount_before)) < 0)
                         HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "driver read request failed")
                 } /* end if */
 
@@ -205,18 +218,35 @@ H5F__accum_read(H5F_t *f, H5FD_mem_t map_type, haddr_t addr,
                 accum->loc = new_addr;
                 accum->size = new_size;
             } /* end if */
+            /* Current read is within a parked (clean) accumulator region */
+            else if((idx = H5F__accum_lru_find(f->shared, addr, size, TRUE)) >= 0) {
+                H5F_meta_accum_t *region = &f->shared->accum_lru[idx];
+
+                /* Copy the data out of the parked region */
+                H5MM_memcpy(buf, region->buf + (addr - region->loc), size);
+
+                /* Make the region the most recently used one */
+                H5F__accum_lru_touch(f->shared, (unsigned)idx);
+
+                f->shared->accum_stats.read_hits++;
+            } /* end if */
             /* Current read doesn't overlap with metadata accumulator, read it from file */
             else {
                 /* Dispatch to driver */
-                if(H5FD_read(file, map_type, addr, size, buf) < 0)
+                if(H5F__fd_read(f->shared, map_type, addr, size, buf) < 0)
                     HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "driver read request failed")
+
+                f->shared->accum_stats.read_misses++;
             } /* end else */
         } /* end if */
         else {
             /* Read the data */
-            if(H5FD_read(file, map_type, addr, size, buf) < 0)
+            if(H5F__fd_read(f->shared, map_type, addr, size, buf) < 0)
                 HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "driver read request failed")
 
+            /* Reads too large for the accumulator always go to the file */
+            f->shared->accum_stats.read_misses++;
+
             /* Check for overlap w/dirty accumulator */
             /* (Note that this could be improved by updating the non-dirty
              *  information in the accumulator with [some of] the information
@@ -257,7 +287,7 @@ H5F__accum_read(H5F_t *f, H5FD_mem_t map_type, haddr_t addr,
     } /* end if */
     else {
         /* Read the data */
-        if(H5FD_read(file, map_type, addr, size, buf) < 0)
+        if(H5F__fd_read(f->shared, map_type, addr, size, buf) < 0)
             HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "driver read request failed")
     } /* end else */
 
@@ -280,7 +310,7 @@ done:
  *-------------------------------------------------------------------------
  */
 static herr_t
-H5F__accum_adjust(H5F_meta_accum_t *accum, H5FD_t *file,
+H5F__accum_adjust(H5F_meta_accum_t *accum, H5F_file_t *f_sh,
     H5F_accum_adjust_t adjust, size_t size)
 {
     herr_t      ret_value = SUCCEED;    /* Return value */
@@ -288,7 +318,7 @@ H5F__accum_adjust(H5F_meta_accum_t *accum, H5FD_t *file,
     FUNC_ENTER_STATIC
 
     HDassert(accum);
-    HDassert(file);
+    HDassert(f_sh);
     HDassert(H5F_ACCUM_APPEND == adjust || H5F_ACCUM_PREPEND == adjust);
     HDassert(size > 0);
     HDassert(size <= H5F_ACCUM_MAX_SIZE);
@@ -346,7 +376,7 @@ H5F__accum_adjust(H5F_meta_accum_t *accum, H5FD_t *file,
                     /* Check if the dirty region overlaps the region to eliminate from the accumulator */
                     if((accum->size - shrink_size) < (accum->dirty_off + accum->dirty_len)) {
                         /* Write out the dirty region from the metadata accumulator, with dispatch to driver */
-                        if(H5FD_write(file, H5FD_MEM_DEFAULT, (accum->loc + accum->dirty_off), accum->dirty_len, (accum->buf + accum->dirty_off)) < 0)
+                        if(H5F__fd_write(f_sh, H5FD_MEM_DEFAULT, (accum->loc + accum->dirty_off), accum->dirty_len, (accum->buf + accum->dirty_off)) < 0)
                             HGOTO_ERROR(H5E_FILE, H5E_WRITEERROR, FAIL, "file write failed")
 
                         /* Reset accumulator dirty flag */
@@ -357,7 +387,7 @@ H5F__accum_adjust(H5F_meta_accum_t *accum, H5FD_t *file,
                     /* Check if the dirty region overlaps the region to eliminate from the accumulator */
                     if(shrink_size > accum->dirty_off) {
                         /* Write out the dirty region from the metadata accumulator, with dispatch to driver */
-                        if(H5FD_write(file, H5FD_MEM_DEFAULT, (accum->loc + accum->dirty_off), accum->dirty_len, (accum->buf + accum->dirty_off)) < 0)
+                        if(H5F__fd_write(f_sh, H5FD_MEM_DEFAULT, (accum->loc + accum->dirty_off), accum->dirty_len, (accum->buf + accum->dirty_off)) < 0)
                             HGOTO_ERROR(H5E_FILE, H5E_WRITEERROR, FAIL, "file write failed")
 
                         /* Reset accumulator dirty flag */
@@ -422,7 +452,6 @@ herr_t
 H5F__accum_write(H5F_t *f, H5FD_mem_t map_type, haddr_t addr,
     size_t size, const void *buf)
 {
-    H5FD_t *file;                       /* File driver pointer */
     herr_t ret_value = SUCCEED;         /* Return value */
 
     FUNC_ENTER_NOAPI(FAIL)
@@ -432,9 +461,6 @@ H5F__accum_write(H5F_t *f, H5FD_mem_t map_type, haddr_t addr,
     HDassert(H5F_INTENT(f) & H5F_ACC_RDWR);
     HDassert(buf);
 
-    /* Translate to file driver pointer */
-    file = f->shared->lf;
-
     /* Check for accumulating metadata */
     if((f->shared->feature_flags & H5FD_FEAT_ACCUMULATE_METADATA) && map_type != H5FD_MEM_DRAW) {
         H5F_meta_accum_t *accum;     /* Alias for file's metadata accumulator */
@@ -446,12 +472,39 @@ H5F__accum_write(H5F_t *f, H5FD_mem_t map_type, haddr_t addr,
             /* Sanity check */
             HDassert(!accum->buf || (accum->alloc_size >= accum->size));
 
+            /* Keep any parked regions consistent with the new metadata */
+            H5F__accum_lru_update(f->shared, addr, size, buf);
+
+            /* Check if the new metadata misses the current accumulator */
+            if(accum->size == 0 || !(H5F_addr_overlap(addr, size, accum->loc, accum->size)
+                    || (addr + size) == accum->loc
+                    || addr == (accum->loc + accum->size))) {
+                int idx;        /* Index of parked region */
+
+                /* Check for a parked region that the new metadata joins */
+                if((idx = H5F__accum_lru_find(f->shared, addr, size, FALSE)) >= 0) {
+                    /* Write out any dirty metadata in the current accumulator */
+                    if(H5F__accum_flush(f) < 0)
+                        HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "can't flush metadata accumulator")
+
+                    /* Swap the parked region in as the accumulator */
+                    if(H5F__accum_reactivate(f->shared, (unsigned)idx) < 0)
+                        HGOTO_ERROR(H5E_IO, H5E_CANTRESET, FAIL, "can't reactivate parked accumulator region")
+
+                    f->shared->accum_stats.write_hits++;
+                } /* end if */
+                else
+                    f->shared->accum_stats.write_misses++;
+            } /* end if */
+            else
+                f->shared->accum_stats.write_hits++;
+
             /* Check if there is already metadata in the accumulator */
             if(accum->size > 0) {
                 /* Check if the new metadata adjoins the beginning of the current accumulator */
                 if((addr + size) == accum->loc) {
                     /* Check if we need to adjust accumulator size */
-                    if(H5F__accum_adjust(accum, file, H5F_ACCUM_PREPEND, size) < 0)
+                    if(H5F__accum_adjust(accum, f->shared, H5F_ACCUM_PREPEND, size) < 0)
                         HGOTO_ERROR(H5E_IO, H5E_CANTRESIZE, FAIL, "can't adjust metadata accumulator")
 
                     /* Move the existing metadata to the proper location */
@@ -476,7 +529,7 @@ H5F__accum_write(H5F_t *f, H5FD_mem_t map_type, haddr_t addr,
                 /* Check if the new metadata adjoins the end of the current accumulator */
                 else if(addr == (accum->loc + accum->size)) {
                     /* Check if we need to adjust accumulator size */
-                    if(H5F__accum_adjust(accum, file, H5F_ACCUM_APPEND, size) < 0)
+                    if(H5F__accum_adjust(accum, f->shared, H5F_ACCUM_APPEND, size) < 0)
                         HGOTO_ERROR(H5E_IO, H5E_CANTRESIZE, FAIL, "can't adjust metadata accumulator")
 
                     /* Copy the new metadata to the end */
@@ -536,7 +589,7 @@ H5F__accum_write(H5F_t *f, H5FD_mem_t map_type, haddr_t addr,
                         H5_CHECKED_ASSIGN(add_size, size_t, (accum->loc - addr), hsize_t);
 
                         /* Check if we need to adjust accumulator size */
-                        if(H5F__accum_adjust(accum, file, H5F_ACCUM_PREPEND, add_size) < 0)
+                        if(H5F__accum_adjust(accum, f->shared, H5F_ACCUM_PREPEND, add_size) < 0)
                             HGOTO_ERROR(H5E_IO, H5E_CANTRESIZE, FAIL, "can't adjust metadata accumulator")
 
                         /* Calculate the proper offset of the existing metadata */
@@ -576,7 +629,7 @@ H5F__accum_write(H5F_t *f, H5FD_mem_t map_type, haddr_t addr,
                         H5_CHECKED_ASSIGN(add_size, size_t, (addr + size) - (accum->loc + accum->size), hsize_t);
 
                         /* Check if we need to adjust accumulator size */
-                        if(H5F__accum_adjust(accum, file, H5F_ACCUM_APPEND, add_size) < 0)
+                        if(H5F__accum_adjust(accum, f->shared, H5F_ACCUM_APPEND, add_size) < 0)
                             HGOTO_ERROR(H5E_IO, H5E_CANTRESIZE, FAIL, "can't adjust metadata accumulator")
 
                         /* Compute offset of dirty region (after adjusting accumulator) */
@@ -642,13 +695,19 @@ H5F__accum_write(H5F_t *f, H5FD_mem_t map_type, haddr_t addr,
                 else {
                     /* Write out the existing metadata accumulator, with dispatch to driver */
                     if(accum->dirty) {
-                        if(H5FD_write(file, H5FD_MEM_DEFAULT, accum->loc + accum->dirty_off, accum->dirty_len, accum->buf + accum->dirty_off) < 0)
+                        if(H5F__fd_write(f->shared, H5FD_MEM_DEFAULT, accum->loc + accum->dirty_off, accum->dirty_len, accum->buf + accum->dirty_off) < 0)
                             HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "file write failed")
 
                         /* Reset accumulator dirty flag */
                         accum->dirty = FALSE;
                     } /* end if */
 
+                    /* Park the (now clean) accumulator contents, in case
+                     *  metadata I/O comes back to this part of the file
+                     */
+                    if(H5F__accum_park(f->shared) < 0)
+                        HGOTO_ERROR(H5E_IO, H5E_CANTRESET, FAIL, "can't park metadata accumulator region")
+
                     /* Cache the new piece of metadata */
                     /* Check if we need to resize the buffer */
                     if(size > accum->alloc_size) {
@@ -738,9 +797,12 @@ H5F__accum_write(H5F_t *f, H5FD_mem_t map_type, haddr_t addr,
                     HGOTO_ERROR(H5E_IO, H5E_CANTRESET, FAIL, "can't reset accumulator")
 
             /* Write the data */
-            if(H5FD_write(file, map_type, addr, size, buf) < 0)
+            if(H5F__fd_write(f->shared, map_type, addr, size, buf) < 0)
                 HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "file write failed")
 
+            /* Keep any parked regions consistent with the new metadata */
+            H5F__accum_lru_update(f->shared, addr, size, buf);
+
             /* Check for overlap w/accumulator */
             /* (Note that this could be improved by updating the accumulator
              *  with [some of] the information just read in. -QAK)
@@ -823,7 +885,7 @@ H5F__accum_write(H5F_t *f, H5FD_mem_t map_type, haddr_t addr,
     } /* end if */
     else {
         /* Write the data */
-        if(H5FD_write(file, map_type, addr, size, buf) < 0)
+        if(H5F__fd_write(f->shared, map_type, addr, size, buf) < 0)
             HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "file write failed")
     } /* end else */
 
@@ -851,7 +913,6 @@ H5F__accum_free(H5F_t *f, H5FD_mem_t H5_ATTR_UNUSED type, haddr_t addr,
     hsize_t size)
 {
     H5F_meta_accum_t *accum;            /* Alias for file's metadata accumulator */
-    H5FD_t *file;                       /* File driver pointer */
     herr_t ret_value = SUCCEED;         /* Return value */
 
     FUNC_ENTER_PACKAGE
@@ -862,8 +923,9 @@ H5F__accum_free(H5F_t *f, H5FD_mem_t H5_ATTR_UNUSED type, haddr_t addr,
     /* Set up alias for file's metadata accumulator info */
     accum = &f->shared->accum;
 
-    /* Translate to file driver pointer */
-    file = f->shared->lf;
+    /* Drop any parked regions that overlap the freed block */
+    if(f->shared->feature_flags & H5FD_FEAT_ACCUMULATE_METADATA)
+        H5F__accum_lru_evict(f->shared, addr, size);
 
     /* Adjust the metadata accumulator to remove the freed block, if it overlaps */
     if((f->shared->feature_flags & H5FD_FEAT_ACCUMULATE_METADATA)
@@ -937,7 +999,7 @@ H5F__accum_free(H5F_t *f, H5FD_mem_t H5_ATTR_UNUSED type, haddr_t addr,
                     /* Check if block to free is entirely before dirty region */
                     if(H5F_addr_le(tail_addr, dirty_start)) {
                         /* Write out the entire dirty region of the accumulator */
-                        if(H5FD_write(file, H5FD_MEM_DEFAULT, dirty_start, accum->dirty_len, accum->buf + accum->dirty_off) < 0)
+                        if(H5F__fd_write(f->shared, H5FD_MEM_DEFAULT, dirty_start, accum->dirty_len, accum->buf + accum->dirty_off) < 0)
                             HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "file write failed")
                     } /* end if */
                     /* Block to free overlaps with some/all of dirty region */
@@ -952,7 +1014,7 @@ H5F__accum_free(H5F_t *f, H5FD_mem_t H5_ATTR_UNUSED type, haddr_t addr,
                         HDassert(write_size > 0);
 
                         /* Write out the unfreed dirty region of the accumulator */
-                        if(H5FD_write(file, H5FD_MEM_DEFAULT, dirty_start + dirty_delta, write_size, accum->buf + accum->dirty_off + dirty_delta) < 0)
+                        if(H5F__fd_write(f->shared, H5FD_MEM_DEFAULT, dirty_start + dirty_delta, write_size, accum->buf + accum->dirty_off + dirty_delta) < 0)
                             HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "file write failed")
                     } /* end if */
 
@@ -972,7 +1034,7 @@ H5F__accum_free(H5F_t *f, H5FD_mem_t H5_ATTR_UNUSED type, haddr_t addr,
                         HDassert(write_size > 0);
 
                         /* Write out the unfreed end of the dirty region of the accumulator */
-                        if(H5FD_write(file, H5FD_MEM_DEFAULT, dirty_start + dirty_delta, write_size, accum->buf + accum->dirty_off + dirty_delta) < 0)
+                        if(H5F__fd_write(f->shared, H5FD_MEM_DEFAULT, dirty_start + dirty_delta, write_size, accum->buf + accum->dirty_off + dirty_delta) < 0)
                             HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "file write failed")
                     } /* end if */
 
@@ -1024,13 +1086,8 @@ H5F__accum_flush(H5F_t *f)
 
     /* Check if we need to flush out the metadata accumulator */
     if((f->shared->feature_flags & H5FD_FEAT_ACCUMULATE_METADATA) && f->shared->accum.dirty) {
-        H5FD_t *file;                       /* File driver pointer */
-
-        /* Translate to file driver pointer */
-        file = f->shared->lf;
-
         /* Flush the metadata contents */
-        if(H5FD_write(file, H5FD_MEM_DEFAULT, f->shared->accum.loc + f->shared->accum.dirty_off, f->shared->accum.dirty_len, f->shared->accum.buf + f->shared->accum.dirty_off) < 0)
+        if(H5F__fd_write(f->shared, H5FD_MEM_DEFAULT, f->shared->accum.loc + f->shared->accum.dirty_off, f->shared->accum.dirty_len, f->shared->accum.buf + f->shared->accum.dirty_off) < 0)
             HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "file write failed")
 
         /* Reset the dirty flag */
@@ -1084,9 +1141,379 @@ H5F__accum_reset(H5F_t *f, hbool_t flush)
         f->shared->accum.loc = HADDR_UNDEF;
         f->shared->accum.dirty = FALSE;
         f->shared->accum.dirty_len = 0;
+
+        /* Drop all the parked regions */
+        while(f->shared->accum_nparked > 0) {
+            f->shared->accum_nparked--;
+            f->shared->accum_lru[f->shared->accum_nparked].buf = H5FL_BLK_FREE(meta_accum, f->shared->accum_lru[f->shared->accum_nparked].buf);
+        } /* end while */
     } /* end if */
 
 done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5F__accum_reset() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	H5F__accum_reset_stats
+ *
+ * Purpose:	Reset the statistics for the metadata accumulator
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5F__accum_reset_stats(H5F_t *f)
+{
+    FUNC_ENTER_PACKAGE_NOERR
+
+    /* Sanity checks */
+    HDassert(f);
+
+    HDmemset(&f->shared->accum_stats, 0, sizeof(H5F_accum_stats_t));
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5F__accum_reset_stats() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5F__accum_get_stats
+ *
+ * Purpose:	Retrieve the statistics for the metadata accumulator
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5F__accum_get_stats(const H5F_t *f, H5F_accum_stats_t *stats)
+{
+    FUNC_ENTER_PACKAGE_NOERR
+
+    /* Sanity checks */
+    HDassert(f);
+    HDassert(stats);
+
+    *stats = f->shared->accum_stats;
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5F__accum_get_stats() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5F__accum_lru_find
+ *
+ * Purpose:	Look for a parked accumulator region that contains the
+ *              block at ADDR (when CONTAINED is set), or that adjoins or
+ *              overlaps it (otherwise).
+ *
+ * Return:	Index of the region in the LRU list / -1 if there is none
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5F__accum_lru_find(const H5F_file_t *f_sh, haddr_t addr, size_t size,
+    hbool_t contained)
+{
+    unsigned u;                         /* Local index variable */
+    int ret_value = -1;                 /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    for(u = 0; u < f_sh->accum_nparked; u++) {
+        const H5F_meta_accum_t *region = &f_sh->accum_lru[u];
+
+        if(contained) {
+            if(H5F_addr_le(region->loc, addr) && H5F_addr_le(addr + size, region->loc + region->size)) {
+                ret_value = (int)u;
+                break;
+            } /* end if */
+        } /* end if */
+        else if(H5F_addr_overlap(addr, size, region->loc, region->size)
+                || (addr + size) == region->loc
+                || (region->loc + region->size) == addr) {
+            ret_value = (int)u;
+            break;
+        } /* end if */
+    } /* end for */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5F__accum_lru_find() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5F__accum_lru_touch
+ *
+ * Purpose:	Move a parked region to the front of the LRU list
+ *
+ * Return:	none
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5F__accum_lru_touch(H5F_file_t *f_sh, unsigned idx)
+{
+    FUNC_ENTER_STATIC_NOERR
+
+    HDassert(idx < f_sh->accum_nparked);
+
+    if(idx > 0) {
+        H5F_meta_accum_t region = f_sh->accum_lru[idx];
+
+        HDmemmove(&f_sh->accum_lru[1], &f_sh->accum_lru[0], idx * sizeof(H5F_meta_accum_t));
+        f_sh->accum_lru[0] = region;
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5F__accum_lru_touch() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5F__accum_lru_remove
+ *
+ * Purpose:	Remove a parked region from the LRU list.  (The region's
+ *              buffer is not released)
+ *
+ * Return:	none
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5F__accum_lru_remove(H5F_file_t *f_sh, unsigned idx)
+{
+    FUNC_ENTER_STATIC_NOERR
+
+    HDassert(idx < f_sh->accum_nparked);
+
+    HDmemmove(&f_sh->accum_lru[idx], &f_sh->accum_lru[idx + 1], ((f_sh->accum_nparked - idx) - 1) * sizeof(H5F_meta_accum_t));
+    f_sh->accum_nparked--;
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5F__accum_lru_remove() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5F__accum_lru_update
+ *
+ * Purpose:	Copy newly written metadata into any parked regions that it
+ *              overlaps, so they always match the current file contents.
+ *
+ * Return:	none
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5F__accum_lru_update(H5F_file_t *f_sh, haddr_t addr, size_t size,
+    const void *buf)
+{
+    unsigned u;                         /* Local index variable */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    for(u = 0; u < f_sh->accum_nparked; u++) {
+        H5F_meta_accum_t *region = &f_sh->accum_lru[u];
+
+        if(H5F_addr_overlap(addr, size, region->loc, region->size)) {
+            haddr_t start = MAX(addr, region->loc);
+            haddr_t end = MIN(addr + size, region->loc + region->size);
+
+            H5MM_memcpy(region->buf + (start - region->loc), (const unsigned char *)buf + (start - addr), (size_t)(end - start));
+        } /* end if */
+    } /* end for */
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5F__accum_lru_update() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5F__accum_lru_evict
+ *
+ * Purpose:	Drop any parked regions that overlap a block of the file
+ *
+ * Return:	none
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5F__accum_lru_evict(H5F_file_t *f_sh, haddr_t addr, hsize_t size)
+{
+    unsigned u;                         /* Local index variable */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    u = 0;
+    while(u < f_sh->accum_nparked) {
+        H5F_meta_accum_t *region = &f_sh->accum_lru[u];
+
+        if(H5F_addr_overlap(addr, size, region->loc, region->size)) {
+            region->buf = H5FL_BLK_FREE(meta_accum, region->buf);
+            H5F__accum_lru_remove(f_sh, u);
+        } /* end if */
+        else
+            u++;
+    } /* end while */
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5F__accum_lru_evict() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5F__accum_park
+ *
+ * Purpose:	Move the contents of the (clean) accumulator to the front
+ *              of the LRU list of parked regions, merging in any parked
+ *              regions that adjoin it and evicting the least recently used
+ *              region if the list is full.  The accumulator is left empty.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5F__accum_park(H5F_file_t *f_sh)
+{
+    H5F_meta_accum_t *accum = &f_sh->accum;     /* Alias for file's metadata accumulator */
+    unsigned char *spare_buf = NULL;    /* Buffer from evicted region */
+    size_t spare_size = 0;              /* Size of buffer from evicted region */
+    int idx;                            /* Index of parked region */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity check */
+    HDassert(!accum->dirty);
+
+    /* Nothing to park */
+    if(0 == accum->size)
+        HGOTO_DONE(SUCCEED)
+
+    /* Merge parked regions that adjoin or overlap the accumulator into it */
+    while((idx = H5F__accum_lru_find(f_sh, accum->loc, accum->size, FALSE)) >= 0) {
+        H5F_meta_accum_t *region = &f_sh->accum_lru[idx];
+        haddr_t new_loc;            /* New address of the accumulator */
+        size_t new_size;            /* New size of the accumulator */
+
+        /* Compute new values for accumulator */
+        new_loc = MIN(region->loc, accum->loc);
+        new_size = (size_t)(MAX((region->loc + region->size), (accum->loc + accum->size)) - new_loc);
+
+        /* Don't let merging grow the region too large */
+        if(new_size > H5F_ACCUM_MAX_SIZE)
+            break;
+
+        /* Check if we need more buffer space */
+        if(new_size > accum->alloc_size) {
+            size_t new_alloc_size;        /* New size of accumulator */
+
+            /* Adjust the buffer size to be a power of 2 that is large enough to hold data */
+            new_alloc_size = (size_t)1 << (1 + H5VM_log2_gen((uint64_t)(new_size - 1)));
+
+            /* Reallocate the metadata accumulator buffer */
+            if(NULL == (accum->buf = H5FL_BLK_REALLOC(meta_accum, accum->buf, new_alloc_size)))
+                HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "unable to allocate metadata accumulator buffer")
+
+            /* Note the new buffer size */
+            accum->alloc_size = new_alloc_size;
+        } /* end if */
+
+        /* Prepend the part of the parked region before the accumulator */
+        if(H5F_addr_lt(region->loc, accum->loc)) {
+            size_t amount_before = (size_t)(accum->loc - region->loc);
+
+            HDmemmove(accum->buf + amount_before, accum->buf, accum->size);
+            H5MM_memcpy(accum->buf, region->buf, amount_before);
+        } /* end if */
+
+        /* Append the part of the parked region after the accumulator */
+        if(H5F_addr_gt(region->loc + region->size, accum->loc + accum->size)) {
+            size_t amount_after = (size_t)((region->loc + region->size) - (accum->loc + accum->size));
+
+            H5MM_memcpy(accum->buf + (new_size - amount_after), region->buf + (region->size - amount_after), amount_after);
+        } /* end if */
+
+        /* Adjust the accumulator address & size */
+        accum->loc = new_loc;
+        accum->size = new_size;
+
+        /* Release the merged region */
+        region->buf = H5FL_BLK_FREE(meta_accum, region->buf);
+        H5F__accum_lru_remove(f_sh, (unsigned)idx);
+
+        f_sh->accum_stats.merges++;
+    } /* end while */
+
+    /* Evict the least recently used region, if the LRU list is full */
+    if(H5F_ACCUM_NPARKED == f_sh->accum_nparked) {
+        f_sh->accum_nparked--;
+        spare_buf = f_sh->accum_lru[f_sh->accum_nparked].buf;
+        spare_size = f_sh->accum_lru[f_sh->accum_nparked].alloc_size;
+
+        f_sh->accum_stats.evictions++;
+    } /* end if */
+
+    /* Put the accumulator's contents at the front of the LRU list */
+    HDmemmove(&f_sh->accum_lru[1], &f_sh->accum_lru[0], f_sh->accum_nparked * sizeof(H5F_meta_accum_t));
+    f_sh->accum_lru[0] = *accum;
+    f_sh->accum_nparked++;
+
+    f_sh->accum_stats.parks++;
+
+    /* Reuse the evicted region's buffer (if any) for the accumulator */
+    accum->buf = spare_buf;
+    accum->alloc_size = spare_size;
+    accum->loc = HADDR_UNDEF;
+    accum->size = 0;
+    accum->dirty_off = 0;
+    accum->dirty_len = 0;
+    accum->dirty = FALSE;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5F__accum_park() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5F__accum_reactivate
+ *
+ * Purpose:	Make a parked region the accumulator again, parking the
+ *              current (clean) contents of the accumulator in its place.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5F__accum_reactivate(H5F_file_t *f_sh, unsigned idx)
+{
+    H5F_meta_accum_t *accum = &f_sh->accum;     /* Alias for file's metadata accumulator */
+    H5F_meta_accum_t region;            /* Region to reactivate */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity check */
+    HDassert(!accum->dirty);
+    HDassert(idx < f_sh->accum_nparked);
+
+    /* Take the region out of the LRU list */
+    region = f_sh->accum_lru[idx];
+    H5F__accum_lru_remove(f_sh, idx);
+
+    /* Park the current accumulator contents */
+    if(H5F__accum_park(f_sh) < 0)
+        HGOTO_ERROR(H5E_IO, H5E_CANTRESET, FAIL, "can't park metadata accumulator region")
+
+    /* Release any buffer left in the accumulator */
+    if(accum->buf)
+        accum->buf = H5FL_BLK_FREE(meta_accum, accum->buf);
+
+    /* Make the parked region the accumulator */
+    *accum = region;
+
+    f_sh->accum_stats.reactivations++;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5F__accum_reactivate() */
+
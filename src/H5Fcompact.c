@@ -0,0 +1,480 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * Copyright by the Board of Trustees of the University of Illinois.         *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://support.hdfgroup.org/ftp/HDF5/releases.  *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*-------------------------------------------------------------------------
+ *
+ * Created:		H5Fcompact.c
+ *
+ * Purpose:		In-place compaction of a file: raw data blocks near the
+ *                      end of the file are moved into free space closer to
+ *                      the beginning, so that the file can be truncated.
+ *
+ *                      Only raw data (contiguous storage and chunks) is
+ *                      moved, and only into space that the file's
+ *                      free-space managers are tracking.
+ *
+ *-------------------------------------------------------------------------
+ */
+
+/****************/
+/* Module Setup */
+/****************/
+
+#include "H5Fmodule.h"          /* This source code file is part of the H5F module */
+
+
+/***********/
+/* Headers */
+/***********/
+#include "H5private.h"		/* Generic Functions			*/
+#include "H5Dprivate.h"		/* Datasets				*/
+#include "H5Eprivate.h"		/* Error handling		  	*/
+#include "H5Fpkg.h"         	/* File access				*/
+#include "H5FLprivate.h"	/* Free Lists                           */
+#include "H5Gprivate.h"		/* Groups				*/
+#include "H5MFprivate.h"	/* File memory management		*/
+#include "H5MMprivate.h"	/* Memory management			*/
+#include "H5Oprivate.h"		/* Object headers		  	*/
+#include "H5Pprivate.h"		/* Property lists			*/
+#include "H5SLprivate.h"	/* Skip lists				*/
+
+
+/****************/
+/* Local Macros */
+/****************/
+
+/* Maximum number of blocks considered for moving in one pass */
+#define H5F_COMPACT_MAX_BLOCKS          4096
+
+/* Size of the buffer used to copy raw data */
+#define H5F_COMPACT_BUF_SIZE            (1024 * 1024)
+
+
+/******************/
+/* Local Typedefs */
+/******************/
+
+/* A block of raw data that could be moved */
+typedef struct H5F_compact_block_t {
+    haddr_t addr;                       /* Address of the block (skip list key) */
+    hsize_t size;                       /* Size of the block */
+    haddr_t dset_addr;                  /* Address of the dataset's object header */
+    hbool_t chunked;                    /* Whether the block is a chunk */
+    hsize_t scaled[H5O_LAYOUT_NDIMS];   /* Scaled offset of the chunk */
+} H5F_compact_block_t;
+
+/* User data for collecting the blocks of raw data in a file */
+typedef struct H5F_compact_gather_ud_t {
+    H5F_t *f;                           /* File being compacted */
+    H5SL_t *blocks;                     /* Skip list of blocks, by address */
+    haddr_t dset_addr;                  /* Address of the current dataset */
+} H5F_compact_gather_ud_t;
+
+
+/********************/
+/* Package Typedefs */
+/********************/
+
+
+/********************/
+/* Local Prototypes */
+/********************/
+
+static herr_t H5F__compact_visit_cb(hid_t group, const char *name,
+    const H5L_info_t *linfo, void *_udata);
+static herr_t H5F__compact_gather_cb(haddr_t addr, hsize_t size,
+    const hsize_t *scaled, void *_udata);
+static herr_t H5F__compact_free_cb(void *item, void *key, void *op_data);
+static H5D_t *H5F__compact_open_dset(H5F_t *f, haddr_t addr);
+static herr_t H5F__compact_move(H5F_t *f, H5D_t *dset,
+    const H5F_compact_block_t *block, haddr_t new_addr, void *buf);
+
+
+/*********************/
+/* Package Variables */
+/*********************/
+
+
+/*****************************/
+/* Library Private Variables */
+/*****************************/
+
+
+/*******************/
+/* Local Variables */
+/*******************/
+
+/* Declare a free list to manage the H5F_compact_block_t struct */
+H5FL_DEFINE_STATIC(H5F_compact_block_t);
+
+/* Declare a free list to manage the copy buffer */
+H5FL_BLK_DEFINE_STATIC(compact_buf);
+
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5F__compact_visit_cb
+ *
+ * Purpose:     Gather the blocks of raw data of each dataset that is
+ *              reached by a hard link.
+ *
+ *              The datasets aren't remembered between passes, so the
+ *              memory used only depends on H5F_COMPACT_MAX_BLOCKS and
+ *              not on the number of datasets in the file.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5F__compact_visit_cb(hid_t H5_ATTR_UNUSED group, const char H5_ATTR_UNUSED *name,
+    const H5L_info_t *linfo, void *_udata)
+{
+    H5F_compact_gather_ud_t *udata = (H5F_compact_gather_ud_t *)_udata;  /* User data */
+    H5O_loc_t   oloc;                   /* Location of the object */
+    H5O_type_t  obj_type;               /* Type of the object */
+    H5D_t       *dset = NULL;           /* Dataset reached */
+    herr_t      ret_value = H5_ITER_CONT;       /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Soft and external links don't lead to objects in this file */
+    if(H5L_TYPE_HARD != linfo->type)
+        HGOTO_DONE(H5_ITER_CONT)
+
+    /* Check the type of the object */
+    H5O_loc_reset(&oloc);
+    oloc.file = udata->f;
+    oloc.addr = linfo->u.address;
+    if(H5O_obj_type(&oloc, &obj_type) < 0)
+        HGOTO_ERROR(H5E_FILE, H5E_CANTGET, H5_ITER_ERROR, "can't get object type")
+    if(H5O_TYPE_DATASET != obj_type)
+        HGOTO_DONE(H5_ITER_CONT)
+
+    /* Gather the dataset's blocks */
+    udata->dset_addr = linfo->u.address;
+    if(NULL == (dset = H5F__compact_open_dset(udata->f, linfo->u.address)))
+        HGOTO_ERROR(H5E_FILE, H5E_CANTOPENOBJ, H5_ITER_ERROR, "unable to open dataset")
+    if(H5D_raw_block_iterate(dset, H5F__compact_gather_cb, udata) < 0)
+        HGOTO_ERROR(H5E_FILE, H5E_BADITER, H5_ITER_ERROR, "unable to iterate over raw data")
+
+done:
+    if(dset && H5D_close(dset) < 0)
+        HDONE_ERROR(H5E_FILE, H5E_CLOSEERROR, H5_ITER_ERROR, "unable to close dataset")
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5F__compact_visit_cb() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5F__compact_gather_cb
+ *
+ * Purpose:     Remember a block of raw data, keeping only the blocks with
+ *              the highest addresses once the limit is reached.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5F__compact_gather_cb(haddr_t addr, hsize_t size, const hsize_t *scaled,
+    void *_udata)
+{
+    H5F_compact_gather_ud_t *udata = (H5F_compact_gather_ud_t *)_udata;  /* User data */
+    H5F_compact_block_t *block = NULL;  /* New block */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Skip blocks of datasets that were reached through another link */
+    if(NULL != H5SL_search(udata->blocks, &addr))
+        HGOTO_DONE(SUCCEED)
+
+    /* Don't bother with blocks lower than everything already gathered */
+    if(H5SL_count(udata->blocks) >= H5F_COMPACT_MAX_BLOCKS) {
+        H5F_compact_block_t *lowest = (H5F_compact_block_t *)H5SL_item(H5SL_first(udata->blocks));
+
+        if(H5F_addr_le(addr, lowest->addr))
+            HGOTO_DONE(SUCCEED)
+    } /* end if */
+
+    /* Describe the block */
+    if(NULL == (block = H5FL_CALLOC(H5F_compact_block_t)))
+        HGOTO_ERROR(H5E_FILE, H5E_CANTALLOC, FAIL, "can't allocate block info")
+    block->addr = addr;
+    block->size = size;
+    block->dset_addr = udata->dset_addr;
+    if(scaled) {
+        block->chunked = TRUE;
+        H5MM_memcpy(block->scaled, scaled, sizeof(block->scaled));
+    } /* end if */
+
+    if(H5SL_insert(udata->blocks, block, &block->addr) < 0) {
+        block = H5FL_FREE(H5F_compact_block_t, block);
+        HGOTO_ERROR(H5E_FILE, H5E_CANTINSERT, FAIL, "can't insert block info")
+    } /* end if */
+
+    /* Drop the lowest block, if there are too many */
+    if(H5SL_count(udata->blocks) > H5F_COMPACT_MAX_BLOCKS) {
+        block = (H5F_compact_block_t *)H5SL_remove_first(udata->blocks);
+        block = H5FL_FREE(H5F_compact_block_t, block);
+    } /* end if */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5F__compact_gather_cb() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5F__compact_free_cb
+ *
+ * Purpose:     Free a block info skip list item
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5F__compact_free_cb(void *item, void H5_ATTR_UNUSED *key, void H5_ATTR_UNUSED *op_data)
+{
+    FUNC_ENTER_STATIC_NOERR
+
+    HDassert(item);
+
+    item = H5FL_FREE(H5F_compact_block_t, item);
+
+    FUNC_LEAVE_NOAPI(0)
+} /* end H5F__compact_free_cb() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5F__compact_open_dset
+ *
+ * Purpose:     Open the dataset whose object header is at ADDR
+ *
+ * Return:      Success:    Pointer to the dataset
+ *              Failure:    NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+static H5D_t *
+H5F__compact_open_dset(H5F_t *f, haddr_t addr)
+{
+    H5G_loc_t   dset_loc;               /* Dataset location */
+    H5G_name_t  dset_path;              /* Dataset path */
+    H5O_loc_t   dset_oloc;              /* Dataset object location */
+    H5D_t       *ret_value = NULL;      /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Set up the dataset's location */
+    dset_loc.oloc = &dset_oloc;
+    dset_loc.path = &dset_path;
+    H5G_loc_reset(&dset_loc);
+    dset_oloc.file = f;
+    dset_oloc.addr = addr;
+    H5G_name_reset(&dset_path);     /* datasets opened here don't have a path name */
+
+    if(NULL == (ret_value = H5D_open(&dset_loc, H5P_DATASET_ACCESS_DEFAULT)))
+        HGOTO_ERROR(H5E_FILE, H5E_CANTOPENOBJ, NULL, "unable to open dataset")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5F__compact_open_dset() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5F__compact_move
+ *
+ * Purpose:     Copy a block of raw data to NEW_ADDR, point the dataset at
+ *              the new copy and release the old space.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5F__compact_move(H5F_t *f, H5D_t *dset, const H5F_compact_block_t *block,
+    haddr_t new_addr, void *buf)
+{
+    hsize_t offset;                     /* Offset of the piece to copy */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Copy the data, a piece at a time */
+    for(offset = 0; offset < block->size; ) {
+        size_t len = (size_t)MIN(block->size - offset, H5F_COMPACT_BUF_SIZE);
+
+        if(H5F_block_read(f, H5FD_MEM_DRAW, block->addr + offset, len, buf) < 0)
+            HGOTO_ERROR(H5E_FILE, H5E_READERROR, FAIL, "unable to read raw data")
+        if(H5F_block_write(f, H5FD_MEM_DRAW, new_addr + offset, len, buf) < 0)
+            HGOTO_ERROR(H5E_FILE, H5E_WRITEERROR, FAIL, "unable to write raw data")
+        offset += len;
+    } /* end for */
+
+    /* Point the dataset at the new copy */
+    if(H5D_raw_block_relocate(dset, block->chunked ? block->scaled : NULL, new_addr) < 0)
+        HGOTO_ERROR(H5E_FILE, H5E_CANTMODIFY, FAIL, "unable to relocate raw data")
+
+    /* Release the old space */
+    if(H5MF_xfree(f, H5FD_MEM_DRAW, block->addr, block->size) < 0)
+        HGOTO_ERROR(H5E_FILE, H5E_CANTFREE, FAIL, "unable to release file space")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5F__compact_move() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5F__compact
+ *
+ * Purpose:     Move raw data blocks from the end of the file into free
+ *              space earlier in the file, highest addresses first, until
+ *              no more blocks can be moved or MAX_BYTES bytes have been
+ *              moved (0 means no limit).  The file is then flushed, which
+ *              lets the file driver truncate any space released at the
+ *              end of the file.
+ *
+ *              Each call leaves the file consistent, so a large file can
+ *              be compacted a piece at a time with several calls.
+ *
+ *              No datasets in the file may be open.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5F__compact(H5F_t *f, hsize_t max_bytes, hsize_t *bytes_moved)
+{
+    H5F_compact_gather_ud_t gather_udata; /* User data for collecting blocks */
+    H5G_loc_t   root_loc;               /* Root group location */
+    H5SL_t      *blocks = NULL;         /* Blocks that could be moved */
+    H5D_t       *dset = NULL;           /* Dataset whose block is being moved */
+    void        *buf = NULL;            /* Buffer for copying raw data */
+    hsize_t     total = 0;              /* Number of bytes moved */
+    hbool_t     done_moving = FALSE;    /* Whether to stop */
+    size_t      nopen = 0;              /* Number of open datasets */
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Check args */
+    HDassert(f);
+    HDassert(f->shared);
+
+    /* Check that the file can be compacted */
+    if(0 == (H5F_INTENT(f) & H5F_ACC_RDWR))
+        HGOTO_ERROR(H5E_FILE, H5E_BADVALUE, FAIL, "no write intent on file")
+    if(H5F_INTENT(f) & H5F_ACC_SWMR_WRITE)
+        HGOTO_ERROR(H5E_FILE, H5E_UNSUPPORTED, FAIL, "can't compact a file opened for SWMR writing")
+    if(H5F_SHARED_NMOUNTS(f) > 0 || f->parent)
+        HGOTO_ERROR(H5E_FILE, H5E_UNSUPPORTED, FAIL, "can't compact a file with mounted files")
+    if(H5F_get_obj_count(f, H5F_OBJ_DATASET, FALSE, &nopen) < 0)
+        HGOTO_ERROR(H5E_FILE, H5E_CANTGET, FAIL, "can't get number of open datasets")
+    if(nopen > 0)
+        HGOTO_ERROR(H5E_FILE, H5E_BADVALUE, FAIL, "can't compact a file with open datasets")
+
+    if(H5G_root_loc(f, &root_loc) < 0)
+        HGOTO_ERROR(H5E_FILE, H5E_CANTGET, FAIL, "unable to create location for file")
+    if(NULL == (blocks = H5SL_create(H5SL_TYPE_HADDR, NULL)))
+        HGOTO_ERROR(H5E_FILE, H5E_CANTCREATE, FAIL, "can't create skip list")
+    if(NULL == (buf = H5FL_BLK_MALLOC(compact_buf, (size_t)H5F_COMPACT_BUF_SIZE)))
+        HGOTO_ERROR(H5E_FILE, H5E_CANTALLOC, FAIL, "can't allocate copy buffer")
+
+    /* Keep moving blocks until nothing more can be moved */
+    while(!done_moving) {
+        H5SL_node_t *node;              /* Skip list node */
+        hsize_t pass_moved = 0;         /* Bytes moved in this pass */
+
+        /* Gather the blocks with the highest addresses */
+        gather_udata.f = f;
+        gather_udata.blocks = blocks;
+        gather_udata.dset_addr = HADDR_UNDEF;
+        if(H5G_visit(&root_loc, ".", H5_INDEX_NAME, H5_ITER_NATIVE, H5F__compact_visit_cb, &gather_udata) < 0)
+            HGOTO_ERROR(H5E_FILE, H5E_BADITER, FAIL, "can't visit objects in file")
+        if(0 == H5SL_count(blocks))
+            break;
+
+        /* Move blocks, starting from the end of the file */
+        for(node = H5SL_last(blocks); node && !done_moving; node = H5SL_prev(node)) {
+            H5F_compact_block_t *block = (H5F_compact_block_t *)H5SL_item(node);
+            haddr_t new_addr;           /* Address to move the block to */
+
+            /* Check the limit on the amount of data to move */
+            if(max_bytes > 0 && total + block->size > max_bytes) {
+                done_moving = TRUE;
+                break;
+            } /* end if */
+
+            /* Look for space before the block */
+            if(H5MF_alloc_below(f, H5FD_MEM_DRAW, block->size, block->addr, &new_addr) < 0)
+                HGOTO_ERROR(H5E_FILE, H5E_CANTALLOC, FAIL, "unable to search for free space")
+            if(!H5F_addr_defined(new_addr))
+                continue;
+
+            /* Open the block's dataset, if it isn't already */
+            if(dset && !H5F_addr_eq(H5D_oloc(dset)->addr, block->dset_addr)) {
+                if(H5D_close(dset) < 0)
+                    HGOTO_ERROR(H5E_FILE, H5E_CLOSEERROR, FAIL, "unable to close dataset")
+                dset = NULL;
+            } /* end if */
+            if(NULL == dset)
+                if(NULL == (dset = H5F__compact_open_dset(f, block->dset_addr))) {
+                    /* Don't leak the space that was found */
+                    if(H5MF_xfree(f, H5FD_MEM_DRAW, new_addr, block->size) < 0)
+                        HDONE_ERROR(H5E_FILE, H5E_CANTFREE, FAIL, "unable to release file space")
+                    HGOTO_ERROR(H5E_FILE, H5E_CANTOPENOBJ, FAIL, "unable to open dataset")
+                } /* end if */
+
+            /* Move the block */
+            if(H5F__compact_move(f, dset, block, new_addr, buf) < 0)
+                HGOTO_ERROR(H5E_FILE, H5E_CANTMODIFY, FAIL, "unable to move raw data block")
+            total += block->size;
+            pass_moved += block->size;
+        } /* end for */
+
+        if(dset) {
+            if(H5D_close(dset) < 0)
+                HGOTO_ERROR(H5E_FILE, H5E_CLOSEERROR, FAIL, "unable to close dataset")
+            dset = NULL;
+        } /* end if */
+
+        /* Start the next pass with a fresh list of blocks */
+        if(H5SL_free(blocks, H5F__compact_free_cb, NULL) < 0)
+            HGOTO_ERROR(H5E_FILE, H5E_CANTFREE, FAIL, "can't release block info")
+
+        if(0 == pass_moved)
+            done_moving = TRUE;
+    } /* end while */
+
+    /* Flush the file, which truncates it to its new end */
+    if(total > 0)
+        if(H5F__flush(f) < 0)
+            HGOTO_ERROR(H5E_FILE, H5E_CANTFLUSH, FAIL, "unable to flush file")
+
+done:
+    if(dset && H5D_close(dset) < 0)
+        HDONE_ERROR(H5E_FILE, H5E_CLOSEERROR, FAIL, "unable to close dataset")
+    if(buf)
+        buf = H5FL_BLK_FREE(compact_buf, buf);
+    if(blocks && H5SL_destroy(blocks, H5F__compact_free_cb, NULL) < 0)
+        HDONE_ERROR(H5E_FILE, H5E_CANTFREE, FAIL, "can't release block info")
+
+    if(bytes_moved)
+        *bytes_moved = total;
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5F__compact() */
+
@@ -1353,6 +1353,9 @@ H5F__dest(H5F_t *f, hbool_t flush)
         if(H5G_node_close(f) < 0)
             /* Push error, but keep going*/
             HDONE_ERROR(H5E_FILE, H5E_CANTRELEASE, FAIL, "problems closing file")
+        if(H5G_pcache_dest(f) < 0)
+            /* Push error, but keep going*/
+            HDONE_ERROR(H5E_FILE, H5E_CANTRELEASE, FAIL, "problems closing file")
 
         /* Destroy file creation properties */
         if(H5I_GENPROP_LST != H5I_get_type(f->shared->fcpl_id))
@@ -1386,6 +1389,9 @@ H5F__dest(H5F_t *f, hbool_t flush)
             if(f->shared->retries[actype])
                 f->shared->retries[actype] = (uint32_t *)H5MM_xfree(f->shared->retries[actype]);
 
+        /* Free the profiling counters */
+        f->shared->prof = (H5F_prof_t *)H5MM_xfree(f->shared->prof);
+
         /* Destroy shared file struct */
         f->shared = (H5F_file_t *)H5FL_FREE(H5F_file_t, f->shared);
 
@@ -1746,6 +1752,17 @@ H5F_open(const char *name, unsigned flags, hid_t fcpl_id, hid_t fapl_id)
             HGOTO_ERROR(H5E_FILE, H5E_BADVALUE, NULL, "file evict-on-close value doesn't match")
     } /* end if */
 
+#ifdef H5_HAVE_THREADSAFE
+    /* Raw data reads may let other threads into the library if nothing
+     * can change the file underneath them: the file must be read-only,
+     * without SWMR or a page buffer, and the driver must support it.
+     */
+    if(shared->nrefs == 1)
+        shared->concurrent_read = !(H5F_INTENT(file) & (H5F_ACC_RDWR | H5F_ACC_SWMR_READ))
+                && NULL == shared->page_buf
+                && H5F_HAS_FEATURE(file, H5FD_FEAT_CONCURRENT_READ);
+#endif /* H5_HAVE_THREADSAFE */
+
     /* Formulate the absolute path for later search of target file for external links */
     if(H5_build_extpath(name, &file->extpath) < 0)
         HGOTO_ERROR(H5E_FILE, H5E_CANTINIT, NULL, "unable to build extpath")
@@ -1985,9 +2002,11 @@ H5F__close(H5F_t *f)
     HDassert(f);
 
     /* Perform checks for "semi" file close degree here, since closing the
-     * file is not allowed if there are objects still open.
+     * file is not allowed if there are objects still open.  The same goes
+     * for the "strong" degree while reads in other threads hold objects.
      */
-    if(f->shared->fc_degree == H5F_CLOSE_SEMI) {
+    if(f->shared->fc_degree == H5F_CLOSE_SEMI ||
+            (f->shared->fc_degree == H5F_CLOSE_STRONG && f->shared->nconcurrent_reads > 0)) {
         unsigned nopen_files = 0;       /* Number of open files in file/mount hierarchy */
         unsigned nopen_objs = 0;        /* Number of open objects in file/mount hierarchy */
 
@@ -2000,8 +2019,12 @@ H5F__close(H5F_t *f)
          * without decrementing the file ID's reference count and triggering
          * a "real" attempt at closing the file.
          */
-        if(nopen_files == 1 && nopen_objs > 0)
-            HGOTO_ERROR(H5E_FILE, H5E_CANTCLOSEFILE, FAIL, "can't close file, there are objects still open")
+        if(nopen_files == 1) {
+            if(f->shared->fc_degree == H5F_CLOSE_SEMI && nopen_objs > 0)
+                HGOTO_ERROR(H5E_FILE, H5E_CANTCLOSEFILE, FAIL, "can't close file, there are objects still open")
+            if(f->shared->fc_degree == H5F_CLOSE_STRONG)
+                HGOTO_ERROR(H5E_FILE, H5E_CANTCLOSEFILE, FAIL, "can't close file, reads are in progress in other threads")
+        } /* end if */
     }
 
     /* Reset the file ID for this file */
@@ -2101,6 +2124,10 @@ H5F_try_close(H5F_t *f, hbool_t *was_closed /*out*/)
             if(nopen_files > 0)
                 HGOTO_DONE(SUCCEED)
 
+            /* Objects can't be closed out from under reads in other threads */
+            if(f->shared->nconcurrent_reads > 0)
+                HGOTO_ERROR(H5E_FILE, H5E_CANTCLOSEFILE, FAIL, "can't close file, reads are in progress in other threads")
+
             /* If we've gotten this far (ie. there are no open file IDs in the file/mount hierarchy), fall through to flush & close */
             break;
 
@@ -2307,6 +2334,55 @@ H5F_decr_nopen_objs(H5F_t *f)
     FUNC_LEAVE_NOAPI(--f->nopen_objs)
 } /* end H5F_decr_nopen_objs() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    H5F_incr_nconcurrent_reads
+ *
+ * Purpose:     Increment the number of API calls that are holding the
+ *              file's objects while their raw data reads let other
+ *              threads into the library.
+ *
+ * Return:      Success:    The number of such calls, after the increment
+ *              Failure:    (can't happen)
+ *-------------------------------------------------------------------------
+ */
+unsigned
+H5F_incr_nconcurrent_reads(H5F_t *f)
+{
+    /* Use FUNC_ENTER_NOAPI_NOINIT_NOERR here to avoid performance issues */
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    HDassert(f);
+    HDassert(f->shared);
+
+    FUNC_LEAVE_NOAPI(++f->shared->nconcurrent_reads)
+} /* end H5F_incr_nconcurrent_reads() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5F_decr_nconcurrent_reads
+ *
+ * Purpose:     Decrement the number of API calls that are holding the
+ *              file's objects while their raw data reads let other
+ *              threads into the library.
+ *
+ * Return:      Success:    The number of such calls, after the decrement
+ *              Failure:    (can't happen)
+ *-------------------------------------------------------------------------
+ */
+unsigned
+H5F_decr_nconcurrent_reads(H5F_t *f)
+{
+    /* Use FUNC_ENTER_NOAPI_NOINIT_NOERR here to avoid performance issues */
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    HDassert(f);
+    HDassert(f->shared);
+    HDassert(f->shared->nconcurrent_reads > 0);
+
+    FUNC_LEAVE_NOAPI(--f->shared->nconcurrent_reads)
+} /* end H5F_decr_nconcurrent_reads() */
+
 
 /*-------------------------------------------------------------------------
  * Function:    H5F__build_actual_name
@@ -2605,6 +2681,30 @@ H5F_set_grp_btree_shared(H5F_t *f, H5UC_t *rc)
     FUNC_LEAVE_NOAPI(SUCCEED)
 } /* H5F_set_grp_btree_shared() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    H5F_set_path_cache
+ *
+ * Purpose:     Set the path_cache field (NULL to detach the cache).
+ *
+ * Return:      SUCCEED/FAIL
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5F_set_path_cache(H5F_t *f, struct H5G_pcache_t *pcache)
+{
+    /* Use FUNC_ENTER_NOAPI_NOINIT_NOERR here to avoid performance issues */
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    /* Sanity check */
+    HDassert(f);
+    HDassert(f->shared);
+
+    f->shared->path_cache = pcache;
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* H5F_set_path_cache() */
+
 
 /*-------------------------------------------------------------------------
  * Function:    H5F_set_sohm_addr
@@ -33,6 +33,7 @@
 /* Headers */
 /***********/
 #include "H5private.h"		/* Generic Functions			*/
+#include "H5CXprivate.h"        /* API Contexts                         */
 #include "H5Eprivate.h"		/* Error handling		  	*/
 #include "H5Fpkg.h"             /* File access				*/
 #include "H5FDprivate.h"	/* File drivers				*/
@@ -120,6 +121,54 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5F_block_read() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	H5F_block_read_direct
+ *
+ * Purpose:	Reads raw data from a file into a buffer that is private to
+ *		the current operation (the application's buffer or one of
+ *		the operation's own conversion buffers).
+ *
+ *		When the file allows concurrent reads and the API call has
+ *		taken references to its IDs, the file driver may release
+ *		the API lock while it waits on the read, letting other
+ *		threads into the library.  Otherwise this is the same as
+ *		H5F_block_read() for raw data.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5F_block_read_direct(H5F_t *f, haddr_t addr, size_t size, void *buf/*out*/)
+{
+    hbool_t     release_api_lock = FALSE;   /* Whether the driver may release the API lock */
+    herr_t      ret_value = SUCCEED;        /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    /* Sanity checks */
+    HDassert(f);
+    HDassert(f->shared);
+    HDassert(buf);
+
+    /* Check if other threads may run while the driver waits */
+    if(f->shared->concurrent_read && H5CX_get_concurrent_read()) {
+        release_api_lock = TRUE;
+        H5CX_set_release_api_lock(TRUE);
+    } /* end if */
+
+    /* Read the data */
+    if(H5F_block_read(f, H5FD_MEM_DRAW, addr, size, buf) < 0)
+        HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "block read failed")
+
+done:
+    if(release_api_lock)
+        H5CX_set_release_api_lock(FALSE);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5F_block_read_direct() */
+
 
 /*-------------------------------------------------------------------------
  * Function:	H5F_block_write
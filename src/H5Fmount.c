@@ -193,6 +193,12 @@ H5F__mount(H5G_loc_t *loc, const char *name, H5F_t *child, hid_t H5_ATTR_UNUSED
     if(!cmp)
         HGOTO_ERROR(H5E_FILE, H5E_MOUNT, FAIL, "mount point is already in use")
 
+    /* Paths cached in either file may now cross the mount point */
+    if(H5G_pcache_clear(parent) < 0)
+        HGOTO_ERROR(H5E_FILE, H5E_CANTRELEASE, FAIL, "unable to clear path cache")
+    if(H5G_pcache_clear(child) < 0)
+        HGOTO_ERROR(H5E_FILE, H5E_CANTRELEASE, FAIL, "unable to clear path cache")
+
     /* Make room in the table */
     if(parent->shared->mtab.nmounts >= parent->shared->mtab.nalloc) {
         unsigned n = MAX(16, 2 * parent->shared->mtab.nalloc);
@@ -375,6 +381,14 @@ H5F__unmount(H5G_loc_t *loc, const char *name)
     parent->shared->mtab.nmounts -= 1;
     parent->nmounts -= 1;
 
+    /* Paths cached in either file may have crossed the mount point.  Clear
+     * them before closing the mount point group, which may close the parent.
+     */
+    if(H5G_pcache_clear(parent) < 0)
+        HGOTO_ERROR(H5E_FILE, H5E_CANTRELEASE, FAIL, "unable to clear path cache")
+    if(H5G_pcache_clear(child) < 0)
+        HGOTO_ERROR(H5E_FILE, H5E_CANTRELEASE, FAIL, "unable to clear path cache")
+
     /* Unmount the child file from the parent file */
     if(H5G_unmount(child_group) < 0)
         HGOTO_ERROR(H5E_FILE, H5E_CANTCLOSEOBJ, FAIL, "unable to reset group mounted flag")
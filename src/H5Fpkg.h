@@ -189,6 +189,12 @@ struct H5F_blk_aggr_t {
     haddr_t             addr;           /* Location of block left */
 };
 
+/* Number of clean metadata accumulator regions kept (in LRU order) in
+ * addition to the active accumulator, so that metadata I/O interleaved
+ * between distant parts of the file doesn't constantly flush & refill it.
+ */
+#define H5F_ACCUM_NPARKED       3
+
 /* Structure for metadata accumulator fields */
 typedef struct H5F_meta_accum_t {
     unsigned char      *buf;            /* Buffer to hold the accumulated metadata */
@@ -200,6 +206,47 @@ typedef struct H5F_meta_accum_t {
     hbool_t             dirty;          /* Flag to indicate that the accumulated metadata is dirty */
 } H5F_meta_accum_t;
 
+/* Number of I/O filters and datatype conversions whose time is kept
+ * separately in a file's profile.  Time for any others only goes into
+ * the totals.
+ */
+#define H5F_PROF_NFILTERS       16
+#define H5F_PROF_NCONVS         32
+
+/* Maximum length of a datatype conversion's name in a file's profile */
+#define H5F_PROF_NAMELEN        32
+
+/* Time spent in one I/O filter */
+typedef struct H5F_prof_filter_t {
+    int                 id;             /* Filter ID */
+    hsize_t             calls;          /* # of times the filter was applied */
+    double              time;           /* Seconds spent in the filter */
+} H5F_prof_filter_t;
+
+/* Time spent in one datatype conversion function */
+typedef struct H5F_prof_conv_t {
+    char                name[H5F_PROF_NAMELEN]; /* Name of the conversion */
+    hsize_t             calls;          /* # of times the conversion was done */
+    double              time;           /* Seconds spent in the conversion */
+} H5F_prof_conv_t;
+
+/* Profiling counters for a file */
+struct H5F_prof_t {
+    hbool_t             on;             /* Whether counters are being collected */
+    H5F_counters_t      totals;         /* Totals, for H5Fget_counters() */
+
+    /* Metadata cache lookups, for each client class */
+    const char         *mdc_name[H5AC_NTYPES];  /* Name of the client class */
+    hsize_t             mdc_hits[H5AC_NTYPES];  /* # of lookups that hit */
+    hsize_t             mdc_misses[H5AC_NTYPES]; /* # of lookups that missed */
+
+    /* I/O filters and datatype conversions, in the order they were first used */
+    unsigned            nfilters;       /* # of filters in filter[] */
+    H5F_prof_filter_t   filter[H5F_PROF_NFILTERS];
+    unsigned            nconvs;         /* # of conversions in conv[] */
+    H5F_prof_conv_t     conv[H5F_PROF_NCONVS];
+};
+
 /* A record of the mount table */
 typedef struct H5F_mount_t {
     struct H5G_t	*group;	/* Mount point group held open		*/
@@ -294,6 +341,8 @@ struct H5F_file_t {
     hid_t       fcpl_id;	/* File creation property list ID 	*/
     H5F_close_degree_t fc_degree; /* File close behavior degree	*/
     hbool_t evict_on_close; /* If the file's objects should be evicted from the metadata cache on close */
+    hbool_t concurrent_read; /* If raw data reads may let other threads into the library */
+    unsigned nconcurrent_reads; /* Number of API calls holding the file's objects for concurrent reads */
     size_t	rdcc_nslots;	/* Size of raw data chunk cache (slots)	*/
     size_t	rdcc_nbytes;	/* Size of raw data chunk cache	(bytes)	*/
     double	rdcc_w0;	/* Preempt read chunks first? [0.0..1.0]*/
@@ -309,6 +358,7 @@ struct H5F_file_t {
     struct H5G_t *root_grp;	/* Open root group			*/
     H5FO_t *open_objs;          /* Open objects in file                 */
     H5UC_t *grp_btree_shared;   /* Ref-counted group B-tree node info   */
+    struct H5G_pcache_t *path_cache; /* Cache of resolved group paths  */
 
     /* Cached VOL connector ID & info */
     hid_t       vol_id;         /* ID of VOL connector for the container */
@@ -348,6 +398,12 @@ struct H5F_file_t {
 
     /* Metadata accumulator information */
     H5F_meta_accum_t accum;                 /* Metadata accumulator info */
+    H5F_meta_accum_t accum_lru[H5F_ACCUM_NPARKED]; /* Clean regions displaced from the accumulator, most recently used first */
+    unsigned accum_nparked;                 /* # of regions in accum_lru[] */
+    H5F_accum_stats_t accum_stats;          /* Metadata accumulator statistics */
+
+    /* Profiling counters (H5Fstart_counters) */
+    H5F_prof_t *prof;                       /* Counters, or NULL if never started */
 
     /* Metadata retry info */
     unsigned 		read_attempts;	    /* The # of reads to try when reading metadata with checksum */
@@ -405,6 +461,7 @@ H5_DLL ssize_t H5F__get_file_image(H5F_t *f, void *buf_ptr, size_t buf_len);
 H5_DLL herr_t H5F__get_info(H5F_t *f, H5F_info2_t *finfo);
 H5_DLL herr_t H5F__format_convert(H5F_t *f);
 H5_DLL herr_t H5F__start_swmr_write(H5F_t *f);
+H5_DLL herr_t H5F__compact(H5F_t *f, hsize_t max_bytes, hsize_t *bytes_moved);
 H5_DLL herr_t H5F__close(H5F_t *f);
 H5_DLL herr_t H5F__set_libver_bounds(H5F_t *f, H5F_libver_t low, H5F_libver_t high);
 H5_DLL H5F_t *H5F__get_file(void *obj, H5I_type_t type);
@@ -434,6 +491,16 @@ H5_DLL herr_t H5F__accum_write(H5F_t *f, H5FD_mem_t type, haddr_t addr, size_t s
 H5_DLL herr_t H5F__accum_free(H5F_t *f, H5FD_mem_t type, haddr_t addr, hsize_t size);
 H5_DLL herr_t H5F__accum_flush(H5F_t *f);
 H5_DLL herr_t H5F__accum_reset(H5F_t *f, hbool_t flush);
+H5_DLL herr_t H5F__accum_reset_stats(H5F_t *f);
+H5_DLL herr_t H5F__accum_get_stats(const H5F_t *f, H5F_accum_stats_t *stats);
+
+/* Profiling counters routines */
+H5_DLL herr_t H5F__fd_read(H5F_file_t *f_sh, H5FD_mem_t type, haddr_t addr, size_t size, void *buf);
+H5_DLL herr_t H5F__fd_write(H5F_file_t *f_sh, H5FD_mem_t type, haddr_t addr, size_t size, const void *buf);
+H5_DLL herr_t H5F__start_counters(H5F_t *f);
+H5_DLL herr_t H5F__stop_counters(H5F_t *f);
+H5_DLL herr_t H5F__get_counters(const H5F_t *f, H5F_counters_t *counters);
+H5_DLL herr_t H5F__print_counters(const H5F_t *f, FILE *stream);
 
 /* Shared file list related routines */
 H5_DLL herr_t H5F__sfile_add(H5F_file_t *shared);
@@ -290,6 +290,7 @@ typedef struct H5F_t H5F_t;
 #define H5F_ID_EXISTS(F)        ((F)->id_exists)
 #define H5F_PARENT(F)           ((F)->parent)
 #define H5F_NMOUNTS(F)          ((F)->nmounts)
+#define H5F_SHARED_NMOUNTS(F)   ((F)->shared->mtab.nmounts)
 #define H5F_GET_READ_ATTEMPTS(F) ((F)->shared->read_attempts)
 #define H5F_DRIVER_ID(F)        ((F)->shared->lf->driver_id)
 #define H5F_GET_FILENO(F,FILENUM) ((FILENUM) = (F)->shared->lf->fileno)
@@ -318,6 +319,8 @@ typedef struct H5F_t H5F_t;
 #define H5F_SET_STORE_MSG_CRT_IDX(F, FL)    ((F)->shared->store_msg_crt_idx = (FL))
 #define H5F_GRP_BTREE_SHARED(F) ((F)->shared->grp_btree_shared)
 #define H5F_SET_GRP_BTREE_SHARED(F, RC) (((F)->shared->grp_btree_shared = (RC)) ? SUCCEED : FAIL)
+#define H5F_PATH_CACHE(F)       ((F)->shared->path_cache)
+#define H5F_SET_PATH_CACHE(F, PC) ((F)->shared->path_cache = (PC), SUCCEED)
 #define H5F_USE_TMP_SPACE(F)    ((F)->shared->fs.use_tmp_space)
 #define H5F_IS_TMP_ADDR(F, ADDR) (H5F_addr_le((F)->shared->fs.tmp_addr, (ADDR)))
 #ifdef H5_HAVE_PARALLEL
@@ -348,6 +351,7 @@ typedef struct H5F_t H5F_t;
 #define H5F_ID_EXISTS(F)        (H5F_file_id_exists(F))
 #define H5F_PARENT(F)           (H5F_get_parent(F))
 #define H5F_NMOUNTS(F)          (H5F_get_nmounts(F))
+#define H5F_SHARED_NMOUNTS(F)   (H5F_get_shared_nmounts(F))
 #define H5F_GET_READ_ATTEMPTS(F) (H5F_get_read_attempts(F))
 #define H5F_DRIVER_ID(F)        (H5F_get_driver_id(F))
 #define H5F_GET_FILENO(F,FILENUM) (H5F_get_fileno((F), &(FILENUM)))
@@ -376,6 +380,8 @@ typedef struct H5F_t H5F_t;
 #define H5F_SET_STORE_MSG_CRT_IDX(F, FL)    (H5F_set_store_msg_crt_idx((F), (FL)))
 #define H5F_GRP_BTREE_SHARED(F) (H5F_grp_btree_shared(F))
 #define H5F_SET_GRP_BTREE_SHARED(F, RC) (H5F_set_grp_btree_shared((F), (RC)))
+#define H5F_PATH_CACHE(F)       (H5F_path_cache(F))
+#define H5F_SET_PATH_CACHE(F, PC) (H5F_set_path_cache((F), (PC)))
 #define H5F_USE_TMP_SPACE(F)    (H5F_use_tmp_space(F))
 #define H5F_IS_TMP_ADDR(F, ADDR) (H5F_is_tmp_addr((F), (ADDR)))
 #ifdef H5_HAVE_PARALLEL
@@ -668,6 +674,9 @@ typedef struct H5F_block_t {
     hsize_t length;             /* Length of the block in the file */
 } H5F_block_t;
 
+/* Profiling counters for a file, collected after H5Fstart_counters() */
+typedef struct H5F_prof_t H5F_prof_t;
+
 /* Enum for free space manager state */
 typedef enum H5F_fs_state_t {
     H5F_FS_STATE_CLOSED = 0,                /* Free space manager is closed */
@@ -732,9 +741,12 @@ H5_DLL hbool_t H5F_same_shared(const H5F_t *f1, const H5F_t *f2);
 H5_DLL unsigned H5F_get_nopen_objs(const H5F_t *f);
 H5_DLL unsigned H5F_incr_nopen_objs(H5F_t *f);
 H5_DLL unsigned H5F_decr_nopen_objs(H5F_t *f);
+H5_DLL unsigned H5F_incr_nconcurrent_reads(H5F_t *f);
+H5_DLL unsigned H5F_decr_nconcurrent_reads(H5F_t *f);
 H5_DLL hbool_t H5F_file_id_exists(const H5F_t *f);
 H5_DLL H5F_t *H5F_get_parent(const H5F_t *f);
 H5_DLL unsigned H5F_get_nmounts(const H5F_t *f);
+H5_DLL unsigned H5F_get_shared_nmounts(const H5F_t *f);
 H5_DLL unsigned H5F_get_read_attempts(const H5F_t *f);
 H5_DLL hid_t H5F_get_access_plist(H5F_t *f, hbool_t app_ref);
 H5_DLL hid_t H5F_get_id(H5F_t *file);
@@ -762,6 +774,8 @@ H5_DLL herr_t H5F_set_sohm_nindexes(H5F_t *f, unsigned nindexes);
 H5_DLL hid_t H5F_get_fcpl(const H5F_t *f);
 H5_DLL H5F_close_degree_t H5F_get_fc_degree(const H5F_t *f);
 H5_DLL hbool_t H5F_get_evict_on_close(const H5F_t *f);
+H5_DLL hbool_t H5F_concurrent_read(const H5F_t *f);
+H5_DLL unsigned H5F_get_nconcurrent_reads(const H5F_t *f);
 H5_DLL size_t H5F_rdcc_nbytes(const H5F_t *f);
 H5_DLL size_t H5F_rdcc_nslots(const H5F_t *f);
 H5_DLL double H5F_rdcc_w0(const H5F_t *f);
@@ -771,6 +785,8 @@ H5_DLL hbool_t H5F_store_msg_crt_idx(const H5F_t *f);
 H5_DLL herr_t H5F_set_store_msg_crt_idx(H5F_t *f, hbool_t flag);
 H5_DLL struct H5UC_t *H5F_grp_btree_shared(const H5F_t *f);
 H5_DLL herr_t H5F_set_grp_btree_shared(H5F_t *f, struct H5UC_t *rc);
+H5_DLL struct H5G_pcache_t *H5F_path_cache(const H5F_t *f);
+H5_DLL herr_t H5F_set_path_cache(H5F_t *f, struct H5G_pcache_t *pcache);
 H5_DLL hbool_t H5F_use_tmp_space(const H5F_t *f);
 H5_DLL hbool_t H5F_is_tmp_addr(const H5F_t *f, haddr_t addr);
 H5_DLL hsize_t H5F_get_alignment(const H5F_t *f);
@@ -798,8 +814,17 @@ H5_DLL herr_t H5F_flush_mounts(H5F_t *f);
 
 /* Functions that operate on blocks of bytes wrt super block */
 H5_DLL herr_t H5F_block_read(H5F_t *f, H5FD_mem_t type, haddr_t addr, size_t size, void *buf/*out*/);
+H5_DLL herr_t H5F_block_read_direct(H5F_t *f, haddr_t addr, size_t size, void *buf/*out*/);
 H5_DLL herr_t H5F_block_write(H5F_t *f, H5FD_mem_t type, haddr_t addr, size_t size, const void *buf);
 
+/* Profiling counters routines */
+H5_DLL H5F_prof_t *H5F_get_prof(const H5F_t *f);
+H5_DLL void H5F_prof_mdc(H5F_prof_t *prof, int type_id, const char *type_name, hbool_t hit);
+H5_DLL void H5F_prof_chunk(H5F_prof_t *prof, hbool_t hit);
+H5_DLL void H5F_prof_filter(H5F_prof_t *prof, int filter_id, double elapsed);
+H5_DLL void H5F_prof_conv(H5F_prof_t *prof, const char *conv_name, double elapsed);
+H5_DLL void H5F_prof_select(H5F_prof_t *prof, double elapsed);
+
 /* Functions that flush or evict */
 H5_DLL herr_t H5F_flush_tagged_metadata(H5F_t *f, haddr_t tag);
 H5_DLL herr_t H5F_evict_tagged_metadata(H5F_t *f, haddr_t tag);
@@ -0,0 +1,620 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://support.hdfgroup.org/ftp/HDF5/releases.  *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*-------------------------------------------------------------------------
+ *
+ * Created:		H5Fprof.c
+ *
+ * Purpose:		Profiling counters for a file: I/O done by the file
+ *                      driver, metadata and chunk cache lookups, and the
+ *                      time spent in I/O filters, datatype conversions and
+ *                      selection iteration.
+ *
+ *                      Counters are only collected between
+ *                      H5Fstart_counters() and H5Fstop_counters(), so a
+ *                      file that isn't being profiled only pays for a
+ *                      pointer check.  All updates are made while holding
+ *                      the API lock, so the counters need no locking of
+ *                      their own.  Callers may hold on to the counters
+ *                      across a read that lets the API lock go, though,
+ *                      so the updaters check that collection is still on.
+ *
+ *-------------------------------------------------------------------------
+ */
+
+/****************/
+/* Module Setup */
+/****************/
+
+#include "H5Fmodule.h"          /* This source code file is part of the H5F module */
+
+
+/***********/
+/* Headers */
+/***********/
+#include "H5private.h"		/* Generic Functions			*/
+#include "H5Eprivate.h"		/* Error handling		  	*/
+#include "H5Fpkg.h"         	/* File access				*/
+#include "H5FDprivate.h"	/* File drivers				*/
+#include "H5MMprivate.h"	/* Memory management			*/
+
+
+/****************/
+/* Local Macros */
+/****************/
+
+/* Whether a file's counters are being collected */
+#define H5F_PROF_ON(F_SH)       ((F_SH)->prof && (F_SH)->prof->on)
+
+
+/******************/
+/* Local Typedefs */
+/******************/
+
+
+/********************/
+/* Package Typedefs */
+/********************/
+
+
+/********************/
+/* Local Prototypes */
+/********************/
+static void H5F__print_json_string(FILE *stream, const char *str);
+
+
+/*********************/
+/* Package Variables */
+/*********************/
+
+
+/*****************************/
+/* Library Private Variables */
+/*****************************/
+
+
+/*******************/
+/* Local Variables */
+/*******************/
+
+/* Names of the file driver's types of data, for H5Fprint_counters() */
+static const char *const H5F_prof_mem_name_g[H5FD_MEM_NTYPES] = {
+    "default",
+    "super",
+    "btree",
+    "draw",
+    "gheap",
+    "lheap",
+    "ohdr"
+};
+
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5F__fd_read
+ *
+ * Purpose:	Reads a block of bytes with the file's driver, counting the
+ *              read if the file is being profiled.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5F__fd_read(H5F_file_t *f_sh, H5FD_mem_t type, haddr_t addr, size_t size,
+    void *buf/*out*/)
+{
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Sanity checks */
+    HDassert(f_sh);
+    HDassert(f_sh->lf);
+
+    /* Dispatch to driver */
+    if(H5FD_read(f_sh->lf, type, addr, size, buf) < 0)
+        HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "driver read request failed")
+
+    /* Count the read */
+    if(H5F_PROF_ON(f_sh) && type >= H5FD_MEM_DEFAULT && type < H5FD_MEM_NTYPES) {
+        f_sh->prof->totals.read_calls[type]++;
+        f_sh->prof->totals.read_bytes[type] += size;
+    } /* end if */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5F__fd_read() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5F__fd_write
+ *
+ * Purpose:	Writes a block of bytes with the file's driver, counting the
+ *              write if the file is being profiled.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5F__fd_write(H5F_file_t *f_sh, H5FD_mem_t type, haddr_t addr, size_t size,
+    const void *buf)
+{
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Sanity checks */
+    HDassert(f_sh);
+    HDassert(f_sh->lf);
+
+    /* Dispatch to driver */
+    if(H5FD_write(f_sh->lf, type, addr, size, buf) < 0)
+        HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "driver write request failed")
+
+    /* Count the write */
+    if(H5F_PROF_ON(f_sh) && type >= H5FD_MEM_DEFAULT && type < H5FD_MEM_NTYPES) {
+        f_sh->prof->totals.write_calls[type]++;
+        f_sh->prof->totals.write_bytes[type] += size;
+    } /* end if */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5F__fd_write() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5F_get_prof
+ *
+ * Purpose:	Retrieve the file's profiling counters, if they are being
+ *              collected.
+ *
+ * Return:	Pointer to the counters, or NULL if the file isn't being
+ *              profiled (shouldn't fail)
+ *
+ *-------------------------------------------------------------------------
+ */
+H5F_prof_t *
+H5F_get_prof(const H5F_t *f)
+{
+    /* Use FUNC_ENTER_NOAPI_NOINIT_NOERR here to avoid performance issues */
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    HDassert(f);
+    HDassert(f->shared);
+
+    FUNC_LEAVE_NOAPI(H5F_PROF_ON(f->shared) ? f->shared->prof : NULL)
+} /* end H5F_get_prof() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5F_prof_mdc
+ *
+ * Purpose:	Counts a metadata cache lookup for an entry of a client
+ *              class.
+ *
+ * Return:	<none>
+ *
+ *-------------------------------------------------------------------------
+ */
+void
+H5F_prof_mdc(H5F_prof_t *prof, int type_id, const char *type_name, hbool_t hit)
+{
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    HDassert(prof);
+
+    if(hit)
+        prof->totals.mdc_hits++;
+    else
+        prof->totals.mdc_misses++;
+
+    if(type_id >= 0 && type_id < H5AC_NTYPES) {
+        prof->mdc_name[type_id] = type_name;
+        if(hit)
+            prof->mdc_hits[type_id]++;
+        else
+            prof->mdc_misses[type_id]++;
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5F_prof_mdc() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5F_prof_chunk
+ *
+ * Purpose:	Counts a chunk cache lookup.
+ *
+ * Return:	<none>
+ *
+ *-------------------------------------------------------------------------
+ */
+void
+H5F_prof_chunk(H5F_prof_t *prof, hbool_t hit)
+{
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    HDassert(prof);
+
+    if(prof->on) {
+        if(hit)
+            prof->totals.chunk_hits++;
+        else
+            prof->totals.chunk_misses++;
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5F_prof_chunk() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5F_prof_filter
+ *
+ * Purpose:	Adds the time for one application of an I/O filter.
+ *
+ * Return:	<none>
+ *
+ *-------------------------------------------------------------------------
+ */
+void
+H5F_prof_filter(H5F_prof_t *prof, int filter_id, double elapsed)
+{
+    unsigned u;                 /* Local index variable */
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    HDassert(prof);
+
+    if(prof->on) {
+        prof->totals.filter_calls++;
+        prof->totals.filter_time += elapsed;
+
+        /* Find the filter, adding it if there's room */
+        for(u = 0; u < prof->nfilters; u++)
+            if(prof->filter[u].id == filter_id)
+                break;
+        if(u == prof->nfilters && u < H5F_PROF_NFILTERS) {
+            prof->filter[u].id = filter_id;
+            prof->nfilters++;
+        } /* end if */
+        if(u < prof->nfilters) {
+            prof->filter[u].calls++;
+            prof->filter[u].time += elapsed;
+        } /* end if */
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5F_prof_filter() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5F_prof_conv
+ *
+ * Purpose:	Adds the time for one datatype conversion.  Conversions
+ *              are kept apart by the name of their conversion path.
+ *
+ * Return:	<none>
+ *
+ *-------------------------------------------------------------------------
+ */
+void
+H5F_prof_conv(H5F_prof_t *prof, const char *conv_name, double elapsed)
+{
+    unsigned u;                 /* Local index variable */
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    HDassert(prof);
+    HDassert(conv_name);
+
+    if(prof->on) {
+        prof->totals.conv_calls++;
+        prof->totals.conv_time += elapsed;
+
+        /* Find the conversion, adding it if there's room */
+        for(u = 0; u < prof->nconvs; u++)
+            if(!HDstrncmp(prof->conv[u].name, conv_name, (size_t)(H5F_PROF_NAMELEN - 1)))
+                break;
+        if(u == prof->nconvs && u < H5F_PROF_NCONVS) {
+            HDstrncpy(prof->conv[u].name, conv_name, (size_t)(H5F_PROF_NAMELEN - 1));
+            prof->conv[u].name[H5F_PROF_NAMELEN - 1] = '\0';
+            prof->nconvs++;
+        } /* end if */
+        if(u < prof->nconvs) {
+            prof->conv[u].calls++;
+            prof->conv[u].time += elapsed;
+        } /* end if */
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5F_prof_conv() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5F_prof_select
+ *
+ * Purpose:	Adds the time for one pass over a selection.
+ *
+ * Return:	<none>
+ *
+ *-------------------------------------------------------------------------
+ */
+void
+H5F_prof_select(H5F_prof_t *prof, double elapsed)
+{
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    HDassert(prof);
+
+    if(prof->on) {
+        prof->totals.select_calls++;
+        prof->totals.select_time += elapsed;
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5F_prof_select() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5F__start_counters
+ *
+ * Purpose:	Resets the file's profiling counters and starts collecting
+ *              them.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5F__start_counters(H5F_t *f)
+{
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Sanity checks */
+    HDassert(f);
+    HDassert(f->shared);
+
+    /* Allocate the counters the first time, reset them afterwards */
+    if(NULL == f->shared->prof) {
+        if(NULL == (f->shared->prof = (H5F_prof_t *)H5MM_calloc(sizeof(H5F_prof_t))))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for profiling counters")
+    } /* end if */
+    else
+        HDmemset(f->shared->prof, 0, sizeof(H5F_prof_t));
+
+    f->shared->prof->on = TRUE;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5F__start_counters() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5F__stop_counters
+ *
+ * Purpose:	Stops collecting the file's profiling counters, keeping the
+ *              values collected so far.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5F__stop_counters(H5F_t *f)
+{
+    FUNC_ENTER_PACKAGE_NOERR
+
+    /* Sanity checks */
+    HDassert(f);
+    HDassert(f->shared);
+
+    if(f->shared->prof)
+        f->shared->prof->on = FALSE;
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5F__stop_counters() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5F__get_counters
+ *
+ * Purpose:	Retrieve the totals of the file's profiling counters.  All
+ *              the counters are zero if they were never started.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5F__get_counters(const H5F_t *f, H5F_counters_t *counters)
+{
+    FUNC_ENTER_PACKAGE_NOERR
+
+    /* Sanity checks */
+    HDassert(f);
+    HDassert(f->shared);
+    HDassert(counters);
+
+    if(f->shared->prof)
+        *counters = f->shared->prof->totals;
+    else
+        HDmemset(counters, 0, sizeof(H5F_counters_t));
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5F__get_counters() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5F__print_json_string
+ *
+ * Purpose:	Writes STR to STREAM as a quoted JSON string, escaping
+ *              quotes, backslashes and control characters.
+ *
+ * Return:	<none>
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5F__print_json_string(FILE *stream, const char *str)
+{
+    const unsigned char *s;     /* Pointer to the current character */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    HDassert(stream);
+    HDassert(str);
+
+    HDfputc('"', stream);
+    for(s = (const unsigned char *)str; *s; s++)
+        switch(*s) {
+            case '"':
+                HDfputs("\\\"", stream);
+                break;
+            case '\\':
+                HDfputs("\\\\", stream);
+                break;
+            case '\b':
+                HDfputs("\\b", stream);
+                break;
+            case '\f':
+                HDfputs("\\f", stream);
+                break;
+            case '\n':
+                HDfputs("\\n", stream);
+                break;
+            case '\r':
+                HDfputs("\\r", stream);
+                break;
+            case '\t':
+                HDfputs("\\t", stream);
+                break;
+            default:
+                if(*s < 0x20)
+                    HDfprintf(stream, "\\u%04x", (unsigned)*s);
+                else
+                    HDfputc(*s, stream);
+                break;
+        } /* end switch */
+    HDfputc('"', stream);
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5F__print_json_string() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5F__print_counters
+ *
+ * Purpose:	Writes the file's profiling counters to STREAM as a JSON
+ *              object, with the metadata cache lookups broken down by
+ *              client class and the filter and conversion times broken
+ *              down by filter and conversion.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5F__print_counters(const H5F_t *f, FILE *stream)
+{
+    const H5F_prof_t *prof;             /* File's counters */
+    H5F_counters_t totals;              /* Totals of the counters */
+    const char *sep;                    /* Separator before the next array element */
+    unsigned u;                         /* Local index variable */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Sanity checks */
+    HDassert(f);
+    HDassert(f->shared);
+    HDassert(stream);
+
+    prof = f->shared->prof;
+    if(prof)
+        totals = prof->totals;
+    else
+        HDmemset(&totals, 0, sizeof(H5F_counters_t));
+
+    HDfprintf(stream, "{\n\"HDF5 file counters\" : {\n");
+    HDfprintf(stream, "\"collecting\":%s,\n", (prof && prof->on) ? "true" : "false");
+
+    /* I/O by the file driver */
+    HDfprintf(stream, "\"driver io\":[\n");
+    for(u = 0, sep = ""; u < H5FD_MEM_NTYPES; u++) {
+        HDfprintf(stream, "%s{\"type\":\"%s\",\"read calls\":%llu,\"read bytes\":%llu,\"write calls\":%llu,\"write bytes\":%llu}",
+                sep, H5F_prof_mem_name_g[u],
+                (unsigned long long)totals.read_calls[u], (unsigned long long)totals.read_bytes[u],
+                (unsigned long long)totals.write_calls[u], (unsigned long long)totals.write_bytes[u]);
+        sep = ",\n";
+    } /* end for */
+    HDfprintf(stream, "\n],\n");
+
+    /* Metadata cache lookups */
+    HDfprintf(stream, "\"metadata cache\":{\"hits\":%llu,\"misses\":%llu,\"classes\":[\n",
+            (unsigned long long)totals.mdc_hits, (unsigned long long)totals.mdc_misses);
+    if(prof)
+        for(u = 0, sep = ""; u < H5AC_NTYPES; u++)
+            if(prof->mdc_name[u]) {
+                HDfprintf(stream, "%s{\"class\":", sep);
+                H5F__print_json_string(stream, prof->mdc_name[u]);
+                HDfprintf(stream, ",\"hits\":%llu,\"misses\":%llu}",
+                        (unsigned long long)prof->mdc_hits[u], (unsigned long long)prof->mdc_misses[u]);
+                sep = ",\n";
+            } /* end if */
+    HDfprintf(stream, "\n]},\n");
+
+    /* Chunk cache lookups */
+    HDfprintf(stream, "\"chunk cache\":{\"hits\":%llu,\"misses\":%llu},\n",
+            (unsigned long long)totals.chunk_hits, (unsigned long long)totals.chunk_misses);
+
+    /* I/O filters */
+    HDfprintf(stream, "\"filters\":{\"calls\":%llu,\"seconds\":%f,\"filters\":[\n",
+            (unsigned long long)totals.filter_calls, totals.filter_time);
+    if(prof)
+        for(u = 0, sep = ""; u < prof->nfilters; u++) {
+            HDfprintf(stream, "%s{\"id\":%d,\"calls\":%llu,\"seconds\":%f}",
+                    sep, prof->filter[u].id,
+                    (unsigned long long)prof->filter[u].calls, prof->filter[u].time);
+            sep = ",\n";
+        } /* end for */
+    HDfprintf(stream, "\n]},\n");
+
+    /* Datatype conversions */
+    HDfprintf(stream, "\"conversions\":{\"calls\":%llu,\"seconds\":%f,\"paths\":[\n",
+            (unsigned long long)totals.conv_calls, totals.conv_time);
+    if(prof)
+        for(u = 0, sep = ""; u < prof->nconvs; u++) {
+            HDfprintf(stream, "%s{\"name\":", sep);
+            H5F__print_json_string(stream, prof->conv[u].name);
+            HDfprintf(stream, ",\"calls\":%llu,\"seconds\":%f}",
+                    (unsigned long long)prof->conv[u].calls, prof->conv[u].time);
+            sep = ",\n";
+        } /* end for */
+    HDfprintf(stream, "\n]},\n");
+
+    /* Selection iteration */
+    HDfprintf(stream, "\"selections\":{\"calls\":%llu,\"seconds\":%f}\n",
+            (unsigned long long)totals.select_calls, totals.select_time);
+
+    HDfprintf(stream, "}\n}\n");
+
+    if(HDfflush(stream) < 0)
+        HGOTO_ERROR(H5E_FILE, H5E_WRITEERROR, FAIL, "unable to write counters")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5F__print_counters() */
+
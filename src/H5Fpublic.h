@@ -17,6 +17,8 @@
 #ifndef _H5Fpublic_H
 #define _H5Fpublic_H
 
+#include <stdio.h>              /*FILE arg of H5Fprint_counters()            */
+
 /* Public header files needed by this file */
 #include "H5public.h"
 #include "H5ACpublic.h"
@@ -215,6 +217,38 @@ typedef struct H5F_retry_info_t {
     uint32_t *retries[H5F_NUM_METADATA_READ_RETRY_TYPES];
 } H5F_retry_info_t;
 
+/* Data structure to report the statistics for the metadata accumulator */
+/* Used by public routine H5Fget_metadata_accum_stats() */
+typedef struct H5F_accum_stats_t {
+    hsize_t read_hits;          /* # of reads satisfied from an accumulator region */
+    hsize_t read_misses;        /* # of reads that had to go to the file */
+    hsize_t write_hits;         /* # of writes that joined an existing accumulator region */
+    hsize_t write_misses;       /* # of writes that started a new accumulator region */
+    hsize_t parks;              /* # of times the active region was displaced into the LRU list */
+    hsize_t reactivations;      /* # of times a parked region became active again */
+    hsize_t merges;             /* # of adjacent regions merged together */
+    hsize_t evictions;          /* # of parked regions evicted from the LRU list */
+} H5F_accum_stats_t;
+
+/* Data structure to report the counters collected for a file */
+/* Used by public routine H5Fget_counters() */
+typedef struct H5F_counters_t {
+    hsize_t read_calls[H5FD_MEM_NTYPES];    /* # of reads by the file driver, for each type of data */
+    hsize_t read_bytes[H5FD_MEM_NTYPES];    /* # of bytes read by the file driver */
+    hsize_t write_calls[H5FD_MEM_NTYPES];   /* # of writes by the file driver */
+    hsize_t write_bytes[H5FD_MEM_NTYPES];   /* # of bytes written by the file driver */
+    hsize_t mdc_hits;           /* # of metadata cache lookups that found the entry in the cache */
+    hsize_t mdc_misses;         /* # of metadata cache lookups that had to load the entry */
+    hsize_t chunk_hits;         /* # of chunk lookups that found the chunk in the chunk cache */
+    hsize_t chunk_misses;       /* # of chunk lookups that had to read the chunk from the file */
+    hsize_t filter_calls;       /* # of times an I/O filter was applied */
+    double filter_time;         /* Seconds spent in I/O filters */
+    hsize_t conv_calls;         /* # of datatype conversions */
+    double conv_time;           /* Seconds spent converting datatypes */
+    hsize_t select_calls;       /* # of times a selection was iterated over */
+    double select_time;         /* Seconds spent iterating over selections */
+} H5F_counters_t;
+
 /* Callback for H5Pset_object_flush_cb() in a file access property list */
 typedef herr_t (*H5F_flush_cb_t)(hid_t object_id, void *udata);
 
@@ -277,6 +311,13 @@ H5_DLL herr_t H5Freset_page_buffering_stats(hid_t file_id);
 H5_DLL herr_t H5Fget_page_buffering_stats(hid_t file_id, unsigned accesses[2],
     unsigned hits[2], unsigned misses[2], unsigned evictions[2], unsigned bypasses[2]);
 H5_DLL herr_t H5Fget_mdc_image_info(hid_t file_id, haddr_t *image_addr, hsize_t *image_size);
+H5_DLL herr_t H5Freset_metadata_accum_stats(hid_t file_id);
+H5_DLL herr_t H5Fget_metadata_accum_stats(hid_t file_id, H5F_accum_stats_t *stats);
+H5_DLL herr_t H5Fcompact(hid_t file_id, hsize_t max_bytes, hsize_t *bytes_moved);
+H5_DLL herr_t H5Fstart_counters(hid_t file_id);
+H5_DLL herr_t H5Fstop_counters(hid_t file_id);
+H5_DLL herr_t H5Fget_counters(hid_t file_id, H5F_counters_t *counters);
+H5_DLL herr_t H5Fprint_counters(hid_t file_id, FILE *stream);
 H5_DLL herr_t H5Fget_dset_no_attrs_hint(hid_t file_id, hbool_t *minimize);
 H5_DLL herr_t H5Fset_dset_no_attrs_hint(hid_t file_id, hbool_t minimize);
 
@@ -335,6 +335,28 @@ H5F_get_nmounts(const H5F_t *f)
     FUNC_LEAVE_NOAPI(f->nmounts)
 } /* end H5F_get_nmounts() */
 
+
+/*-------------------------------------------------------------------------
+ * Function: H5F_get_shared_nmounts
+ *
+ * Purpose:  Retrieve the # of files mounted on the shared file, through
+ *           any of the top-level file structs that refer to it
+ *
+ * Return:   # of mounted files on success/abort on failure (shouldn't fail)
+ *-------------------------------------------------------------------------
+ */
+unsigned
+H5F_get_shared_nmounts(const H5F_t *f)
+{
+    /* Use FUNC_ENTER_NOAPI_NOINIT_NOERR here to avoid performance issues */
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    HDassert(f);
+    HDassert(f->shared);
+
+    FUNC_LEAVE_NOAPI(f->shared->mtab.nmounts)
+} /* end H5F_get_shared_nmounts() */
+
 
 /*-------------------------------------------------------------------------
  * Function: H5F_get_read_attempts
@@ -703,6 +725,29 @@ H5F_grp_btree_shared(const H5F_t *f)
     FUNC_LEAVE_NOAPI(f->shared->grp_btree_shared)
 } /* end H5F_grp_btree_shared() */
 
+
+/*-------------------------------------------------------------------------
+ * Function: H5F_path_cache
+ *
+ * Purpose:  Retrieve the cache of resolved group paths for the file.
+ *
+ * Return:   Success:    Pointer to the path cache (may be NULL if
+ *                       no paths have been cached yet)
+ *           Failure:    (should not happen)
+ *-------------------------------------------------------------------------
+ */
+struct H5G_pcache_t *
+H5F_path_cache(const H5F_t *f)
+{
+    /* Use FUNC_ENTER_NOAPI_NOINIT_NOERR here to avoid performance issues */
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    HDassert(f);
+    HDassert(f->shared);
+
+    FUNC_LEAVE_NOAPI(f->shared->path_cache)
+} /* end H5F_path_cache() */
+
 
 /*-------------------------------------------------------------------------
  * Function: H5F_sieve_buf_size
@@ -803,6 +848,56 @@ H5F_get_evict_on_close(const H5F_t *f)
     FUNC_LEAVE_NOAPI(f->shared->evict_on_close)
 } /* end H5F_get_evict_on_close() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    H5F_concurrent_read
+ *
+ * Purpose:     Checks if raw data reads from the file may release the
+ *              library's API lock while they wait on the file driver.
+ *              Only set for files opened read-only without SWMR or a
+ *              page buffer, in thread-safe builds.
+ *
+ * Return:      Success:    Flag indicating whether concurrent raw data
+ *                          reads are allowed for the file.
+ *              Failure:    (can't happen)
+ *-------------------------------------------------------------------------
+ */
+hbool_t
+H5F_concurrent_read(const H5F_t *f)
+{
+    /* Use FUNC_ENTER_NOAPI_NOINIT_NOERR here to avoid performance issues */
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    HDassert(f);
+    HDassert(f->shared);
+
+    FUNC_LEAVE_NOAPI(f->shared->concurrent_read)
+} /* end H5F_concurrent_read() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5F_get_nconcurrent_reads
+ *
+ * Purpose:     Retrieve the number of API calls that are holding the
+ *              file's objects while their raw data reads let other threads
+ *              into the library.
+ *
+ * Return:      Success:    The number of such calls
+ *              Failure:    (can't happen)
+ *-------------------------------------------------------------------------
+ */
+unsigned
+H5F_get_nconcurrent_reads(const H5F_t *f)
+{
+    /* Use FUNC_ENTER_NOAPI_NOINIT_NOERR here to avoid performance issues */
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    HDassert(f);
+    HDassert(f->shared);
+
+    FUNC_LEAVE_NOAPI(f->shared->nconcurrent_reads)
+} /* end H5F_get_nconcurrent_reads() */
+
 
 /*-------------------------------------------------------------------------
  * Function: H5F_store_msg_crt_idx
@@ -981,6 +981,10 @@ H5G_obj_remove(const H5O_loc_t *oloc, H5RS_str_t *grp_full_path_r, const char *n
     HDassert(oloc);
     HDassert(name && *name);
 
+    /* Paths resolved through the link are no longer valid */
+    if(H5G_pcache_clear(oloc->file) < 0)
+        HGOTO_ERROR(H5E_SYM, H5E_CANTRELEASE, FAIL, "can't clear path cache")
+
     /* Attempt to get the link info for this group */
     if((linfo_exists = H5G__obj_get_linfo(oloc, &linfo)) < 0)
         HGOTO_ERROR(H5E_SYM, H5E_CANTGET, FAIL, "can't check for link info message")
@@ -1045,6 +1049,10 @@ H5G_obj_remove_by_idx(const H5O_loc_t *grp_oloc, H5RS_str_t *grp_full_path_r,
     /* Sanity check */
     HDassert(grp_oloc && grp_oloc->file);
 
+    /* Paths resolved through the link are no longer valid */
+    if(H5G_pcache_clear(grp_oloc->file) < 0)
+        HGOTO_ERROR(H5E_SYM, H5E_CANTRELEASE, FAIL, "can't clear path cache")
+
     /* Attempt to get the link info for this group */
     if((linfo_exists = H5G__obj_get_linfo(grp_oloc, &linfo)) < 0)
         HGOTO_ERROR(H5E_SYM, H5E_CANTGET, FAIL, "can't check for link info message")
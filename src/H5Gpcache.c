@@ -0,0 +1,442 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://support.hdfgroup.org/ftp/HDF5/releases.  *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*-------------------------------------------------------------------------
+ *
+ * Created:		H5Gpcache.c
+ *
+ * Purpose:		Per-file cache of resolved group paths, used by
+ *			H5G_traverse() to skip looking up each intermediate
+ *			component of a path that has been traversed before.
+ *
+ *			Only paths made entirely of hard links within one
+ *			file are cached, so an entry can only become stale
+ *			when a link is removed (which includes moving it) or
+ *			when a file is mounted or unmounted.  Both of those
+ *			empty the cache.  While a file has mounted children
+ *			or is itself mounted, H5G_traverse() bypasses the
+ *			cache entirely.
+ *
+ *-------------------------------------------------------------------------
+ */
+
+/****************/
+/* Module Setup */
+/****************/
+
+#include "H5Gmodule.h"          /* This source code file is part of the H5G module */
+
+
+/***********/
+/* Headers */
+/***********/
+#include "H5private.h"          /* Generic Functions                        */
+#include "H5Eprivate.h"         /* Error handling                           */
+#include "H5Fprivate.h"         /* File access                              */
+#include "H5FLprivate.h"        /* Free Lists                               */
+#include "H5Gpkg.h"             /* Groups                                   */
+#include "H5MMprivate.h"        /* Memory management                        */
+#include "H5SLprivate.h"        /* Skip lists                               */
+
+
+/****************/
+/* Local Macros */
+/****************/
+
+/* Maximum # of paths cached for each file */
+#define H5G_PCACHE_MAX_NENTS    1024
+
+
+/******************/
+/* Local Typedefs */
+/******************/
+
+/* Key for an entry in the path cache */
+typedef struct H5G_pcache_key_t {
+    haddr_t             start_addr;     /* Address of the group the path is relative to */
+    char                *path;          /* Normalized path of intermediate components */
+} H5G_pcache_key_t;
+
+/* Structure for each entry in a file's path cache */
+typedef struct H5G_pcache_ent_t {
+    H5G_pcache_key_t    key;            /* Key for entry */
+    haddr_t             addr;           /* Address of group the path resolves to */
+    struct H5G_pcache_ent_t *LRU_next;  /* Next (more recently used) entry in LRU list */
+    struct H5G_pcache_ent_t *LRU_prev;  /* Previous (less recently used) entry in LRU list */
+} H5G_pcache_ent_t;
+
+/* Structure for a file's path cache */
+struct H5G_pcache_t {
+    H5SL_t              *slist;         /* Skip list of cached paths */
+    H5G_pcache_ent_t    *LRU_head;      /* Head of LRU list.  This is the least recently used entry */
+    H5G_pcache_ent_t    *LRU_tail;      /* Tail of LRU list.  This is the most recently used entry */
+    size_t              nents;          /* # of entries in the cache */
+};
+
+
+/********************/
+/* Local Prototypes */
+/********************/
+static int H5G__pcache_cmp(const void *_key1, const void *_key2);
+static void H5G__pcache_touch(H5G_pcache_t *pcache, H5G_pcache_ent_t *ent);
+static herr_t H5G__pcache_free_cb(void *_ent, void *key, void *op_data);
+
+
+/*********************/
+/* Package Variables */
+/*********************/
+
+
+/*****************************/
+/* Library Private Variables */
+/*****************************/
+
+
+/*******************/
+/* Local Variables */
+/*******************/
+
+/* Free lists */
+H5FL_DEFINE_STATIC(H5G_pcache_t);
+H5FL_DEFINE_STATIC(H5G_pcache_ent_t);
+
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5G__pcache_cmp
+ *
+ * Purpose:     Skip list callback to compare two path cache keys
+ *
+ * Return:      <0, 0, >0, like strcmp()
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5G__pcache_cmp(const void *_key1, const void *_key2)
+{
+    const H5G_pcache_key_t *key1 = (const H5G_pcache_key_t *)_key1;
+    const H5G_pcache_key_t *key2 = (const H5G_pcache_key_t *)_key2;
+    int ret_value = 0;          /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    if(key1->start_addr < key2->start_addr)
+        ret_value = -1;
+    else if(key1->start_addr > key2->start_addr)
+        ret_value = 1;
+    else
+        ret_value = HDstrcmp(key1->path, key2->path);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5G__pcache_cmp() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5G__pcache_free_cb
+ *
+ * Purpose:     Skip list callback to release a path cache entry
+ *
+ * Return:      SUCCEED (can't fail)
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5G__pcache_free_cb(void *_ent, void H5_ATTR_UNUSED *key, void H5_ATTR_UNUSED *op_data)
+{
+    H5G_pcache_ent_t *ent = (H5G_pcache_ent_t *)_ent;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    H5MM_xfree(ent->key.path);
+    ent = H5FL_FREE(H5G_pcache_ent_t, ent);
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5G__pcache_free_cb() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5G__pcache_touch
+ *
+ * Purpose:     Move an entry to the end (most recently used) of the LRU list
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5G__pcache_touch(H5G_pcache_t *pcache, H5G_pcache_ent_t *ent)
+{
+    FUNC_ENTER_STATIC_NOERR
+
+    if(ent->LRU_next) {
+        if(ent->LRU_prev)
+            ent->LRU_prev->LRU_next = ent->LRU_next;
+        else
+            pcache->LRU_head = ent->LRU_next;
+        ent->LRU_next->LRU_prev = ent->LRU_prev;
+        ent->LRU_prev = pcache->LRU_tail;
+        ent->LRU_next = NULL;
+        pcache->LRU_tail->LRU_next = ent;
+        pcache->LRU_tail = ent;
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5G__pcache_touch() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5G__pcache_lookup
+ *
+ * Purpose:     Look up the address of the group that PATH (a normalized
+ *              list of hard links) resolves to, starting from the group at
+ *              START_ADDR in file F.
+ *
+ * Return:      TRUE if found (with *ADDR set) / FALSE if not found
+ *
+ *-------------------------------------------------------------------------
+ */
+htri_t
+H5G__pcache_lookup(H5F_t *f, haddr_t start_addr, const char *path,
+    haddr_t *addr/*out*/)
+{
+    H5G_pcache_t *pcache;               /* File's path cache */
+    H5G_pcache_key_t key;               /* Key to search for */
+    H5G_pcache_ent_t *ent;              /* Entry found */
+    htri_t ret_value = FALSE;           /* Return value */
+
+    FUNC_ENTER_PACKAGE_NOERR
+
+    /* Sanity checks */
+    HDassert(f);
+    HDassert(path);
+    HDassert(addr);
+
+    /* Check for a cache on the file */
+    if(NULL == (pcache = H5F_PATH_CACHE(f)))
+        HGOTO_DONE(FALSE)
+
+    /* Search for the path */
+    key.start_addr = start_addr;
+    key.path = (char *)path;    /* (Casting away const OK - QAK) */
+    if(NULL == (ent = (H5G_pcache_ent_t *)H5SL_search(pcache->slist, &key)))
+        HGOTO_DONE(FALSE)
+
+    /* Move the entry to the end of the LRU list */
+    H5G__pcache_touch(pcache, ent);
+
+    /* Set return values */
+    *addr = ent->addr;
+    ret_value = TRUE;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5G__pcache_lookup() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5G__pcache_insert
+ *
+ * Purpose:     Remember that PATH, starting from the group at START_ADDR
+ *              in file F, resolves to the group at ADDR.  Creates the
+ *              file's cache if necessary and evicts the least recently
+ *              used entry if the cache is full.  The path may already be
+ *              cached, when it was resolved by a nested traversal (e.g.
+ *              of a soft link).
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5G__pcache_insert(H5F_t *f, haddr_t start_addr, const char *path,
+    haddr_t addr)
+{
+    H5G_pcache_t *pcache;               /* File's path cache */
+    H5G_pcache_ent_t *ent = NULL;       /* New entry */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Sanity checks */
+    HDassert(f);
+    HDassert(path);
+    HDassert(H5F_addr_defined(addr));
+
+    /* Create the cache for the file, if it doesn't exist yet */
+    if(NULL == (pcache = H5F_PATH_CACHE(f))) {
+        if(NULL == (pcache = H5FL_CALLOC(H5G_pcache_t)))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed")
+        if(NULL == (pcache->slist = H5SL_create(H5SL_TYPE_GENERIC, H5G__pcache_cmp))) {
+            pcache = H5FL_FREE(H5G_pcache_t, pcache);
+            HGOTO_ERROR(H5E_SYM, H5E_CANTCREATE, FAIL, "can't create skip list")
+        } /* end if */
+        if(H5F_SET_PATH_CACHE(f, pcache) < 0) {
+            H5SL_close(pcache->slist);
+            pcache = H5FL_FREE(H5G_pcache_t, pcache);
+            HGOTO_ERROR(H5E_SYM, H5E_CANTSET, FAIL, "can't set path cache for file")
+        } /* end if */
+    } /* end if */
+    else {
+        H5G_pcache_key_t key;           /* Key to search for */
+        H5G_pcache_ent_t *old_ent;      /* Existing entry for path */
+
+        /* Check for the path already being cached */
+        key.start_addr = start_addr;
+        key.path = (char *)path;    /* (Casting away const OK - QAK) */
+        if(NULL != (old_ent = (H5G_pcache_ent_t *)H5SL_search(pcache->slist, &key))) {
+            old_ent->addr = addr;
+            H5G__pcache_touch(pcache, old_ent);
+            HGOTO_DONE(SUCCEED)
+        } /* end if */
+    } /* end else */
+
+    /* Evict the least recently used entry, if the cache is full */
+    if(pcache->nents >= H5G_PCACHE_MAX_NENTS) {
+        H5G_pcache_ent_t *lru = pcache->LRU_head;
+
+        HDassert(lru);
+        if(NULL == H5SL_remove(pcache->slist, &lru->key))
+            HGOTO_ERROR(H5E_SYM, H5E_CANTDELETE, FAIL, "can't remove entry from path cache")
+        pcache->LRU_head = lru->LRU_next;
+        if(pcache->LRU_head)
+            pcache->LRU_head->LRU_prev = NULL;
+        else
+            pcache->LRU_tail = NULL;
+        pcache->nents--;
+        H5G__pcache_free_cb(lru, NULL, NULL);
+    } /* end if */
+
+    /* Create the new entry */
+    if(NULL == (ent = H5FL_CALLOC(H5G_pcache_ent_t)))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed")
+    ent->key.start_addr = start_addr;
+    if(NULL == (ent->key.path = H5MM_xstrdup(path)))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed")
+    ent->addr = addr;
+
+    /* Add the entry to the skip list */
+    if(H5SL_insert(pcache->slist, ent, &ent->key) < 0)
+        HGOTO_ERROR(H5E_SYM, H5E_CANTINSERT, FAIL, "can't insert entry into path cache")
+
+    /* Add the entry to the end of the LRU list */
+    ent->LRU_prev = pcache->LRU_tail;
+    if(pcache->LRU_tail)
+        pcache->LRU_tail->LRU_next = ent;
+    else
+        pcache->LRU_head = ent;
+    pcache->LRU_tail = ent;
+    pcache->nents++;
+
+done:
+    if(ret_value < 0 && ent)
+        H5G__pcache_free_cb(ent, NULL, NULL);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5G__pcache_insert() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5G_pcache_clear
+ *
+ * Purpose:     Evict all the entries in a file's path cache.  Called when
+ *              a link is removed from a group in the file (H5G_obj_remove*)
+ *              and when the file is mounted on or unmounted from another
+ *              (H5F__mount/H5F__unmount), for both parent and child.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5G_pcache_clear(const H5F_t *f)
+{
+    H5G_pcache_t *pcache;               /* File's path cache */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    /* Sanity check */
+    HDassert(f);
+
+    /* Release all the entries */
+    if(NULL != (pcache = H5F_PATH_CACHE(f)) && pcache->nents > 0) {
+        if(H5SL_free(pcache->slist, H5G__pcache_free_cb, NULL) < 0)
+            HGOTO_ERROR(H5E_SYM, H5E_CANTRELEASE, FAIL, "can't release path cache entries")
+        pcache->LRU_head = pcache->LRU_tail = NULL;
+        pcache->nents = 0;
+    } /* end if */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5G_pcache_clear() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5G_pcache_dest
+ *
+ * Purpose:     Release a file's path cache.  Called when the shared file
+ *              struct is being closed.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5G_pcache_dest(H5F_t *f)
+{
+    H5G_pcache_t *pcache;               /* File's path cache */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    /* Sanity check */
+    HDassert(f);
+
+    if(NULL != (pcache = H5F_PATH_CACHE(f))) {
+        if(H5SL_destroy(pcache->slist, H5G__pcache_free_cb, NULL) < 0)
+            HGOTO_ERROR(H5E_SYM, H5E_CANTRELEASE, FAIL, "can't release path cache")
+        pcache = H5FL_FREE(H5G_pcache_t, pcache);
+        if(H5F_SET_PATH_CACHE(f, NULL) < 0)
+            HGOTO_ERROR(H5E_SYM, H5E_CANTSET, FAIL, "can't reset path cache for file")
+    } /* end if */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5G_pcache_dest() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5G__pcache_nents
+ *
+ * Purpose:     Retrieve the # of entries in a file's path cache.
+ *
+ * Return:      # of entries (can't fail)
+ *
+ *-------------------------------------------------------------------------
+ */
+size_t
+H5G__pcache_nents(const H5F_t *f)
+{
+    H5G_pcache_t *pcache;               /* File's path cache */
+    size_t ret_value = 0;               /* Return value */
+
+    FUNC_ENTER_PACKAGE_NOERR
+
+    /* Sanity check */
+    HDassert(f);
+
+    if(NULL != (pcache = H5F_PATH_CACHE(f)))
+        ret_value = pcache->nents;
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5G__pcache_nents() */
+
@@ -344,6 +344,15 @@ H5_DLL herr_t H5G__traverse_special(const H5G_loc_t *grp_loc,
     const H5O_link_t *lnk, unsigned target, hbool_t last_comp,
     H5G_loc_t *obj_loc, hbool_t *obj_exists);
 
+/*
+ * Path resolution cache routines
+ */
+H5_DLL htri_t H5G__pcache_lookup(H5F_t *f, haddr_t start_addr, const char *path,
+    haddr_t *addr/*out*/);
+H5_DLL herr_t H5G__pcache_insert(H5F_t *f, haddr_t start_addr, const char *path,
+    haddr_t addr);
+H5_DLL size_t H5G__pcache_nents(const H5F_t *f);
+
 /*
  * Utility functions
  */
@@ -510,6 +519,7 @@ H5_DLL herr_t H5G__lheap_size_test(hid_t gid, size_t *lheap_size);
 H5_DLL herr_t H5G__user_path_test(hid_t obj_id, char *user_path, size_t *user_path_len, unsigned *user_path_hidden);
 H5_DLL herr_t H5G__verify_cached_stab_test(H5O_loc_t *grp_oloc, H5G_entry_t *ent);
 H5_DLL herr_t H5G__verify_cached_stabs_test(hid_t gid);
+H5_DLL herr_t H5G__pcache_nents_test(hid_t obj_id, size_t *nents);
 #endif /* H5G_TESTING */
 
 #endif /* _H5Gpkg_H */
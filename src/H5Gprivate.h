@@ -181,6 +181,7 @@ typedef struct {
 typedef struct H5G_t H5G_t;
 typedef struct H5G_shared_t H5G_shared_t;
 typedef struct H5G_entry_t H5G_entry_t;
+typedef struct H5G_pcache_t H5G_pcache_t;
 
 /*
  * Library prototypes...  These are the ones that other packages routinely
@@ -243,6 +244,12 @@ H5_DLL herr_t H5G_node_close(const H5F_t *f);
 H5_DLL herr_t H5G_node_debug(H5F_t *f, haddr_t addr, FILE *stream, int indent,
     int fwidth, haddr_t heap);
 
+/*
+ * These functions operate on the path resolution cache.
+ */
+H5_DLL herr_t H5G_pcache_clear(const H5F_t *f);
+H5_DLL herr_t H5G_pcache_dest(H5F_t *f);
+
 /*
  * These functions operate on group object locations.
  */
@@ -863,3 +863,36 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5G__verify_cached_stabs_test() */
 
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5G__pcache_nents_test
+ *
+ * Purpose:     Retrieve the # of entries in the path resolution cache
+ *              for the file that an object is in.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5G__pcache_nents_test(hid_t obj_id, size_t *nents)
+{
+    H5G_loc_t           loc;                    /* Location of object */
+    herr_t              ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Check args */
+    HDassert(nents);
+
+    /* Get object location */
+    if(H5G_loc(obj_id, &loc) < 0)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a location")
+
+    *nents = H5G__pcache_nents(loc.oloc->file);
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5G__pcache_nents_test() */
+
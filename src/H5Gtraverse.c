@@ -80,6 +80,8 @@ static herr_t H5G__traverse_ud(const H5G_loc_t *grp_loc, const H5O_link_t *lnk,
     H5G_loc_t *obj_loc/*in,out*/, unsigned target, hbool_t *obj_exists);
 static herr_t H5G__traverse_slink(const H5G_loc_t *grp_loc, const H5O_link_t *lnk,
     H5G_loc_t *obj_loc/*in,out*/, unsigned target, hbool_t *obj_exists);
+static size_t H5G__traverse_prefix(const char *name, char *prefix,
+    const char **last_name);
 static herr_t H5G__traverse_real(const H5G_loc_t *loc, const char *name,
     unsigned target, H5G_traverse_t op, void *op_data);
 
@@ -449,6 +451,62 @@ done:
 } /* end H5G__traverse_special() */
 
 
+/*-------------------------------------------------------------------------
+ * Function:	H5G__traverse_prefix
+ *
+ * Purpose:	Build the normalized form of the intermediate components of
+ *              a path (all components except the last, with '.' components
+ *              dropped and separated by single '/' characters), which is
+ *              the key for the path resolution cache.
+ *
+ *              PREFIX must be at least as large as NAME.
+ *
+ * Return:	# of intermediate components in the path (can't fail)
+ *
+ *-------------------------------------------------------------------------
+ */
+static size_t
+H5G__traverse_prefix(const char *name, char *prefix, const char **last_name)
+{
+    const char *last = NULL;            /* Last component seen */
+    size_t last_len = 0;                /* Length of last component seen */
+    size_t prefix_len = 0;              /* Length of prefix built */
+    size_t ncomps = 0;                  /* # of components in prefix */
+    size_t nchars;                      /* Length of current component */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Check parameters */
+    HDassert(name);
+    HDassert(prefix);
+    HDassert(last_name);
+
+    while((name = H5G__component(name, &nchars)) && *name) {
+        /* Skip the special name '.' */
+        if(!('.' == name[0] && 1 == nchars)) {
+            /* Append the previous component to the prefix */
+            if(last) {
+                if(prefix_len > 0)
+                    prefix[prefix_len++] = '/';
+                H5MM_memcpy(prefix + prefix_len, last, last_len);
+                prefix_len += last_len;
+                ncomps++;
+            } /* end if */
+
+            last = name;
+            last_len = nchars;
+        } /* end if */
+
+        name += nchars;
+    } /* end while */
+    prefix[prefix_len] = '\0';
+
+    *last_name = last;
+
+    FUNC_LEAVE_NOAPI(ncomps)
+} /* end H5G__traverse_prefix() */
+
+
 /*-------------------------------------------------------------------------
  * Function:	H5G__traverse_real
  *
@@ -485,6 +543,11 @@ H5G__traverse_real(const H5G_loc_t *_loc, const char *name, unsigned target,
     char                comp_buf[1024];     /* Temporary buffer for path components */
     char                *comp;          /* Pointer to buffer for path components */
     H5WB_t              *wb = NULL;     /* Wrapped buffer for temporary buffer */
+    char                prefix_buf[1024];   /* Temporary buffer for path prefix */
+    char                *prefix = NULL; /* Pointer to buffer for path prefix */
+    H5WB_t              *prefix_wb = NULL; /* Wrapped buffer for path prefix */
+    haddr_t             start_addr = HADDR_UNDEF; /* Address of group the path starts at */
+    hbool_t cache_prefix = FALSE;       /* Whether to cache the resolution of the path's prefix */
     hbool_t last_comp = FALSE;          /* Flag to indicate that a component is the last component in the name */
     herr_t              ret_value = SUCCEED;       /* Return value */
 
@@ -545,6 +608,54 @@ H5G__traverse_real(const H5G_loc_t *_loc, const char *name, unsigned target,
     if(NULL == (comp = (char *)H5WB_actual(wb, (HDstrlen(name) + 1))))
         HGOTO_ERROR(H5E_SYM, H5E_NOSPACE, FAIL, "can't get actual buffer")
 
+    /* Check the path resolution cache for the intermediate components of the
+     * name, unless the file could change underneath us (SWMR reading) or
+     * mount points could redirect the traversal.
+     */
+    if(!(H5F_INTENT(grp_loc.oloc->file) & H5F_ACC_SWMR_READ) &&
+            0 == H5F_SHARED_NMOUNTS(grp_loc.oloc->file) &&
+            NULL == H5F_PARENT(grp_loc.oloc->file)) {
+        const char *last_name;          /* Last component of the name */
+
+        /* Get a pointer to a buffer that's large enough */
+        if(NULL == (prefix_wb = H5WB_wrap(prefix_buf, sizeof(prefix_buf))))
+            HGOTO_ERROR(H5E_SYM, H5E_CANTINIT, FAIL, "can't wrap buffer")
+        if(NULL == (prefix = (char *)H5WB_actual(prefix_wb, (HDstrlen(name) + 1))))
+            HGOTO_ERROR(H5E_SYM, H5E_NOSPACE, FAIL, "can't get actual buffer")
+
+        if(H5G__traverse_prefix(name, prefix, &last_name) > 0) {
+            haddr_t grp_addr;           /* Address of cached group */
+            htri_t found;               /* Whether the prefix was cached */
+
+            start_addr = grp_loc.oloc->addr;
+            if((found = H5G__pcache_lookup(grp_loc.oloc->file, start_addr, prefix, &grp_addr)) < 0)
+                HGOTO_ERROR(H5E_SYM, H5E_NOTFOUND, FAIL, "can't search path cache")
+            if(found) {
+                /* Build location for the group the prefix resolves to */
+                if(H5G_name_set(grp_loc.path, obj_loc.path, prefix) < 0)
+                    HGOTO_ERROR(H5E_SYM, H5E_CANTINIT, FAIL, "cannot set name")
+                obj_loc.oloc->file = grp_loc.oloc->file;
+                obj_loc.oloc->addr = grp_addr;
+                obj_loc.oloc->holding_file = FALSE;
+                obj_loc_valid = TRUE;
+                if(grp_loc.oloc->holding_file)
+                    if(H5O_loc_hold_file(obj_loc.oloc) < 0)
+                        HGOTO_ERROR(H5E_SYM, H5E_CANTOPENOBJ, FAIL, "unable to hold file open")
+
+                /* Transfer "ownership" of the object's information to the group object */
+                H5G_loc_free(&grp_loc);
+                H5G_loc_copy(&grp_loc, &obj_loc, H5_COPY_SHALLOW);
+                H5G_loc_reset(&obj_loc);
+                obj_loc_valid = FALSE;
+
+                /* Continue with the last component */
+                name = last_name;
+            } /* end if */
+            else
+                cache_prefix = TRUE;
+        } /* end if */
+    } /* end if */
+
     /* Traverse the path */
     while((name = H5G__component(name, &nchars)) && *name) {
         const char *s;                  /* Temporary string pointer */
@@ -607,6 +718,11 @@ H5G__traverse_real(const H5G_loc_t *_loc, const char *name, unsigned target,
             H5O_link_t         *cb_lnk;    /* Pointer to link info for callback */
             H5G_loc_t          *cb_loc;    /* Pointer to object location for callback */
 
+            /* Remember the group that the intermediate components resolved to */
+            if(cache_prefix)
+                if(H5G__pcache_insert(grp_loc.oloc->file, start_addr, prefix, grp_loc.oloc->addr) < 0)
+                    HGOTO_ERROR(H5E_SYM, H5E_CANTINSERT, FAIL, "can't insert path into cache")
+
             /* Set callback parameters appropriately, based on link being found */
             if(lookup_status) {
                 cb_lnk = &lnk;
@@ -628,6 +744,13 @@ H5G__traverse_real(const H5G_loc_t *_loc, const char *name, unsigned target,
             HGOTO_DONE(SUCCEED)
         } /* end if */
 
+        /* Only cache paths whose intermediate components are existing hard
+         * links within the starting file
+         */
+        if(!lookup_status || H5L_TYPE_HARD != lnk.type ||
+                obj_loc.oloc->file != grp_loc.oloc->file)
+            cache_prefix = FALSE;
+
         /* Handle lookup failures now */
         if(!lookup_status) {
             /* If an intermediate group doesn't exist & flag is set, create the group */
@@ -791,6 +914,8 @@ done:
     /* Release temporary component buffer */
     if(wb && H5WB_unwrap(wb) < 0)
         HDONE_ERROR(H5E_SYM, H5E_CANTRELEASE, FAIL, "can't release wrapped buffer")
+    if(prefix_wb && H5WB_unwrap(prefix_wb) < 0)
+        HDONE_ERROR(H5E_SYM, H5E_CANTRELEASE, FAIL, "can't release wrapped buffer")
 
    FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5G__traverse_real() */
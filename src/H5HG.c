@@ -820,10 +820,12 @@ H5HG_remove (H5F_t *f, H5HG_t *hobj)
     HDmemset(heap->obj + hobj->idx, 0, sizeof(H5HG_obj_t));
     flags |= H5AC__DIRTIED_FLAG;
 
-    if((heap->obj[0].size + H5HG_SIZEOF_HDR(f)) == heap->size) {
+    if((heap->obj[0].size + H5HG_SIZEOF_HDR(f)) == heap->size
+            && !heap->cache_info.is_pinned) {
         /*
          * The collection is empty. Remove it from the CWFS list and return it
-         * to the file free list.
+         * to the file free list.  (Unless a cursor has it pinned, in which
+         * case the empty collection is left for the cursor to fill.)
          */
         flags |= H5AC__DELETED_FLAG | H5AC__FREE_FILE_SPACE_FLAG; /* Indicate that the object was deleted, for the unprotect call */
     } /* end if */
@@ -845,6 +847,259 @@ done:
 } /* end H5HG_remove() */
 
 
+/*-------------------------------------------------------------------------
+ * Function:	H5HG_cursor_reserve
+ *
+ * Purpose:	Tells a cursor that NOBJS more objects, totalling NBYTES of
+ *		data, are about to be inserted through it.  When the cursor
+ *		needs a new collection, it makes one big enough for all of
+ *		them (up to H5HG_MAXSIZE), instead of the smallest one that
+ *		fits the next object.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5HG_cursor_reserve(H5F_t *f, H5HG_cursor_t *cursor, size_t nobjs, size_t nbytes)
+{
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    /* Check args */
+    HDassert(f);
+    HDassert(cursor);
+
+    /* Allow for the object headers and alignment padding */
+    cursor->reserve += nobjs * (H5HG_SIZEOF_OBJHDR(f) + H5HG_ALIGNMENT - 1) + nbytes;
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5HG_cursor_reserve() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5HG_cursor_insert
+ *
+ * Purpose:	Inserts a new object into the global heap, like
+ *		H5HG_insert(), but places it in the collection pinned by
+ *		CURSOR when there's room.  Otherwise a collection with room
+ *		for the rest of the cursor's reservation is found on the CWFS
+ *		list (or created), and pinned in place of the old one.
+ *
+ * Return:	Success:	Non-negative, and a heap object handle returned
+ *				through the HOBJ pointer.
+ *
+ *		Failure:	Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5HG_cursor_insert(H5F_t *f, H5HG_cursor_t *cursor, size_t size, void *obj,
+    H5HG_t *hobj/*out*/)
+{
+    size_t	need;		/*total space needed for object		*/
+    size_t	idx;
+    H5HG_heap_t	*heap = NULL;
+    hbool_t     protected = FALSE;      /* Whether the heap was protected here */
+    unsigned 	heap_flags = H5AC__NO_FLAGS_SET;
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_NOAPI_TAG(H5AC__GLOBALHEAP_TAG, FAIL)
+
+    /* Check args */
+    HDassert(f);
+    HDassert(cursor);
+    HDassert(0 == size || obj);
+    HDassert(hobj);
+
+    if(0 == (H5F_INTENT(f) & H5F_ACC_RDWR))
+        HGOTO_ERROR(H5E_HEAP, H5E_WRITEERROR, FAIL, "no write intent on file")
+
+    need = H5HG_SIZEOF_OBJHDR(f) + H5HG_ALIGN(size);
+
+    /* Give up the pinned collection if it's in another file or is full */
+    if(cursor->heap && (cursor->heap->shared != H5F_SHARED(f) || cursor->heap->obj[0].size < need))
+        if(H5HG_cursor_release(cursor) < 0)
+            HGOTO_ERROR(H5E_HEAP, H5E_CANTUNPIN, FAIL, "unable to release global heap cursor")
+
+    if(cursor->heap)
+        heap = cursor->heap;
+    else {
+        haddr_t addr = HADDR_UNDEF;     /* Address of heap to add object within */
+        size_t want;                    /* Free space wanted in the collection */
+
+        /* Look for room for the rest of the run, but at least this object
+         * (keeping the size aligned, in case a collection is extended) */
+        want = H5HG_ALIGN(MAX(MIN(cursor->reserve, H5HG_MAXSIZE - H5HG_SIZEOF_HDR(f)), need));
+        if(H5F_cwfs_find_free_heap(f, want, &addr) < 0)
+            HGOTO_ERROR(H5E_HEAP, H5E_NOTFOUND, FAIL, "error trying to locate heap")
+        if(!H5F_addr_defined(addr))
+            if(!H5F_addr_defined(addr = H5HG__create(f, want + H5HG_SIZEOF_HDR(f))))
+                HGOTO_ERROR(H5E_HEAP, H5E_CANTINIT, FAIL, "unable to allocate a global heap collection")
+
+        if(NULL == (heap = H5HG__protect(f, addr, H5AC__NO_FLAGS_SET)))
+            HGOTO_ERROR(H5E_HEAP, H5E_CANTPROTECT, FAIL, "unable to protect global heap")
+        protected = TRUE;
+    } /* end else */
+    HDassert(heap->obj[0].size >= need);
+
+    /* Split the free space to make room for the new object */
+    if(0 == (idx = H5HG__alloc(f, heap, size, &heap_flags)))
+        HGOTO_ERROR(H5E_HEAP, H5E_CANTALLOC, FAIL, "unable to allocate global heap object")
+
+    /* Copy data into the heap */
+    if(size > 0)
+        H5MM_memcpy(heap->obj[idx].begin + H5HG_SIZEOF_OBJHDR(f), obj, size);
+    heap_flags |= H5AC__DIRTIED_FLAG;
+
+    /* Mark the pinned heap dirty (a newly protected one is marked when released) */
+    if(!protected)
+        if(H5AC_mark_entry_dirty(heap) < 0)
+            HGOTO_ERROR(H5E_HEAP, H5E_CANTMARKDIRTY, FAIL, "unable to mark global heap as dirty")
+
+    /* Account for the space used */
+    cursor->reserve -= MIN(cursor->reserve, need);
+
+    /* Return value */
+    hobj->addr = heap->addr;
+    hobj->idx = idx;
+
+done:
+    if(protected) {
+        /* Keep the heap pinned for the next insert, unless another cursor has it */
+        if(ret_value >= 0 && !heap->cache_info.is_pinned) {
+            heap_flags |= H5AC__PIN_ENTRY_FLAG;
+            cursor->heap = heap;
+        } /* end if */
+        if(H5AC_unprotect(f, H5AC_GHEAP, heap->addr, heap, heap_flags) < 0) {
+            cursor->heap = NULL;
+            HDONE_ERROR(H5E_HEAP, H5E_CANTUNPROTECT, FAIL, "unable to unprotect heap.")
+        } /* end if */
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI_TAG(ret_value)
+} /* end H5HG_cursor_insert() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5HG_cursor_read
+ *
+ * Purpose:	Reads a global heap object, like H5HG_read(), but keeps the
+ *		collection it's in pinned by CURSOR, so that following reads
+ *		of objects in the same collection don't have to go through
+ *		the metadata cache.
+ *
+ * Return:	Success:	The buffer containing the result.
+ *
+ *		Failure:	NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+void *
+H5HG_cursor_read(H5F_t *f, H5HG_cursor_t *cursor, H5HG_t *hobj, void *object/*out*/,
+    size_t *buf_size)
+{
+    H5HG_heap_t	*heap = NULL;           /* Pointer to global heap object */
+    hbool_t     protected = FALSE;      /* Whether the heap was protected here */
+    size_t	size;                   /* Size of the heap object */
+    void        *orig_object = object;  /* Keep a copy of the original object pointer */
+    void	*ret_value = NULL;      /* Return value */
+
+    FUNC_ENTER_NOAPI_TAG(H5AC__GLOBALHEAP_TAG, NULL)
+
+    /* Check args */
+    HDassert(f);
+    HDassert(cursor);
+    HDassert(hobj);
+
+    /* Give up the pinned collection if the object is in another one */
+    if(cursor->heap && (cursor->heap->shared != H5F_SHARED(f) || cursor->heap->addr != hobj->addr))
+        if(H5HG_cursor_release(cursor) < 0)
+            HGOTO_ERROR(H5E_HEAP, H5E_CANTUNPIN, NULL, "unable to release global heap cursor")
+
+    if(cursor->heap)
+        heap = cursor->heap;
+    else {
+        if(NULL == (heap = H5HG__protect(f, hobj->addr, H5AC__READ_ONLY_FLAG)))
+            HGOTO_ERROR(H5E_HEAP, H5E_CANTPROTECT, NULL, "unable to protect global heap")
+        protected = TRUE;
+
+        /* Advance the heap in the CWFS list */
+        if(heap->obj[0].begin)
+            if(H5F_cwfs_advance_heap(f, heap, FALSE) < 0)
+                HGOTO_ERROR(H5E_HEAP, H5E_CANTMODIFY, NULL, "can't adjust file's CWFS")
+    } /* end else */
+
+    HDassert(hobj->idx < heap->nused);
+    HDassert(heap->obj[hobj->idx].begin);
+    size = heap->obj[hobj->idx].size;
+
+    /* Allocate a buffer for the object read in, if the user didn't give one */
+    if(!object && NULL == (object = H5MM_malloc(size)))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, NULL, "memory allocation failed")
+    H5MM_memcpy(object, heap->obj[hobj->idx].begin + H5HG_SIZEOF_OBJHDR(f), size);
+
+    /* If the caller would like to know the heap object's size, set that */
+    if(buf_size)
+        *buf_size = size;
+
+    /* Set return value */
+    ret_value = object;
+
+done:
+    if(protected) {
+        unsigned heap_flags = H5AC__NO_FLAGS_SET;
+
+        /* Keep the heap pinned for the next read, unless another cursor has it */
+        if(ret_value && !heap->cache_info.is_pinned) {
+            heap_flags |= H5AC__PIN_ENTRY_FLAG;
+            cursor->heap = heap;
+        } /* end if */
+        if(H5AC_unprotect(f, H5AC_GHEAP, hobj->addr, heap, heap_flags) < 0) {
+            cursor->heap = NULL;
+            HDONE_ERROR(H5E_HEAP, H5E_CANTUNPROTECT, NULL, "unable to release object header")
+        } /* end if */
+    } /* end if */
+
+    if(NULL == ret_value && NULL == orig_object && object)
+        H5MM_free(object);
+
+    FUNC_LEAVE_NOAPI_TAG(ret_value)
+} /* end H5HG_cursor_read() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5HG_cursor_release
+ *
+ * Purpose:	Unpins the collection held by a cursor, if any.  The
+ *		reservation is kept, so the cursor can carry on being used.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5HG_cursor_release(H5HG_cursor_t *cursor)
+{
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    /* Check args */
+    HDassert(cursor);
+
+    if(cursor->heap) {
+        H5HG_heap_t *heap = cursor->heap;
+
+        cursor->heap = NULL;
+        if(H5AC_unpin_entry(heap) < 0)
+            HGOTO_ERROR(H5E_HEAP, H5E_CANTUNPIN, FAIL, "unable to unpin global heap")
+    } /* end if */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5HG_cursor_release() */
+
+
 /*-------------------------------------------------------------------------
  * Function:    H5HG__free
  *
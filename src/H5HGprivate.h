@@ -30,6 +30,22 @@ typedef struct H5HG_t {
 /* Typedef for heap in memory (defined in H5HGpkg.h) */
 typedef struct H5HG_heap_t H5HG_heap_t;
 
+/*
+ * Cursor for accessing a run of global heap objects.  The most recently used
+ * collection stays pinned in the metadata cache between calls, so objects in
+ * the same collection are read or inserted without protecting it again, and
+ * inserts are packed into collections sized for the whole run.  A cursor
+ * must be initialized with H5HG_CURSOR_INIT and released with
+ * H5HG_cursor_release() before any other operation that could delete the
+ * collection.
+ */
+typedef struct H5HG_cursor_t {
+    H5HG_heap_t *heap;          /* Pinned collection, or NULL */
+    size_t reserve;             /* Bytes still expected to be inserted */
+} H5HG_cursor_t;
+
+#define H5HG_CURSOR_INIT        {NULL, 0}
+
 
 /*
  * Limit global heap collections to the some reasonable size.  This is
@@ -57,6 +73,15 @@ H5_DLL int H5HG_link(H5F_t *f, const H5HG_t *hobj, int adjust);
 H5_DLL herr_t H5HG_get_obj_size(H5F_t *f, H5HG_t *hobj, size_t *obj_size);
 H5_DLL herr_t H5HG_remove(H5F_t *f, H5HG_t *hobj);
 
+/* Cursor routines */
+H5_DLL herr_t H5HG_cursor_reserve(H5F_t *f, H5HG_cursor_t *cursor, size_t nobjs,
+    size_t nbytes);
+H5_DLL herr_t H5HG_cursor_insert(H5F_t *f, H5HG_cursor_t *cursor, size_t size,
+    void *obj, H5HG_t *hobj/*out*/);
+H5_DLL void *H5HG_cursor_read(H5F_t *f, H5HG_cursor_t *cursor, H5HG_t *hobj,
+    void *object, size_t *buf_size/*out*/);
+H5_DLL herr_t H5HG_cursor_release(H5HG_cursor_t *cursor);
+
 /* Support routines */
 H5_DLL herr_t H5HG_extend(H5F_t *f, haddr_t addr, size_t need);
 
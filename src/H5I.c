@@ -51,6 +51,17 @@
 #define H5I_MAKE(g,i)	((((hid_t)(g) & TYPE_MASK) << ID_BITS) |	  \
 			     ((hid_t)(i) & ID_MASK))
 
+/* Initial number of buckets in a type's hash index (must be a power of 2),
+ * and the most that H5Iregister_type() may ask for up front
+ */
+#define H5I_HASH_INIT_SIZE      64
+#define H5I_HASH_MAX_INIT_SIZE  ((size_t)1 << 20)
+
+/* Hash bucket for an atom.  IDs within a type are handed out in sequence,
+ * so their low bits spread them evenly across the buckets.
+ */
+#define H5I_HASH_BUCKET(t, i)   ((size_t)((hid_t)(i) & ID_MASK) & ((t)->hash_size - 1))
+
 /* Local typedefs */
 
 /* Atom information structure used */
@@ -59,6 +70,7 @@ typedef struct H5I_id_info_t {
     unsigned	count;		/* ref. count for this atom		    */
     unsigned    app_count;      /* ref. count of application visible atoms  */
     const void	*obj_ptr;	/* pointer associated with the atom	    */
+    struct H5I_id_info_t *hash_next; /* next atom in the same hash bucket   */
 } H5I_id_info_t;
 
 /* ID type structure used */
@@ -68,6 +80,12 @@ typedef struct {
     uint64_t	id_count;	/* Current number of IDs held		    */
     uint64_t	nextid;		/* ID to use for the next atom		    */
     H5SL_t      *ids;           /* Pointer to skip list that stores IDs     */
+
+    /* Hash index over the IDs, for lookups */
+    /* (The skip list keeps the IDs in order, for iteration) */
+    H5I_id_info_t **hash_table; /* Buckets of IDs, chained through 'hash_next' */
+    size_t      hash_size;      /* Number of buckets (a power of 2)         */
+    H5I_id_info_t *last_id_info; /* ID found by the most recent lookup      */
 } H5I_id_type_t;
 
 typedef struct {
@@ -140,6 +158,9 @@ static int H5I__inc_type_ref(H5I_type_t type);
 static int H5I__get_type_ref(H5I_type_t type);
 static int H5I__search_cb(void *obj, hid_t id, void *_udata);
 static H5I_id_info_t *H5I__find_id(hid_t id);
+static herr_t H5I__hash_resize(H5I_id_type_t *type_ptr, size_t new_size);
+static herr_t H5I__hash_insert(H5I_id_type_t *type_ptr, H5I_id_info_t *id_ptr);
+static H5I_id_info_t *H5I__hash_remove(H5I_id_type_t *type_ptr, hid_t id);
 static int H5I__iterate_pub_cb(void *obj, hid_t id, void *udata);
 static int H5I__find_id_cb(void *_item, void *_key, void *_udata);
 static int H5I__id_dump_cb(void *_item, void *_key, void *_udata);
@@ -264,6 +285,16 @@ H5Iregister_type(size_t hash_size, unsigned reserved, H5I_free_t free_func)
     if(H5I_register_type(cls) < 0)
         HGOTO_ERROR(H5E_ATOM, H5E_CANTINIT, H5I_BADID, "can't initialize ID class")
 
+    /* Size the type's hash index for the number of IDs expected */
+    if(hash_size > H5I_HASH_INIT_SIZE) {
+        size_t new_size = H5I_HASH_INIT_SIZE;   /* Number of buckets */
+
+        while(new_size < hash_size && new_size < H5I_HASH_MAX_INIT_SIZE)
+            new_size *= 2;
+        if(H5I__hash_resize(H5I_id_type_list_g[new_type], new_size) < 0)
+            HGOTO_ERROR(H5E_ATOM, H5E_CANTALLOC, H5I_BADID, "can't size hash index")
+    } /* end if */
+
     /* Set return value */
     ret_value = new_type;
 
@@ -319,6 +350,10 @@ H5I_register_type(const H5I_class_t *cls)
         type_ptr->nextid = cls->reserved;
         if(NULL == (type_ptr->ids = H5SL_create(H5SL_TYPE_HID, NULL)))
             HGOTO_ERROR(H5E_ATOM, H5E_CANTCREATE, FAIL, "skip list creation failed")
+        if(NULL == (type_ptr->hash_table = (H5I_id_info_t **)H5MM_calloc(H5I_HASH_INIT_SIZE * sizeof(H5I_id_info_t *))))
+            HGOTO_ERROR(H5E_ATOM, H5E_CANTALLOC, FAIL, "hash index allocation failed")
+        type_ptr->hash_size = H5I_HASH_INIT_SIZE;
+        type_ptr->last_id_info = NULL;
     } /* end if */
 
     /* Increment the count of the times this type has been initialized */
@@ -329,6 +364,7 @@ done:
         if(type_ptr) {
             if(type_ptr->ids)
                 H5SL_close(type_ptr->ids);
+            type_ptr->hash_table = (H5I_id_info_t **)H5MM_xfree(type_ptr->hash_table);
             (void)H5FL_FREE(H5I_id_type_t, type_ptr);
         } /* end if */
     } /* end if */
@@ -629,6 +665,9 @@ H5I__clear_type_cb(void *_id, void H5_ATTR_UNUSED *key, void *_udata)
 
         /* Remove ID if requested */
         if(ret_value) {
+            /* Remove the ID from the hash index */
+            H5I__hash_remove(udata->type_ptr, id->id);
+
             /* Free ID info */
             id = H5FL_FREE(H5I_id_info_t, id);
 
@@ -718,6 +757,7 @@ H5I__destroy_type(H5I_type_t type)
     if(H5SL_close(type_ptr->ids) < 0)
         HGOTO_ERROR(H5E_ATOM, H5E_CANTCLOSEOBJ, FAIL, "can't close skip list")
     type_ptr->ids = NULL;
+    type_ptr->hash_table = (H5I_id_info_t **)H5MM_xfree(type_ptr->hash_table);
 
     type_ptr = H5FL_FREE(H5I_id_type_t, type_ptr);
     H5I_id_type_list_g[type] = NULL;
@@ -800,6 +840,10 @@ H5I_register(H5I_type_t type, const void *object, hbool_t app_ref)
     /* Insert into the type */
     if (H5SL_insert(type_ptr->ids, id_ptr, &id_ptr->id) < 0)
         HGOTO_ERROR(H5E_ATOM, H5E_CANTINSERT, H5I_INVALID_HID, "can't insert ID node into skip list")
+    if (H5I__hash_insert(type_ptr, id_ptr) < 0) {
+        H5SL_remove(type_ptr->ids, &id_ptr->id);
+        HGOTO_ERROR(H5E_ATOM, H5E_CANTINSERT, H5I_INVALID_HID, "can't insert ID node into hash index")
+    } /* end if */
     type_ptr->id_count++;
     type_ptr->nextid++;
 
@@ -875,6 +919,10 @@ H5I_register_using_existing_id(H5I_type_t type, void *object, hbool_t app_ref, h
     /* Insert into the type */
     if(H5SL_insert(type_ptr->ids, id_ptr, &id_ptr->id) < 0)
         HGOTO_ERROR(H5E_ATOM, H5E_CANTINSERT, FAIL, "can't insert ID node into skip list")
+    if(H5I__hash_insert(type_ptr, id_ptr) < 0) {
+        H5SL_remove(type_ptr->ids, &id_ptr->id);
+        HGOTO_ERROR(H5E_ATOM, H5E_CANTINSERT, FAIL, "can't insert ID node into hash index")
+    } /* end if */
     type_ptr->id_count++;
 
 done:
@@ -1183,6 +1231,7 @@ H5I__remove_common(H5I_id_type_t *type_ptr, hid_t id)
     /* Get the ID node for the ID */
     if(NULL == (curr_id = (H5I_id_info_t *)H5SL_remove(type_ptr->ids, &id)))
         HGOTO_ERROR(H5E_ATOM, H5E_CANTDELETE, NULL, "can't remove ID node from skip list")
+    H5I__hash_remove(type_ptr, id);
 
     /* (Casting away const OK -QAK) */
     ret_value = (void *)curr_id->obj_ptr;
@@ -2134,13 +2183,149 @@ H5I__find_id(hid_t id)
     if(!type_ptr || type_ptr->init_count <= 0)
         HGOTO_DONE(NULL)
 
+    /* Check the ID found by the last lookup, since API calls tend to look
+     * up the same ID several times in a row
+     */
+    if(type_ptr->last_id_info && type_ptr->last_id_info->id == id)
+        HGOTO_DONE(type_ptr->last_id_info)
+
     /* Locate the ID node for the ID */
-    ret_value = (H5I_id_info_t *)H5SL_search(type_ptr->ids, &id);
+    for(ret_value = type_ptr->hash_table[H5I_HASH_BUCKET(type_ptr, id)]; ret_value; ret_value = ret_value->hash_next)
+        if(ret_value->id == id) {
+            type_ptr->last_id_info = ret_value;
+            break;
+        } /* end if */
 
 done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5I__find_id() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    H5I__hash_resize
+ *
+ * Purpose:     Moves a type's IDs to a hash index with NEW_SIZE buckets,
+ *              which must be a power of 2.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5I__hash_resize(H5I_id_type_t *type_ptr, size_t new_size)
+{
+    H5I_id_info_t **new_table;          /* New array of buckets */
+    size_t      u;                      /* Local index variable */
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity checks */
+    HDassert(type_ptr);
+    HDassert(type_ptr->hash_table);
+    HDassert(new_size > 0 && 0 == (new_size & (new_size - 1)));
+
+    if(NULL == (new_table = (H5I_id_info_t **)H5MM_calloc(new_size * sizeof(H5I_id_info_t *))))
+        HGOTO_ERROR(H5E_ATOM, H5E_CANTALLOC, FAIL, "hash index allocation failed")
+
+    /* Move the IDs to their new buckets */
+    for(u = 0; u < type_ptr->hash_size; u++) {
+        H5I_id_info_t *curr = type_ptr->hash_table[u];
+
+        while(curr) {
+            H5I_id_info_t *next = curr->hash_next;
+            size_t bucket = (size_t)(curr->id & ID_MASK) & (new_size - 1);
+
+            curr->hash_next = new_table[bucket];
+            new_table[bucket] = curr;
+            curr = next;
+        } /* end while */
+    } /* end for */
+
+    H5MM_xfree(type_ptr->hash_table);
+    type_ptr->hash_table = new_table;
+    type_ptr->hash_size = new_size;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5I__hash_resize() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5I__hash_insert
+ *
+ * Purpose:     Adds an ID to its type's hash index, doubling the number of
+ *              buckets first if the type holds as many IDs as buckets.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5I__hash_insert(H5I_id_type_t *type_ptr, H5I_id_info_t *id_ptr)
+{
+    size_t      bucket;                 /* Bucket for the ID */
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity checks */
+    HDassert(type_ptr);
+    HDassert(type_ptr->hash_table);
+    HDassert(id_ptr);
+
+    /* Grow the index, to keep the bucket chains short */
+    if(type_ptr->id_count >= type_ptr->hash_size)
+        if(H5I__hash_resize(type_ptr, type_ptr->hash_size * 2) < 0)
+            HGOTO_ERROR(H5E_ATOM, H5E_CANTALLOC, FAIL, "can't grow hash index")
+
+    /* Add the ID to the front of its bucket */
+    bucket = H5I_HASH_BUCKET(type_ptr, id_ptr->id);
+    id_ptr->hash_next = type_ptr->hash_table[bucket];
+    type_ptr->hash_table[bucket] = id_ptr;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5I__hash_insert() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5I__hash_remove
+ *
+ * Purpose:     Takes an ID out of its type's hash index.
+ *
+ * Return:      Success:    A pointer to the ID's info struct
+ *              Failure:    NULL, if the ID isn't in the index
+ *
+ *-------------------------------------------------------------------------
+ */
+static H5I_id_info_t *
+H5I__hash_remove(H5I_id_type_t *type_ptr, hid_t id)
+{
+    H5I_id_info_t **link;               /* Link to the current ID in the bucket */
+    H5I_id_info_t *ret_value = NULL;    /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Sanity checks */
+    HDassert(type_ptr);
+    HDassert(type_ptr->hash_table);
+
+    /* Unlink the ID from its bucket */
+    for(link = &type_ptr->hash_table[H5I_HASH_BUCKET(type_ptr, id)]; *link; link = &(*link)->hash_next)
+        if((*link)->id == id) {
+            ret_value = *link;
+            *link = ret_value->hash_next;
+            break;
+        } /* end if */
+
+    /* Forget the ID, if it was the last one looked up */
+    if(ret_value && type_ptr->last_id_info == ret_value)
+        type_ptr->last_id_info = NULL;
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5I__hash_remove() */
+
 
 /*-------------------------------------------------------------------------
  * Function:    H5Iget_name
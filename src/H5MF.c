@@ -85,6 +85,8 @@ typedef struct {
 
 /* Allocator routines */
 static haddr_t H5MF__alloc_pagefs(H5F_t *f, H5FD_mem_t alloc_type, hsize_t size);
+static htri_t H5MF__find_sect_real(H5F_t *f, H5FD_mem_t alloc_type, hsize_t size,
+    H5FS_t *fspace, haddr_t max_addr, haddr_t *addr);
 
 /* "File closing" routines */
 static herr_t H5MF__close_aggrfs(H5F_t *f);
@@ -696,6 +698,34 @@ done:
 htri_t
 H5MF__find_sect(H5F_t *f, H5FD_mem_t alloc_type, hsize_t size, H5FS_t *fspace,
     haddr_t *addr)
+{
+    htri_t ret_value = FAIL;      	    /* Whether an existing free list node was found */
+
+    FUNC_ENTER_PACKAGE
+
+    if((ret_value = H5MF__find_sect_real(f, alloc_type, size, fspace, HADDR_UNDEF, addr)) < 0)
+        HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "error locating free space in file")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5MF__find_sect() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5MF__find_sect_real
+ *
+ * Purpose:	Find a section for H5MF__find_sect() and H5MF_alloc_below().
+ *		    If MAX_ADDR is defined, only sections that start before it
+ *		    are considered, lowest address first.
+ *
+ * Return:	TRUE if a section is found to fulfill the request
+ *		    FALSE if not
+ *
+ *-------------------------------------------------------------------------
+ */
+static htri_t
+H5MF__find_sect_real(H5F_t *f, H5FD_mem_t alloc_type, hsize_t size, H5FS_t *fspace,
+    haddr_t max_addr, haddr_t *addr)
 {
     H5AC_ring_t orig_ring = H5AC_RING_INV;  /* Original ring value */
     H5AC_ring_t fsm_ring = H5AC_RING_INV;   /* Ring of FSM */
@@ -715,7 +745,11 @@ H5MF__find_sect(H5F_t *f, H5FD_mem_t alloc_type, hsize_t size, H5FS_t *fspace,
     H5AC_set_ring(fsm_ring, &orig_ring);
 
     /* Try to get a section from the free space manager */
-    if((ret_value = H5FS_sect_find(f, fspace, size, (H5FS_section_info_t **)&node)) < 0)
+    if(H5F_addr_defined(max_addr))
+        ret_value = H5FS_sect_find_below(f, fspace, size, max_addr, (H5FS_section_info_t **)&node);
+    else
+        ret_value = H5FS_sect_find(f, fspace, size, (H5FS_section_info_t **)&node);
+    if(ret_value < 0)
         HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "error locating free space in file")
 
 #ifdef H5MF_ALLOC_DEBUG_MORE
@@ -762,7 +796,7 @@ done:
         H5AC_set_ring(orig_ring, NULL);
 
     FUNC_LEAVE_NOAPI_TAG(ret_value)
-} /* end H5MF__find_sect() */
+} /* end H5MF__find_sect_real() */
 
 
 /*-------------------------------------------------------------------------
@@ -1073,6 +1107,86 @@ done:
 } /* end H5MF_alloc_tmp() */
 
 
+/*-------------------------------------------------------------------------
+ * Function:    H5MF_alloc_below
+ *
+ * Purpose:     Allocate SIZE bytes of file memory from space that the
+ *              file's free-space manager is already tracking, but only if
+ *              that space is located before MAX_ADDR.  The lowest such
+ *              space is used.  Never extends the file or takes space from
+ *              the aggregators.
+ *
+ *              Used to move blocks toward the beginning of the file.
+ *
+ * Return:      Non-negative on success/Negative on failure.  *ADDR is set
+ *              to HADDR_UNDEF if no suitable space is available.
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5MF_alloc_below(H5F_t *f, H5FD_mem_t alloc_type, hsize_t size, haddr_t max_addr,
+    haddr_t *addr)
+{
+    H5AC_ring_t fsm_ring = H5AC_RING_INV;       /* free space manager ring */
+    H5AC_ring_t orig_ring = H5AC_RING_INV;      /* Original ring value */
+    H5F_mem_page_t  fs_type;            /* Free space type (mapped from allocation type) */
+    haddr_t new_addr = HADDR_UNDEF;     /* Address of space found */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_NOAPI_TAG(H5AC__FREESPACE_TAG, FAIL)
+
+    /* check arguments */
+    HDassert(f);
+    HDassert(f->shared);
+    HDassert(size > 0);
+    HDassert(addr);
+
+    *addr = HADDR_UNDEF;
+
+    /* Only space that is tracked by a free space manager can be reused */
+    if(!H5F_HAVE_FREE_SPACE_MANAGER(f))
+        HGOTO_DONE(SUCCEED)
+
+    H5MF__alloc_to_fs_type(f, alloc_type, size, &fs_type);
+
+    /* Set the ring type in the API context */
+    if(H5MF__fsm_type_is_self_referential(f, fs_type))
+        fsm_ring = H5AC_RING_MDFSM;
+    else
+        fsm_ring = H5AC_RING_RDFSM;
+    H5AC_set_ring(fsm_ring, &orig_ring);
+
+    /* We are about to change the contents of the free space manager --
+     * notify metadata cache that the associated fsm ring is unsettled
+     */
+    if(H5AC_unsettle_ring(f, fsm_ring) < 0)
+        HGOTO_ERROR(H5E_RESOURCE, H5E_SYSTEM, FAIL, "attempt to notify cache that ring is unsettled failed")
+
+    /* Check if the free space manager for the file has been initialized */
+    if(!f->shared->fs_man[fs_type] && H5F_addr_defined(f->shared->fs_addr[fs_type])) {
+        /* Open the free-space manager */
+        if(H5MF__open_fstype(f, fs_type) < 0)
+            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTOPENOBJ, FAIL, "can't initialize file free space")
+        HDassert(f->shared->fs_man[fs_type]);
+    } /* end if */
+
+    /* Search for the lowest large enough space before the limit */
+    if(f->shared->fs_man[fs_type])
+        if(H5MF__find_sect_real(f, alloc_type, size, f->shared->fs_man[fs_type], max_addr, &new_addr) < 0)
+            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "error locating a node")
+
+    HDassert(!H5F_addr_defined(new_addr) || H5F_addr_lt(new_addr, max_addr));
+    *addr = new_addr;
+
+done:
+    /* Reset the ring in the API context */
+    if(orig_ring != H5AC_RING_INV)
+        H5AC_set_ring(orig_ring, NULL);
+
+    FUNC_LEAVE_NOAPI_TAG(ret_value)
+} /* end H5MF_alloc_below() */
+
+
 /*-------------------------------------------------------------------------
  * Function:    H5MF_xfree
  *
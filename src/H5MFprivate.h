@@ -56,6 +56,8 @@ H5_DLL herr_t H5MF_try_close(H5F_t *f);
 /* File space allocation routines */
 H5_DLL haddr_t H5MF_alloc(H5F_t *f, H5FD_mem_t type, hsize_t size);
 H5_DLL haddr_t H5MF_aggr_vfd_alloc(H5F_t *f, H5FD_mem_t type, hsize_t size);
+H5_DLL herr_t H5MF_alloc_below(H5F_t *f, H5FD_mem_t type, hsize_t size,
+    haddr_t max_addr, haddr_t *addr);
 H5_DLL herr_t H5MF_xfree(H5F_t *f, H5FD_mem_t type, haddr_t addr,
     hsize_t size);
 H5_DLL herr_t H5MF_try_extend(H5F_t *f, H5FD_mem_t type, haddr_t addr,
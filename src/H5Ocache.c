@@ -1627,7 +1627,10 @@ H5O__chunk_deserialize(H5O_t *oh, haddr_t addr, size_t len, const uint8_t *image
     } /* end if */
 
 done:
-    if(ret_value < 0 && udata->cont_msg_info->msgs) {
+    /* (The continuation messages of a header that loads its chunks on
+     *  demand are released with the header)
+     */
+    if(ret_value < 0 && udata->cont_msg_info != &oh->cont_msgs && udata->cont_msg_info->msgs) {
         udata->cont_msg_info->msgs = H5FL_SEQ_FREE(H5O_cont_t, udata->cont_msg_info->msgs);
         udata->cont_msg_info->alloc_nmsgs = 0;
     }
@@ -64,6 +64,9 @@
 /* Declare the free list for H5O_chunk_proxy_t's */
 H5FL_DEFINE(H5O_chunk_proxy_t);
 
+/* Declare external the free list for H5O_cont_t sequences */
+H5FL_SEQ_EXTERN(H5O_cont_t);
+
 
 /*****************************/
 /* Library Private Variables */
@@ -144,6 +147,111 @@ done:
     FUNC_LEAVE_NOAPI_TAG(ret_value)
 } /* end H5O__chunk_add() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    H5O__chunk_load_pending
+ *
+ * Purpose:     Load continuation chunks of an object header that haven't
+ *              been read from the file yet, in the order their
+ *              continuation messages were found.
+ *
+ *              When TYPE is non-NULL, loading stops as soon as a message
+ *              of that type is among the loaded messages, so that a
+ *              lookup only reads the chunks it needs.  When TYPE is NULL,
+ *              all remaining chunks are loaded.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5O__chunk_load_pending(H5F_t *f, H5O_t *oh, unsigned prot_flags,
+    const H5O_msg_class_t *type, unsigned *merged_null_msgs)
+{
+    H5O_chk_cache_ud_t chk_udata;       /* User data for loading chunk */
+    size_t      curr_mesg = 0;          /* First message not checked for TYPE yet */
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_PACKAGE_TAG(oh->cache_info.addr)
+
+    /* check args */
+    HDassert(f);
+    HDassert(oh);
+    HDassert(oh->cont_loaded <= oh->cont_msgs.nmsgs);
+
+    /* A chunk that failed to load has left the header partly decoded */
+    if(oh->cont_load_failed)
+        HGOTO_ERROR(H5E_OHDR, H5E_CANTLOAD, FAIL, "object header chunk failed to load")
+
+    /* Construct the user data for protecting chunks */
+    chk_udata.decoding = TRUE;
+    chk_udata.oh = oh;
+    chk_udata.chunkno = UINT_MAX;   /* Set to invalid value, for better error detection */
+    chk_udata.common.f = f;
+    chk_udata.common.file_intent = H5F_INTENT(f);
+    chk_udata.common.merged_null_msgs = merged_null_msgs ? *merged_null_msgs : 0;
+    chk_udata.common.cont_msg_info = &oh->cont_msgs;
+
+    /* Read in continuation chunks, until there are no more */
+    /* (Note that loading chunks could increase the # of continuation
+     *      messages if new ones are found - QAK, 19/11/2016)
+     */
+    while(oh->cont_loaded < oh->cont_msgs.nmsgs) {
+        H5O_chunk_proxy_t *chk_proxy;       /* Proxy for chunk, to bring it into memory */
+        const H5O_cont_t *cont = &oh->cont_msgs.msgs[oh->cont_loaded];     /* Continuation message for the chunk */
+#ifndef NDEBUG
+        size_t chkcnt = oh->nchunks;      /* Count of chunks (for sanity checking) */
+#endif /* NDEBUG */
+
+        /* Stop when the messages loaded so far include one of the type wanted */
+        if(type) {
+            for(; curr_mesg < oh->nmesgs; curr_mesg++)
+                if(oh->mesg[curr_mesg].type == type)
+                    break;
+            if(curr_mesg < oh->nmesgs)
+                break;
+        } /* end if */
+
+        /* Bring the chunk into the cache */
+        /* (which adds to the object header) */
+        chk_udata.common.addr = cont->addr;
+        chk_udata.size = cont->size;
+        if(NULL == (chk_proxy = (H5O_chunk_proxy_t *)H5AC_protect(f, H5AC_OHDR_CHK, cont->addr, &chk_udata, prot_flags))) {
+            oh->cont_load_failed = TRUE;
+            HGOTO_ERROR(H5E_OHDR, H5E_CANTPROTECT, FAIL, "unable to load object header chunk")
+        } /* end if */
+
+        /* Sanity check */
+        HDassert(chk_proxy->oh == oh);
+        HDassert(chk_proxy->chunkno == chkcnt);
+        HDassert(oh->nchunks == (chkcnt + 1));
+
+        /* Release the chunk from the cache */
+        /* (the continuation messages may have been reallocated while loading
+         *  it, so look the address up again)
+         */
+        if(H5AC_unprotect(f, H5AC_OHDR_CHK, oh->cont_msgs.msgs[oh->cont_loaded].addr, chk_proxy, H5AC__NO_FLAGS_SET) < 0)
+            HGOTO_ERROR(H5E_OHDR, H5E_CANTUNPROTECT, FAIL, "unable to release object header chunk")
+
+        /* Advance to next continuation message */
+        oh->cont_loaded++;
+    } /* end while */
+
+    /* Release the continuation messages, once all their chunks are loaded */
+    if(oh->cont_loaded == oh->cont_msgs.nmsgs && oh->cont_msgs.msgs) {
+        oh->cont_msgs.msgs = (H5O_cont_t *)H5FL_SEQ_FREE(H5O_cont_t, oh->cont_msgs.msgs);
+        oh->cont_msgs.nmsgs = oh->cont_msgs.alloc_nmsgs = 0;
+        oh->cont_loaded = 0;
+    } /* end if */
+
+    /* Pass back out some of the chunks' user data */
+    if(merged_null_msgs)
+        *merged_null_msgs = chk_udata.common.merged_null_msgs;
+
+done:
+    FUNC_LEAVE_NOAPI_TAG(ret_value)
+} /* end H5O__chunk_load_pending() */
+
 
 /*-------------------------------------------------------------------------
  * Function:    H5O_chunk_protect
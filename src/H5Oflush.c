@@ -306,6 +306,12 @@ H5O_refresh_metadata(hid_t oid, H5O_loc_t oloc)
         obj_loc.path = &obj_path;
         H5G_loc_reset(&obj_loc);
 
+        /* The object can't be closed and re-opened while reads in other
+         *  threads may be using it.
+         */
+        if(H5F_get_nconcurrent_reads(oloc.file) > 0)
+            HGOTO_ERROR(H5E_OHDR, H5E_CANTLOAD, FAIL, "unable to refresh object, reads are in progress in other threads")
+
         /* "Fake" another open object in the file, so that it doesn't get closed
          *  if this object is the only thing holding the file open.
          */
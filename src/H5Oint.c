@@ -47,6 +47,17 @@
 /* Local Macros */
 /****************/
 
+/* Whether continuation chunks of object headers in a file may be loaded on
+ * demand.  SWMR readers and writers need every chunk of a header from the
+ * same point in time, and strict format checking counts the messages of
+ * the whole header when it is loaded, so both always load all chunks.
+ */
+#ifdef H5_STRICT_FORMAT_CHECKS
+#define H5O_LAZY_CHUNKS(F)      FALSE
+#else /* H5_STRICT_FORMAT_CHECKS */
+#define H5O_LAZY_CHUNKS(F)      (0 == (H5F_INTENT(F) & (H5F_ACC_SWMR_READ | H5F_ACC_SWMR_WRITE)))
+#endif /* H5_STRICT_FORMAT_CHECKS */
+
 
 /******************/
 /* Local Typedefs */
@@ -80,6 +91,9 @@ static herr_t H5O__free_visit_visited(void *item, void *key,
 static herr_t H5O__visit_cb(hid_t group, const char *name, const H5L_info_t *linfo,
     void *_udata);
 static const H5O_obj_class_t *H5O__obj_class_real(const H5O_t *oh);
+static herr_t H5O__obj_class_load(const H5O_loc_t *loc, H5O_t *oh);
+static H5O_t *H5O__protect_real(const H5O_loc_t *loc, unsigned prot_flags,
+    hbool_t pin_all_chunks, hbool_t load_all);
 
 /*********************/
 /* Package Variables */
@@ -1017,6 +1031,88 @@ done:
  */
 H5O_t *
 H5O_protect(const H5O_loc_t *loc, unsigned prot_flags, hbool_t pin_all_chunks)
+{
+    H5O_t *ret_value = NULL;    /* Return value */
+
+    FUNC_ENTER_NOAPI(NULL)
+
+    /* Protect the object header, with all of its chunks loaded */
+    if(NULL == (ret_value = H5O__protect_real(loc, prot_flags, pin_all_chunks, TRUE)))
+        HGOTO_ERROR(H5E_OHDR, H5E_CANTPROTECT, NULL, "unable to protect object header")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5O_protect() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5O__protect_msg
+ *
+ * Purpose:	Protect an object header for reading a message of type
+ *              TYPE_ID, loading continuation chunks only until a message
+ *              of that type has been loaded (or all chunks are loaded,
+ *              when the header has no such message).
+ *
+ *              The object header returned may have chunks that aren't
+ *              loaded yet, so it must only be used to look up messages
+ *              of type TYPE_ID, and must be released with H5O_unprotect.
+ *
+ * Return:	Success:	Pointer to the object header structure for the
+ *                              object.
+ *		Failure:	NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+H5O_t *
+H5O__protect_msg(const H5O_loc_t *loc, unsigned type_id)
+{
+    H5O_t *oh = NULL;           /* Object header protected */
+    H5O_t *ret_value = NULL;    /* Return value */
+
+    FUNC_ENTER_PACKAGE_TAG(loc->addr)
+
+    HDassert(type_id < NELMTS(H5O_msg_class_g));
+
+    /* Protect the object header, with the chunks loaded so far */
+    if(NULL == (oh = H5O__protect_real(loc, H5AC__READ_ONLY_FLAG, FALSE, FALSE)))
+        HGOTO_ERROR(H5E_OHDR, H5E_CANTPROTECT, NULL, "unable to protect object header")
+
+    /* Load chunks until a message of the type wanted is loaded */
+    if(H5O__chunk_load_pending(loc->file, oh, H5AC__READ_ONLY_FLAG, H5O_msg_class_g[type_id], NULL) < 0)
+        HGOTO_ERROR(H5E_OHDR, H5E_CANTLOAD, NULL, "unable to load object header chunks")
+
+    /* Set return value */
+    ret_value = oh;
+
+done:
+    if(ret_value == NULL && oh)
+        if(H5O_unprotect(loc, oh, H5AC__NO_FLAGS_SET) < 0)
+            HDONE_ERROR(H5E_OHDR, H5E_CANTUNPROTECT, NULL, "unable to release object header")
+
+    FUNC_LEAVE_NOAPI_TAG(ret_value)
+} /* end H5O__protect_msg() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5O__protect_real
+ *
+ * Purpose:	Protect an object header in the metadata cache.
+ *
+ *              When LOAD_ALL is set, or chunks can't be loaded on demand
+ *              in the file, all continuation chunks of the header are
+ *              loaded.  Otherwise only the first chunk is guaranteed to
+ *              be loaded, and the continuation messages for the others
+ *              are kept in the header, for H5O__chunk_load_pending.
+ *
+ * Return:	Success:	Pointer to the object header structure for the
+ *                              object.
+ *		Failure:	NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+static H5O_t *
+H5O__protect_real(const H5O_loc_t *loc, unsigned prot_flags, hbool_t pin_all_chunks,
+    hbool_t load_all)
 {
     H5O_t *oh = NULL;           /* Object header protected */
     H5O_cache_ud_t udata;       /* User data for protecting object header */
@@ -1024,7 +1120,7 @@ H5O_protect(const H5O_loc_t *loc, unsigned prot_flags, hbool_t pin_all_chunks)
     unsigned file_intent;       /* R/W intent on file */
     H5O_t *ret_value = NULL;    /* Return value */
 
-    FUNC_ENTER_NOAPI_TAG(loc->addr, NULL)
+    FUNC_ENTER_STATIC_TAG(loc->addr)
 
     /* check args */
     HDassert(loc);
@@ -1059,64 +1155,26 @@ H5O_protect(const H5O_loc_t *loc, unsigned prot_flags, hbool_t pin_all_chunks)
     if(NULL == (oh = (H5O_t *)H5AC_protect(loc->file, H5AC_OHDR, loc->addr, &udata, prot_flags)))
         HGOTO_ERROR(H5E_OHDR, H5E_CANTPROTECT, NULL, "unable to load object header")
 
-    /* Check if there are any continuation messages to process */
+    /* Hand any continuation messages found to the object header, which
+     *  loads their chunks below or on demand
+     */
     if(cont_msg_info.nmsgs > 0) {
-        size_t curr_msg;        /* Current continuation message to process */
-        H5O_chk_cache_ud_t chk_udata;   /* User data for loading chunk */
-
         /* Sanity check - we should only have continuation messages to process
          *      when the object header is actually loaded from the file.
          */
         HDassert(udata.made_attempt == TRUE);
         HDassert(cont_msg_info.msgs);
+        HDassert(0 == oh->cont_msgs.nmsgs);
 
-        /* Construct the user data for protecting chunks */
-        chk_udata.decoding = TRUE;
-        chk_udata.oh = oh;
-        chk_udata.chunkno = UINT_MAX;   /* Set to invalid value, for better error detection */
-        chk_udata.common.f = loc->file;
-        chk_udata.common.file_intent = file_intent;
-        chk_udata.common.merged_null_msgs = udata.common.merged_null_msgs;
-        chk_udata.common.cont_msg_info = &cont_msg_info;
-
-        /* Read in continuation messages, until there are no more */
-        /* (Note that loading chunks could increase the # of continuation
-         *      messages if new ones are found - QAK, 19/11/2016)
-         */
-        curr_msg = 0;
-        while(curr_msg < cont_msg_info.nmsgs) {
-            H5O_chunk_proxy_t *chk_proxy;       /* Proxy for chunk, to bring it into memory */
-#ifndef NDEBUG
-            size_t chkcnt = oh->nchunks;      /* Count of chunks (for sanity checking) */
-#endif /* NDEBUG */
-
-            /* Bring the chunk into the cache */
-            /* (which adds to the object header) */
-            chk_udata.common.addr = cont_msg_info.msgs[curr_msg].addr;
-            chk_udata.size = cont_msg_info.msgs[curr_msg].size;
-            if(NULL == (chk_proxy = (H5O_chunk_proxy_t *)H5AC_protect(loc->file, H5AC_OHDR_CHK, cont_msg_info.msgs[curr_msg].addr, &chk_udata, prot_flags)))
-                HGOTO_ERROR(H5E_OHDR, H5E_CANTPROTECT, NULL, "unable to load object header chunk")
-
-            /* Sanity check */
-            HDassert(chk_proxy->oh == oh);
-            HDassert(chk_proxy->chunkno == chkcnt);
-            HDassert(oh->nchunks == (chkcnt + 1));
-
-            /* Release the chunk from the cache */
-            if(H5AC_unprotect(loc->file, H5AC_OHDR_CHK, cont_msg_info.msgs[curr_msg].addr, chk_proxy, H5AC__NO_FLAGS_SET) < 0)
-                HGOTO_ERROR(H5E_OHDR, H5E_CANTUNPROTECT, NULL, "unable to release object header chunk")
-
-            /* Advance to next continuation message */
-            curr_msg++;
-        } /* end while */
-
-        /* Release any continuation messages built up */
-        cont_msg_info.msgs = (H5O_cont_t *)H5FL_SEQ_FREE(H5O_cont_t, cont_msg_info.msgs);
-
-        /* Pass back out some of the chunk's user data */
-        udata.common.merged_null_msgs = chk_udata.common.merged_null_msgs;
+        oh->cont_msgs = cont_msg_info;
+        oh->cont_loaded = 0;
     } /* end if */
 
+    /* Load the chunks that aren't loaded yet, unless they are loaded on demand */
+    if(load_all || pin_all_chunks || oh->swmr_write || !H5O_LAZY_CHUNKS(loc->file))
+        if(H5O__chunk_load_pending(loc->file, oh, prot_flags, NULL, &udata.common.merged_null_msgs) < 0)
+            HGOTO_ERROR(H5E_OHDR, H5E_CANTLOAD, NULL, "unable to load object header chunks")
+
     /* Check for incorrect # of object header messages, if we've just loaded
      *  this object header from the file
      */
@@ -1136,7 +1194,8 @@ H5O_protect(const H5O_loc_t *loc, unsigned prot_flags, hbool_t pin_all_chunks)
     } /* end if */
 
 #ifdef H5O_DEBUG
-H5O__assert(oh);
+    if(0 == oh->cont_msgs.nmsgs)
+        H5O__assert(oh);
 #endif /* H5O_DEBUG */
 
     /* Pin the other chunks also when requested, so that the object header
@@ -1181,7 +1240,7 @@ done:
             HDONE_ERROR(H5E_OHDR, H5E_CANTUNPROTECT, NULL, "unable to release object header")
 
     FUNC_LEAVE_NOAPI_TAG(ret_value)
-} /* end H5O_protect() */
+} /* end H5O__protect_real() */
 
 
 /*-------------------------------------------------------------------------
@@ -1663,9 +1722,11 @@ H5O_obj_type(const H5O_loc_t *loc, H5O_type_t *obj_type)
 
     FUNC_ENTER_NOAPI_TAG(loc->addr, FAIL)
 
-    /* Load the object header */
-    if(NULL == (oh = H5O_protect(loc, H5AC__READ_ONLY_FLAG, FALSE)))
+    /* Load the object header, with the chunks needed to tell its class */
+    if(NULL == (oh = H5O__protect_real(loc, H5AC__READ_ONLY_FLAG, FALSE, FALSE)))
         HGOTO_ERROR(H5E_OHDR, H5E_CANTPROTECT, FAIL, "unable to load object header")
+    if(H5O__obj_class_load(loc, oh) < 0)
+        HGOTO_ERROR(H5E_OHDR, H5E_CANTLOAD, FAIL, "unable to load object header chunks")
 
     /* Retrieve the type of the object */
     if(H5O__obj_type_real(oh, obj_type) < 0)
@@ -1741,9 +1802,11 @@ H5O__obj_class(const H5O_loc_t *loc)
 
     FUNC_ENTER_PACKAGE_TAG(loc->addr)
 
-    /* Load the object header */
-    if(NULL == (oh = H5O_protect(loc, H5AC__READ_ONLY_FLAG, FALSE)))
+    /* Load the object header, with the chunks needed to tell its class */
+    if(NULL == (oh = H5O__protect_real(loc, H5AC__READ_ONLY_FLAG, FALSE, FALSE)))
         HGOTO_ERROR(H5E_OHDR, H5E_CANTPROTECT, NULL, "unable to load object header")
+    if(H5O__obj_class_load(loc, oh) < 0)
+        HGOTO_ERROR(H5E_OHDR, H5E_CANTLOAD, NULL, "unable to load object header chunks")
 
     /* Test whether entry qualifies as a particular type of object */
     if(NULL == (ret_value = H5O__obj_class_real(oh)))
@@ -1799,6 +1862,71 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5O__obj_class_real() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	H5O__obj_class_load
+ *
+ * Purpose:	Make sure enough chunks of the object header `oh' are loaded
+ *              to determine its class.
+ *
+ *              The group and dataset tests only match when messages they
+ *              look for are present, so a match on the chunks loaded so
+ *              far stands.  Otherwise, chunks are loaded until the
+ *              datatype and dataspace messages of a dataset would be
+ *              loaded, and the tests are tried again.  Anything else
+ *              (including a match as a named datatype, which could be a
+ *              dataset whose dataspace message is in a chunk not loaded
+ *              yet) needs the whole header.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5O__obj_class_load(const H5O_loc_t *loc, H5O_t *oh)
+{
+    unsigned	pass;                   /* Pass over the header */
+    size_t	i;                      /* Local index variable */
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity check */
+    HDassert(loc);
+    HDassert(oh);
+
+    /* Check for chunks that aren't loaded */
+    for(pass = 0; pass < 2 && oh->cont_loaded < oh->cont_msgs.nmsgs; pass++) {
+        /* Load the chunks with the messages that make a dataset, the second time */
+        if(pass > 0) {
+            if(H5O__chunk_load_pending(loc->file, oh, H5AC__READ_ONLY_FLAG, H5O_MSG_DTYPE, NULL) < 0)
+                HGOTO_ERROR(H5E_OHDR, H5E_CANTLOAD, FAIL, "unable to load object header chunks")
+            if(H5O__chunk_load_pending(loc->file, oh, H5AC__READ_ONLY_FLAG, H5O_MSG_SDSPACE, NULL) < 0)
+                HGOTO_ERROR(H5E_OHDR, H5E_CANTLOAD, FAIL, "unable to load object header chunks")
+        } /* end if */
+
+        /* (Note: loop is in reverse order, to test specific objects first) */
+        for(i = NELMTS(H5O_obj_class_g); i > 0; --i) {
+            htri_t	isa;            /* Is entry a particular type? */
+
+            if(H5O_TYPE_NAMED_DATATYPE == H5O_obj_class_g[i - 1]->type)
+                break;
+            if((isa = (H5O_obj_class_g[i - 1]->isa)(oh)) < 0)
+                HGOTO_ERROR(H5E_OHDR, H5E_CANTINIT, FAIL, "unable to determine object type")
+            else if(isa)
+                HGOTO_DONE(SUCCEED)
+        } /* end for */
+    } /* end for */
+
+    /* Load the rest of the object header, when its class isn't known yet */
+    if(oh->cont_loaded < oh->cont_msgs.nmsgs)
+        if(H5O__chunk_load_pending(loc->file, oh, H5AC__READ_ONLY_FLAG, NULL, NULL) < 0)
+            HGOTO_ERROR(H5E_OHDR, H5E_CANTLOAD, FAIL, "unable to load object header chunks")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5O__obj_class_load() */
+
 
 /*-------------------------------------------------------------------------
  * Function:	H5O_get_loc
@@ -3036,6 +3164,10 @@ H5O__free(H5O_t *oh)
         oh->chunk = (H5O_chunk_t *)H5FL_SEQ_FREE(H5O_chunk_t, oh->chunk);
     } /* end if */
 
+    /* Release continuation messages for chunks that were never loaded */
+    if(oh->cont_msgs.msgs)
+        oh->cont_msgs.msgs = (H5O_cont_t *)H5FL_SEQ_FREE(H5O_cont_t, oh->cont_msgs.msgs);
+
     /* Destroy messages */
     if(oh->mesg) {
         for(u = 0; u < oh->nmesgs; u++) {
@@ -472,8 +472,8 @@ H5O_msg_read(const H5O_loc_t *loc, unsigned type_id, void *mesg)
     HDassert(H5F_addr_defined(loc->addr));
     HDassert(type_id < NELMTS(H5O_msg_class_g));
 
-    /* Get the object header */
-    if(NULL == (oh = H5O_protect(loc, H5AC__READ_ONLY_FLAG, FALSE)))
+    /* Get the object header, with the chunks up to the message loaded */
+    if(NULL == (oh = H5O__protect_msg(loc, type_id)))
         HGOTO_ERROR(H5E_OHDR, H5E_CANTPROTECT, NULL, "unable to protect object header")
 
     /* Call the "real" read routine */
@@ -878,8 +878,8 @@ H5O_msg_exists(const H5O_loc_t *loc, unsigned type_id)
     HDassert(loc->file);
     HDassert(type_id < NELMTS(H5O_msg_class_g));
 
-    /* Load the object header */
-    if(NULL == (oh = H5O_protect(loc, H5AC__READ_ONLY_FLAG, FALSE)))
+    /* Load the object header, with the chunks up to the message loaded */
+    if(NULL == (oh = H5O__protect_msg(loc, type_id)))
 	HGOTO_ERROR(H5E_OHDR, H5E_CANTPROTECT, FAIL, "unable to protect object header")
 
     /* Call the "real" exists routine */
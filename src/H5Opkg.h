@@ -268,6 +268,13 @@ typedef struct H5O_msg_alloc_info_t {
     unsigned null_msgno;            /* Message index of null message immediately after message */
 } H5O_msg_alloc_info_t;
 
+/* Stack of continuation messages to interpret */
+typedef struct H5O_cont_msgs_t {
+    size_t      nmsgs;                  /* Number of continuation messages found so far */
+    size_t	alloc_nmsgs;		/* Continuation messages allocated */
+    H5O_cont_t *msgs;			/* Array of continuation messages */
+} H5O_cont_msgs_t;
+
 typedef struct H5O_chunk_t {
     haddr_t	addr;			/*chunk file address		     */
     size_t	size;			/*chunk size			     */
@@ -327,6 +334,9 @@ struct H5O_t {
     size_t	alloc_nchunks;		/*chunks allocated		     */
     H5O_chunk_t *chunk;			/*array of chunks		     */
     hbool_t     chunks_pinned;          /* Whether chunks are pinned from ohdr protect */
+    H5O_cont_msgs_t cont_msgs;          /* Continuation messages for chunks that may not be loaded yet */
+    size_t      cont_loaded;            /* # of continuation messages whose chunk is loaded */
+    hbool_t     cont_load_failed;       /* Whether loading a chunk on demand failed */
 
     /* Object header proxy information (not stored) */
     H5AC_proxy_entry_t *proxy;          /* Proxy cache entry for all ohdr entries */
@@ -356,13 +366,6 @@ typedef struct H5O_addr_map_t {
     void        *udata;                 /* Object class copy file udata */
 } H5O_addr_map_t;
 
-/* Stack of continuation messages to interpret */
-typedef struct H5O_cont_msgs_t {
-    size_t      nmsgs;                  /* Number of continuation messages found so far */
-    size_t	alloc_nmsgs;		/* Continuation messages allocated */
-    H5O_cont_t *msgs;			/* Array of continuation messages */
-} H5O_cont_msgs_t;
-
 /* Common callback information for loading object header prefix from disk */
 typedef struct H5O_common_cache_ud_t {
     H5F_t *f;                           /* Pointer to file for object header/chunk */
@@ -555,6 +558,7 @@ H5_DLLVAR const H5O_obj_class_t H5O_OBJ_DATATYPE[1];
 
 /* Package-local function prototypes */
 H5_DLL const H5O_obj_class_t *H5O__obj_class(const H5O_loc_t *loc);
+H5_DLL H5O_t *H5O__protect_msg(const H5O_loc_t *loc, unsigned type_id);
 H5_DLL int H5O__link_oh(H5F_t *f, int adjust, H5O_t *oh, hbool_t *deleted);
 H5_DLL herr_t H5O__get_info_by_idx(const H5G_loc_t *loc, const char *group_name,
     H5_index_t idx_type, H5_iter_order_t order, hsize_t n, H5O_info_t *oinfo, unsigned fields);
@@ -585,6 +589,8 @@ H5_DLL herr_t H5O__delete_mesg(H5F_t *f, H5O_t *open_oh, H5O_mesg_t *mesg);
 
 /* Object header chunk routines */
 H5_DLL herr_t H5O__chunk_add(H5F_t *f, H5O_t *oh, unsigned idx, unsigned cont_chunkno);
+H5_DLL herr_t H5O__chunk_load_pending(H5F_t *f, H5O_t *oh, unsigned prot_flags,
+    const H5O_msg_class_t *type, unsigned *merged_null_msgs);
 H5_DLL H5O_chunk_proxy_t *H5O__chunk_protect(H5F_t *f, H5O_t *oh, unsigned idx);
 H5_DLL herr_t H5O__chunk_unprotect(H5F_t *f, H5O_chunk_proxy_t *chk_proxy, hbool_t chk_dirtied);
 H5_DLL herr_t H5O__chunk_update_idx(H5F_t *f, H5O_t *oh, unsigned idx);
@@ -650,6 +656,8 @@ H5_DLL herr_t H5O__expunge_chunks_test(const H5O_loc_t *oloc);
 H5_DLL herr_t H5O__get_rc_test(const H5O_loc_t *oloc, unsigned *rc);
 H5_DLL herr_t H5O__msg_get_chunkno_test(hid_t oid, unsigned msg_type, unsigned *chunk_num);
 H5_DLL herr_t H5O__msg_move_to_new_chunk_test(hid_t oid, unsigned msg_type);
+H5_DLL herr_t H5O__msg_chunks_loaded_test(hid_t oid, unsigned msg_type,
+    size_t *nloaded, size_t *nunloaded);
 #endif /* H5O_TESTING */
 
 /* Object header debugging routines */
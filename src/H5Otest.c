@@ -791,3 +791,64 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 }   /* H5O__msg_get_chunkno_test() */
 
+
+
+/*--------------------------------------------------------------------------
+ NAME
+    H5O__msg_chunks_loaded_test
+ PURPOSE
+    Retrieve the number of object header chunks loaded for reading a message
+ USAGE
+    herr_t H5O__msg_chunks_loaded_test(oid, msg_type, nloaded, nunloaded)
+        hid_t oid;              IN: Object to check
+        unsigned msg_type;      IN: Object header message type to read
+        size_t *nloaded;        OUT: Number of chunks loaded
+        size_t *nunloaded;      OUT: Number of chunks known but not loaded
+ RETURNS
+    Non-negative on success, negative on failure
+ DESCRIPTION
+    Protects the object header for reading a message of the given type
+    and retrieves the number of its chunks that are loaded, and the number
+    that are not loaded yet (of the chunks found so far).
+ GLOBAL VARIABLES
+ COMMENTS, BUGS, ASSUMPTIONS
+    DO NOT USE THIS FUNCTION FOR ANYTHING EXCEPT TESTING
+ EXAMPLES
+ REVISION LOG
+--------------------------------------------------------------------------*/
+herr_t
+H5O__msg_chunks_loaded_test(hid_t oid, unsigned msg_type, size_t *nloaded,
+    size_t *nunloaded)
+{
+    H5O_t *oh = NULL;           /* Object header */
+    H5O_loc_t *loc;             /* Pointer to object's location */
+    hbool_t     api_ctx_pushed = FALSE;             /* Whether API context pushed */
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Get object location for object */
+    if(NULL == (loc = H5O_get_loc(oid)))
+        HGOTO_ERROR(H5E_SYM, H5E_NOTFOUND, FAIL, "object not found")
+
+    /* Set API context */
+    if(H5CX_push() < 0)
+        HGOTO_ERROR(H5E_OHDR, H5E_CANTSET, FAIL, "can't set API context")
+    api_ctx_pushed = TRUE;
+
+    /* Get the object header, for reading the message */
+    if(NULL == (oh = H5O__protect_msg(loc, msg_type)))
+        HGOTO_ERROR(H5E_OHDR, H5E_CANTPROTECT, FAIL, "unable to load object header")
+
+    /* Retrieve the chunk counts */
+    *nloaded = oh->nchunks;
+    *nunloaded = oh->cont_msgs.nmsgs - oh->cont_loaded;
+
+done:
+    if(oh && H5O_unprotect(loc, oh, H5AC__NO_FLAGS_SET) < 0)
+        HDONE_ERROR(H5E_OHDR, H5E_CANTUNPROTECT, FAIL, "unable to release object header")
+    if(api_ctx_pushed && H5CX_pop() < 0)
+        HDONE_ERROR(H5E_OHDR, H5E_CANTRESET, FAIL, "can't reset API context")
+
+    FUNC_LEAVE_NOAPI(ret_value)
+}   /* H5O__msg_chunks_loaded_test() */
@@ -688,7 +688,6 @@ H5PB_read(H5F_t *f, H5FD_mem_t type, haddr_t addr, size_t size, void *buf/*out*/
 {
     H5PB_t *page_buf;                   /* Page buffering info for this file */
     H5PB_entry_t *page_entry;           /* Pointer to the corresponding page entry */
-    H5FD_t *file;                       /* File driver pointer */
     haddr_t first_page_addr, last_page_addr;    /* Addresses of the first and last pages covered by I/O */
     haddr_t offset;
     haddr_t search_addr;                /* Address of current page */
@@ -779,9 +778,6 @@ H5PB_read(H5F_t *f, H5FD_mem_t type, haddr_t addr, size_t size, void *buf/*out*/
         last_page_addr = HADDR_UNDEF;
     } /* end else */
 
-    /* Translate to file driver I/O info object */
-    file = f->shared->lf;
-
     /* Copy raw data from dirty pages into the read buffer if the read
        request spans pages in the page buffer*/
     if(H5FD_MEM_DRAW == type && size >= page_buf->page_size) {
@@ -905,7 +901,7 @@ H5PB_read(H5F_t *f, H5FD_mem_t type, haddr_t addr, size_t size, void *buf/*out*/
                         HDassert(0 == i);
 
                         /* read entire block from VFD and return */
-                        if(H5FD_read(file, type, addr, size, buf) < 0)
+                        if(H5F__fd_read(f->shared, type, addr, size, buf) < 0)
                             HGOTO_ERROR(H5E_PAGEBUF, H5E_READERROR, FAIL, "driver read request failed")
 
                         /* Break out of loop */
@@ -932,7 +928,7 @@ H5PB_read(H5F_t *f, H5FD_mem_t type, haddr_t addr, size_t size, void *buf/*out*/
                     page_size = (size_t)(eoa - search_addr);
 
                 /* Read page from VFD */
-                if(H5FD_read(file, type, search_addr, page_size, new_page_buf) < 0)
+                if(H5F__fd_read(f->shared, type, search_addr, page_size, new_page_buf) < 0)
                     HGOTO_ERROR(H5E_PAGEBUF, H5E_READERROR, FAIL, "driver read request failed")
 
                 /* Copy the requested data from the page into the input buffer */
@@ -986,7 +982,6 @@ H5PB_write(H5F_t *f, H5FD_mem_t type, haddr_t addr,
 {
     H5PB_t *page_buf;                   /* Page buffering info for this file */
     H5PB_entry_t *page_entry;           /* Pointer to the corresponding page entry */
-    H5FD_t *file;                       /* File driver pointer */
     haddr_t first_page_addr, last_page_addr;    /* Addresses of the first and last pages covered by I/O */
     haddr_t offset;
     haddr_t search_addr;                /* Address of current page */
@@ -1083,9 +1078,6 @@ H5PB_write(H5F_t *f, H5FD_mem_t type, haddr_t addr,
         last_page_addr = HADDR_UNDEF;
     } /* end else */
 
-    /* Translate to file driver I/O info object */
-    file = f->shared->lf;
-
     /* Check if existing pages for raw data need to be updated since raw data access is not atomic */
     if(H5FD_MEM_DRAW == type && size >= page_buf->page_size) {
         /* For each touched page, check if it exists in the page buffer, and
@@ -1206,7 +1198,7 @@ H5PB_write(H5F_t *f, H5FD_mem_t type, haddr_t addr,
                         HDassert(0 == i);
 
                         /* Write to VFD and return */
-                        if(H5FD_write(file, type, addr, size, buf) < 0)
+                        if(H5F__fd_write(f->shared, type, addr, size, buf) < 0)
                             HGOTO_ERROR(H5E_PAGEBUF, H5E_WRITEERROR, FAIL, "driver write request failed")
                         
                         /* Break out of loop */
@@ -1278,7 +1270,7 @@ H5PB_write(H5F_t *f, H5FD_mem_t type, haddr_t addr,
                         page_size = (size_t)(eoa - search_addr);
 
                     if(search_addr < eof) {
-                        if(H5FD_read(file, type, search_addr, page_size, new_page_buf) < 0)
+                        if(H5F__fd_read(f->shared, type, search_addr, page_size, new_page_buf) < 0)
                             HGOTO_ERROR(H5E_PAGEBUF, H5E_READERROR, FAIL, "driver read request failed")
 
                         /* Update statistics */
@@ -1497,17 +1489,13 @@ H5PB__write_entry(H5F_t *f, H5PB_entry_t *page_entry)
      * the EOA, then the entire page is discarded without writing.
      */
     if(page_entry->addr <= eoa) {
-        H5FD_t *file;                   /* File driver I/O info */
         size_t page_size = f->shared->page_buf->page_size;
 
         /* Adjust the page length if it exceeds the EOA */
         if((page_entry->addr + page_size) > eoa)
             page_size = (size_t)(eoa - page_entry->addr);
 
-        /* Translate to file driver I/O info object */
-        file = f->shared->lf;
-
-        if(H5FD_write(file, (H5FD_mem_t)page_entry->type, page_entry->addr, page_size, page_entry->page_buf_ptr) < 0)
+        if(H5F__fd_write(f->shared, (H5FD_mem_t)page_entry->type, page_entry->addr, page_size, page_entry->page_buf_ptr) < 0)
             HGOTO_ERROR(H5E_PAGEBUF, H5E_WRITEERROR, FAIL, "file write failed")
     } /* end if */
 
@@ -126,9 +126,13 @@ H5PL__set_plugin_control_mask(unsigned int mask)
      *      silently ignore it. We may want to consider this behavior
      *      more carefully.
      */
-    if (H5PL_allow_plugins_g)
+    if (H5PL_allow_plugins_g) {
         H5PL_plugin_control_mask_g = mask;
 
+        /* Search for the plugins that weren't found again */
+        H5PL__clear_missing();
+    }
+
     FUNC_LEAVE_NOAPI(ret_value)
 
 } /* end H5PL__set_plugin_control_mask() */
@@ -268,11 +272,19 @@ H5PL_load(H5PL_type_t type, const H5PL_key_t *key)
     if(H5PL__find_plugin_in_cache(&search_params, &found, &plugin_info) < 0)
         HGOTO_ERROR(H5E_PLUGIN, H5E_CANTGET, NULL, "search in plugin cache  failed")
 
-    /* If not found, try iterating through the path table to find an appropriate plugin */
-    if (!found)
+    /* If not found, try iterating through the path table to find an appropriate
+     * plugin, unless an earlier search didn't find it
+     */
+    if (!found && !H5PL__is_missing(&search_params)) {
         if (H5PL__find_plugin_in_path_table(&search_params, &found, &plugin_info) < 0)
             HGOTO_ERROR(H5E_PLUGIN, H5E_CANTGET, NULL, "search in path table failed")
 
+        /* Don't search the paths again for a plugin that isn't there */
+        if (!found)
+            if (H5PL__add_missing(&search_params) < 0)
+                HGOTO_ERROR(H5E_PLUGIN, H5E_CANTINSERT, NULL, "can't remember missing plugin")
+    }
+
     /* Set the return value we found the plugin */
     if (found)
         ret_value = plugin_info;
@@ -66,12 +66,16 @@ static herr_t H5PL__insert_at(const char *path, unsigned int index);
 static herr_t H5PL__make_space_at(unsigned int index);
 static herr_t H5PL__replace_at(const char *path, unsigned int index);
 static herr_t H5PL__expand_path_table(void);
+static herr_t H5PL__find_plugin_in_index(const H5PL_search_params_t *search_params, hbool_t *found, const char *dir, const void **plugin_info, hbool_t *indexed);
 static herr_t H5PL__find_plugin_in_path(const H5PL_search_params_t *search_params, hbool_t *found, const char *dir, const void **plugin_info);
 
 /*********************/
 /* Package Variables */
 /*********************/
 
+/* The number of plugin directories searched, for testing */
+unsigned            H5PL_num_dir_searches_g = 0;
+
 
 /*****************************/
 /* Library Private Variables */
@@ -140,6 +144,9 @@ H5PL__insert_at(const char *path, unsigned int index)
     H5PL_paths_g[index] = path_copy;
     H5PL_num_paths_g++;
 
+    /* Plugins that weren't found may be in the new path */
+    H5PL__clear_missing();
+
 done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5PL__insert_at() */
@@ -219,6 +226,9 @@ H5PL__replace_at(const char *path, unsigned int index)
     /* Copy the search path into the table at the specified index */
     H5PL_paths_g[index] = path_copy;
 
+    /* Plugins that weren't found may be in the new path */
+    H5PL__clear_missing();
+
 done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5PL__replace_at() */
@@ -535,6 +545,11 @@ H5PL__remove_path(unsigned int index)
     /* Set the (former) last path to NULL */
     H5PL_paths_g[H5PL_num_paths_g] = NULL;
 
+    /* Keep the missing plugins in step with the paths they were looked
+     * for in
+     */
+    H5PL__clear_missing();
+
 done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5PL__remove_path() */
@@ -598,10 +613,18 @@ H5PL__find_plugin_in_path_table(const H5PL_search_params_t *search_params, hbool
 
     /* Loop over the paths in the table, checking for an appropriate plugin */
     for (u = 0; u < H5PL_num_paths_g; u++) {
+        hbool_t indexed = FALSE;        /* Whether the path has a plugin index */
+
+        /* Look the plugin up in the path's index, if it has one */
+        if (H5PL__find_plugin_in_index(search_params, found, H5PL_paths_g[u], plugin_info, &indexed) < 0)
+            HGOTO_ERROR(H5E_PLUGIN, H5E_CANTGET, FAIL, "search in index for path %s encountered an error", H5PL_paths_g[u])
 
-        /* Search for the plugin in this path */
-        if (H5PL__find_plugin_in_path(search_params, found, H5PL_paths_g[u], plugin_info) < 0)
-            HGOTO_ERROR(H5E_PLUGIN, H5E_CANTGET, FAIL, "search in path %s encountered an error", H5PL_paths_g[u])
+        /* Otherwise, search for the plugin in this path */
+        if (!indexed) {
+            H5PL_num_dir_searches_g++;
+            if (H5PL__find_plugin_in_path(search_params, found, H5PL_paths_g[u], plugin_info) < 0)
+                HGOTO_ERROR(H5E_PLUGIN, H5E_CANTGET, FAIL, "search in path %s encountered an error", H5PL_paths_g[u])
+        }
 
         /* Break out if found */
         if (*found) {
@@ -616,6 +639,142 @@ done:
 } /* end H5PL__find_plugin_in_path_table() */
 
 
+/*-------------------------------------------------------------------------
+ * Function:    H5PL__find_plugin_in_index
+ *
+ * Purpose:     Looks a filter plugin up in the index of a plugin
+ *              directory, if the directory has one.  The index is a text
+ *              file named H5PL_INDEX_FILE_NAME, with a line for each
+ *              filter plugin in the directory giving the filter ID and
+ *              the plugin library's file name (relative to the directory,
+ *              or absolute).  Blank lines and lines starting with '#' are
+ *              ignored.
+ *
+ *              When the directory has an index, only the libraries it
+ *              lists for the filter are opened, and the 'indexed'
+ *              parameter is set to TRUE.  Otherwise the directory must be
+ *              searched.  VOL connector plugins are always searched for.
+ *
+ *              An index with a line that can't be parsed, or that is
+ *              longer than H5PL_INDEX_LINE_SIZE, isn't trusted: 'indexed'
+ *              is set to FALSE so the directory is searched instead.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5PL__find_plugin_in_index(const H5PL_search_params_t *search_params, hbool_t *found, const char *dir, const void **plugin_info, hbool_t *indexed)
+{
+    char           *index_path = NULL;
+    char           *path = NULL;
+    char           *line = NULL;
+    FILE           *index_file = NULL;
+    size_t          len;
+    herr_t          ret_value = SUCCEED;
+
+    FUNC_ENTER_STATIC
+
+    /* Check args - Just assert on package functions */
+    HDassert(search_params);
+    HDassert(found);
+    HDassert(dir);
+    HDassert(plugin_info);
+    HDassert(indexed);
+
+    /* Initialize the output parameters */
+    *found = FALSE;
+    *indexed = FALSE;
+
+    /* Only filter plugins are indexed */
+    if (H5PL_TYPE_FILTER != search_params->type)
+        HGOTO_DONE(SUCCEED)
+
+    /* Open the directory's index, if it has one */
+    len = HDstrlen(dir) + HDstrlen(H5_DIR_SEPS) + HDstrlen(H5PL_INDEX_FILE_NAME) + 1;
+    if (NULL == (index_path = (char *)H5MM_malloc(len)))
+        HGOTO_ERROR(H5E_PLUGIN, H5E_CANTALLOC, FAIL, "can't allocate memory for path")
+    HDsnprintf(index_path, len, "%s%s%s", dir, H5_DIR_SEPS, H5PL_INDEX_FILE_NAME);
+    if (NULL == (index_file = HDfopen(index_path, "r")))
+        HGOTO_DONE(SUCCEED)
+    *indexed = TRUE;
+
+    if (NULL == (line = (char *)H5MM_malloc(H5PL_INDEX_LINE_SIZE)))
+        HGOTO_ERROR(H5E_PLUGIN, H5E_CANTALLOC, FAIL, "can't allocate memory for index line")
+
+    /* Check each of the libraries listed for the filter */
+    while (NULL != HDfgets(line, H5PL_INDEX_LINE_SIZE, index_file)) {
+        char   *name;
+        char   *end;
+        long    id;
+
+        /* A line too long for the buffer was split, so fall back to
+         * searching the directory
+         */
+        len = HDstrlen(line);
+        if (len > 0 && '\n' != line[len - 1] && !HDfeof(index_file)) {
+            *indexed = FALSE;
+            break;
+        }
+
+        /* Skip blank lines and comments */
+        name = line;
+        while (HDisspace(*name))
+            name++;
+        if ('\0' == *name || '#' == *name)
+            continue;
+
+        /* Get the filter ID */
+        id = HDstrtol(name, &end, 10);
+        if (end == name || !HDisspace(*end)) {
+            *indexed = FALSE;
+            break;
+        }
+        if (id != (long)search_params->key->id)
+            continue;
+
+        /* Get the library name, without surrounding white space */
+        name = end;
+        while (HDisspace(*name))
+            name++;
+        end = name + HDstrlen(name);
+        while (end > name && HDisspace(*(end - 1)))
+            end--;
+        *end = '\0';
+        if ('\0' == *name) {
+            *indexed = FALSE;
+            break;
+        }
+
+        /* Attempt to open the library */
+        path = (char *)H5MM_xfree(path);
+        if (H5_CHECK_ABSOLUTE(name)) {
+            if (NULL == (path = H5MM_strdup(name)))
+                HGOTO_ERROR(H5E_PLUGIN, H5E_CANTALLOC, FAIL, "can't allocate memory for path")
+        }
+        else {
+            len = HDstrlen(dir) + HDstrlen(H5_DIR_SEPS) + HDstrlen(name) + 1;
+            if (NULL == (path = (char *)H5MM_malloc(len)))
+                HGOTO_ERROR(H5E_PLUGIN, H5E_CANTALLOC, FAIL, "can't allocate memory for path")
+            HDsnprintf(path, len, "%s%s%s", dir, H5_DIR_SEPS, name);
+        }
+        if (H5PL__open(path, search_params->type, search_params->key, found, plugin_info) < 0)
+            HGOTO_ERROR(H5E_PLUGIN, H5E_CANTGET, FAIL, "can't open plugin %s listed in index", path)
+        if (*found)
+            break;
+    } /* end while */
+
+done:
+    if (index_file)
+        HDfclose(index_file);
+    index_path = (char *)H5MM_xfree(index_path);
+    path = (char *)H5MM_xfree(path);
+    line = (char *)H5MM_xfree(line);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5PL__find_plugin_in_index() */
+
+
 /*-------------------------------------------------------------------------
  * Function:    H5PL__find_plugin_in_path
  *
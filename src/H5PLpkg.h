@@ -36,6 +36,12 @@
 /* Whether to pre-load pathnames for plugin libraries */
 #define H5PL_DEFAULT_PATH       H5_DEFAULT_PLUGINDIR
 
+/* Name of the optional index of the filter plugins in a plugin directory */
+#define H5PL_INDEX_FILE_NAME    "hdf5_plugin_index"
+
+/* Size of the buffer for a line of a plugin index */
+#define H5PL_INDEX_LINE_SIZE    4096
+
 
 /****************************/
 /* Macros for supporting    */
@@ -126,6 +132,9 @@ typedef struct H5PL_search_params_t {
 /* Package Private Variables */
 /*****************************/
 
+/* The number of plugin directories searched */
+extern unsigned H5PL_num_dir_searches_g;
+
 
 /******************************/
 /* Package Private Prototypes */
@@ -146,6 +155,9 @@ H5_DLL herr_t H5PL__close_plugin_cache(hbool_t *already_closed /*out*/);
 H5_DLL herr_t H5PL__add_plugin(H5PL_type_t type, const H5PL_key_t *key,
     H5PL_HANDLE handle);
 H5_DLL herr_t H5PL__find_plugin_in_cache(const H5PL_search_params_t *search_params, hbool_t *found /*out*/, const void **plugin_info /*out*/);
+H5_DLL herr_t H5PL__add_missing(const H5PL_search_params_t *search_params);
+H5_DLL hbool_t H5PL__is_missing(const H5PL_search_params_t *search_params);
+H5_DLL herr_t H5PL__clear_missing(void);
 
 /* Plugin search path calls */
 H5_DLL herr_t H5PL__create_path_table(void);
@@ -159,5 +171,10 @@ H5_DLL herr_t H5PL__remove_path(unsigned int index);
 H5_DLL const char *H5PL__get_path(unsigned int index);
 H5_DLL herr_t H5PL__find_plugin_in_path_table(const H5PL_search_params_t *search_params, hbool_t *found /*out*/, const void **plugin_info /*out*/);
 
+/* Testing functions */
+#ifdef H5PL_TESTING
+H5_DLL unsigned H5PL__get_num_dir_searches_test(void);
+#endif /* H5PL_TESTING */
+
 #endif /* _H5PLpkg_H */
 
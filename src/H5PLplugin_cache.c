@@ -49,6 +49,9 @@
 /* The amount to add to the capacity when the cache is full */
 #define H5PL_CACHE_CAPACITY_ADD         16
 
+/* The amount to add to the capacity of the list of missing filters */
+#define H5PL_MISSING_CAPACITY_ADD       16
+
 
 /******************/
 /* Local Typedefs */
@@ -92,6 +95,19 @@ static unsigned int     H5PL_num_plugins_g = 0;
 /* The capacity of the plugin cache */
 static unsigned int     H5PL_cache_capacity_g = 0;
 
+/* IDs of filters that weren't found in the plugin paths, so the paths
+ * aren't searched again for them.  Cleared whenever a path is added,
+ * inserted, replaced or removed, and whenever the plugin control mask
+ * is set.
+ */
+static int             *H5PL_missing_g = NULL;
+
+/* The number of missing filters */
+static unsigned int     H5PL_num_missing_g = 0;
+
+/* The capacity of the list of missing filters */
+static unsigned int     H5PL_missing_capacity_g = 0;
+
 
 
 /*-------------------------------------------------------------------------
@@ -167,6 +183,11 @@ H5PL__close_plugin_cache(hbool_t *already_closed /*out*/)
     else
         *already_closed = TRUE;
 
+    /* Forget the missing filters */
+    H5PL_missing_g = (int *)H5MM_xfree(H5PL_missing_g);
+    H5PL_num_missing_g = 0;
+    H5PL_missing_capacity_g = 0;
+
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5PL__close_plugin_cache() */
 
@@ -305,3 +326,92 @@ done:
 } /* end H5PL__find_plugin_in_cache() */
 #pragma GCC diagnostic pop
 
+
+/*-------------------------------------------------------------------------
+ * Function:    H5PL__add_missing
+ *
+ * Purpose:     Remember that a plugin wasn't found in the plugin paths.
+ *              Only filter plugins are remembered.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5PL__add_missing(const H5PL_search_params_t *search_params)
+{
+    herr_t      ret_value = SUCCEED;
+
+    FUNC_ENTER_PACKAGE
+
+    /* Check args - Just assert on package functions */
+    HDassert(search_params);
+
+    if (H5PL_TYPE_FILTER == search_params->type) {
+        /* Expand the list if it is full */
+        if (H5PL_num_missing_g >= H5PL_missing_capacity_g) {
+            int *new_missing;
+
+            if (NULL == (new_missing = (int *)H5MM_realloc(H5PL_missing_g, (size_t)(H5PL_missing_capacity_g + H5PL_MISSING_CAPACITY_ADD) * sizeof(int))))
+                HGOTO_ERROR(H5E_PLUGIN, H5E_CANTALLOC, FAIL, "can't expand list of missing plugins")
+            H5PL_missing_g = new_missing;
+            H5PL_missing_capacity_g += H5PL_MISSING_CAPACITY_ADD;
+        }
+
+        H5PL_missing_g[H5PL_num_missing_g++] = search_params->key->id;
+    }
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5PL__add_missing() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5PL__is_missing
+ *
+ * Purpose:     Check if a plugin is known not to be in the plugin paths.
+ *
+ * Return:      TRUE/FALSE (can't fail)
+ *
+ *-------------------------------------------------------------------------
+ */
+hbool_t
+H5PL__is_missing(const H5PL_search_params_t *search_params)
+{
+    unsigned int    u;                          /* iterator */
+    hbool_t         ret_value = FALSE;
+
+    FUNC_ENTER_PACKAGE_NOERR
+
+    /* Check args - Just assert on package functions */
+    HDassert(search_params);
+
+    if (H5PL_TYPE_FILTER == search_params->type)
+        for (u = 0; u < H5PL_num_missing_g; u++)
+            if (search_params->key->id == H5PL_missing_g[u])
+                HGOTO_DONE(TRUE)
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5PL__is_missing() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5PL__clear_missing
+ *
+ * Purpose:     Forget which plugins weren't found, so the plugin paths
+ *              are searched for them again.
+ *
+ * Return:      SUCCEED (can't fail)
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5PL__clear_missing(void)
+{
+    FUNC_ENTER_PACKAGE_NOERR
+
+    H5PL_num_missing_g = 0;
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5PL__clear_missing() */
@@ -83,6 +83,9 @@
 /* Definitions for vlen free info property */
 #define H5D_XFER_VLEN_FREE_INFO_SIZE    sizeof(void *)
 #define H5D_XFER_VLEN_FREE_INFO_DEF     H5D_VLEN_FREE_INFO
+/* Definitions for vlen arena property */
+#define H5D_XFER_VLEN_ARENA_SIZE        sizeof(H5T_vlen_arena_t)
+#define H5D_XFER_VLEN_ARENA_DEF         {NULL, 0, 0}
 /* Definitions for hyperslab vector size property */
 /* (Be cautious about increasing the default size, there are arrays allocated
  *      on the stack which depend on it - QAK)
@@ -237,6 +240,7 @@ static const H5MM_allocate_t H5D_def_vlen_alloc_g = H5D_XFER_VLEN_ALLOC_DEF;   /
 static const void *H5D_def_vlen_alloc_info_g = H5D_XFER_VLEN_ALLOC_INFO_DEF;   /* Default value for vlen allocation information */
 static const H5MM_free_t H5D_def_vlen_free_g = H5D_XFER_VLEN_FREE_DEF;         /* Default value for vlen free function */
 static const void *H5D_def_vlen_free_info_g = H5D_XFER_VLEN_FREE_INFO_DEF;     /* Default value for vlen free information */
+static const H5T_vlen_arena_t H5D_def_vlen_arena_g = H5D_XFER_VLEN_ARENA_DEF;  /* Default value for vlen arena */
 static const size_t H5D_def_hyp_vec_size_g = H5D_XFER_HYPER_VECTOR_SIZE_DEF;   /* Default value for vector size */
 static const H5FD_mpio_xfer_t H5D_def_io_xfer_mode_g = H5D_XFER_IO_XFER_MODE_DEF;      /* Default value for I/O transfer mode */
 static const H5FD_mpio_chunk_opt_t H5D_def_mpio_chunk_opt_mode_g = H5D_XFER_MPIO_CHUNK_OPT_HARD_DEF;
@@ -324,6 +328,12 @@ H5P__dxfr_reg_prop(H5P_genclass_t *pclass)
             NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL) < 0)
         HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
 
+    /* Register the vlen arena property */
+    /* (Note: this property should not have an encode/decode callback, it's a memory pointer) */
+    if(H5P__register_real(pclass, H5D_XFER_VLEN_ARENA_NAME, H5D_XFER_VLEN_ARENA_SIZE, &H5D_def_vlen_arena_g,
+            NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
+
     /* Register the vector size property */
     if(H5P__register_real(pclass, H5D_XFER_HYPER_VECTOR_SIZE_NAME, H5D_XFER_HYPER_VECTOR_SIZE_SIZE, &H5D_def_hyp_vec_size_g, 
             NULL, NULL, NULL, H5D_XFER_HYPER_VECTOR_SIZE_ENC, H5D_XFER_HYPER_VECTOR_SIZE_DEC,
@@ -1644,6 +1654,96 @@ done:
     FUNC_LEAVE_API(ret_value)
 } /* end H5Pget_vlen_mem_manager() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Pset_vlen_arena
+ *
+ * Purpose:	Sets an application buffer that VL data read with this
+ *		transfer property list is placed in.  Instead of allocating
+ *		each sequence or string separately, the library hands out
+ *		consecutive (suitably aligned) pieces of BUF, so all the VL
+ *		data for one I/O call ends up packed in a single buffer and
+ *		the hvl_t / char * element slots point into it.  Each I/O call
+ *		starts again at the beginning of the buffer.
+ *
+ *		H5Dvlen_get_buf_size() gives a lower bound on the size the
+ *		arena needs; allow some slack for alignment.  If the arena
+ *		fills up, the read fails.  While an arena is set it takes
+ *		precedence over H5Pset_vlen_mem_manager(), and calling
+ *		H5Dvlen_reclaim() with this property list does not free any
+ *		memory, since the application owns the buffer.
+ *
+ *		Call this routine with BUF set to NULL to go back to
+ *		allocating VL data with the VL memory manager.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pset_vlen_arena(hid_t plist_id, void *buf, size_t size)
+{
+    H5P_genplist_t *plist;      /* Property list pointer */
+    H5T_vlen_arena_t arena;     /* Arena information */
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE3("e", "i*xz", plist_id, buf, size);
+
+    /* Check arguments */
+    if(buf && 0 == size)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "arena size must be positive")
+    if(NULL == (plist = H5P_object_verify(plist_id, H5P_DATASET_XFER)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a dataset transfer property list")
+
+    /* Update property list */
+    arena.buf = buf;
+    arena.size = buf ? size : 0;
+    arena.used = 0;
+    if(H5P_set(plist, H5D_XFER_VLEN_ARENA_NAME, &arena) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "unable to set value")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pset_vlen_arena() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Pget_vlen_arena
+ *
+ * Purpose:	The inverse of H5Pset_vlen_arena()
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pget_vlen_arena(hid_t plist_id, void **buf/*out*/, size_t *size/*out*/)
+{
+    H5P_genplist_t *plist;      /* Property list pointer */
+    H5T_vlen_arena_t arena;     /* Arena information */
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE3("e", "ixx", plist_id, buf, size);
+
+    /* Get the plist structure */
+    if(NULL == (plist = H5P_object_verify(plist_id, H5P_DATASET_XFER)))
+        HGOTO_ERROR(H5E_ATOM, H5E_BADATOM, FAIL, "can't find object for ID")
+
+    if(H5P_get(plist, H5D_XFER_VLEN_ARENA_NAME, &arena) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "unable to get value")
+
+    /* Return values */
+    if(buf)
+        *buf = arena.buf;
+    if(size)
+        *size = arena.size;
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pget_vlen_arena() */
+
 
 /*-------------------------------------------------------------------------
  * Function:	H5Pset_hyper_vector_size
@@ -42,6 +42,15 @@
 /* Local Macros */
 /****************/
 
+/* Slot in a property list's lookup cache for a property name.  The library
+ * looks properties up by the same (constant) name strings over and over, so
+ * the string's address is a good enough hash.
+ */
+#define H5P_LOOKUP_SLOT(N)      ((size_t)(((size_t)(N) >> 3) ^ ((size_t)(N) >> 8)) % H5P_LOOKUP_CACHE_SIZE)
+
+/* Forget the properties found by a property list's recent lookups */
+#define H5P_RESET_LOOKUP(PL)    HDmemset((PL)->lookup, 0, sizeof((PL)->lookup))
+
 
 /******************/
 /* Local Typedefs */
@@ -115,6 +124,9 @@ static herr_t H5P__do_prop(H5P_genplist_t *plist, const char *name, H5P_do_plist
     H5P_do_pclass_op_t pclass_op, void *udata);
 static int H5P__open_class_path_cb(void *_obj, hid_t H5_ATTR_UNUSED id, void *_key);
 static H5P_genprop_t *H5P__find_prop_pclass(H5P_genclass_t *pclass, const char *name);
+static H5P_genprop_t *H5P__lookup_cached(const H5P_genplist_t *plist, const char *name);
+static void H5P__lookup_remember(const H5P_genplist_t *plist, const char *name,
+    H5P_genprop_t *prop);
 static herr_t H5P__free_prop_cb(void *item, void H5_ATTR_UNUSED *key, void *op_data);
 static herr_t H5P__free_del_name_cb(void *item, void H5_ATTR_UNUSED *key, void H5_ATTR_UNUSED *op_data);
 
@@ -1249,6 +1261,10 @@ H5P__find_prop_plist(const H5P_genplist_t *plist, const char *name)
     HDassert(plist);
     HDassert(name);
 
+    /* Check the properties found by recent lookups */
+    if(NULL != (ret_value = H5P__lookup_cached(plist, name)))
+        HGOTO_DONE(ret_value)
+
     /* Check if the property has been deleted from list */
     if(H5SL_search(plist->del,name) != NULL) {
         HGOTO_ERROR(H5E_PLIST, H5E_NOTFOUND, NULL, "property deleted from skip list")
@@ -1274,12 +1290,101 @@ H5P__find_prop_plist(const H5P_genplist_t *plist, const char *name)
             if(ret_value == NULL)
                 HGOTO_ERROR(H5E_PLIST,H5E_NOTFOUND,NULL,"can't find property in skip list")
         } /* end else */
+
+        /* Remember the property for the next lookup */
+        H5P__lookup_remember(plist, name, ret_value);
     } /* end else */
 
 done:
     FUNC_LEAVE_NOAPI(ret_value)
 }   /* H5P__find_prop_plist() */
 
+
+/*--------------------------------------------------------------------------
+ NAME
+    H5P__lookup_cached
+ PURPOSE
+    Internal routine to check a property list's recent lookups for a property
+ USAGE
+    H5P_genprop_t *H5P__lookup_cached(plist, name)
+        const H5P_genplist_t *plist; IN: Pointer to the property list to check
+        const char *name;           IN: Name of property to check for
+ RETURNS
+    Returns pointer to the property (in the list or one of its classes) if a
+    recent lookup found it, NULL otherwise.
+ DESCRIPTION
+        Checks the slot for NAME in the property list's lookup cache.  The
+    cache is only used while no property list class has changed since it was
+    filled in, and the property's name must match.
+ GLOBAL VARIABLES
+ COMMENTS, BUGS, ASSUMPTIONS
+ EXAMPLES
+ REVISION LOG
+--------------------------------------------------------------------------*/
+static H5P_genprop_t *
+H5P__lookup_cached(const H5P_genplist_t *plist, const char *name)
+{
+    H5P_genprop_t *ret_value = NULL;    /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    HDassert(plist);
+    HDassert(name);
+
+    if(plist->lookup_rev == H5P_next_rev) {
+        H5P_genprop_t *prop = plist->lookup[H5P_LOOKUP_SLOT(name)];
+
+        if(prop && !HDstrcmp(prop->name, name))
+            ret_value = prop;
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+}   /* H5P__lookup_cached() */
+
+
+/*--------------------------------------------------------------------------
+ NAME
+    H5P__lookup_remember
+ PURPOSE
+    Internal routine to add a property to a property list's recent lookups
+ USAGE
+    void H5P__lookup_remember(plist, name, prop)
+        const H5P_genplist_t *plist; IN: Pointer to the property list
+        const char *name;           IN: Name the property was looked up by
+        H5P_genprop_t *prop;        IN: Property found
+ RETURNS
+    None
+ DESCRIPTION
+        Stores the property in the slot for NAME in the property list's
+    lookup cache, first forgetting the cache's contents if a property list
+    class has changed since they were stored.  The cache isn't part of the
+    list's value, so it's updated even through a const pointer.
+ GLOBAL VARIABLES
+ COMMENTS, BUGS, ASSUMPTIONS
+ EXAMPLES
+ REVISION LOG
+--------------------------------------------------------------------------*/
+static void
+H5P__lookup_remember(const H5P_genplist_t *plist, const char *name,
+    H5P_genprop_t *prop)
+{
+    H5P_genplist_t *cache_plist = (H5P_genplist_t *)plist;   /* (Casting away const OK) */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    HDassert(plist);
+    HDassert(name);
+    HDassert(prop);
+
+    if(cache_plist->lookup_rev != H5P_next_rev) {
+        H5P_RESET_LOOKUP(cache_plist);
+        cache_plist->lookup_rev = H5P_next_rev;
+    } /* end if */
+    cache_plist->lookup[H5P_LOOKUP_SLOT(name)] = prop;
+
+    FUNC_LEAVE_NOAPI_VOID
+}   /* H5P__lookup_remember() */
+
 
 /*--------------------------------------------------------------------------
  NAME
@@ -2617,6 +2722,8 @@ H5P_insert(H5P_genplist_t *plist, const char *name, size_t size,
     /* Insert property into property list class */
     if(H5P__add_prop(plist->props, new_prop) < 0)
         HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "Can't insert property into class")
+    H5P_RESET_LOOKUP(plist);
+    plist->mod_count++;
 
     /* Increment property count for class */
     plist->nprops++;
@@ -2669,12 +2776,29 @@ H5P__do_prop(H5P_genplist_t *plist, const char *name, H5P_do_plist_op_t plist_op
     HDassert(plist_op);
     HDassert(pclass_op);
 
+    /* Check the properties found by recent lookups */
+    if(NULL != (prop = H5P__lookup_cached(plist, name))) {
+        /* Call the callback for where the property was found */
+        if(H5P_PROP_WITHIN_LIST == prop->type) {
+            if((*plist_op)(plist, name, prop, udata) < 0)
+                HGOTO_ERROR(H5E_PLIST, H5E_CANTOPERATE, FAIL, "can't operate on property")
+        } /* end if */
+        else
+            if((*pclass_op)(plist, name, prop, udata) < 0)
+                HGOTO_ERROR(H5E_PLIST, H5E_CANTOPERATE, FAIL, "can't operate on property")
+
+        HGOTO_DONE(SUCCEED)
+    } /* end if */
+
     /* Check if the property has been deleted */
     if(NULL != H5SL_search(plist->del, name))
         HGOTO_ERROR(H5E_PLIST, H5E_NOTFOUND, FAIL, "property doesn't exist")
 
     /* Find property in changed list */
     if(NULL != (prop = (H5P_genprop_t *)H5SL_search(plist->props, name))) {
+        /* Remember the property for the next lookup */
+        H5P__lookup_remember(plist, name, prop);
+
         /* Call the 'found in property list' callback */
         if((*plist_op)(plist, name, prop, udata) < 0)
             HGOTO_ERROR(H5E_PLIST, H5E_CANTOPERATE, FAIL, "can't operate on property")
@@ -2689,6 +2813,9 @@ H5P__do_prop(H5P_genplist_t *plist, const char *name, H5P_do_plist_op_t plist_op
             if(tclass->nprops > 0) {
                 /* Find the property in the class */
                 if(NULL != (prop = (H5P_genprop_t *)H5SL_search(tclass->props, name))) {
+                    /* Remember the property for the next lookup */
+                    H5P__lookup_remember(plist, name, prop);
+
                     /* Call the 'found in class' callback */
                     if((*pclass_op)(plist, name, prop, udata) < 0)
                         HGOTO_ERROR(H5E_PLIST, H5E_CANTOPERATE, FAIL, "can't operate on property")
@@ -2811,6 +2938,7 @@ H5P__poke_pclass_cb(H5P_genplist_t *plist, const char *name, H5P_genprop_t *prop
     /* Insert the changed property into the property list */
     if(H5P__add_prop(plist->props, pcopy) < 0)
         HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL,"Can't insert changed property into skip list")
+    H5P_RESET_LOOKUP(plist);
 
 done:
     /* Cleanup on failure */
@@ -2861,6 +2989,7 @@ H5P_poke(H5P_genplist_t *plist, const char *name, const void *value)
 
     /* Find the property and set the value */
     udata.value = value;
+    plist->mod_count++;
     if(H5P__do_prop(plist, name, H5P__poke_plist_cb, H5P__poke_pclass_cb, &udata) < 0)
         HGOTO_ERROR(H5E_PLIST, H5E_CANTOPERATE, FAIL, "can't operate on plist to overwrite value")
 
@@ -3017,6 +3146,7 @@ H5P__set_pclass_cb(H5P_genplist_t *plist, const char *name, H5P_genprop_t *prop,
     /* Insert the changed property into the property list */
     if(H5P__add_prop(plist->props, pcopy) < 0)
         HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL,"Can't insert changed property into skip list")
+    H5P_RESET_LOOKUP(plist);
 
 done:
     /* Free the temporary value buffer */
@@ -3078,6 +3208,7 @@ H5P_set(H5P_genplist_t *plist, const char *name, const void *value)
 
     /* Find the property and set the value */
     udata.value = value;
+    plist->mod_count++;
     if(H5P__do_prop(plist, name, H5P__set_plist_cb, H5P__set_pclass_cb, &udata) < 0)
         HGOTO_ERROR(H5E_PLIST, H5E_CANTOPERATE, FAIL, "can't operate on plist to set value")
 
@@ -4597,6 +4728,7 @@ H5P__del_plist_cb(H5P_genplist_t *plist, const char *name, H5P_genprop_t *prop,
     /* Remove the property from the skip list */
     if(NULL == H5SL_remove(plist->props, prop->name))
         HGOTO_ERROR(H5E_PLIST, H5E_CANTDELETE, FAIL, "can't remove property from skip list")
+    H5P_RESET_LOOKUP(plist);
 
     /* Free the property, ignoring return value, nothing we can do */
     H5P__free_prop(prop);
@@ -4669,6 +4801,7 @@ H5P__del_pclass_cb(H5P_genplist_t *plist, const char *name, H5P_genprop_t *prop,
     /* Insert property name into deleted list */
     if(H5SL_insert(plist->del, del_name, del_name) < 0)
         HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into deleted skip list")
+    H5P_RESET_LOOKUP(plist);
 
     /* Decrement the number of properties in list */
     plist->nprops--;
@@ -4724,7 +4857,8 @@ H5P_remove(H5P_genplist_t *plist, const char *name)
     HDassert(plist);
     HDassert(name);
 
-    /* Find the property and get the value */
+    /* Find the property and delete it */
+    plist->mod_count++;
     if(H5P__do_prop(plist, name, H5P__del_plist_cb, H5P__del_pclass_cb, NULL) < 0)
         HGOTO_ERROR(H5E_PLIST, H5E_CANTOPERATE, FAIL, "can't operate on plist to remove value")
 
@@ -4787,6 +4921,17 @@ H5P__copy_prop_plist(hid_t dst_id, hid_t src_id, const char *name)
         if(H5P_remove(dst_plist, name) < 0)
             HGOTO_ERROR(H5E_PLIST, H5E_CANTDELETE, FAIL, "unable to remove property")
 
+        /* The property is about to be re-added, so take its name back off
+         * the deleted property skip list
+         */
+        if(NULL != H5SL_search(dst_plist->del, name)) {
+            char *temp_name;
+
+            if(NULL == (temp_name = (char *)H5SL_remove(dst_plist->del, name)))
+                HGOTO_ERROR(H5E_PLIST, H5E_CANTDELETE, FAIL, "can't remove property from deleted skip list")
+            H5MM_xfree(temp_name);
+        } /* end if */
+
         /* Get the pointer to the source property */
         prop = H5P__find_prop_plist(src_plist, name);
 
@@ -4803,6 +4948,8 @@ H5P__copy_prop_plist(hid_t dst_id, hid_t src_id, const char *name)
         /* Insert the initialized property into the property list */
         if(H5P__add_prop(dst_plist->props,new_prop) < 0)
             HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL,"Can't insert property into list")
+        H5P_RESET_LOOKUP(dst_plist);
+        dst_plist->mod_count++;
 
         /* Increment the number of properties in list */
         dst_plist->nprops++;
@@ -4827,6 +4974,8 @@ H5P__copy_prop_plist(hid_t dst_id, hid_t src_id, const char *name)
         /* Insert property into property list class */
         if(H5P__add_prop(dst_plist->props, new_prop) < 0)
             HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL,"Can't insert property into class")
+        H5P_RESET_LOOKUP(dst_plist);
+        dst_plist->mod_count++;
 
         /* Increment property count for class */
         dst_plist->nprops++;
@@ -5566,6 +5715,29 @@ H5P_get_plist_id(const H5P_genplist_t *plist)
 } /* end H5P_get_plist_id() */
 
 
+/*-------------------------------------------------------------------------
+ * Function:	H5P_get_mod_count
+ *
+ * Purpose:	Quick routine to retrieve the number of times a property list
+ *		has been modified, so that callers can tell whether values
+ *		they retrieved from it earlier are still current.
+ *
+ * Return:	The property list's modification count (never fails)
+ *
+ *-------------------------------------------------------------------------
+ */
+unsigned
+H5P_get_mod_count(const H5P_genplist_t *plist)
+{
+    /* Use FUNC_ENTER_NOAPI_NOINIT_NOERR here to avoid performance issues */
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    HDassert(plist);
+
+    FUNC_LEAVE_NOAPI(plist->mod_count)
+} /* end H5P_get_mod_count() */
+
+
 /*-------------------------------------------------------------------------
  * Function:	H5P_get_class
  *
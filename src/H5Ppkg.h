@@ -36,6 +36,9 @@
 /* Package Private Macros */
 /**************************/
 
+/* Number of recent property lookups each property list remembers */
+#define H5P_LOOKUP_CACHE_SIZE   8
+
 
 /****************************/
 /* Package Private Typedefs */
@@ -111,6 +114,12 @@ struct H5P_genplist_t {
     hbool_t class_init; /* Whether the class initialization callback finished successfully */
     H5SL_t *del;        /* Skip list containing names of deleted properties */
     H5SL_t *props;      /* Skip list containing properties */
+    unsigned mod_count; /* Number of times the list's properties have been set, added or removed */
+
+    /* Properties found by recent lookups, in the list or its classes */
+    /* (Forgotten whenever the list's properties or any class change) */
+    unsigned lookup_rev; /* Class revision counter when the lookups were made */
+    H5P_genprop_t *lookup[H5P_LOOKUP_CACHE_SIZE]; /* Properties found, by hash of the name pointer */
 };
 
 /* Property list/class iterator callback function pointer */
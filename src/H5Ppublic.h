@@ -467,6 +467,9 @@ H5_DLL herr_t H5Pget_vlen_mem_manager(hid_t plist_id,
                                        void **alloc_info,
                                        H5MM_free_t *free_func,
                                        void **free_info);
+H5_DLL herr_t H5Pset_vlen_arena(hid_t plist_id, void *buf, size_t size);
+H5_DLL herr_t H5Pget_vlen_arena(hid_t plist_id, void **buf/*out*/,
+                                 size_t *size/*out*/);
 H5_DLL herr_t H5Pset_hyper_vector_size(hid_t fapl_id, size_t size);
 H5_DLL herr_t H5Pget_hyper_vector_size(hid_t fapl_id, size_t *size/*out*/);
 H5_DLL herr_t H5Pset_type_conv_cb(hid_t dxpl_id, H5T_conv_except_func_t op, void* operate_data);
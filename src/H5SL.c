@@ -55,6 +55,14 @@
  *              are similar to deterministic skip lists, in the August 2000
  *              issue of Dr. Dobb's Journal)
  *
+ *              (Lookups - H5SL_count, H5SL_search, H5SL_less, H5SL_greater,
+ *               H5SL_find, H5SL_below and H5SL_above - only read the list, so
+ *               several threads may search the same list at once without a
+ *               lock, as long as no thread modifies it meanwhile)
+ *
+ *              (A list can also be filled from sorted keys in one pass with
+ *               H5SL_build, which links each node at its final height)
+ *
  */
 
 #include "H5SLmodule.h"         /* This source code file is part of the H5SL module */
@@ -538,6 +546,14 @@
 #define H5SL_FIND(CMP, SLIST, X, TYPE, KEY, HASHVAL)            \
     H5SL_LOCATE(FIND, CMP, SLIST, X, TYPE, KEY, HASHVAL)
 
+/* Macro used to check that the keys given to H5SL_build are in increasing
+ * order.  PREV is the node holding the previous key. */
+#define H5SL_BUILD_CHECK(CMP, SLIST, PREV, TYPE, KEY)                          \
+{                                                                              \
+    if(!H5_GLUE3(H5SL_LOCATE_,CMP,_CMP)(SLIST, TYPE, PREV, KEY, -))            \
+        HGOTO_ERROR(H5E_SLIST, H5E_CANTINSERT, FAIL, "keys are not in increasing order") \
+}
+
 
 /* Private typedefs & structs */
 
@@ -1050,7 +1066,7 @@ done:
     Count the number of objects in a skip list
  USAGE
     size_t H5SL_count(slist)
-        H5SL_t *slist;            IN: Pointer to skip list to count
+        const H5SL_t *slist;      IN: Pointer to skip list to count
 
  RETURNS
     Returns number of objects on success, can't fail
@@ -1062,7 +1078,7 @@ done:
  REVISION LOG
 --------------------------------------------------------------------------*/
 size_t
-H5SL_count(H5SL_t *slist)
+H5SL_count(const H5SL_t *slist)
 {
     FUNC_ENTER_NOAPI_NOINIT_NOERR
 
@@ -1175,6 +1191,168 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5SL_add() */
 
+
+/*--------------------------------------------------------------------------
+ NAME
+    H5SL_build
+ PURPOSE
+    Fill an empty skip list from arrays of items and sorted keys
+ USAGE
+    herr_t H5SL_build(slist,nitems,items,keys)
+        H5SL_t *slist;          IN/OUT: Pointer to skip list
+        size_t nitems;          IN: Number of items to insert
+        void *items[];          IN: Items to insert
+        const void *keys[];     IN: Keys for items, in increasing order
+
+ RETURNS
+    Returns non-negative on success, negative on failure.
+ DESCRIPTION
+    Insert all the items into an empty skip list in one pass, linking each
+    node at its final height instead of searching for its position and
+    rebalancing as H5SL_insert does.  Between any two neighboring nodes
+    taller than a given height there are one or two nodes of that height,
+    so later inserts and removals start from a balanced list.
+ GLOBAL VARIABLES
+ COMMENTS, BUGS, ASSUMPTIONS
+    The keys must be strictly increasing, otherwise the build fails.  On
+    failure the list is left empty and the items are not released.
+
+    String keys are ordered by their hash value in the list, so lists with
+    H5SL_TYPE_STR keys can't be built this way.
+ EXAMPLES
+ REVISION LOG
+--------------------------------------------------------------------------*/
+herr_t
+H5SL_build(H5SL_t *slist, size_t nitems, void *items[], const void *keys[])
+{
+    H5SL_node_t *last[8 * sizeof(size_t)];      /* Last node linked at each level */
+    size_t      nlevel[8 * sizeof(size_t)];     /* Number of nodes at least as tall as each level */
+    size_t      top;                            /* Top level of the list */
+    size_t      lvl;                            /* Local level variable */
+    size_t      u;                              /* Local index variable */
+    hbool_t     linked = FALSE;                 /* Whether any nodes have been linked in */
+    herr_t      ret_value = SUCCEED;            /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    /* Check args */
+    HDassert(slist);
+    HDassert(nitems == 0 || (items && keys));
+
+    /* Not currently supported */
+    HDassert(!slist->safe_iterating);
+
+    if(slist->nobjs > 0)
+        HGOTO_ERROR(H5E_SLIST, H5E_CANTINSERT, FAIL, "skip list is not empty")
+    if(slist->type == H5SL_TYPE_STR)
+        HGOTO_ERROR(H5E_SLIST, H5E_UNSUPPORTED, FAIL, "can't build skip list with string keys")
+    if(nitems == 0)
+        HGOTO_DONE(SUCCEED)
+
+    /* Choose the height of each level: every other node of a level, but
+     * never the first or last, moves up to the next level until there are
+     * no more than 3 nodes left */
+    nlevel[0] = nitems;
+    for(top = 0; nlevel[top] > 3; top++)
+        nlevel[top + 1] = (nlevel[top] - 1) / 2;
+
+    /* Reset the header (removals may have left it taller than level 0) and
+     * grow it to the top level */
+    if(H5SL_release_common(slist, NULL, NULL) < 0)
+        HGOTO_ERROR(H5E_SLIST, H5E_CANTFREE, FAIL, "can't reset skip list")
+    for(lvl = 0; lvl < top; lvl++)
+        H5SL_GROW(slist->header, lvl, FAIL)
+    for(lvl = 0; lvl <= top; lvl++)
+        last[lvl] = slist->header;
+    linked = TRUE;
+
+    /* Create the nodes and link them in order */
+    for(u = 0; u < nitems; u++) {
+        H5SL_node_t *x;         /* New node */
+        size_t height;          /* Height of new node */
+
+        HDassert(keys[u]);
+
+        /* Check the key order */
+        if(u > 0)
+            switch(slist->type) {
+                case H5SL_TYPE_INT:
+                    H5SL_BUILD_CHECK(SCALAR, slist, last[0], const int, keys[u])
+                    break;
+
+                case H5SL_TYPE_HADDR:
+                    H5SL_BUILD_CHECK(SCALAR, slist, last[0], const haddr_t, keys[u])
+                    break;
+
+                case H5SL_TYPE_HSIZE:
+                    H5SL_BUILD_CHECK(SCALAR, slist, last[0], const hsize_t, keys[u])
+                    break;
+
+                case H5SL_TYPE_UNSIGNED:
+                    H5SL_BUILD_CHECK(SCALAR, slist, last[0], const unsigned, keys[u])
+                    break;
+
+                case H5SL_TYPE_SIZE:
+                    H5SL_BUILD_CHECK(SCALAR, slist, last[0], const size_t, keys[u])
+                    break;
+
+                case H5SL_TYPE_OBJ:
+                    H5SL_BUILD_CHECK(OBJ, slist, last[0], const H5_obj_t, keys[u])
+                    break;
+
+                case H5SL_TYPE_HID:
+                    H5SL_BUILD_CHECK(SCALAR, slist, last[0], const hid_t, keys[u])
+                    break;
+
+                case H5SL_TYPE_GENERIC:
+                    H5SL_BUILD_CHECK(GENERIC, slist, last[0], const void, keys[u])
+                    break;
+
+                case H5SL_TYPE_STR:
+                default:
+                    HDassert(0 && "Unknown skiplist type!");
+            } /* end switch */
+
+        /* Create new node of level 0 and link it in at the end of the list */
+        if(NULL == (x = H5SL_new_node(items[u], keys[u], (uint32_t)0)))
+            HGOTO_ERROR(H5E_SLIST, H5E_NOSPACE, FAIL, "can't create new skip list node")
+        x->backward = last[0];
+        x->forward[0] = NULL;
+        last[0]->forward[0] = x;
+        last[0] = x;
+
+        /* The node at 0-based index u is at level h if (u + 1) is a multiple
+         * of 2^h and the node is one of the first nlevel[h] at that level */
+        for(height = 0; height < top; height++)
+            if(((u + 1) & (((size_t)2 << height) - 1)) != 0 || ((u + 1) >> (height + 1)) > nlevel[height + 1])
+                break;
+
+        /* Grow the node and link it in at its upper levels */
+        for(lvl = 1; lvl <= height; lvl++) {
+            H5SL_GROW(x, lvl - 1, FAIL)
+            last[lvl]->forward[lvl] = x;
+            last[lvl] = x;
+        } /* end for */
+    } /* end for */
+
+    /* Terminate each level */
+    for(lvl = 1; lvl <= top; lvl++)
+        last[lvl]->forward[lvl] = NULL;
+
+    /* Update the list's information */
+    slist->last = last[0];
+    slist->curr_level = (int)top;
+    slist->nobjs = nitems;
+
+done:
+    /* Release any nodes already linked in on failure */
+    if(ret_value < 0 && linked)
+        if(H5SL_release_common(slist, NULL, NULL) < 0)
+            HDONE_ERROR(H5E_SLIST, H5E_CANTFREE, FAIL, "can't release skip list nodes")
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5SL_build() */
+
 
 /*--------------------------------------------------------------------------
  NAME
@@ -1377,7 +1555,7 @@ done:
     Search for object in a skip list
  USAGE
     void *H5SL_search(slist,key)
-        H5SL_t *slist;          IN/OUT: Pointer to skip list
+        const H5SL_t *slist;    IN: Pointer to skip list
         void *key;              IN: Key for item to search for
 
  RETURNS
@@ -1390,7 +1568,7 @@ done:
  REVISION LOG
 --------------------------------------------------------------------------*/
 void *
-H5SL_search(H5SL_t *slist, const void *key)
+H5SL_search(const H5SL_t *slist, const void *key)
 {
     H5SL_node_t *x;                             /* Current node to examine */
     uint32_t hashval = 0;                       /* Hash value for key */
@@ -1467,7 +1645,7 @@ done:
     Search for object in a skip list that is less than or equal to 'key'
  USAGE
     void *H5SL_less(slist,key)
-        H5SL_t *slist;          IN/OUT: Pointer to skip list
+        const H5SL_t *slist;    IN: Pointer to skip list
         void *key;              IN: Key for item to search for
 
  RETURNS
@@ -1483,7 +1661,7 @@ done:
  REVISION LOG
 --------------------------------------------------------------------------*/
 void *
-H5SL_less(H5SL_t *slist, const void *key)
+H5SL_less(const H5SL_t *slist, const void *key)
 {
     H5SL_node_t *x;             /* Current node to examine */
     uint32_t hashval = 0;       /* Hash value for key */
@@ -1576,7 +1754,7 @@ done:
     Search for object in a skip list that is greater than or equal to 'key'
  USAGE
     void *H5SL_greater(slist, key)
-        H5SL_t *slist;          IN/OUT: Pointer to skip list
+        const H5SL_t *slist;    IN: Pointer to skip list
         void *key;              IN: Key for item to search for
 
  RETURNS
@@ -1592,7 +1770,7 @@ done:
  REVISION LOG
 --------------------------------------------------------------------------*/
 void *
-H5SL_greater(H5SL_t *slist, const void *key)
+H5SL_greater(const H5SL_t *slist, const void *key)
 {
     H5SL_node_t *x;                     /* Current node to examine */
     uint32_t hashval = 0;               /* Hash value for key */
@@ -1676,7 +1854,7 @@ done:
     Search for _node_ in a skip list
  USAGE
     H5SL_node_t *H5SL_node(slist,key)
-        H5SL_t *slist;          IN/OUT: Pointer to skip list
+        const H5SL_t *slist;    IN: Pointer to skip list
         void *key;              IN: Key for item to search for
 
  RETURNS
@@ -1691,7 +1869,7 @@ done:
  REVISION LOG
 --------------------------------------------------------------------------*/
 H5SL_node_t *
-H5SL_find(H5SL_t *slist, const void *key)
+H5SL_find(const H5SL_t *slist, const void *key)
 {
     H5SL_node_t *x;                             /* Current node to examine */
     uint32_t hashval = 0;                       /* Hash value for key */
@@ -1768,7 +1946,7 @@ done:
     Search for _node_ in a skip list whose object is less than or equal to 'key'
  USAGE
     H5SL_node_t *H5SL_below(slist, key)
-        H5SL_t *slist;          IN/OUT: Pointer to skip list
+        const H5SL_t *slist;    IN: Pointer to skip list
         void *key;              IN: Key for item to search for
 
  RETURNS
@@ -1784,7 +1962,7 @@ done:
  REVISION LOG
 --------------------------------------------------------------------------*/
 H5SL_node_t *
-H5SL_below(H5SL_t *slist, const void *key)
+H5SL_below(const H5SL_t *slist, const void *key)
 {
     H5SL_node_t *x;                     /* Current node to examine */
     uint32_t hashval = 0;               /* Hash value for key */
@@ -1874,7 +2052,7 @@ done:
     Search for _node_ in a skip list whose object is greater than or equal to 'key'
  USAGE
     H5SL_node_t *H5SL_above(slist, key)
-        H5SL_t *slist;          IN/OUT: Pointer to skip list
+        const H5SL_t *slist;    IN: Pointer to skip list
         void *key;              IN: Key for item to search for
 
  RETURNS
@@ -1890,7 +2068,7 @@ done:
  REVISION LOG
 --------------------------------------------------------------------------*/
 H5SL_node_t *
-H5SL_above(H5SL_t *slist, const void *key)
+H5SL_above(const H5SL_t *slist, const void *key)
 {
     H5SL_node_t *x;                     /* Current node to examine */
     uint32_t hashval = 0;               /* Hash value for key */
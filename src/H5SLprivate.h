@@ -69,17 +69,19 @@ typedef htri_t (*H5SL_try_free_op_t)(void *item, void *key,
 /* Private routines */
 /********************/
 H5_DLL H5SL_t *H5SL_create(H5SL_type_t type, H5SL_cmp_t cmp);
-H5_DLL size_t H5SL_count(H5SL_t *slist);
+H5_DLL size_t H5SL_count(const H5SL_t *slist);
 H5_DLL herr_t H5SL_insert(H5SL_t *slist, void *item, const void *key);
 H5_DLL H5SL_node_t *H5SL_add(H5SL_t *slist, void *item, const void *key);
+H5_DLL herr_t H5SL_build(H5SL_t *slist, size_t nitems, void *items[],
+    const void *keys[]);
 H5_DLL void *H5SL_remove(H5SL_t *slist, const void *key);
 H5_DLL void *H5SL_remove_first(H5SL_t *slist);
-H5_DLL void *H5SL_search(H5SL_t *slist, const void *key);
-H5_DLL void *H5SL_less(H5SL_t *slist, const void *key);
-H5_DLL void *H5SL_greater(H5SL_t *slist, const void *key);
-H5_DLL H5SL_node_t *H5SL_find(H5SL_t *slist, const void *key);
-H5_DLL H5SL_node_t *H5SL_below(H5SL_t *slist, const void *key);
-H5_DLL H5SL_node_t *H5SL_above(H5SL_t *slist, const void *key);
+H5_DLL void *H5SL_search(const H5SL_t *slist, const void *key);
+H5_DLL void *H5SL_less(const H5SL_t *slist, const void *key);
+H5_DLL void *H5SL_greater(const H5SL_t *slist, const void *key);
+H5_DLL H5SL_node_t *H5SL_find(const H5SL_t *slist, const void *key);
+H5_DLL H5SL_node_t *H5SL_below(const H5SL_t *slist, const void *key);
+H5_DLL H5SL_node_t *H5SL_above(const H5SL_t *slist, const void *key);
 H5_DLL H5SL_node_t *H5SL_first(H5SL_t *slist);
 H5_DLL H5SL_node_t *H5SL_next(H5SL_node_t *slist_node);
 H5_DLL H5SL_node_t *H5SL_prev(H5SL_node_t *slist_node);
@@ -211,6 +211,8 @@ static herr_t H5S__hyper_iter_next(H5S_sel_iter_t *sel_iter, size_t nelem);
 static herr_t H5S__hyper_iter_next_block(H5S_sel_iter_t *sel_iter);
 static herr_t H5S__hyper_iter_get_seq_list(H5S_sel_iter_t *iter, size_t maxseq,
     size_t maxbytes, size_t *nseq, size_t *nbytes, hsize_t *off, size_t *len);
+static htri_t H5S__hyper_iter_get_run_list(H5S_sel_iter_t *iter, size_t maxrun,
+    size_t maxelem, size_t *nrun, size_t *nelem, H5S_sel_run_t *run);
 static herr_t H5S__hyper_iter_release(H5S_sel_iter_t *sel_iter);
 
 
@@ -272,6 +274,7 @@ static const H5S_sel_iter_class_t H5S_sel_iter_hyper[1] = {{
     H5S__hyper_iter_next,
     H5S__hyper_iter_next_block,
     H5S__hyper_iter_get_seq_list,
+    H5S__hyper_iter_get_run_list,
     H5S__hyper_iter_release,
 }};
 
@@ -2727,6 +2730,188 @@ H5S__hyper_iter_get_seq_list(H5S_sel_iter_t *iter, size_t maxseq,
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5S__hyper_iter_get_seq_list() */
 
+
+/*--------------------------------------------------------------------------
+ NAME
+    H5S__hyper_iter_get_run_list
+ PURPOSE
+    Create a list of strided runs of sequences for a selection
+ USAGE
+    htri_t H5S__hyper_iter_get_run_list(iter,maxrun,maxelem,nrun,nelem,run)
+        H5S_sel_iter_t *iter;   IN/OUT: Selection iterator describing last
+                                    position of interest in selection.
+        size_t maxrun;          IN: Maximum number of runs to generate
+        size_t maxelem;         IN: Maximum number of elements to include in the
+                                    generated runs
+        size_t *nrun;           OUT: Actual number of runs generated
+        size_t *nelem;          OUT: Actual number of elements in runs generated
+        H5S_sel_run_t *run;     OUT: Array of runs
+ RETURNS
+    TRUE if runs were generated, FALSE if the selection isn't regular,
+    negative on failure.
+ DESCRIPTION
+    For a regular hyperslab selection, generate one run for each row of
+    blocks in the fastest changing dimension (or for what is left of a
+    row, or of a partial block), instead of one sequence per block.  Each
+    run takes O(rank) time to generate, however many blocks it covers.
+    Start/Restart from the position in the ITER parameter.
+ GLOBAL VARIABLES
+ COMMENTS, BUGS, ASSUMPTIONS
+    Irregular selections aren't handled, and the iterator isn't changed
+    for them.
+ EXAMPLES
+ REVISION LOG
+--------------------------------------------------------------------------*/
+static htri_t
+H5S__hyper_iter_get_run_list(H5S_sel_iter_t *iter, size_t maxrun,
+    size_t maxelem, size_t *nrun, size_t *nelem, H5S_sel_run_t *run)
+{
+    const H5S_hyper_dim_t *tdiminfo;    /* Temporary pointer to diminfo information */
+    const hssize_t *sel_off;            /* Selection offset in dataspace */
+    const hsize_t *slab;                /* Hyperslab size */
+    hsize_t iter_offset[H5S_MAX_RANK];  /* Offset within current block */
+    hsize_t iter_count[H5S_MAX_RANK];   /* Current block */
+    hsize_t fast_dim_buf_off;           /* Bytes between blocks in fastest dimension */
+    size_t fast_dim_block;              /* Elements in a block in fastest dimension */
+    size_t elem_size;                   /* Size of each element iterating over */
+    size_t curr_run = 0;                /* Current run being generated */
+    size_t io_left;                     /* The number of elements left in I/O operation */
+    size_t start_io_left;               /* The initial number of elements left in I/O operation */
+    unsigned ndims;                     /* Number of dimensions of dataset */
+    unsigned fast_dim;                  /* Rank of the fastest changing dimension */
+    unsigned u;                         /* Local index variable */
+    htri_t ret_value = TRUE;            /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Check args */
+    HDassert(iter);
+    HDassert(iter->elmt_left > 0);
+    HDassert(maxrun > 0);
+    HDassert(maxelem > 0);
+    HDassert(nrun);
+    HDassert(nelem);
+    HDassert(run);
+
+    /* Only regular selections can be described with runs */
+    if(!iter->u.hyp.diminfo_valid)
+        HGOTO_DONE(FALSE)
+
+    /* Set a local copy of the diminfo pointer */
+    tdiminfo = iter->u.hyp.diminfo;
+
+    /* Check if this is a "flattened" regular hyperslab selection */
+    if(iter->u.hyp.iter_rank != 0 && iter->u.hyp.iter_rank < iter->rank) {
+        ndims = iter->u.hyp.iter_rank;
+        sel_off = iter->u.hyp.sel_off;
+    } /* end if */
+    else {
+        ndims = iter->rank;
+        sel_off = iter->sel_off;
+    } /* end else */
+    fast_dim = ndims - 1;
+    slab = iter->u.hyp.slab;
+    elem_size = iter->elmt_size;
+
+    /* Calculate the offset within the current block and the current block
+     * for each dimension
+     */
+    for(u = 0; u < ndims; u++) {
+        if(tdiminfo[u].count == 1) {
+            iter_offset[u] = iter->u.hyp.off[u] - tdiminfo[u].start;
+            iter_count[u] = 0;
+        } /* end if */
+        else {
+            iter_offset[u] = (iter->u.hyp.off[u] - tdiminfo[u].start) % tdiminfo[u].stride;
+            iter_count[u] = (iter->u.hyp.off[u] - tdiminfo[u].start) / tdiminfo[u].stride;
+        } /* end else */
+    } /* end for */
+
+    /* Set local copies of information for the fastest changing dimension */
+    H5_CHECKED_ASSIGN(fast_dim_block, size_t, tdiminfo[fast_dim].block, hsize_t);
+    fast_dim_buf_off = slab[fast_dim] * tdiminfo[fast_dim].stride;
+
+    /* Calculate the number of elements to generate runs for */
+    H5_CHECK_OVERFLOW(iter->elmt_left, hsize_t, size_t);
+    start_io_left = io_left = MIN((size_t)iter->elmt_left, maxelem);
+
+    while(io_left > 0 && curr_run < maxrun) {
+        hsize_t loc = 0;            /* Byte offset of current position */
+        size_t run_elem;            /* Number of elements in the run */
+
+        /* Compute the buffer offset of the current position */
+        for(u = 0; u < ndims; u++)
+            loc += (hsize_t)((hssize_t)(tdiminfo[u].start + (tdiminfo[u].stride * iter_count[u]) + iter_offset[u]) + sel_off[u]) * slab[u];
+
+        run[curr_run].off = loc;
+        if(iter_offset[fast_dim] > 0 || io_left < fast_dim_block) {
+            /* Part of a block: finish the block, or use the elements left */
+            run_elem = MIN(fast_dim_block - (size_t)iter_offset[fast_dim], io_left);
+            run[curr_run].stride = 0;
+            run[curr_run].count = 1;
+            run[curr_run].len = run_elem * elem_size;
+
+            iter_offset[fast_dim] += run_elem;
+            if(iter_offset[fast_dim] == fast_dim_block) {
+                iter_offset[fast_dim] = 0;
+                iter_count[fast_dim]++;
+            } /* end if */
+        } /* end if */
+        else {
+            size_t nblocks;         /* Number of whole blocks in the run */
+
+            /* Whole blocks, to the end of the row or as many as fit */
+            H5_CHECKED_ASSIGN(nblocks, size_t, tdiminfo[fast_dim].count - iter_count[fast_dim], hsize_t);
+            nblocks = MIN(nblocks, io_left / fast_dim_block);
+            run_elem = nblocks * fast_dim_block;
+            run[curr_run].stride = fast_dim_buf_off;
+            run[curr_run].count = nblocks;
+            run[curr_run].len = fast_dim_block * elem_size;
+
+            iter_count[fast_dim] += nblocks;
+        } /* end else */
+
+        /* Move to the next row, if the end of this one was reached */
+        if(iter_count[fast_dim] == tdiminfo[fast_dim].count) {
+            int temp_dim;           /* Temporary rank holder */
+
+            iter_count[fast_dim] = 0;
+            for(temp_dim = (int)fast_dim - 1; temp_dim >= 0; temp_dim--) {
+                /* Move to the next row in the current dimension */
+                iter_offset[temp_dim]++;
+                if(iter_offset[temp_dim] < tdiminfo[temp_dim].block)
+                    break;
+
+                /* Move to the next block in the current dimension */
+                iter_offset[temp_dim] = 0;
+                iter_count[temp_dim]++;
+                if(iter_count[temp_dim] < tdiminfo[temp_dim].count)
+                    break;
+
+                /* Reset back to the beginning of the line */
+                iter_count[temp_dim] = 0;
+            } /* end for */
+        } /* end if */
+
+        io_left -= run_elem;
+        curr_run++;
+    } /* end while */
+
+    /* Translate current iter_offset and iter_count into iterator position */
+    for(u = 0; u < ndims; u++)
+        iter->u.hyp.off[u] = tdiminfo[u].start + (tdiminfo[u].stride * iter_count[u]) + iter_offset[u];
+
+    /* Decrement the number of elements left in selection */
+    iter->elmt_left -= (start_io_left - io_left);
+
+    /* Set the number of runs generated and elements used */
+    *nrun = curr_run;
+    *nelem = start_io_left - io_left;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5S__hyper_iter_get_run_list() */
+
 
 /*--------------------------------------------------------------------------
  NAME
@@ -131,6 +131,7 @@ static const H5S_sel_iter_class_t H5S_sel_iter_none[1] = {{
     H5S__none_iter_next,
     H5S__none_iter_next_block,
     H5S__none_iter_get_seq_list,
+    NULL,
     H5S__none_iter_release,
 }};
 
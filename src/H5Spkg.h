@@ -314,6 +314,9 @@ typedef herr_t (*H5S_sel_iter_next_block_func_t)(H5S_sel_iter_t *iter);
 typedef herr_t (*H5S_sel_iter_get_seq_list_func_t)(H5S_sel_iter_t *iter,
     size_t maxseq, size_t maxbytes, size_t *nseq, size_t *nbytes, hsize_t *off,
     size_t *len);
+/* Method to retrieve a list of strided runs of sequences for selection iterator */
+typedef htri_t (*H5S_sel_iter_get_run_list_func_t)(H5S_sel_iter_t *iter,
+    size_t maxrun, size_t maxelem, size_t *nrun, size_t *nelem, H5S_sel_run_t *run);
 /* Method to release iterator for current selection */
 typedef herr_t (*H5S_sel_iter_release_func_t)(H5S_sel_iter_t *iter);
 
@@ -329,6 +332,7 @@ typedef struct H5S_sel_iter_class_t {
     H5S_sel_iter_next_func_t iter_next;         /* Method to move selection iterator to the next element in the selection */
     H5S_sel_iter_next_block_func_t iter_next_block;     /* Method to move selection iterator to the next block in the selection */
     H5S_sel_iter_get_seq_list_func_t iter_get_seq_list; /* Method to retrieve a list of offset/length sequences for selection iterator */
+    H5S_sel_iter_get_run_list_func_t iter_get_run_list; /* Method to retrieve a list of strided runs for selection iterator (may be NULL) */
     H5S_sel_iter_release_func_t iter_release;   /* Method to release iterator for current selection */
 } H5S_sel_iter_class_t;
 
@@ -375,6 +379,8 @@ H5_DLL herr_t H5S__get_rebuild_status_test(hid_t space_id,
 H5_DLL herr_t H5S__get_diminfo_status_test(hid_t space_id,
     H5S_diminfo_valid_t *status);
 H5_DLL htri_t H5S__internal_consistency_test(hid_t space_id);
+H5_DLL htri_t H5S__sel_iter_get_run_list_test(hid_t sel_iter_id, size_t maxrun,
+    size_t maxelem, size_t *nrun, size_t *nelem, H5S_sel_run_t *run);
 #endif /* H5S_TESTING */
 
 #endif /*_H5Spkg_H*/
@@ -154,6 +154,7 @@ static const H5S_sel_iter_class_t H5S_sel_iter_point[1] = {{
     H5S__point_iter_next,
     H5S__point_iter_next_block,
     H5S__point_iter_get_seq_list,
+    NULL,
     H5S__point_iter_release,
 }};
 
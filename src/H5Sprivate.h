@@ -115,6 +115,17 @@ typedef struct H5S_sel_iter_t {
     } u;
 } H5S_sel_iter_t;
 
+/* Run of sequences of the same length, at a fixed distance from each other */
+/* (COUNT sequences of LEN bytes, the first at byte OFF and each one after
+ *  that STRIDE bytes after the one before it)
+ */
+typedef struct H5S_sel_run_t {
+    hsize_t off;                /* Offset of first sequence, in bytes */
+    hsize_t stride;             /* Distance between starts of sequences, in bytes */
+    size_t count;               /* Number of sequences in run */
+    size_t len;                 /* Length of each sequence, in bytes */
+} H5S_sel_run_t;
+
 /* Selection iteration operator for internal library callbacks */
 typedef herr_t (*H5S_sel_iter_lib_op_t)(void *elem, const H5T_t *type,
         unsigned ndim, const hsize_t *point, void *op_data);
@@ -261,6 +272,7 @@ H5_DLL herr_t H5S_select_serialize(const H5S_t *space, uint8_t **p);
 H5_DLL htri_t H5S_select_is_contiguous(const H5S_t *space);
 H5_DLL htri_t H5S_select_is_single(const H5S_t *space);
 H5_DLL htri_t H5S_select_is_regular(const H5S_t *space);
+H5_DLL htri_t H5S_select_get_regular(const H5S_t *space, H5S_hyper_dim_t diminfo[]);
 H5_DLL herr_t H5S_select_adjust_u(H5S_t *space, const hsize_t *offset);
 H5_DLL herr_t H5S_select_project_scalar(const H5S_t *space, hsize_t *offset);
 H5_DLL herr_t H5S_select_project_simple(const H5S_t *space, H5S_t *new_space, hsize_t *offset);
@@ -309,6 +321,8 @@ H5_DLL hsize_t H5S_select_iter_nelmts(const H5S_sel_iter_t *sel_iter);
 H5_DLL herr_t H5S_select_iter_next(H5S_sel_iter_t *sel_iter, size_t nelem);
 H5_DLL herr_t H5S_select_iter_get_seq_list(H5S_sel_iter_t *iter, size_t maxseq,
     size_t maxbytes, size_t *nseq, size_t *nbytes, hsize_t *off, size_t *len);
+H5_DLL htri_t H5S_select_iter_get_run_list(H5S_sel_iter_t *iter, size_t maxrun,
+    size_t maxelem, size_t *nrun, size_t *nelem, H5S_sel_run_t *run);
 H5_DLL herr_t H5S_select_iter_release(H5S_sel_iter_t *sel_iter);
 H5_DLL herr_t H5S_sel_iter_close(H5S_sel_iter_t *sel_iter);
 
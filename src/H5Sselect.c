@@ -28,8 +28,10 @@
 /* Headers */
 /***********/
 #include "H5private.h"		/* Generic Functions			*/
+#include "H5CXprivate.h"	/* API Contexts				*/
 #include "H5Dprivate.h"		/* Datasets				*/
 #include "H5Eprivate.h"		/* Error handling		  	*/
+#include "H5Fprivate.h"		/* Files				*/
 #include "H5FLprivate.h"	/* Free Lists                           */
 #include "H5Iprivate.h"		/* IDs			  		*/
 #include "H5Spkg.h"		/* Dataspaces 				*/
@@ -918,6 +920,82 @@ H5S_select_is_regular(const H5S_t *space)
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5S_select_is_regular() */
 
+
+/*--------------------------------------------------------------------------
+ NAME
+    H5S_select_get_regular
+ PURPOSE
+    Retrieve the per-dimension pattern of a "regular" selection
+ USAGE
+    htri_t H5S_select_get_regular(space, diminfo)
+        const H5S_t *space;             IN: Dataspace of selection to query
+        H5S_hyper_dim_t diminfo[];      OUT: Start/stride/count/block of the
+                                            selection in each dimension
+ RETURNS
+    TRUE if the selection is regular and DIMINFO was set, FALSE if it isn't,
+    negative on failure
+ DESCRIPTION
+    Retrieves the (optimized) start/stride/count/block of an "all" selection
+    or of a regular hyperslab selection, so that callers can compute with
+    the pattern directly instead of generating selections from it.
+ GLOBAL VARIABLES
+ COMMENTS, BUGS, ASSUMPTIONS
+    Selections with an offset set and unlimited selections aren't
+    reported as regular here.
+ EXAMPLES
+ REVISION LOG
+--------------------------------------------------------------------------*/
+htri_t
+H5S_select_get_regular(const H5S_t *space, H5S_hyper_dim_t diminfo[])
+{
+    unsigned u;                 /* Local index variable */
+    htri_t ret_value = FALSE;   /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    /* Check args */
+    HDassert(space);
+    HDassert(diminfo);
+
+    /* Don't bother with selections that are offset */
+    if(space->select.offset_changed)
+        HGOTO_DONE(FALSE)
+
+    switch(H5S_GET_SELECT_TYPE(space)) {
+        case H5S_SEL_ALL:
+            for(u = 0; u < space->extent.rank; u++) {
+                diminfo[u].start = 0;
+                diminfo[u].stride = 1;
+                diminfo[u].count = 1;
+                diminfo[u].block = space->extent.size[u];
+            } /* end for */
+            ret_value = TRUE;
+            break;
+
+        case H5S_SEL_HYPERSLABS:
+            if((ret_value = H5S_SELECT_IS_REGULAR(space)) < 0)
+                HGOTO_ERROR(H5E_DATASPACE, H5E_CANTCOMPARE, FAIL, "can't check for regular selection")
+            if(ret_value) {
+                if(space->select.sel_info.hslab->unlim_dim >= 0)
+                    HGOTO_DONE(FALSE)
+                H5MM_memcpy(diminfo, space->select.sel_info.hslab->diminfo.opt, sizeof(H5S_hyper_dim_t) * space->extent.rank);
+            } /* end if */
+            break;
+
+        case H5S_SEL_NONE:
+        case H5S_SEL_POINTS:
+            break;
+
+        case H5S_SEL_ERROR:
+        case H5S_SEL_N:
+        default:
+            HGOTO_ERROR(H5E_ARGS, H5E_BADRANGE, FAIL, "invalid selection type")
+    } /* end switch */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5S_select_get_regular() */
+
 
 /*--------------------------------------------------------------------------
  NAME
@@ -1373,6 +1451,8 @@ herr_t
 H5S_select_iter_get_seq_list(H5S_sel_iter_t *iter, size_t maxseq, size_t maxelmts,
     size_t *nseq, size_t *nelmts, hsize_t *off, size_t *len)
 {
+    H5F_prof_t *prof;           /* Profiling counters for the file, if any */
+    double start = 0.0;         /* Time the iteration started */
     herr_t ret_value = FAIL;    /* Return value */
 
     FUNC_ENTER_NOAPI_NOINIT
@@ -1381,13 +1461,60 @@ H5S_select_iter_get_seq_list(H5S_sel_iter_t *iter, size_t maxseq, size_t maxelmt
     HDassert(iter);
 
     /* Call the selection type's get_seq_list function */
+    if(NULL != (prof = H5CX_get_prof()))
+        start = H5_get_time();
     if((ret_value = (*iter->type->iter_get_seq_list)(iter, maxseq, maxelmts, nseq, nelmts, off, len)) < 0)
         HGOTO_ERROR(H5E_DATASPACE, H5E_CANTGET, FAIL, "unable to get selection sequence list")
+    if(prof)
+        H5F_prof_select(prof, H5_get_time() - start);
 
 done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5S_select_iter_get_seq_list() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	H5S_select_iter_get_run_list
+ *
+ * Purpose:	Retrieves the next strided runs of sequences for an iterator
+ *              on a dataspace.  Each run stands for a number of sequences
+ *              of the same length, spaced evenly, so a regular selection
+ *              needs far fewer runs than offset/length pairs.
+ *
+ * Return:	TRUE if runs were generated, FALSE if the selection can't be
+ *              described with runs (the iterator isn't moved, and the
+ *              caller should use H5S_SELECT_ITER_GET_SEQ_LIST instead),
+ *              negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+htri_t
+H5S_select_iter_get_run_list(H5S_sel_iter_t *iter, size_t maxrun, size_t maxelmts,
+    size_t *nrun, size_t *nelmts, H5S_sel_run_t *run)
+{
+    H5F_prof_t *prof;           /* Profiling counters for the file, if any */
+    double start = 0.0;         /* Time the iteration started */
+    htri_t ret_value = FALSE;   /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    /* Sanity check */
+    HDassert(iter);
+
+    /* Call the selection type's get_run_list function, if it has one */
+    if(iter->type->iter_get_run_list) {
+        if(NULL != (prof = H5CX_get_prof()))
+            start = H5_get_time();
+        if((ret_value = (*iter->type->iter_get_run_list)(iter, maxrun, maxelmts, nrun, nelmts, run)) < 0)
+            HGOTO_ERROR(H5E_DATASPACE, H5E_CANTGET, FAIL, "unable to get selection run list")
+        if(prof && ret_value > 0)
+            H5F_prof_select(prof, H5_get_time() - start);
+    } /* end if */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5S_select_iter_get_run_list() */
+
 
 /*--------------------------------------------------------------------------
  NAME
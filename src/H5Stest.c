@@ -412,3 +412,52 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* H5S__internal_consistency_test() */
 
+
+
+/*--------------------------------------------------------------------------
+ NAME
+    H5S__sel_iter_get_run_list_test
+ PURPOSE
+    Retrieve the next strided runs of sequences from a selection iterator
+ USAGE
+    htri_t H5S__sel_iter_get_run_list_test(sel_iter_id, maxrun, maxelem, nrun, nelem, run)
+        hid_t sel_iter_id;      IN: Selection iterator ID
+        size_t maxrun;          IN: Maximum number of runs to generate
+        size_t maxelem;         IN: Maximum number of elements in the runs
+        size_t *nrun;           OUT: Actual number of runs generated
+        size_t *nelem;          OUT: Actual number of elements in the runs
+        H5S_sel_run_t *run;     OUT: Array of runs
+ RETURNS
+    TRUE if runs were generated, FALSE if the selection can't be described
+    with runs, negative on failure
+ DESCRIPTION
+    Calls H5S_select_iter_get_run_list on the iterator, for comparing its
+    runs with the sequences from H5Ssel_iter_get_seq_list.
+ GLOBAL VARIABLES
+ COMMENTS, BUGS, ASSUMPTIONS
+    DO NOT USE THIS FUNCTION FOR ANYTHING EXCEPT TESTING
+ EXAMPLES
+ REVISION LOG
+--------------------------------------------------------------------------*/
+htri_t
+H5S__sel_iter_get_run_list_test(hid_t sel_iter_id, size_t maxrun, size_t maxelem,
+    size_t *nrun, size_t *nelem, H5S_sel_run_t *run)
+{
+    H5S_sel_iter_t *sel_iter;   /* Dataspace selection iterator to use */
+    htri_t ret_value = FALSE;   /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Get the selection iterator */
+    if(NULL == (sel_iter = (H5S_sel_iter_t *)H5I_object_verify(sel_iter_id, H5I_SPACE_SEL_ITER)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a dataspace selection iterator")
+
+    *nrun = 0;
+    *nelem = 0;
+    if(sel_iter->elmt_left > 0)
+        if((ret_value = H5S_select_iter_get_run_list(sel_iter, maxrun, maxelem, nrun, nelem, run)) < 0)
+            HGOTO_ERROR(H5E_DATASPACE, H5E_CANTGET, FAIL, "unable to get selection run list")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5S__sel_iter_get_run_list_test() */
@@ -50,6 +50,15 @@
 
 #define H5T_ENCODE_VERSION      0
 
+/* Number of entries in the table of recently found conversion paths (power of two) */
+#define H5T_PATH_CACHE_SIZE     256
+
+/* Fold a value into a datatype fingerprint */
+#define H5T_FP_MIX(H, V) do {                                                 \
+    (H) = ((H) ^ (uint64_t)(V)) * (uint64_t)0x100000001b3ULL;                 \
+    (H) ^= (H) >> 29;                                                         \
+} while(0)
+
 /*
  * Type initialization macros
  *
@@ -284,6 +293,13 @@
 /* Local Typedefs */
 /******************/
 
+/* Entry in the table of recently found conversion paths */
+typedef struct H5T_path_cache_t {
+    uint64_t       src_fp;        /*fingerprint of source datatype        */
+    uint64_t       dst_fp;        /*fingerprint of destination datatype   */
+    H5T_path_t    *path;          /*path found for the datatypes          */
+} H5T_path_cache_t;
+
 
 /********************/
 /* Local Prototypes */
@@ -295,6 +311,8 @@ static htri_t H5T__compiler_conv(H5T_t *src, H5T_t *dst);
 static herr_t H5T__set_size(H5T_t *dt, size_t size);
 static herr_t H5T__close_cb(H5T_t *dt);
 static H5T_path_t *H5T__path_find_real(const H5T_t *src, const H5T_t *dst, const char *name, H5T_conv_func_t *conv);
+static uint64_t H5T__fingerprint(const H5T_t *dt);
+static void H5T__path_cache_reset(void);
 static hbool_t H5T__detect_reg_ref(const H5T_t *dt);
 
 
@@ -524,6 +542,19 @@ const unsigned H5O_dtype_ver_bounds[] = {
 /*
  * The path database. Each path has a source and destination data type pair
  * which is used as the key by which the `entries' array is sorted.
+ *
+ * Lookups go through two caches before searching the array.  The `mru'
+ * slot remembers the last path found for a pair of datatypes which can't
+ * change (read-only or immutable, with no variable-length or reference
+ * parts), and is matched by pointer.  The `cache' table is indexed by the
+ * fingerprints of the two datatypes, and a hit is confirmed by comparing
+ * the datatypes with those of the path.  Both caches are cleared whenever
+ * a path is replaced or removed.  (Under the thread-safe build the whole
+ * library is serialized, so a single MRU slot serves every thread.)
+ *
+ * Dataset reads that let other threads into the library while they wait
+ * on the file keep using their conversion paths afterwards, so paths
+ * can't be replaced or removed while `nconcurrent_reads' is non-zero.
  */
 static struct {
     int            npaths;        /*number of paths defined               */
@@ -532,6 +563,11 @@ static struct {
     int            nsoft;         /*number of soft conversions defined    */
     size_t         asoft;         /*number of soft conversions allocated  */
     H5T_soft_t    *soft;          /*unsorted array of soft conversions    */
+    H5T_path_cache_t cache[H5T_PATH_CACHE_SIZE]; /*paths by fingerprint   */
+    const H5T_shared_t *mru_src;  /*source of the most recent path        */
+    const H5T_shared_t *mru_dst;  /*destination of the most recent path   */
+    H5T_path_t    *mru_path;      /*most recently found path              */
+    unsigned       nconcurrent_reads; /*reads holding paths without the lock */
 } H5T_g;
 
 /* Declare the free list for H5T_path_t's */
@@ -1418,6 +1454,7 @@ H5T_top_term_package(void)
             } /* end for */
 
             /* Clear conversion tables */
+            H5T__path_cache_reset();
             H5T_g.path = (H5T_path_t **)H5MM_xfree(H5T_g.path);
             H5T_g.npaths = 0;
             H5T_g.apaths = 0;
@@ -2475,6 +2512,7 @@ H5T__register(H5T_pers_t pers, const char *name, H5T_t *src, H5T_t *dst,
             /* Replace previous path */
             H5T_g.path[i] = new_path;
             new_path = NULL; /*so we don't free it on error*/
+            H5T__path_cache_reset();
 
             /* Free old path */
             H5T__print_stats(old_path, &nprint);
@@ -2574,6 +2612,10 @@ H5Tregister(H5T_pers_t pers, const char *name, hid_t src_id, hid_t dst_id,
     if(!func)
         HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "no conversion function specified")
 
+    /* Paths in use by reads in other threads can't be replaced */
+    if(H5T_g.nconcurrent_reads > 0)
+        HGOTO_ERROR(H5E_DATATYPE, H5E_CANTREGISTER, FAIL, "can't register conversion function, reads are in progress in other threads")
+
     /* Set up conversion function wrapper */
     conv_func.is_app = TRUE;
     conv_func.u.app_func = func;
@@ -2657,6 +2699,7 @@ H5T__unregister(H5T_pers_t pers, const char *name, H5T_t *src, H5T_t *dst,
             /* Remove from table */
             HDmemmove(H5T_g.path + i, H5T_g.path + i + 1, (size_t)(H5T_g.npaths - (i + 1)) * sizeof(H5T_path_t*));
             --H5T_g.npaths;
+            H5T__path_cache_reset();
 
             /* Shut down path */
             H5T__print_stats(path, &nprint);
@@ -2723,6 +2766,10 @@ H5Tunregister(H5T_pers_t pers, const char *name, hid_t src_id, hid_t dst_id,
     if(dst_id > 0 && (NULL == (dst = (H5T_t *)H5I_object_verify(dst_id, H5I_DATATYPE))))
         HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "dst is not a data type")
 
+    /* Paths in use by reads in other threads can't be removed */
+    if(H5T_g.nconcurrent_reads > 0)
+        HGOTO_ERROR(H5E_DATATYPE, H5E_CANTDELETE, FAIL, "can't unregister conversion function, reads are in progress in other threads")
+
     if(H5T__unregister(pers, name, src, dst, func) < 0)
         HGOTO_ERROR(H5E_DATATYPE, H5E_CANTDELETE, FAIL, "internal unregister function failed")
 
@@ -3253,6 +3300,7 @@ H5T_copy(H5T_t *old_dt, H5T_copy_t method)
 
     /* Copy shared information (entry information is copied last) */
     *(new_dt->shared) = *(old_dt->shared);
+    new_dt->shared->fp_valid = FALSE;
 
     /* No VOL object */
     new_dt->vol_obj = NULL;
@@ -3634,6 +3682,12 @@ H5T__free(H5T_t *dt)
     if(H5T_STATE_IMMUTABLE == dt->shared->state)
         HGOTO_ERROR(H5E_DATATYPE, H5E_CLOSEERROR, FAIL, "unable to close immutable datatype")
 
+    /* Forget the most recent conversion path, if it was found for this datatype */
+    if(H5T_g.mru_src == dt->shared || H5T_g.mru_dst == dt->shared) {
+        H5T_g.mru_src = H5T_g.mru_dst = NULL;
+        H5T_g.mru_path = NULL;
+    } /* end if */
+
     /* Close the datatype */
     switch(dt->shared->type) {
         case H5T_COMPOUND:
@@ -4549,6 +4603,175 @@ done:
 } /* end H5T_path_find() */
 
 
+/*-------------------------------------------------------------------------
+ * Function:    H5T__fingerprint
+ *
+ * Purpose:     Computes a fingerprint of a datatype for conversion path
+ *              lookups.  The fingerprint only covers properties which
+ *              H5T_cmp() always compares, so datatypes which compare as
+ *              equal (with or without the "superset" option) have the same
+ *              fingerprint, and datatypes with different fingerprints
+ *              never compare as equal.
+ *
+ *              The fingerprint is cached in datatypes which can't change:
+ *              read-only or immutable ones, without variable-length or
+ *              reference parts.  It is computed again for other datatypes.
+ *
+ * Return:      The fingerprint (can't fail)
+ *
+ *-------------------------------------------------------------------------
+ */
+static uint64_t
+H5T__fingerprint(const H5T_t *dt)
+{
+    H5T_shared_t *shared = dt->shared;  /* Shared datatype info */
+    uint64_t    fp = (uint64_t)0xcbf29ce484222325ULL;  /* Fingerprint */
+    unsigned    u;                      /* Local index variable */
+    uint64_t    ret_value = 0;          /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    if(shared->fp_valid)
+        HGOTO_DONE(shared->fp)
+
+    H5T_FP_MIX(fp, shared->type);
+    H5T_FP_MIX(fp, shared->size);
+    if(shared->parent)
+        H5T_FP_MIX(fp, H5T__fingerprint(shared->parent));
+
+    switch(shared->type) {
+        case H5T_COMPOUND:
+            {
+                uint64_t sum = 0;       /* Sum of the member fingerprints, which doesn't depend on member order */
+
+                H5T_FP_MIX(fp, shared->u.compnd.nmembs);
+                for(u = 0; u < shared->u.compnd.nmembs; u++) {
+                    const H5T_cmemb_t *memb = &shared->u.compnd.memb[u];
+                    uint64_t mfp = (uint64_t)H5_hash_string(memb->name);
+
+                    H5T_FP_MIX(mfp, memb->offset);
+                    H5T_FP_MIX(mfp, memb->size);
+                    H5T_FP_MIX(mfp, H5T__fingerprint(memb->type));
+                    sum += mfp;
+                } /* end for */
+                H5T_FP_MIX(fp, sum);
+            }
+            break;
+
+        case H5T_ENUM:
+            /* The number of members isn't compared by "superset" comparisons */
+            break;
+
+        case H5T_VLEN:
+            H5T_FP_MIX(fp, shared->u.vlen.type);
+            break;
+
+        case H5T_OPAQUE:
+            /* Tags are only compared when both datatypes have one */
+            break;
+
+        case H5T_ARRAY:
+            H5T_FP_MIX(fp, shared->u.array.ndims);
+            for(u = 0; u < shared->u.array.ndims; u++)
+                H5T_FP_MIX(fp, shared->u.array.dim[u]);
+            break;
+
+        case H5T_NO_CLASS:
+        case H5T_INTEGER:
+        case H5T_FLOAT:
+        case H5T_TIME:
+        case H5T_STRING:
+        case H5T_BITFIELD:
+        case H5T_REFERENCE:
+        case H5T_NCLASSES:
+        default:
+            H5T_FP_MIX(fp, shared->u.atomic.order);
+            H5T_FP_MIX(fp, shared->u.atomic.prec);
+            H5T_FP_MIX(fp, shared->u.atomic.offset);
+            H5T_FP_MIX(fp, shared->u.atomic.lsb_pad);
+            H5T_FP_MIX(fp, shared->u.atomic.msb_pad);
+            break;
+    } /* end switch */
+
+    /* Cache the fingerprint, if the datatype can't change */
+    if((H5T_STATE_RDONLY == shared->state || H5T_STATE_IMMUTABLE == shared->state) && !shared->force_conv) {
+        shared->fp = fp;
+        shared->fp_valid = TRUE;
+    } /* end if */
+
+    ret_value = fp;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5T__fingerprint() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5T__path_cache_reset
+ *
+ * Purpose:     Forgets the recently found conversion paths, when a path is
+ *              replaced or removed from the path table.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5T__path_cache_reset(void)
+{
+    FUNC_ENTER_STATIC_NOERR
+
+    HDmemset(H5T_g.cache, 0, sizeof(H5T_g.cache));
+    H5T_g.mru_src = H5T_g.mru_dst = NULL;
+    H5T_g.mru_path = NULL;
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5T__path_cache_reset() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5T_incr_nconcurrent_reads
+ *
+ * Purpose:     Increment the number of dataset reads that may use
+ *              conversion paths after letting other threads into the
+ *              library.  No paths are replaced or removed until the
+ *              count drops back to zero.
+ *
+ * Return:      The number of such reads, after the increment
+ *
+ *-------------------------------------------------------------------------
+ */
+unsigned
+H5T_incr_nconcurrent_reads(void)
+{
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    FUNC_LEAVE_NOAPI(++H5T_g.nconcurrent_reads)
+} /* end H5T_incr_nconcurrent_reads() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5T_decr_nconcurrent_reads
+ *
+ * Purpose:     Decrement the number of dataset reads that may use
+ *              conversion paths after letting other threads into the
+ *              library.
+ *
+ * Return:      The number of such reads, after the decrement
+ *
+ *-------------------------------------------------------------------------
+ */
+unsigned
+H5T_decr_nconcurrent_reads(void)
+{
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    HDassert(H5T_g.nconcurrent_reads > 0);
+
+    FUNC_LEAVE_NOAPI(--H5T_g.nconcurrent_reads)
+} /* end H5T_decr_nconcurrent_reads() */
+
+
 /*-------------------------------------------------------------------------
  * Function:    H5T__path_find_real
  *
@@ -4588,6 +4811,8 @@ H5T__path_find_real(const H5T_t *src, const H5T_t *dst, const char *name,
     hid_t         src_id = -1, dst_id = -1;    /* src and dst type identifiers */
     int           i;                           /* counter */
     int           nprint = 0;                  /* lines of output printed */
+    uint64_t      src_fp, dst_fp;              /* fingerprints of the datatypes */
+    H5T_path_cache_t *ent;                     /* entry in the table of recent paths */
     H5T_path_t    *ret_value = NULL;           /* Return value */
 
     FUNC_ENTER_STATIC
@@ -4598,6 +4823,22 @@ H5T__path_find_real(const H5T_t *src, const H5T_t *dst, const char *name,
     HDassert(dst);
     HDassert(dst->shared);
 
+    /* Check the most recently found path, for datatypes which can't change */
+    if(!conv->u.app_func && H5T_g.mru_path && H5T_g.mru_src == src->shared && H5T_g.mru_dst == dst->shared)
+        HGOTO_DONE(H5T_g.mru_path)
+
+    /* Look for the path in the table of recent paths */
+    src_fp = H5T__fingerprint(src);
+    dst_fp = H5T__fingerprint(dst);
+    ent = &H5T_g.cache[(src_fp ^ (dst_fp * (uint64_t)0x9e3779b97f4a7c15ULL)) & (H5T_PATH_CACHE_SIZE - 1)];
+    if(!conv->u.app_func && ent->path && ent->src_fp == src_fp && ent->dst_fp == dst_fp &&
+            src->shared->force_conv == ent->path->src->shared->force_conv &&
+            dst->shared->force_conv == ent->path->dst->shared->force_conv &&
+            0 == H5T_cmp(src, ent->path->src, FALSE) && 0 == H5T_cmp(dst, ent->path->dst, FALSE)) {
+        table = ent->path;
+        HGOTO_DONE(table)
+    } /* end if */
+
     /*
      * Make sure the first entry in the table is the no-op conversion path.
      */
@@ -4628,9 +4869,11 @@ H5T__path_find_real(const H5T_t *src, const H5T_t *dst, const char *name,
      *
      * Quincey Koziol, 2 July, 1999
      * Only allow the no-op conversion to occur if no "force conversion" flags
-     * are set
+     * are set.  Datatypes with different fingerprints can't be equal, so
+     * don't compare them.
      */
-    if(src->shared->force_conv == FALSE && dst->shared->force_conv == FALSE && 0 == H5T_cmp(src, dst, TRUE)) {
+    if(src->shared->force_conv == FALSE && dst->shared->force_conv == FALSE &&
+            src_fp == dst_fp && 0 == H5T_cmp(src, dst, TRUE)) {
         table = H5T_g.path[0];
         cmp = 0;
         md = 0;
@@ -4811,6 +5054,7 @@ H5T__path_find_real(const H5T_t *src, const H5T_t *dst, const char *name,
         table = H5FL_FREE(H5T_path_t, table);
         table = path;
         H5T_g.path[md] = path;
+        H5T__path_cache_reset();
     } /* end if */
     else if(path != table) {
         HDassert(cmp);
@@ -4836,6 +5080,20 @@ H5T__path_find_real(const H5T_t *src, const H5T_t *dst, const char *name,
     if(H5T_COMPOUND == H5T_get_class(src, TRUE) && H5T_COMPOUND == H5T_get_class(dst, TRUE))
         path->are_compounds = TRUE;
 
+    /* Remember the path for later lookups of the same datatypes (the no-op
+     * path has no datatypes to compare with, so it's only remembered by
+     * pointer) */
+    if(path->src && path->dst) {
+        ent->src_fp = src_fp;
+        ent->dst_fp = dst_fp;
+        ent->path = path;
+    } /* end if */
+    if(src->shared->fp_valid && dst->shared->fp_valid) {
+        H5T_g.mru_src = src->shared;
+        H5T_g.mru_dst = dst->shared;
+        H5T_g.mru_path = path;
+    } /* end if */
+
     /* Set return value */
     ret_value = path;
 
@@ -5003,6 +5261,8 @@ H5T_convert(H5T_path_t *tpath, hid_t src_id, hid_t dst_id, size_t nelmts,
 #ifdef H5T_DEBUG
     H5_timer_t        timer;
 #endif
+    H5F_prof_t *prof;                   /* Profiling counters for the file, if any */
+    double start = 0.0;                 /* Time the conversion started */
     herr_t ret_value = SUCCEED;         /* Return value */
 
     FUNC_ENTER_NOAPI(FAIL)
@@ -5011,6 +5271,8 @@ H5T_convert(H5T_path_t *tpath, hid_t src_id, hid_t dst_id, size_t nelmts,
     if(H5DEBUG(T))
         H5_timer_begin(&timer);
 #endif
+    if(NULL != (prof = H5CX_get_prof()))
+        start = H5_get_time();
     tpath->cdata.command = H5T_CONV_CONV;
     if(tpath->conv.is_app) {
         if((tpath->conv.u.app_func)(src_id, dst_id, &(tpath->cdata), nelmts, buf_stride, bkg_stride, buf, bkg, H5CX_get_dxpl()) < 0)
@@ -5019,6 +5281,8 @@ H5T_convert(H5T_path_t *tpath, hid_t src_id, hid_t dst_id, size_t nelmts,
     else
         if((tpath->conv.u.lib_func)(src_id, dst_id, &(tpath->cdata), nelmts, buf_stride, bkg_stride, buf, bkg) < 0)
             HGOTO_ERROR(H5E_DATATYPE, H5E_CANTCONVERT, FAIL, "datatype conversion failed")
+    if(prof)
+        H5F_prof_conv(prof, tpath->name, H5_get_time() - start);
 #ifdef H5T_DEBUG
     if(H5DEBUG(T)) {
         H5_timer_end(&(tpath->stats.timer), &timer);
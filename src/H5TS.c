@@ -218,6 +218,55 @@ H5TS_mutex_unlock(H5TS_mutex_t *mutex)
 #endif /* H5_HAVE_WIN_THREADS */
 } /* H5TS_mutex_unlock */
 
+
+/*--------------------------------------------------------------------------
+ * NAME
+ *    H5TS_mutex_try_release
+ *
+ * USAGE
+ *    released = H5TS_mutex_try_release(&mutex_var)
+ *
+ * RETURNS
+ *    TRUE if the lock was released, FALSE if it is still held.
+ *
+ * DESCRIPTION
+ *    Releases a recursive lock held by the calling thread, but only when
+ *    the thread holds it exactly once.  Used to let other threads into
+ *    the library while this one waits on something that doesn't touch
+ *    library state.  A lock held recursively is kept, since the outer
+ *    acquisition may be protecting state the caller knows nothing about.
+ *    The lock is taken back with H5TS_mutex_lock().
+ *
+ *    Always returns FALSE with Windows threads.
+ *
+ *--------------------------------------------------------------------------
+ */
+hbool_t
+H5TS_mutex_try_release(H5TS_mutex_t *mutex)
+{
+#ifdef  H5_HAVE_WIN_THREADS
+    (void)mutex;
+    return FALSE;
+#else  /* H5_HAVE_WIN_THREADS */
+    hbool_t released = FALSE;
+
+    if(pthread_mutex_lock(&mutex->atomic_lock))
+        return FALSE;
+
+    if(1 == mutex->lock_count && pthread_equal(HDpthread_self(), mutex->owner_thread)) {
+        mutex->lock_count = 0;
+        released = TRUE;
+    } /* end if */
+
+    pthread_mutex_unlock(&mutex->atomic_lock);
+
+    if(released)
+        pthread_cond_signal(&mutex->cond_var);
+
+    return released;
+#endif /* H5_HAVE_WIN_THREADS */
+} /* H5TS_mutex_try_release */
+
 
 /*--------------------------------------------------------------------------
  * NAME
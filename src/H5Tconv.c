@@ -955,6 +955,9 @@ done:                                                                         \
 /* Minimum size of variable-length conversion buffer */
 #define H5T_VLEN_MIN_CONF_BUF_SIZE      4096
 
+/* Largest number of runs an array member of a compound is flattened into */
+#define H5T_CONV_STRUCT_MAX_ARRAY_RUNS  256
+
 /******************/
 /* Local Typedefs */
 /******************/
@@ -967,6 +970,11 @@ typedef struct H5T_conv_struct_t {
     H5T_path_t	**memb_path;		/*conversion path for each member    */
     H5T_subset_info_t   subset_info;    /*info related to compound subsets   */
     unsigned            src_nmembs;     /*needed by free function            */
+    H5T_subset_run_t    *run;           /*runs copied without conversion     */
+    size_t              nruns;          /*number of runs                     */
+    size_t              nalloc_runs;    /*number of runs allocated           */
+    hbool_t             *memb_copied;   /*whether a src member is in the runs*/
+    hbool_t             copy_only;      /*whether all members are in the runs*/
 } H5T_conv_struct_t;
 
 /* Conversion data for H5T__conv_enum() */
@@ -992,6 +1000,14 @@ typedef struct H5T_conv_hw_t {
 /********************/
 
 static herr_t H5T_reverse_order(uint8_t *rev, uint8_t *s, size_t size, H5T_order_t order);
+static herr_t H5T_conv_struct_add_run(H5T_conv_struct_t *priv, size_t src_off,
+    size_t dst_off, size_t len);
+static const H5T_conv_struct_t *H5T_conv_struct_copy_plan(const H5T_path_t *tpath);
+static herr_t H5T_conv_struct_plan(const H5T_t *src, const H5T_t *dst,
+    H5T_conv_struct_t *priv);
+static herr_t H5T_conv_struct_copy_runs(const H5T_conv_struct_t *priv,
+    const H5T_t *src, const H5T_t *dst, size_t nelmts, size_t buf_stride,
+    size_t bkg_stride, uint8_t *buf, uint8_t *bkg);
 
 
 /*********************/
@@ -1019,6 +1035,9 @@ H5FL_BLK_DEFINE_STATIC(vlen_seq);
 /* Declare a free list to manage pieces of array data */
 H5FL_BLK_DEFINE_STATIC(array_seq);
 
+/* Declare a free list to manage single compound elements */
+H5FL_BLK_DEFINE_STATIC(struct_elmt);
+
 
 /*-------------------------------------------------------------------------
  * Function:	H5T__conv_noop
@@ -1858,11 +1877,273 @@ H5T_conv_struct_free(H5T_conv_struct_t *priv)
     H5MM_xfree(src_memb_id);
     H5MM_xfree(dst_memb_id);
     H5MM_xfree(priv->memb_path);
+    H5MM_xfree(priv->run);
+    H5MM_xfree(priv->memb_copied);
 
     FUNC_LEAVE_NOAPI((H5T_conv_struct_t *)H5MM_xfree(priv))
 } /* end H5T_conv_struct_free() */
 
 
+/*-------------------------------------------------------------------------
+ * Function:	H5T_conv_struct_add_run
+ *
+ * Purpose:	Appends a run of bytes to the copy plan of a compound
+ *		conversion, merging it with the previous run when it
+ *		carries on from that run in both the source and the
+ *		destination.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5T_conv_struct_add_run(H5T_conv_struct_t *priv, size_t src_off, size_t dst_off,
+    size_t len)
+{
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    if(priv->nruns > 0) {
+        H5T_subset_run_t *prev = &priv->run[priv->nruns - 1];
+
+        if(prev->src_off + prev->len == src_off && prev->dst_off + prev->len == dst_off) {
+            prev->len += len;
+            HGOTO_DONE(SUCCEED)
+        } /* end if */
+    } /* end if */
+
+    if(priv->nruns == priv->nalloc_runs) {
+        size_t na = MAX(8, 2 * priv->nalloc_runs);
+        H5T_subset_run_t *x;
+
+        if(NULL == (x = (H5T_subset_run_t *)H5MM_realloc(priv->run, na * sizeof(H5T_subset_run_t))))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed")
+        priv->run = x;
+        priv->nalloc_runs = na;
+    } /* end if */
+
+    priv->run[priv->nruns].src_off = src_off;
+    priv->run[priv->nruns].dst_off = dst_off;
+    priv->run[priv->nruns].len = len;
+    priv->nruns++;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5T_conv_struct_add_run() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5T_conv_struct_copy_plan
+ *
+ * Purpose:	Checks if a conversion path is a compound conversion that
+ *		only copies bytes, so that its runs can be folded into the
+ *		plan of an enclosing compound.
+ *
+ * Return:	The private data of the path if it only copies bytes,
+ *		NULL otherwise
+ *
+ *-------------------------------------------------------------------------
+ */
+static const H5T_conv_struct_t *
+H5T_conv_struct_copy_plan(const H5T_path_t *tpath)
+{
+    const H5T_conv_struct_t *ret_value = NULL;  /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    if(tpath->are_compounds && !tpath->conv.is_app && !tpath->cdata.recalc &&
+            (tpath->conv.u.lib_func == H5T__conv_struct_opt || tpath->conv.u.lib_func == H5T__conv_struct)) {
+        const H5T_conv_struct_t *priv = (const H5T_conv_struct_t *)tpath->cdata.priv;
+
+        if(priv && priv->copy_only)
+            ret_value = priv;
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5T_conv_struct_copy_plan() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5T_conv_struct_plan
+ *
+ * Purpose:	Compiles the copy plan for a compound conversion: the runs
+ *		of bytes that move unchanged from a source element to a
+ *		destination element.  A member goes into the runs when it
+ *		needs no conversion, when it is a nested compound whose
+ *		own conversion only copies bytes, or when it is an array of
+ *		such compounds.  Members that need converting are left to
+ *		their member conversion paths.
+ *
+ *		The runs are built in source member order, and runs that
+ *		follow on from each other in both elements are merged.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5T_conv_struct_plan(const H5T_t *src, const H5T_t *dst, H5T_conv_struct_t *priv)
+{
+    unsigned    u;                      /* Local index variable */
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    /* Reset any previous plan */
+    priv->nruns = 0;
+    priv->memb_copied = (hbool_t *)H5MM_xfree(priv->memb_copied);
+    if(NULL == (priv->memb_copied = (hbool_t *)H5MM_calloc(src->shared->u.compnd.nmembs * sizeof(hbool_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed")
+    priv->copy_only = TRUE;
+
+    for(u = 0; u < src->shared->u.compnd.nmembs; u++) {
+        const H5T_cmemb_t *src_memb;            /* Source member */
+        const H5T_cmemb_t *dst_memb;            /* Destination member */
+        const H5T_conv_struct_t *sub_priv;      /* Plan for a nested compound */
+        size_t k, r;                            /* Local index variables */
+
+        if(priv->src2dst[u] < 0)
+            continue;
+        src_memb = src->shared->u.compnd.memb + u;
+        dst_memb = dst->shared->u.compnd.memb + priv->src2dst[u];
+
+        if(priv->memb_path[u]->is_noop) {
+            /* Member is copied as is */
+            if(H5T_conv_struct_add_run(priv, src_memb->offset, dst_memb->offset, src_memb->size) < 0)
+                HGOTO_ERROR(H5E_DATATYPE, H5E_CANTINIT, FAIL, "unable to add copy run")
+            priv->memb_copied[u] = TRUE;
+        } /* end if */
+        else if(NULL != (sub_priv = H5T_conv_struct_copy_plan(priv->memb_path[u]))) {
+            /* Nested compound that only copies bytes */
+            for(r = 0; r < sub_priv->nruns; r++)
+                if(H5T_conv_struct_add_run(priv, src_memb->offset + sub_priv->run[r].src_off,
+                        dst_memb->offset + sub_priv->run[r].dst_off, sub_priv->run[r].len) < 0)
+                    HGOTO_ERROR(H5E_DATATYPE, H5E_CANTINIT, FAIL, "unable to add copy run")
+            priv->memb_copied[u] = TRUE;
+        } /* end if */
+        else if(H5T_ARRAY == src_memb->type->shared->type && H5T_ARRAY == dst_memb->type->shared->type &&
+                src_memb->type->shared->u.array.nelem == dst_memb->type->shared->u.array.nelem) {
+            H5T_t *src_base = src_memb->type->shared->parent;   /* Source array base type */
+            H5T_t *dst_base = dst_memb->type->shared->parent;   /* Destination array base type */
+            size_t nelem = src_memb->type->shared->u.array.nelem;
+            H5T_path_t *base_path;                              /* Path between the base types */
+
+            /* Array of elements that need no conversion, or of compounds that only copy bytes */
+            if(NULL == (base_path = H5T_path_find(src_base, dst_base)))
+                HGOTO_ERROR(H5E_DATATYPE, H5E_UNSUPPORTED, FAIL, "unable to convert array base datatype")
+            if(base_path->is_noop) {
+                if(H5T_conv_struct_add_run(priv, src_memb->offset, dst_memb->offset, src_memb->size) < 0)
+                    HGOTO_ERROR(H5E_DATATYPE, H5E_CANTINIT, FAIL, "unable to add copy run")
+                priv->memb_copied[u] = TRUE;
+            } /* end if */
+            else if(NULL != (sub_priv = H5T_conv_struct_copy_plan(base_path)) &&
+                    nelem * sub_priv->nruns <= H5T_CONV_STRUCT_MAX_ARRAY_RUNS) {
+                for(k = 0; k < nelem; k++)
+                    for(r = 0; r < sub_priv->nruns; r++)
+                        if(H5T_conv_struct_add_run(priv,
+                                src_memb->offset + k * src_base->shared->size + sub_priv->run[r].src_off,
+                                dst_memb->offset + k * dst_base->shared->size + sub_priv->run[r].dst_off,
+                                sub_priv->run[r].len) < 0)
+                            HGOTO_ERROR(H5E_DATATYPE, H5E_CANTINIT, FAIL, "unable to add copy run")
+                priv->memb_copied[u] = TRUE;
+            } /* end if */
+            else
+                priv->copy_only = FALSE;
+        } /* end if */
+        else
+            priv->copy_only = FALSE;
+    } /* end for */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5T_conv_struct_plan() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5T_conv_struct_copy_runs
+ *
+ * Purpose:	Converts between compound datatypes whose members all need
+ *		no conversion, by copying the runs of the copy plan for
+ *		each element.
+ *
+ *		With a background buffer the runs are copied into BKG,
+ *		which is then copied back to BUF.  Without one the runs
+ *		cover the whole destination element, and each element is
+ *		converted in place through a copy of the source element,
+ *		working from the end of the buffer when the destination is
+ *		larger so that no source element is overwritten before it
+ *		is read.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5T_conv_struct_copy_runs(const H5T_conv_struct_t *priv, const H5T_t *src,
+    const H5T_t *dst, size_t nelmts, size_t buf_stride, size_t bkg_stride,
+    uint8_t *buf, uint8_t *bkg)
+{
+    const H5T_subset_run_t *run = priv->run;    /* Runs to copy */
+    size_t      nruns = priv->nruns;            /* Number of runs to copy */
+    uint8_t     *elmt = NULL;                   /* Copy of one source element */
+    size_t      elmtno;                         /* Element counter */
+    size_t      r;                              /* Local index variable */
+    herr_t      ret_value = SUCCEED;            /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    HDassert(priv->copy_only);
+
+    if(bkg) {
+        uint8_t *xbuf, *xbkg;               /* Pointers into the buffers */
+        size_t src_stride = buf_stride ? buf_stride : src->shared->size;
+        size_t dst_stride = buf_stride ? buf_stride : dst->shared->size;
+
+        if(!buf_stride || !bkg_stride)
+            bkg_stride = dst->shared->size;
+
+        /* Copy the runs of each element into the background buffer */
+        for(xbuf = buf, xbkg = bkg, elmtno = 0; elmtno < nelmts; elmtno++) {
+            for(r = 0; r < nruns; r++)
+                H5MM_memcpy(xbkg + run[r].dst_off, xbuf + run[r].src_off, run[r].len);
+            xbuf += src_stride;
+            xbkg += bkg_stride;
+        } /* end for */
+
+        /* Move background buffer into result buffer */
+        for(xbuf = buf, xbkg = bkg, elmtno = 0; elmtno < nelmts; elmtno++) {
+            HDmemmove(xbuf, xbkg, dst->shared->size);
+            xbuf += dst_stride;
+            xbkg += bkg_stride;
+        } /* end for */
+    } /* end if */
+    else {
+        size_t src_stride = buf_stride ? buf_stride : src->shared->size;
+        size_t dst_stride = buf_stride ? buf_stride : dst->shared->size;
+        hbool_t backward = (hbool_t)(!buf_stride && dst->shared->size > src->shared->size);
+
+        if(NULL == (elmt = H5FL_BLK_MALLOC(struct_elmt, src->shared->size)))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for element buffer")
+
+        for(elmtno = 0; elmtno < nelmts; elmtno++) {
+            size_t idx = backward ? (nelmts - 1) - elmtno : elmtno;
+            uint8_t *xdst = buf + idx * dst_stride;
+
+            H5MM_memcpy(elmt, buf + idx * src_stride, src->shared->size);
+            for(r = 0; r < nruns; r++)
+                H5MM_memcpy(xdst + run[r].dst_off, elmt + run[r].src_off, run[r].len);
+        } /* end for */
+    } /* end else */
+
+done:
+    if(elmt)
+        elmt = H5FL_BLK_FREE(struct_elmt, elmt);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5T_conv_struct_copy_runs() */
+
+
 /*-------------------------------------------------------------------------
  * Function:	H5T_conv_struct_init
  *
@@ -2007,6 +2288,8 @@ H5T_conv_struct_init(H5T_t *src, H5T_t *dst, H5T_cdata_t *cdata)
     /* The compound conversion functions need a background buffer */
     cdata->need_bkg = H5T_BKG_YES;
 
+    priv->subset_info.subset = H5T_SUBSET_FALSE;
+    priv->subset_info.copy_size = 0;
     if(src_nmembs < dst_nmembs) {
         priv->subset_info.subset = H5T_SUBSET_SRC;
         for(i = 0; i < src_nmembs; i++) {
@@ -2047,6 +2330,33 @@ H5T_conv_struct_init(H5T_t *src, H5T_t *dst, H5T_cdata_t *cdata)
             * the case should have been handled as noop earlier in H5Dio.c. */
         {;}
 
+    /* Compile the runs of bytes which are copied without conversion */
+    if(H5T_conv_struct_plan(src, dst, priv) < 0) {
+        cdata->priv = H5T_conv_struct_free(priv);
+        HGOTO_ERROR(H5E_DATATYPE, H5E_CANTINIT, FAIL, "unable to compile compound conversion plan")
+    } /* end if */
+    priv->subset_info.nruns = priv->nruns;
+    priv->subset_info.run = priv->run;
+    if(priv->copy_only) {
+        size_t copied = 0;          /* Number of destination bytes copied */
+        size_t r;                   /* Local index variable */
+
+        /* Members are only copied, so the runs replace the member conversions */
+        if(priv->subset_info.subset == H5T_SUBSET_FALSE)
+            priv->subset_info.subset = H5T_SUBSET_RUNS;
+
+        /* No background buffer is needed when every destination byte is
+         * copied by the runs.  The subset optimizations still move the data
+         * through the background buffer, so they keep needing it.
+         */
+        if(priv->subset_info.subset == H5T_SUBSET_RUNS) {
+            for(r = 0; r < priv->nruns; r++)
+                copied += priv->run[r].len;
+            if(copied == dst->shared->size)
+                cdata->need_bkg = H5T_BKG_NO;
+        } /* end if */
+    } /* end if */
+
     cdata->recalc = FALSE;
 
 done:
@@ -2176,10 +2486,10 @@ H5T__conv_struct(hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata, size_t nelmts,
             if(NULL == (src = (H5T_t *)H5I_object(src_id)) || NULL == (dst = (H5T_t *)H5I_object(dst_id)))
                 HGOTO_ERROR(H5E_DATATYPE, H5E_BADTYPE, FAIL, "not a datatype")
             HDassert(priv);
-            HDassert(bkg && cdata->need_bkg);
 
             if(cdata->recalc && H5T_conv_struct_init(src, dst, cdata) < 0)
                 HGOTO_ERROR(H5E_DATATYPE, H5E_CANTINIT, FAIL, "unable to initialize conversion data")
+            HDassert(bkg || !cdata->need_bkg);
 
             /*
              * Insure that members are sorted.
@@ -2188,6 +2498,13 @@ H5T__conv_struct(hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata, size_t nelmts,
             H5T__sort_value(dst, NULL);
             src2dst = priv->src2dst;
 
+            /* Members which are only copied are moved by the runs of the copy plan */
+            if(priv->copy_only) {
+                if(H5T_conv_struct_copy_runs(priv, src, dst, nelmts, buf_stride, bkg_stride, buf, bkg) < 0)
+                    HGOTO_ERROR(H5E_DATATYPE, H5E_CANTCONVERT, FAIL, "unable to copy compound datatype members")
+                break;
+            } /* end if */
+
             /*
              * Direction of conversion and striding through background.
              */
@@ -2220,11 +2537,14 @@ H5T__conv_struct(hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata, size_t nelmts,
                  * it is larger than the source type.  Then move the member to the
                  * left-most unoccupied position in the buffer.  This makes the
                  * data point as small as possible with all the free space on the
-                 * right side.
+                 * right side.  Members in the copy plan are copied to the
+                 * background buffer first, before they can be overwritten.
                  */
+                for(u = 0; u < priv->nruns; u++)
+                    HDmemmove(xbkg + priv->run[u].dst_off, xbuf + priv->run[u].src_off, priv->run[u].len);
                 for(u = 0, offset = 0; u < src->shared->u.compnd.nmembs; u++) {
-                    if(src2dst[u] < 0)
-                        continue; /*subsetting*/
+                    if(src2dst[u] < 0 || priv->memb_copied[u])
+                        continue; /*subsetting or copied*/
                     src_memb = src->shared->u.compnd.memb + u;
                     dst_memb = dst->shared->u.compnd.memb + src2dst[u];
 
@@ -2253,8 +2573,8 @@ H5T__conv_struct(hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata, size_t nelmts,
                  */
                 H5_CHECK_OVERFLOW(src->shared->u.compnd.nmembs, size_t, int);
                 for(i = (int)src->shared->u.compnd.nmembs - 1; i >= 0; --i) {
-                    if(src2dst[i] < 0)
-                        continue; /*subsetting*/
+                    if(src2dst[i] < 0 || priv->memb_copied[i])
+                        continue; /*subsetting or copied*/
                     src_memb = src->shared->u.compnd.memb + i;
                     dst_memb = dst->shared->u.compnd.memb + src2dst[i];
 
@@ -2448,7 +2768,14 @@ H5T__conv_struct_opt(hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata,
             priv = (H5T_conv_struct_t *)(cdata->priv);
             HDassert(priv);
             src2dst = priv->src2dst;
-            HDassert(bkg && cdata->need_bkg);
+            HDassert(bkg || !cdata->need_bkg);
+
+            /* Members which are only copied are moved by the runs of the copy plan */
+            if(priv->copy_only && priv->subset_info.subset == H5T_SUBSET_RUNS) {
+                if(H5T_conv_struct_copy_runs(priv, src, dst, nelmts, buf_stride, bkg_stride, buf, bkg) < 0)
+                    HGOTO_ERROR(H5E_DATATYPE, H5E_CANTCONVERT, FAIL, "unable to copy compound datatype members")
+                break;
+            } /* end if */
 
             /*
              * Insure that members are sorted.
@@ -2495,11 +2822,20 @@ H5T__conv_struct_opt(hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata,
                  * source, stride through all the elements converting only that member
                  * in each element and then copying the element to its final
                  * destination in the bkg buffer. Otherwise move the element as far
-                 * left as possible in the buffer.
+                 * left as possible in the buffer.  Members in the copy plan are
+                 * copied to the background buffer first, before they can be
+                 * overwritten.
                  */
+                if(priv->nruns > 0)
+                    for(xbuf = buf, xbkg = bkg, elmtno = 0; elmtno < nelmts; elmtno++) {
+                        for(u = 0; u < priv->nruns; u++)
+                            HDmemmove(xbkg + priv->run[u].dst_off, xbuf + priv->run[u].src_off, priv->run[u].len);
+                        xbuf += buf_stride;
+                        xbkg += bkg_stride;
+                    } /* end for */
                 for(u = 0, offset = 0; u < src->shared->u.compnd.nmembs; u++) {
-                    if(src2dst[u] < 0)
-                        continue; /*subsetting*/
+                    if(src2dst[u] < 0 || priv->memb_copied[u])
+                        continue; /*subsetting or copied*/
                     src_memb = src->shared->u.compnd.memb + u;
                     dst_memb = dst->shared->u.compnd.memb + src2dst[u];
 
@@ -2533,7 +2869,7 @@ H5T__conv_struct_opt(hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata,
                  */
                 H5_CHECK_OVERFLOW(src->shared->u.compnd.nmembs, size_t, int);
                 for(i = (int)src->shared->u.compnd.nmembs - 1; i >= 0; --i) {
-                    if(src2dst[i] < 0)
+                    if(src2dst[i] < 0 || priv->memb_copied[i])
                         continue;
                     src_memb = src->shared->u.compnd.memb + i;
                     dst_memb = dst->shared->u.compnd.memb + src2dst[i];
@@ -3037,6 +3373,7 @@ H5T__conv_vlen(hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata, size_t nelmts,
     void	*tmp_buf = NULL;     	/*temporary background buffer 	     */
     size_t	tmp_buf_size = 0;	/*size of temporary bkg buffer	     */
     hbool_t     nested = FALSE;         /*flag of nested VL case             */
+    H5HG_cursor_t hg_cursor = H5HG_CURSOR_INIT; /*global heap cursor for the sequences */
     size_t	elmtno;			/*element number counter	     */
     herr_t      ret_value = SUCCEED;    /* Return value */
 
@@ -3138,6 +3475,25 @@ H5T__conv_vlen(hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata, size_t nelmts,
             if(write_to_file && parent_is_vlen && bkg != NULL)
                 nested = TRUE;
 
+            /* Tell the global heap how much is about to be written, so the
+             * sequences are packed into as few collections as possible */
+            if(write_to_file) {
+                size_t nseqs = 0;       /* Number of non-nil sequences */
+                size_t nbytes = 0;      /* Total size of the sequences */
+
+                for(elmtno = 0, s = (uint8_t *)buf; elmtno < nelmts; elmtno++, s += s_stride)
+                    if(!(*(src->shared->u.vlen.isnull))(src->shared->u.vlen.f, s)) {
+                        ssize_t sseq_len;   /* The number of elements in the sequence */
+
+                        if((sseq_len = (*(src->shared->u.vlen.getlen))(s)) < 0)
+                            HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "incorrect length")
+                        nseqs++;
+                        nbytes += (size_t)sseq_len * dst_base_size;
+                    } /* end if */
+                if(H5HG_cursor_reserve(dst->shared->u.vlen.f, &hg_cursor, nseqs, nbytes) < 0)
+                    HGOTO_ERROR(H5E_DATATYPE, H5E_CANTINIT, FAIL, "can't reserve global heap space")
+            } /* end if */
+
             /* The outer loop of the type conversion macro, controlling which */
             /* direction the buffer is walked */
             while(nelmts > 0) {
@@ -3223,7 +3579,7 @@ H5T__conv_vlen(hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata, size_t nelmts,
                             } /* end if */
 
                             /* Read in VL sequence */
-                            if((*(src->shared->u.vlen.read))(src->shared->u.vlen.f, s, conv_buf, src_size) < 0)
+                            if((*(src->shared->u.vlen.read))(src->shared->u.vlen.f, &hg_cursor, s, conv_buf, src_size) < 0)
                                 HGOTO_ERROR(H5E_DATATYPE, H5E_READERROR, FAIL, "can't read VL data")
                         } /* end else */
 
@@ -3268,7 +3624,7 @@ H5T__conv_vlen(hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata, size_t nelmts,
                         } /* end if */
 
                         /* Write sequence to destination location */
-                        if((*(dst->shared->u.vlen.write))(dst->shared->u.vlen.f, &vl_alloc_info, d, conv_buf, b, seq_len, dst_base_size) < 0)
+                        if((*(dst->shared->u.vlen.write))(dst->shared->u.vlen.f, &hg_cursor, &vl_alloc_info, d, conv_buf, b, seq_len, dst_base_size) < 0)
                             HGOTO_ERROR(H5E_DATATYPE, H5E_WRITEERROR, FAIL, "can't write VL data")
 
                         if(!noop_conv) {
@@ -3315,6 +3671,9 @@ H5T__conv_vlen(hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata, size_t nelmts,
     }   /* end switch */
 
 done:
+    /* Unpin the last global heap collection used */
+    if(H5HG_cursor_release(&hg_cursor) < 0)
+        HDONE_ERROR(H5E_DATATYPE, H5E_CANTUNPIN, FAIL, "can't release global heap cursor")
     /* If the conversion buffer doesn't need to be freed, reset its pointer */
     if(write_to_file && noop_conv)
         conv_buf = NULL;
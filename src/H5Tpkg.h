@@ -39,6 +39,7 @@
 /* Other private headers needed by this file */
 #include "H5Fprivate.h"		/* Files				*/
 #include "H5FLprivate.h"	/* Free Lists				*/
+#include "H5HGprivate.h"	/* Global Heaps				*/
 #include "H5Oprivate.h"		/* Object headers		  	*/
 
 /* Other public headers needed by this file */
@@ -247,8 +248,8 @@ typedef struct H5T_enum_t {
 typedef ssize_t (*H5T_vlen_getlenfunc_t)(const void *vl_addr);
 typedef void * (*H5T_vlen_getptrfunc_t)(void *vl_addr);
 typedef htri_t (*H5T_vlen_isnullfunc_t)(const H5F_t *f, void *vl_addr);
-typedef herr_t (*H5T_vlen_readfunc_t)(H5F_t *f, void *_vl, void *buf, size_t len);
-typedef herr_t (*H5T_vlen_writefunc_t)(H5F_t *f, const H5T_vlen_alloc_info_t *vl_alloc_info, void *_vl, void *buf, void *_bg, size_t seq_len, size_t base_size);
+typedef herr_t (*H5T_vlen_readfunc_t)(H5F_t *f, H5HG_cursor_t *hg_cursor, void *_vl, void *buf, size_t len);
+typedef herr_t (*H5T_vlen_writefunc_t)(H5F_t *f, H5HG_cursor_t *hg_cursor, const H5T_vlen_alloc_info_t *vl_alloc_info, void *_vl, void *buf, void *_bg, size_t seq_len, size_t base_size);
 typedef herr_t (*H5T_vlen_setnullfunc_t)(H5F_t *f, void *_vl, void *_bg);
 
 /* VL types */
@@ -303,6 +304,8 @@ typedef struct H5T_shared_t {
     size_t		size;	/*total size of an instance of this type     */
     unsigned            version;        /* Version of object header message to encode this object with */
     hbool_t		force_conv;/* Set if this type always needs to be converted and H5T__conv_noop cannot be called */
+    hbool_t             fp_valid;  /* Whether the fingerprint is cached      */
+    uint64_t            fp;        /* Cached fingerprint, for conversion path lookups */
     struct H5T_t	*parent;/*parent type for derived datatypes	     */
     union {
         H5T_atomic_t	atomic; /* an atomic datatype              */
@@ -75,6 +75,13 @@ typedef struct {
     void *free_info;            /* Free information */
 } H5T_vlen_alloc_info_t;
 
+/* VL arena information (H5D_XFER_VLEN_ARENA_NAME) */
+typedef struct {
+    void *buf;                  /* Application buffer to place VL data in */
+    size_t size;                /* Size of the buffer, in bytes */
+    size_t used;                /* Number of bytes handed out so far */
+} H5T_vlen_arena_t;
+
 /* Structure for conversion callback property */
 typedef struct H5T_conv_cb_t {
     H5T_conv_except_func_t      func;
@@ -90,12 +97,24 @@ typedef enum {
     H5T_SUBSET_FALSE = 0,       /* Source and destination aren't subset of each other */
     H5T_SUBSET_SRC,             /* Source is the subset of dest and no conversion is needed */
     H5T_SUBSET_DST,             /* Dest is the subset of source and no conversion is needed */
+    H5T_SUBSET_RUNS,            /* No conversion is needed, but members move, so the runs are copied */
     H5T_SUBSET_CAP              /* Must be the last value */
 } H5T_subset_t;
 
+/* A run of bytes copied unchanged from each source element to each
+ * destination element of a compound conversion.
+ */
+typedef struct H5T_subset_run_t {
+    size_t          src_off;    /* Offset of the run in the source element */
+    size_t          dst_off;    /* Offset of the run in the destination element */
+    size_t          len;        /* Length of the run, in bytes */
+} H5T_subset_run_t;
+
 typedef struct H5T_subset_info_t {
     H5T_subset_t    subset;     /* See above */
     size_t          copy_size;  /* Size in bytes, to copy for each element */
+    size_t          nruns;      /* Number of runs to copy for each element */
+    const H5T_subset_run_t *run;    /* Runs to copy, in source offset order */
 } H5T_subset_info_t;
 
 /* Forward declarations for prototype arguments */
@@ -125,6 +144,8 @@ H5_DLL htri_t H5T_is_named(const H5T_t *dt);
 H5_DLL herr_t H5T_convert_committed_datatype(H5T_t *dt, H5F_t *f);
 H5_DLL htri_t H5T_is_relocatable(const H5T_t *dt);
 H5_DLL H5T_path_t *H5T_path_find(const H5T_t *src, const H5T_t *dst);
+H5_DLL unsigned H5T_incr_nconcurrent_reads(void);
+H5_DLL unsigned H5T_decr_nconcurrent_reads(void);
 H5_DLL hbool_t H5T_path_noop(const H5T_path_t *p);
 H5_DLL H5T_bkg_t H5T_path_bkg(const H5T_path_t *p);
 H5_DLL H5T_subset_info_t *H5T_path_compound_subset(const H5T_path_t *p);
@@ -132,6 +153,8 @@ H5_DLL herr_t H5T_convert(H5T_path_t *tpath, hid_t src_id, hid_t dst_id,
     size_t nelmts, size_t buf_stride, size_t bkg_stride, void *buf, void *bkg);
 H5_DLL herr_t H5T_vlen_reclaim(void *elem, hid_t type_id, unsigned ndim, const hsize_t *point, void *_op_data);
 H5_DLL herr_t H5T_vlen_reclaim_elmt(void *elem, H5T_t *dt);
+H5_DLL void *H5T_vlen_arena_alloc(size_t size, void *info);
+H5_DLL void H5T_vlen_arena_free(void *mem, void *info);
 H5_DLL htri_t H5T_set_loc(H5T_t *dt, H5F_t *f, H5T_loc_t loc);
 H5_DLL htri_t H5T_is_sensible(const H5T_t *dt);
 H5_DLL uint32_t H5T_hash(H5F_t * file, const H5T_t *dt);
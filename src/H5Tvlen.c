@@ -29,25 +29,28 @@
 #include "H5Pprivate.h"		/* Property lists			*/
 #include "H5Tpkg.h"		/* Datatypes				*/
 
+/* Maximum alignment of pieces handed out of a VL arena */
+#define H5T_VLEN_ARENA_ALIGN    16
+
 /* Local functions */
 static herr_t H5T_vlen_reclaim_recurse(void *elem, const H5T_t *dt, H5MM_free_t free_func, void *free_info);
 static ssize_t H5T_vlen_seq_mem_getlen(const void *_vl);
 static void * H5T_vlen_seq_mem_getptr(void *_vl);
 static htri_t H5T_vlen_seq_mem_isnull(const H5F_t *f, void *_vl);
-static herr_t H5T_vlen_seq_mem_read(H5F_t *f, void *_vl, void *_buf, size_t len);
-static herr_t H5T_vlen_seq_mem_write(H5F_t *f, const H5T_vlen_alloc_info_t *vl_alloc_info, void *_vl, void *_buf, void *_bg, size_t seq_len, size_t base_size);
+static herr_t H5T_vlen_seq_mem_read(H5F_t *f, H5HG_cursor_t *hg_cursor, void *_vl, void *_buf, size_t len);
+static herr_t H5T_vlen_seq_mem_write(H5F_t *f, H5HG_cursor_t *hg_cursor, const H5T_vlen_alloc_info_t *vl_alloc_info, void *_vl, void *_buf, void *_bg, size_t seq_len, size_t base_size);
 static herr_t H5T_vlen_seq_mem_setnull(H5F_t *f, void *_vl, void *_bg);
 static ssize_t H5T_vlen_str_mem_getlen(const void *_vl);
 static void * H5T_vlen_str_mem_getptr(void *_vl);
 static htri_t H5T_vlen_str_mem_isnull(const H5F_t *f, void *_vl);
-static herr_t H5T_vlen_str_mem_read(H5F_t *f, void *_vl, void *_buf, size_t len);
-static herr_t H5T_vlen_str_mem_write(H5F_t *f, const H5T_vlen_alloc_info_t *vl_alloc_info, void *_vl, void *_buf, void *_bg, size_t seq_len, size_t base_size);
+static herr_t H5T_vlen_str_mem_read(H5F_t *f, H5HG_cursor_t *hg_cursor, void *_vl, void *_buf, size_t len);
+static herr_t H5T_vlen_str_mem_write(H5F_t *f, H5HG_cursor_t *hg_cursor, const H5T_vlen_alloc_info_t *vl_alloc_info, void *_vl, void *_buf, void *_bg, size_t seq_len, size_t base_size);
 static herr_t H5T_vlen_str_mem_setnull(H5F_t *f, void *_vl, void *_bg);
 static ssize_t H5T_vlen_disk_getlen(const void *_vl);
 static void * H5T_vlen_disk_getptr(void *_vl);
 static htri_t H5T_vlen_disk_isnull(const H5F_t *f, void *_vl);
-static herr_t H5T_vlen_disk_read(H5F_t *f, void *_vl, void *_buf, size_t len);
-static herr_t H5T_vlen_disk_write(H5F_t *f, const H5T_vlen_alloc_info_t *vl_alloc_info, void *_vl, void *_buf, void *_bg, size_t seq_len, size_t base_size);
+static herr_t H5T_vlen_disk_read(H5F_t *f, H5HG_cursor_t *hg_cursor, void *_vl, void *_buf, size_t len);
+static herr_t H5T_vlen_disk_write(H5F_t *f, H5HG_cursor_t *hg_cursor, const H5T_vlen_alloc_info_t *vl_alloc_info, void *_vl, void *_buf, void *_bg, size_t seq_len, size_t base_size);
 static herr_t H5T_vlen_disk_setnull(H5F_t *f, void *_vl, void *_bg);
 
 /* Local variables */
@@ -396,7 +399,7 @@ H5T_vlen_seq_mem_isnull(const H5F_t H5_ATTR_UNUSED *f, void *_vl)
  *-------------------------------------------------------------------------
  */
 static herr_t
-H5T_vlen_seq_mem_read(H5F_t H5_ATTR_UNUSED *f, void *_vl, void *buf, size_t len)
+H5T_vlen_seq_mem_read(H5F_t H5_ATTR_UNUSED *f, H5HG_cursor_t H5_ATTR_UNUSED *hg_cursor, void *_vl, void *buf, size_t len)
 {
 #ifdef H5_NO_ALIGNMENT_RESTRICTIONS
     const hvl_t *vl=(const hvl_t *)_vl;   /* Pointer to the user's hvl_t information */
@@ -437,7 +440,7 @@ H5T_vlen_seq_mem_read(H5F_t H5_ATTR_UNUSED *f, void *_vl, void *buf, size_t len)
  *-------------------------------------------------------------------------
  */
 static herr_t
-H5T_vlen_seq_mem_write(H5F_t H5_ATTR_UNUSED *f, const H5T_vlen_alloc_info_t *vl_alloc_info, void *_vl, void *buf, void H5_ATTR_UNUSED *_bg, size_t seq_len, size_t base_size)
+H5T_vlen_seq_mem_write(H5F_t H5_ATTR_UNUSED *f, H5HG_cursor_t H5_ATTR_UNUSED *hg_cursor, const H5T_vlen_alloc_info_t *vl_alloc_info, void *_vl, void *buf, void H5_ATTR_UNUSED *_bg, size_t seq_len, size_t base_size)
 {
     hvl_t vl;                       /* Temporary hvl_t to use during operation */
     size_t len;
@@ -627,7 +630,7 @@ H5T_vlen_str_mem_isnull(const H5F_t H5_ATTR_UNUSED *f, void *_vl)
  *-------------------------------------------------------------------------
  */
 static herr_t
-H5T_vlen_str_mem_read(H5F_t H5_ATTR_UNUSED *f, void *_vl, void *buf, size_t len)
+H5T_vlen_str_mem_read(H5F_t H5_ATTR_UNUSED *f, H5HG_cursor_t H5_ATTR_UNUSED *hg_cursor, void *_vl, void *buf, size_t len)
 {
 #ifdef H5_NO_ALIGNMENT_RESTRICTIONS
     char *s=*(char **)_vl;   /* Pointer to the user's string information */
@@ -667,7 +670,7 @@ H5T_vlen_str_mem_read(H5F_t H5_ATTR_UNUSED *f, void *_vl, void *buf, size_t len)
  *-------------------------------------------------------------------------
  */
 static herr_t
-H5T_vlen_str_mem_write(H5F_t H5_ATTR_UNUSED *f, const H5T_vlen_alloc_info_t *vl_alloc_info,
+H5T_vlen_str_mem_write(H5F_t H5_ATTR_UNUSED *f, H5HG_cursor_t H5_ATTR_UNUSED *hg_cursor, const H5T_vlen_alloc_info_t *vl_alloc_info,
     void *_vl, void *buf, void H5_ATTR_UNUSED *_bg, size_t seq_len, size_t base_size)
 {
     char *t;                        /* Pointer to temporary buffer allocated */
@@ -816,7 +819,8 @@ H5T_vlen_disk_isnull(const H5F_t *f, void *_vl)
 /*-------------------------------------------------------------------------
  * Function:	H5T_vlen_disk_read
  *
- * Purpose:	Reads the disk based VL element into a buffer
+ * Purpose:	Reads the disk based VL element into a buffer, through
+ *		the global heap cursor HG_CURSOR
  *
  * Return:	Non-negative on success/Negative on failure
  *
@@ -826,7 +830,7 @@ H5T_vlen_disk_isnull(const H5F_t *f, void *_vl)
  *-------------------------------------------------------------------------
  */
 static herr_t
-H5T_vlen_disk_read(H5F_t *f, void *_vl, void *buf, size_t H5_ATTR_UNUSED len)
+H5T_vlen_disk_read(H5F_t *f, H5HG_cursor_t *hg_cursor, void *_vl, void *buf, size_t H5_ATTR_UNUSED len)
 {
     uint8_t *vl=(uint8_t *)_vl;   /* Pointer to the user's hvl_t information */
     H5HG_t hobjid;
@@ -838,6 +842,7 @@ H5T_vlen_disk_read(H5F_t *f, void *_vl, void *buf, size_t H5_ATTR_UNUSED len)
     HDassert(vl);
     HDassert(buf);
     HDassert(f);
+    HDassert(hg_cursor);
 
     /* Skip the length of the sequence */
     vl += 4;
@@ -849,7 +854,7 @@ H5T_vlen_disk_read(H5F_t *f, void *_vl, void *buf, size_t H5_ATTR_UNUSED len)
     /* Check if this sequence actually has any data */
     if(hobjid.addr > 0) {
         /* Read the VL information from disk */
-        if(NULL == H5HG_read(f, &hobjid, buf, NULL))
+        if(NULL == H5HG_cursor_read(f, hg_cursor, &hobjid, buf, NULL))
             HGOTO_ERROR(H5E_DATATYPE, H5E_READERROR, FAIL, "Unable to read VL information")
     }
 
@@ -861,7 +866,8 @@ done:
 /*-------------------------------------------------------------------------
  * Function:	H5T_vlen_disk_write
  *
- * Purpose:	Writes the disk based VL element from a buffer
+ * Purpose:	Writes the disk based VL element from a buffer, through
+ *		the global heap cursor HG_CURSOR
  *
  * Return:	Non-negative on success/Negative on failure
  *
@@ -871,7 +877,7 @@ done:
  *-------------------------------------------------------------------------
  */
 static herr_t
-H5T_vlen_disk_write(H5F_t *f, const H5T_vlen_alloc_info_t H5_ATTR_UNUSED *vl_alloc_info,
+H5T_vlen_disk_write(H5F_t *f, H5HG_cursor_t *hg_cursor, const H5T_vlen_alloc_info_t H5_ATTR_UNUSED *vl_alloc_info,
     void *_vl, void *buf, void *_bg, size_t seq_len, size_t base_size)
 {
     uint8_t *vl = (uint8_t *)_vl; /*Pointer to the user's hvl_t information*/
@@ -886,6 +892,7 @@ H5T_vlen_disk_write(H5F_t *f, const H5T_vlen_alloc_info_t H5_ATTR_UNUSED *vl_all
     HDassert(vl);
     HDassert(seq_len == 0 || buf);
     HDassert(f);
+    HDassert(hg_cursor);
 
     /* Free heap object for old data.  */
     if(bg!=NULL) {
@@ -911,7 +918,7 @@ H5T_vlen_disk_write(H5F_t *f, const H5T_vlen_alloc_info_t H5_ATTR_UNUSED *vl_all
 
     /* Write the VL information to disk (allocates space also) */
     len = (seq_len*base_size);
-    if(H5HG_insert(f, len, buf, &hobjid) < 0)
+    if(H5HG_cursor_insert(f, hg_cursor, len, buf, &hobjid) < 0)
         HGOTO_ERROR(H5E_DATATYPE, H5E_WRITEERROR, FAIL, "Unable to write VL information")
 
     /* Encode the heap information */
@@ -1195,3 +1202,74 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* H5T_vlen_reclaim_elmt */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	H5T_vlen_arena_alloc
+ *
+ * Purpose:	VL allocation routine used when the application has placed
+ *		an arena buffer on the DXPL with H5Pset_vlen_arena().  Hands
+ *		out consecutive pieces of the arena, so that all the VL data
+ *		for one I/O call ends up packed in a single buffer instead of
+ *		a separate malloc'd block per element.
+ *
+ *		Each piece is aligned to the largest power of two (up to
+ *		H5T_VLEN_ARENA_ALIGN) that divides the requested size, which
+ *		is enough for any sequence of a native type, since the
+ *		alignment of a type always divides its size.  Strings and
+ *		other odd-sized requests are packed with little or no padding.
+ *		Alignment is relative to the start of the arena, which is
+ *		assumed to be suitably aligned itself (as from malloc).
+ *
+ * Return:	Success:	Pointer into the arena
+ *		Failure:	NULL, when the arena is exhausted
+ *
+ *-------------------------------------------------------------------------
+ */
+void *
+H5T_vlen_arena_alloc(size_t size, void *info)
+{
+    H5T_vlen_arena_t *arena = (H5T_vlen_arena_t *)info;
+    size_t align;                   /* Alignment for this piece */
+    size_t pad;                     /* Padding needed to align the piece */
+    void *ret_value = NULL;         /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    HDassert(arena);
+    HDassert(arena->buf);
+
+    /* Largest power of two dividing the size, capped */
+    align = size & (~size + 1);
+    if(0 == align || align > H5T_VLEN_ARENA_ALIGN)
+        align = H5T_VLEN_ARENA_ALIGN;
+    pad = (align - (arena->used & (align - 1))) & (align - 1);
+
+    /* Hand out the next piece, if there's room for it */
+    if(pad <= arena->size - arena->used && size <= arena->size - arena->used - pad) {
+        ret_value = (uint8_t *)arena->buf + arena->used + pad;
+        arena->used += pad + size;
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5T_vlen_arena_alloc() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5T_vlen_arena_free
+ *
+ * Purpose:	VL free routine paired with H5T_vlen_arena_alloc().  Pieces
+ *		of the arena are owned by the application's buffer and are
+ *		never released individually, so this does nothing.
+ *
+ * Return:	void
+ *
+ *-------------------------------------------------------------------------
+ */
+void
+H5T_vlen_arena_free(void H5_ATTR_UNUSED *mem, void H5_ATTR_UNUSED *info)
+{
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5T_vlen_arena_free() */
+
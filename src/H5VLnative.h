@@ -30,6 +30,7 @@ typedef int H5VL_native_attr_optional_t;
 #ifndef H5_NO_DEPRECATED_SYMBOLS
 #define H5VL_NATIVE_ATTR_ITERATE_OLD    0   /* H5Aiterate (deprecated routine) */
 #endif /* H5_NO_DEPRECATED_SYMBOLS */
+#define H5VL_NATIVE_ATTR_READ_BULK      1   /* H5Aread_bulk                    */
 
 /* Typedef and values for native VOL connector dataset optional VOL operations */
 typedef int H5VL_native_dataset_optional_t;
@@ -38,6 +39,8 @@ typedef int H5VL_native_dataset_optional_t;
 #define H5VL_NATIVE_DATASET_GET_CHUNK_STORAGE_SIZE  2   /* H5Dget_chunk_storage_size    */
 #define H5VL_NATIVE_DATASET_CHUNK_READ              3   /* H5Dchunk_read                */
 #define H5VL_NATIVE_DATASET_CHUNK_WRITE             4   /* H5Dchunk_write               */
+#define H5VL_NATIVE_DATASET_READ_MULTI              5   /* H5Dread_multi                */
+#define H5VL_NATIVE_DATASET_WRITE_MULTI             6   /* H5Dwrite_multi               */
 
 /* Typedef and values for native VOL connector file optional VOL operations */
 typedef int H5VL_native_file_optional_t;
@@ -68,6 +71,13 @@ typedef int H5VL_native_file_optional_t;
 #define H5VL_NATIVE_FILE_SET_LIBVER_BOUNDS              24  /* H5Fset_latest_format/libver_bounds   */
 #define H5VL_NATIVE_FILE_GET_MIN_DSET_OHDR_FLAG         25  /* H5Fget_dset_no_attrs_hint            */
 #define H5VL_NATIVE_FILE_SET_MIN_DSET_OHDR_FLAG         26  /* H5Fset_dset_no_attrs_hint            */
+#define H5VL_NATIVE_FILE_RESET_ACCUM_STATS              27  /* H5Freset_metadata_accum_stats        */
+#define H5VL_NATIVE_FILE_GET_ACCUM_STATS                28  /* H5Fget_metadata_accum_stats          */
+#define H5VL_NATIVE_FILE_COMPACT                        29  /* H5Fcompact                           */
+#define H5VL_NATIVE_FILE_START_COUNTERS                 30  /* H5Fstart_counters                    */
+#define H5VL_NATIVE_FILE_STOP_COUNTERS                  31  /* H5Fstop_counters                     */
+#define H5VL_NATIVE_FILE_GET_COUNTERS                   32  /* H5Fget_counters                      */
+#define H5VL_NATIVE_FILE_PRINT_COUNTERS                 33  /* H5Fprint_counters                    */
 
 /* Typedef and values for native VOL connector group optional VOL operations */
 typedef int H5VL_native_group_optional_t;
@@ -550,6 +550,29 @@ H5VL__native_attr_optional(void H5_ATTR_UNUSED *obj, hid_t H5_ATTR_UNUSED dxpl_i
             }
 #endif /* H5_NO_DEPRECATED_SYMBOLS */
 
+        /* H5Aread_bulk */
+        case H5VL_NATIVE_ATTR_READ_BULK:
+            {
+                hid_t loc_id = HDva_arg(arguments, hid_t);
+                const char * const *names = HDva_arg(arguments, const char * const *);
+                size_t nnames = HDva_arg(arguments, size_t);
+                H5A_bulk_info_t *info = HDva_arg(arguments, H5A_bulk_info_t *);
+                size_t ninfo = HDva_arg(arguments, size_t);
+                void *buf = HDva_arg(arguments, void *);
+                size_t *buf_size = HDva_arg(arguments, size_t *);
+                size_t *nfound = HDva_arg(arguments, size_t *);
+                H5G_loc_t loc;
+
+                if(H5G_loc(loc_id, &loc) < 0)
+                    HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a location")
+
+                /* Read the attributes */
+                if(H5A__read_bulk(&loc, names, nnames, info, ninfo, buf, buf_size, nfound) < 0)
+                    HGOTO_ERROR(H5E_ATTR, H5E_READERROR, FAIL, "unable to read attributes")
+
+                break;
+            }
+
         default:
             HGOTO_ERROR(H5E_VOL, H5E_UNSUPPORTED, FAIL, "invalid optional operation")
     } /* end switch */
@@ -392,6 +392,9 @@ H5VL__native_dataset_optional(void *obj, hid_t H5_ATTR_UNUSED dxpl_id,
     void H5_ATTR_UNUSED **req, va_list arguments)
 {
     H5D_t *dset = NULL;             /* Dataset */
+    H5D_t **dsets = NULL;           /* Datasets for multi-dataset I/O */
+    const H5S_t **mem_space = NULL; /* Memory dataspaces for multi-dataset I/O */
+    const H5S_t **file_space = NULL; /* File dataspaces for multi-dataset I/O */
     H5VL_native_dataset_optional_t optional_type = HDva_arg(arguments, H5VL_native_dataset_optional_t);
     herr_t ret_value = SUCCEED;    /* Return value */
 
@@ -524,11 +527,60 @@ H5VL__native_dataset_optional(void *obj, hid_t H5_ATTR_UNUSED dxpl_id,
                 break;
             }
 
+        case H5VL_NATIVE_DATASET_READ_MULTI:
+        case H5VL_NATIVE_DATASET_WRITE_MULTI:
+            {
+                size_t          count               = HDva_arg(arguments, size_t);
+                const hid_t    *dset_id             = HDva_arg(arguments, const hid_t *);
+                const hid_t    *mem_type_id         = HDva_arg(arguments, const hid_t *);
+                const hid_t    *mem_space_id        = HDva_arg(arguments, const hid_t *);
+                const hid_t    *file_space_id       = HDva_arg(arguments, const hid_t *);
+                size_t          u;
+
+                /* Get the dataset and dataspace pointers */
+                if(NULL == (dsets = (H5D_t **)H5MM_malloc(count * sizeof(H5D_t *))))
+                    HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for dataset array")
+                if(NULL == (mem_space = (const H5S_t **)H5MM_malloc(count * sizeof(H5S_t *))))
+                    HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for dataspace array")
+                if(NULL == (file_space = (const H5S_t **)H5MM_malloc(count * sizeof(H5S_t *))))
+                    HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for dataspace array")
+                for(u = 0; u < count; u++) {
+                    if(NULL == (dsets[u] = (H5D_t *)H5VL_object_verify(dset_id[u], H5I_DATASET)))
+                        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a dataset")
+                    if(NULL == dsets[u]->oloc.file)
+                        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "dataset is not associated with a file")
+                    if(H5S_get_validated_dataspace(mem_space_id[u], &mem_space[u]) < 0)
+                        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "could not get a validated dataspace from mem_space_id")
+                    if(H5S_get_validated_dataspace(file_space_id[u], &file_space[u]) < 0)
+                        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "could not get a validated dataspace from file_space_id")
+                } /* end for */
+
+                /* Transfer the raw data */
+                if(H5VL_NATIVE_DATASET_READ_MULTI == optional_type) {
+                    void **buf = HDva_arg(arguments, void **);
+
+                    if(H5D__read_multi(count, dsets, mem_type_id, mem_space, file_space, buf) < 0)
+                        HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "can't read data")
+                } /* end if */
+                else {
+                    const void **buf = HDva_arg(arguments, const void **);
+
+                    if(H5D__write_multi(count, dsets, mem_type_id, mem_space, file_space, buf) < 0)
+                        HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "can't write data")
+                } /* end else */
+
+                break;
+            }
+
         default:
             HGOTO_ERROR(H5E_VOL, H5E_UNSUPPORTED, FAIL, "invalid optional operation")
     } /* end switch */
 
 done:
+    H5MM_xfree(dsets);
+    H5MM_xfree(mem_space);
+    H5MM_xfree(file_space);
+
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5VL__native_dataset_optional() */
 
@@ -698,6 +698,85 @@ H5VL__native_file_optional(void *obj, hid_t H5_ATTR_UNUSED dxpl_id, void H5_ATTR
                 break;
             }
 
+        /* H5Freset_metadata_accum_stats */
+        case H5VL_NATIVE_FILE_RESET_ACCUM_STATS:
+            {
+                /* Reset the statistics */
+                if(H5F__accum_reset_stats(f) < 0)
+                    HGOTO_ERROR(H5E_FILE, H5E_CANTSET, FAIL, "can't reset stats for metadata accumulator")
+
+                break;
+            }
+
+        /* H5Fget_metadata_accum_stats */
+        case H5VL_NATIVE_FILE_GET_ACCUM_STATS:
+            {
+                H5F_accum_stats_t *stats = HDva_arg(arguments, H5F_accum_stats_t *);
+
+                /* Get the statistics */
+                if(H5F__accum_get_stats(f, stats) < 0)
+                    HGOTO_ERROR(H5E_FILE, H5E_CANTGET, FAIL, "can't retrieve stats for metadata accumulator")
+
+                break;
+            }
+
+        /* H5Fcompact */
+        case H5VL_NATIVE_FILE_COMPACT:
+            {
+                hsize_t max_bytes = HDva_arg(arguments, hsize_t);
+                hsize_t *bytes_moved = HDva_arg(arguments, hsize_t *);
+
+                /* Move raw data toward the beginning of the file */
+                if(H5F__compact(f, max_bytes, bytes_moved) < 0)
+                    HGOTO_ERROR(H5E_FILE, H5E_CANTMODIFY, FAIL, "unable to compact file")
+
+                break;
+            }
+
+        /* H5Fstart_counters */
+        case H5VL_NATIVE_FILE_START_COUNTERS:
+            {
+                /* Reset and start the counters */
+                if(H5F__start_counters(f) < 0)
+                    HGOTO_ERROR(H5E_FILE, H5E_CANTSET, FAIL, "can't start counters")
+
+                break;
+            }
+
+        /* H5Fstop_counters */
+        case H5VL_NATIVE_FILE_STOP_COUNTERS:
+            {
+                /* Stop the counters */
+                if(H5F__stop_counters(f) < 0)
+                    HGOTO_ERROR(H5E_FILE, H5E_CANTSET, FAIL, "can't stop counters")
+
+                break;
+            }
+
+        /* H5Fget_counters */
+        case H5VL_NATIVE_FILE_GET_COUNTERS:
+            {
+                H5F_counters_t *counters = HDva_arg(arguments, H5F_counters_t *);
+
+                /* Get the counters */
+                if(H5F__get_counters(f, counters) < 0)
+                    HGOTO_ERROR(H5E_FILE, H5E_CANTGET, FAIL, "can't retrieve counters")
+
+                break;
+            }
+
+        /* H5Fprint_counters */
+        case H5VL_NATIVE_FILE_PRINT_COUNTERS:
+            {
+                FILE *stream = HDva_arg(arguments, FILE *);
+
+                /* Write the counters */
+                if(H5F__print_counters(f, stream) < 0)
+                    HGOTO_ERROR(H5E_FILE, H5E_WRITEERROR, FAIL, "can't print counters")
+
+                break;
+            }
+
         /* H5Fget_mdc_image_info */
         case H5VL_NATIVE_FILE_GET_MDC_IMAGE_INFO:
             {
@@ -1256,6 +1256,8 @@ H5Z_pipeline(const H5O_pline_t *pline, unsigned flags,
     H5Z_stats_t  *fstats=NULL;   /* Filter stats pointer */
     H5_timer_t    timer;
 #endif
+    H5F_prof_t  *prof;           /* Profiling counters for the file, if any */
+    double      start = 0.0;     /* Time a filter started */
     unsigned    failed = 0;
     unsigned    tmp_flags;
     herr_t      ret_value = SUCCEED;       /* Return value */
@@ -1269,6 +1271,9 @@ H5Z_pipeline(const H5O_pline_t *pline, unsigned flags,
     HDassert(buf && *buf);
     HDassert(!pline || pline->nused < H5Z_MAX_NFILTERS);
 
+    /* Time the filters if the file is being profiled */
+    prof = H5CX_get_prof();
+
     if (pline && (flags & H5Z_FLAG_REVERSE)) { /* Read */
         for (i = pline->nused; i > 0; --i) {
             idx = i-1;
@@ -1319,8 +1324,12 @@ H5Z_pipeline(const H5O_pline_t *pline, unsigned flags,
 #endif
             tmp_flags = flags | (pline->filter[idx].flags);
             tmp_flags |= (edc_read== H5Z_DISABLE_EDC) ? H5Z_FLAG_SKIP_EDC : 0;
+            if (prof)
+                start = H5_get_time();
             new_nbytes = (fclass->filter)(tmp_flags, pline->filter[idx].cd_nelmts,
                                         pline->filter[idx].cd_values, *nbytes, buf_size, buf);
+            if (prof)
+                H5F_prof_filter(prof, (int)pline->filter[idx].id, H5_get_time() - start);
 
 #ifdef H5Z_DEBUG
             H5_timer_end (&(fstats->stats[1].timer), &timer);
@@ -1361,8 +1370,12 @@ H5Z_pipeline(const H5O_pline_t *pline, unsigned flags,
             fstats = &H5Z_stat_table_g[fclass_idx];
             H5_timer_begin (&timer);
 #endif
+            if (prof)
+                start = H5_get_time();
             new_nbytes = (fclass->filter)(flags | (pline->filter[idx].flags), pline->filter[idx].cd_nelmts,
                     pline->filter[idx].cd_values, *nbytes, buf_size, buf);
+            if (prof)
+                H5F_prof_filter(prof, (int)pline->filter[idx].id, H5_get_time() - start);
 #ifdef H5Z_DEBUG
             H5_timer_end (&(fstats->stats[0].timer), &timer);
             fstats->stats[0].total += MAX(*nbytes, new_nbytes);
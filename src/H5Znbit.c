@@ -83,6 +83,10 @@ static void H5Z_nbit_compress_one_compound(unsigned char *data, size_t data_offs
     unsigned *parms_index);
 static void H5Z_nbit_compress(unsigned char *data, unsigned d_nelmts, unsigned char *buffer,
     size_t *buffer_size, const unsigned parms[]);
+static void H5Z_nbit_decompress_atomic_words(unsigned char *data, unsigned d_nelmts,
+    const unsigned char *buffer, const parms_atomic *p);
+static size_t H5Z_nbit_compress_atomic_words(const unsigned char *data, unsigned d_nelmts,
+    unsigned char *buffer, const parms_atomic *p);
 
 /* This message derives from H5Z */
 H5Z_class2_t H5Z_NBIT[1] = {{
@@ -104,6 +108,7 @@ H5Z_class2_t H5Z_NBIT[1] = {{
 #define H5Z_NBIT_MAX_NPARMS      4096  /* Max number of parameters for filter */
 #define H5Z_NBIT_ORDER_LE        0     /* Little endian for datatype byte order */
 #define H5Z_NBIT_ORDER_BE        1     /* Big endian for datatype byte order */
+#define H5Z_NBIT_WORD_MAX_PRECISION 56 /* Max precision packed through a 64-bit accumulator */
 
 /* Local variables */
 
@@ -1053,6 +1058,94 @@ H5Z_nbit_next_byte(size_t *j, size_t *buf_len)
    *buf_len = 8 * sizeof(unsigned char);
 }
 
+/* The routines below handle the common case of a single atomic datatype no
+ * wider than 8 bytes.  Instead of walking each element byte by byte, the
+ * element is loaded as one 64-bit integer, its significant bits are
+ * extracted with a shift and a mask, and they are appended to a 64-bit bit
+ * accumulator that is flushed a whole byte at a time.  The bit stream
+ * produced is identical to the one built by H5Z_nbit_compress_one_atomic().
+ */
+static size_t
+H5Z_nbit_compress_atomic_words(const unsigned char *data, unsigned d_nelmts,
+    unsigned char *buffer, const parms_atomic *p)
+{
+    uint64_t mask;      /* mask for the significant bits */
+    uint64_t acc = 0;   /* bit accumulator */
+    uint64_t val;       /* current element */
+    unsigned nacc = 0;  /* number of bits held in the accumulator */
+    size_t j = 0;       /* index of buffer */
+    unsigned i, k;      /* local index variables */
+
+    HDassert(p->precision > 0 && p->precision <= H5Z_NBIT_WORD_MAX_PRECISION);
+    HDassert(p->size <= sizeof(uint64_t));
+
+    mask = ((uint64_t)1 << p->precision) - 1;
+
+    for(i = 0; i < d_nelmts; i++, data += p->size) {
+        /* load the element as an integer */
+        val = 0;
+        if(p->order == H5Z_NBIT_ORDER_LE)
+            for(k = p->size; k > 0; k--)
+                val = (val << 8) | data[k - 1];
+        else
+            for(k = 0; k < p->size; k++)
+                val = (val << 8) | data[k];
+
+        /* append its significant bits to the accumulator */
+        acc = (acc << p->precision) | ((val >> p->offset) & mask);
+        nacc += p->precision;
+
+        /* flush whole bytes */
+        while(nacc >= 8) {
+            nacc -= 8;
+            buffer[j++] = (unsigned char)(acc >> nacc);
+        }
+    }
+
+    /* bits hanging over go into the high end of the last byte */
+    if(nacc > 0)
+        buffer[j] = (unsigned char)(acc << (8 - nacc));
+
+    return j;
+}
+
+static void
+H5Z_nbit_decompress_atomic_words(unsigned char *data, unsigned d_nelmts,
+    const unsigned char *buffer, const parms_atomic *p)
+{
+    uint64_t mask;      /* mask for the significant bits */
+    uint64_t acc = 0;   /* bit accumulator */
+    uint64_t val;       /* current element */
+    unsigned nacc = 0;  /* number of bits held in the accumulator */
+    size_t j = 0;       /* index of buffer */
+    unsigned i, k;      /* local index variables */
+
+    HDassert(p->precision > 0 && p->precision <= H5Z_NBIT_WORD_MAX_PRECISION);
+    HDassert(p->size <= sizeof(uint64_t));
+
+    mask = ((uint64_t)1 << p->precision) - 1;
+
+    for(i = 0; i < d_nelmts; i++, data += p->size) {
+        /* refill the accumulator */
+        while(nacc < p->precision) {
+            acc = (acc << 8) | buffer[j++];
+            nacc += 8;
+        }
+
+        /* extract the significant bits and move them to their offset */
+        nacc -= p->precision;
+        val = ((acc >> nacc) & mask) << p->offset;
+
+        /* store the element, padding bits are left zero */
+        if(p->order == H5Z_NBIT_ORDER_LE)
+            for(k = 0; k < p->size; k++, val >>= 8)
+                data[k] = (unsigned char)val;
+        else
+            for(k = p->size; k > 0; k--, val >>= 8)
+                data[k - 1] = (unsigned char)val;
+    }
+}
+
 static void
 H5Z_nbit_decompress_one_byte(unsigned char *data, size_t data_offset, unsigned k,
     unsigned begin_i, unsigned end_i, unsigned char *buffer, size_t *j, size_t *buf_len,
@@ -1334,8 +1427,11 @@ H5Z__nbit_decompress(unsigned char *data, unsigned d_nelmts, unsigned char *buff
             if(p.precision > p.size * 8 || (p.precision + p.offset) > p.size * 8)
                HGOTO_ERROR(H5E_PLINE, H5E_BADTYPE, FAIL, "invalid datatype precision/offset")
 
-            for(i = 0; i < d_nelmts; i++)
-               H5Z_nbit_decompress_one_atomic(data, i * p.size, buffer, &j, &buf_len, &p);
+            if(p.size <= sizeof(uint64_t) && p.precision > 0 && p.precision <= H5Z_NBIT_WORD_MAX_PRECISION)
+               H5Z_nbit_decompress_atomic_words(data, d_nelmts, buffer, &p);
+            else
+               for(i = 0; i < d_nelmts; i++)
+                  H5Z_nbit_decompress_one_atomic(data, i * p.size, buffer, &j, &buf_len, &p);
             break;
 
        case H5Z_NBIT_ARRAY:
@@ -1598,8 +1694,11 @@ H5Z_nbit_compress(unsigned char *data, unsigned d_nelmts, unsigned char *buffer,
             p.precision = parms[6];
             p.offset = parms[7];
 
-            for(i = 0; i < d_nelmts; i++)
-                H5Z_nbit_compress_one_atomic(data, i * p.size, buffer, &new_size, &buf_len, &p);
+            if(p.size <= sizeof(uint64_t) && p.precision > 0 && p.precision <= H5Z_NBIT_WORD_MAX_PRECISION)
+                new_size = H5Z_nbit_compress_atomic_words(data, d_nelmts, buffer, &p);
+            else
+                for(i = 0; i < d_nelmts; i++)
+                    H5Z_nbit_compress_one_atomic(data, i * p.size, buffer, &new_size, &buf_len, &p);
             break;
 
        case H5Z_NBIT_ARRAY:
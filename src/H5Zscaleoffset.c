@@ -74,6 +74,10 @@ static void H5Z_scaleoffset_decompress(unsigned char *data, unsigned d_nelmts,
     unsigned char *buffer, parms_atomic p);
 static void H5Z_scaleoffset_compress(unsigned char *data, unsigned d_nelmts, unsigned char *buffer,
     size_t buffer_size, parms_atomic p);
+static void H5Z_scaleoffset_decompress_words(unsigned char *data, unsigned d_nelmts,
+    const unsigned char *buffer, const parms_atomic *p);
+static void H5Z_scaleoffset_compress_words(const unsigned char *data, unsigned d_nelmts,
+    unsigned char *buffer, const parms_atomic *p);
 
 /* This message derives from H5Z */
 H5Z_class2_t H5Z_SCALEOFFSET[1] = {{
@@ -108,6 +112,8 @@ H5Z_class2_t H5Z_SCALEOFFSET[1] = {{
 #define H5Z_SCALEOFFSET_ORDER_LE         0    /* Little endian (datatype byte order) */
 #define H5Z_SCALEOFFSET_ORDER_BE         1    /* Big endian (datatype byte order) */
 
+#define H5Z_SCALEOFFSET_WORD_MAX_MINBITS 56   /* Max minbits packed through a 64-bit accumulator */
+
 #define H5Z_SCALEOFFSET_FILL_UNDEFINED   0    /* Fill value is not defined */
 #define H5Z_SCALEOFFSET_FILL_DEFINED     1    /* Fill value is defined */
 
@@ -1602,6 +1608,14 @@ H5Z_scaleoffset_decompress(unsigned char *data, unsigned d_nelmts,
     size_t i, j;
     unsigned buf_len;
 
+    /* values no wider than 8 bytes go through the word-at-a-time path,
+     * which writes every byte of the output itself
+     */
+    if(p.size <= sizeof(uint64_t) && p.minbits <= H5Z_SCALEOFFSET_WORD_MAX_MINBITS) {
+        H5Z_scaleoffset_decompress_words(data, d_nelmts, buffer, &p);
+        return;
+    }
+
     /* must initialize to zeros */
     for(i = 0; i < d_nelmts * p.size; i++)
         data[i] = 0;
@@ -1688,6 +1702,12 @@ H5Z_scaleoffset_compress(unsigned char *data, unsigned d_nelmts,
    for(j = 0; j < buffer_size; j++)
       buffer[j] = 0;
 
+   /* values no wider than 8 bytes go through the word-at-a-time path */
+   if(p.size <= sizeof(uint64_t) && p.minbits <= H5Z_SCALEOFFSET_WORD_MAX_MINBITS) {
+       H5Z_scaleoffset_compress_words(data, d_nelmts, buffer, &p);
+       return;
+   }
+
    /* initialization before the loop */
    j = 0;
    buf_len = sizeof(unsigned char) * 8;
@@ -1697,3 +1717,78 @@ H5Z_scaleoffset_compress(unsigned char *data, unsigned d_nelmts,
        H5Z_scaleoffset_compress_one_atomic(data, i * p.size, buffer, &j, &buf_len, p);
 }
 
+/* pack the low minbits bits of each value, most significant bit first,
+ * through a 64-bit accumulator that is flushed a whole byte at a time;
+ * produces the same bit stream as H5Z_scaleoffset_compress_one_atomic()
+ */
+static void
+H5Z_scaleoffset_compress_words(const unsigned char *data, unsigned d_nelmts,
+    unsigned char *buffer, const parms_atomic *p)
+{
+   uint64_t mask;      /* mask for the low minbits bits */
+   uint64_t acc = 0;   /* bit accumulator */
+   uint64_t val;       /* current value */
+   unsigned nacc = 0;  /* number of bits held in the accumulator */
+   size_t j = 0;       /* index of buffer */
+   unsigned i, k;
+
+   HDassert(p->minbits > 0 && p->minbits <= H5Z_SCALEOFFSET_WORD_MAX_MINBITS);
+
+   mask = ((uint64_t)1 << p->minbits) - 1;
+
+   for(i = 0; i < d_nelmts; i++, data += p->size) {
+      val = 0;
+      if(p->mem_order == H5Z_SCALEOFFSET_ORDER_LE)
+         for(k = p->size; k > 0; k--)
+            val = (val << 8) | data[k - 1];
+      else
+         for(k = 0; k < p->size; k++)
+            val = (val << 8) | data[k];
+
+      acc = (acc << p->minbits) | (val & mask);
+      nacc += p->minbits;
+      while(nacc >= 8) {
+         nacc -= 8;
+         buffer[j++] = (unsigned char)(acc >> nacc);
+      }
+   }
+
+   if(nacc > 0)
+      buffer[j] = (unsigned char)(acc << (8 - nacc));
+}
+
+/* inverse of H5Z_scaleoffset_compress_words(), the high bits of each value
+ * are left zero
+ */
+static void
+H5Z_scaleoffset_decompress_words(unsigned char *data, unsigned d_nelmts,
+    const unsigned char *buffer, const parms_atomic *p)
+{
+   uint64_t mask;      /* mask for the low minbits bits */
+   uint64_t acc = 0;   /* bit accumulator */
+   uint64_t val;       /* current value */
+   unsigned nacc = 0;  /* number of bits held in the accumulator */
+   size_t j = 0;       /* index of buffer */
+   unsigned i, k;
+
+   HDassert(p->minbits > 0 && p->minbits <= H5Z_SCALEOFFSET_WORD_MAX_MINBITS);
+
+   mask = ((uint64_t)1 << p->minbits) - 1;
+
+   for(i = 0; i < d_nelmts; i++, data += p->size) {
+      while(nacc < p->minbits) {
+         acc = (acc << 8) | buffer[j++];
+         nacc += 8;
+      }
+      nacc -= p->minbits;
+      val = (acc >> nacc) & mask;
+
+      if(p->mem_order == H5Z_SCALEOFFSET_ORDER_LE)
+         for(k = 0; k < p->size; k++, val >>= 8)
+            data[k] = (unsigned char)val;
+      else
+         for(k = p->size; k > 0; k--, val >>= 8)
+            data[k - 1] = (unsigned char)val;
+   }
+}
+
@@ -58,10 +58,43 @@ typedef struct H5Z_node {
     H5Z_num_val         value;
 } H5Z_node;
 
+/* Instructions of a compiled transform program */
+typedef enum {
+    H5Z_XFORM_INSTR_LOAD,       /* r[dst] = x                           */
+    H5Z_XFORM_INSTR_ADD_C,      /* r[dst] = r[dst] + a                  */
+    H5Z_XFORM_INSTR_SUB_C,      /* r[dst] = r[dst] - a                  */
+    H5Z_XFORM_INSTR_CSUB,       /* r[dst] = a - r[dst]                  */
+    H5Z_XFORM_INSTR_MUL_C,      /* r[dst] = r[dst] * a                  */
+    H5Z_XFORM_INSTR_DIV_C,      /* r[dst] = r[dst] / a                  */
+    H5Z_XFORM_INSTR_CDIV,       /* r[dst] = a / r[dst]                  */
+    H5Z_XFORM_INSTR_AFFINE,     /* r[dst] = s * (r[dst] * a) + b        */
+    H5Z_XFORM_INSTR_ADD,        /* r[dst] = r[dst] + r[src]             */
+    H5Z_XFORM_INSTR_SUB,        /* r[dst] = r[dst] - r[src]             */
+    H5Z_XFORM_INSTR_MUL,        /* r[dst] = r[dst] * r[src]             */
+    H5Z_XFORM_INSTR_DIV         /* r[dst] = r[dst] / r[src]             */
+} H5Z_xform_opcode_t;
+
+typedef struct {
+    H5Z_xform_opcode_t code;    /* Operation                            */
+    unsigned    dst;            /* Register operated on                 */
+    unsigned    src;            /* Second register, for reg-reg ops     */
+    double      a, b, s;        /* Constant operands                    */
+} H5Z_xform_instr_t;
+
+/* A parse tree lowered to a flat sequence of instructions on registers
+ * of one block of elements each.  The result is left in register 0. */
+typedef struct {
+    size_t      ninstrs;        /* Number of instructions               */
+    unsigned    nregs;          /* Number of registers used             */
+    unsigned    nloads;         /* Number of references to "x"          */
+    H5Z_xform_instr_t *instrs;  /* The instructions                     */
+} H5Z_xform_prog_t;
+
 struct H5Z_data_xform_t {
     char*       xform_exp;
     H5Z_node*       parse_root;
     H5Z_datval_ptrs*	dat_val_pointers;
+    H5Z_xform_prog_t*   prog;   /* Compiled form of the parse tree, if it could be compiled */
 };
 
 typedef struct result {
@@ -100,6 +133,10 @@ static void H5Z_xform_destroy_parse_tree(H5Z_node *tree);
 static void* H5Z_xform_parse(const char *expression, H5Z_datval_ptrs* dat_val_pointers);
 static void* H5Z_xform_copy_tree(H5Z_node* tree, H5Z_datval_ptrs* dat_val_pointers, H5Z_datval_ptrs* new_dat_val_pointers);
 static void H5Z_xform_reduce_tree(H5Z_node* tree);
+static H5Z_xform_prog_t *H5Z_xform_compile(const H5Z_node *tree);
+static hbool_t H5Z_xform_compile_node(const H5Z_node *tree, unsigned reg, H5Z_xform_prog_t *prog);
+static void H5Z_xform_destroy_prog(H5Z_xform_prog_t *prog);
+static herr_t H5Z_xform_eval_prog(const H5Z_xform_prog_t *prog, void *array, size_t array_size, hid_t array_type);
 #ifdef H5Z_XFORM_DEBUG
 static void H5Z_XFORM_DEBUG(H5Z_node *tree);
 static void H5Z_print(H5Z_node *tree, FILE *stream);
@@ -370,6 +407,91 @@ static void H5Z_print(H5Z_node *tree, FILE *stream);
         }																	\
 }
 
+/* Number of elements processed by each pass of a compiled program */
+#define H5Z_XFORM_BLOCK_NELMTS  1024
+
+/* Runs a compiled program over ARRAY, one block of elements at a time, so
+ * the block stays in cache while every instruction is applied to it.  Each
+ * instruction is a simple loop over the block that the compiler can
+ * vectorize.  Operations with a constant are done in double and rounded
+ * back to TYPE, as H5Z_XFORM_DO_OP1 does, so both evaluators give the same
+ * results.  When REGS is NULL, the program refers to "x" once and works on
+ * the array in place; otherwise register 0 is copied back after each block.
+ */
+#define H5Z_XFORM_DO_PROG(PROG,TYPE,ARRAY,SIZE,REGS)                        \
+{                                                                           \
+    size_t start, n, u, i;                                                  \
+                                                                            \
+    for(start = 0; start < (SIZE); start += H5Z_XFORM_BLOCK_NELMTS) {       \
+        TYPE *blk = (TYPE *)(ARRAY) + start;                                \
+                                                                            \
+        n = MIN(H5Z_XFORM_BLOCK_NELMTS, (SIZE) - start);                    \
+        for(i = 0; i < (PROG)->ninstrs; i++) {                              \
+            const H5Z_xform_instr_t *ins = &(PROG)->instrs[i];              \
+            TYPE *p = (REGS) ? (TYPE *)(REGS) + ins->dst * H5Z_XFORM_BLOCK_NELMTS : blk; \
+            TYPE *q = (REGS) ? (TYPE *)(REGS) + ins->src * H5Z_XFORM_BLOCK_NELMTS : blk; \
+            double a = ins->a, b = ins->b, s = ins->s;                      \
+                                                                            \
+            switch(ins->code) {                                             \
+                case H5Z_XFORM_INSTR_LOAD:                                  \
+                    if(p != blk)                                            \
+                        H5MM_memcpy(p, blk, n * sizeof(TYPE));              \
+                    break;                                                  \
+                case H5Z_XFORM_INSTR_ADD_C:                                 \
+                    for(u = 0; u < n; u++)                                  \
+                        p[u] = (TYPE)((double)p[u] + a);                    \
+                    break;                                                  \
+                case H5Z_XFORM_INSTR_SUB_C:                                 \
+                    for(u = 0; u < n; u++)                                  \
+                        p[u] = (TYPE)((double)p[u] - a);                    \
+                    break;                                                  \
+                case H5Z_XFORM_INSTR_CSUB:                                  \
+                    for(u = 0; u < n; u++)                                  \
+                        p[u] = (TYPE)(a - (double)p[u]);                    \
+                    break;                                                  \
+                case H5Z_XFORM_INSTR_MUL_C:                                 \
+                    for(u = 0; u < n; u++)                                  \
+                        p[u] = (TYPE)((double)p[u] * a);                    \
+                    break;                                                  \
+                case H5Z_XFORM_INSTR_DIV_C:                                 \
+                    for(u = 0; u < n; u++)                                  \
+                        p[u] = (TYPE)((double)p[u] / a);                    \
+                    break;                                                  \
+                case H5Z_XFORM_INSTR_CDIV:                                  \
+                    for(u = 0; u < n; u++)                                  \
+                        p[u] = (TYPE)(a / (double)p[u]);                    \
+                    break;                                                  \
+                case H5Z_XFORM_INSTR_AFFINE:                                \
+                    for(u = 0; u < n; u++)                                  \
+                        p[u] = (TYPE)((double)(TYPE)((double)p[u] * a) * s + b); \
+                    break;                                                  \
+                case H5Z_XFORM_INSTR_ADD:                                   \
+                    for(u = 0; u < n; u++)                                  \
+                        p[u] = (TYPE)(p[u] + q[u]);                         \
+                    break;                                                  \
+                case H5Z_XFORM_INSTR_SUB:                                   \
+                    for(u = 0; u < n; u++)                                  \
+                        p[u] = (TYPE)(p[u] - q[u]);                         \
+                    break;                                                  \
+                case H5Z_XFORM_INSTR_MUL:                                   \
+                    for(u = 0; u < n; u++)                                  \
+                        p[u] = (TYPE)(p[u] * q[u]);                         \
+                    break;                                                  \
+                case H5Z_XFORM_INSTR_DIV:                                   \
+                    for(u = 0; u < n; u++)                                  \
+                        p[u] = (TYPE)(p[u] / q[u]);                         \
+                    break;                                                  \
+                default:                                                    \
+                    HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "Invalid transform instruction") \
+            } /* end switch */                                              \
+        } /* end for */                                                     \
+                                                                            \
+        /* Copy the result back from register 0 */                          \
+        if(REGS)                                                            \
+            H5MM_memcpy(blk, (REGS), n * sizeof(TYPE));                     \
+    } /* end for */                                                         \
+}
+
 /*
  *  Programmer: Bill Wendling <wendling@ncsa.uiuc.edu>
  *              25. August 2003
@@ -997,8 +1119,9 @@ done:
 /*-------------------------------------------------------------------------
  * Function:    H5Z_xform_eval
  * Purpose: 	If the transform is trivial, this function applies it.
- * 		Otherwise, it calls H5Z_xform_eval_full to do the full
- * 		transform.
+ * 		Otherwise, it runs the compiled program for the transform,
+ * 		or calls H5Z_xform_eval_full to walk the parse tree if it
+ * 		couldn't be compiled.
  * Return:      SUCCEED if transform applied successfully, FAIL otherwise
  * Programmer:  Leon Arber
  * 		5/1/04
@@ -1066,6 +1189,11 @@ H5Z_xform_eval(H5Z_data_xform_t *data_xform_prop, void* array, size_t array_size
 #endif
 
     } /* end if */
+    /* Run the compiled form of the transform, when there is one */
+    else if(data_xform_prop->prog) {
+        if(H5Z_xform_eval_prog(data_xform_prop->prog, array, array_size, array_type) < 0)
+	    HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "error while performing data transform")
+    } /* end if */
     /* Otherwise, do the full data transform */
     else {
 	/* Optimization for linear transform: */
@@ -1209,6 +1337,261 @@ done:
 } /* end H5Z_xform_eval_full() */
 
 
+/*-------------------------------------------------------------------------
+ * Function:    H5Z_xform_eval_prog
+ * Purpose: 	Applies a compiled transform program to array.
+ * Return:      SUCCEED if transform applied successfully, FAIL otherwise
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5Z_xform_eval_prog(const H5Z_xform_prog_t *prog, void *array, size_t array_size, hid_t array_type)
+{
+    void *regs = NULL;                  /* Register blocks, when "x" is used more than once */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    HDassert(prog);
+    HDassert(prog->nloads > 1 || prog->nregs == 1);
+
+    /* A program that reads "x" more than once needs its own registers, since
+     * register 0 can't be updated in place while "x" is still to be loaded */
+    if(prog->nloads > 1)
+        if(NULL == (regs = H5MM_malloc(prog->nregs * H5Z_XFORM_BLOCK_NELMTS * H5T_get_size((H5T_t *)H5I_object(array_type)))))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "Ran out of memory trying to allocate space for data in data transform")
+
+    if(array_type == H5T_NATIVE_CHAR)
+        H5Z_XFORM_DO_PROG(prog, char, array, array_size, regs)
+#if CHAR_MIN >= 0
+    else if(array_type == H5T_NATIVE_SCHAR)
+        H5Z_XFORM_DO_PROG(prog, signed char, array, array_size, regs)
+#else /* CHAR_MIN >= 0 */
+    else if(array_type == H5T_NATIVE_UCHAR)
+        H5Z_XFORM_DO_PROG(prog, unsigned char, array, array_size, regs)
+#endif /* CHAR_MIN >= 0 */
+    else if(array_type == H5T_NATIVE_SHORT)
+        H5Z_XFORM_DO_PROG(prog, short, array, array_size, regs)
+    else if(array_type == H5T_NATIVE_USHORT)
+        H5Z_XFORM_DO_PROG(prog, unsigned short, array, array_size, regs)
+    else if(array_type == H5T_NATIVE_INT)
+        H5Z_XFORM_DO_PROG(prog, int, array, array_size, regs)
+    else if(array_type == H5T_NATIVE_UINT)
+        H5Z_XFORM_DO_PROG(prog, unsigned int, array, array_size, regs)
+    else if(array_type == H5T_NATIVE_LONG)
+        H5Z_XFORM_DO_PROG(prog, long, array, array_size, regs)
+    else if(array_type == H5T_NATIVE_ULONG)
+        H5Z_XFORM_DO_PROG(prog, unsigned long, array, array_size, regs)
+    else if(array_type == H5T_NATIVE_LLONG)
+        H5Z_XFORM_DO_PROG(prog, long long, array, array_size, regs)
+    else if(array_type == H5T_NATIVE_ULLONG)
+        H5Z_XFORM_DO_PROG(prog, unsigned long long, array, array_size, regs)
+    else if(array_type == H5T_NATIVE_FLOAT)
+        H5Z_XFORM_DO_PROG(prog, float, array, array_size, regs)
+    else if(array_type == H5T_NATIVE_DOUBLE)
+        H5Z_XFORM_DO_PROG(prog, double, array, array_size, regs)
+#if H5_SIZEOF_LONG_DOUBLE !=0
+    else if(array_type == H5T_NATIVE_LDOUBLE)
+        H5Z_XFORM_DO_PROG(prog, long double, array, array_size, regs)
+#endif
+    else
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "Cannot perform data transform on this type.")
+
+done:
+    if(regs)
+        H5MM_xfree(regs);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5Z_xform_eval_prog() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Z_xform_compile
+ * Purpose:     Lowers a (reduced) parse tree to a flat program for
+ *              H5Z_xform_eval_prog.  A multiplication by a constant
+ *              followed by the addition or subtraction of a constant, as in
+ *              "a*x+b", is fused into a single pass over the data.
+ * Return:      A pointer to the program, or NULL if the tree has a shape the
+ *              compiler doesn't handle (the caller then falls back to
+ *              walking the tree).  Doesn't push errors.
+ *
+ *-------------------------------------------------------------------------
+ */
+static H5Z_xform_prog_t *
+H5Z_xform_compile(const H5Z_node *tree)
+{
+    H5Z_xform_prog_t *prog = NULL;
+    size_t nnodes = 0;                  /* Upper bound on number of instructions */
+    const H5Z_node *stack[64];          /* Nodes left to count */
+    unsigned depth = 0;
+    size_t i, j;
+    H5Z_xform_prog_t *ret_value = NULL; /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    HDassert(tree);
+
+    /* Constant transforms are handled directly by H5Z_xform_eval */
+    if(tree->type == H5Z_XFORM_INTEGER || tree->type == H5Z_XFORM_FLOAT)
+        HGOTO_DONE(NULL)
+
+    /* Count the nodes, to size the instruction array */
+    stack[depth++] = tree;
+    while(depth > 0) {
+        const H5Z_node *node = stack[--depth];
+
+        nnodes++;
+        if(node->lchild || node->rchild) {
+            /* Very deep trees are left to the tree walk */
+            if(depth + 2 > NELMTS(stack))
+                HGOTO_DONE(NULL)
+            if(node->lchild)
+                stack[depth++] = node->lchild;
+            if(node->rchild)
+                stack[depth++] = node->rchild;
+        } /* end if */
+    } /* end while */
+
+    if(NULL == (prog = (H5Z_xform_prog_t *)H5MM_calloc(sizeof(H5Z_xform_prog_t))))
+        HGOTO_DONE(NULL)
+    if(NULL == (prog->instrs = (H5Z_xform_instr_t *)H5MM_calloc(nnodes * sizeof(H5Z_xform_instr_t))))
+        HGOTO_DONE(NULL)
+
+    if(!H5Z_xform_compile_node(tree, 0, prog))
+        HGOTO_DONE(NULL)
+
+    /* Fuse "r * a" followed by "r + b", "r - b" or "b - r" into one pass.
+     * The product is still rounded to the buffer's type before the sum, so
+     * the results are the same as running the two instructions in turn. */
+    for(i = j = 0; i < prog->ninstrs; i++, j++) {
+        const H5Z_xform_instr_t *next = (i + 1 < prog->ninstrs) ? &prog->instrs[i + 1] : NULL;
+
+        prog->instrs[j] = prog->instrs[i];
+        if(prog->instrs[i].code == H5Z_XFORM_INSTR_MUL_C && next && next->dst == prog->instrs[i].dst
+                && (next->code == H5Z_XFORM_INSTR_ADD_C || next->code == H5Z_XFORM_INSTR_SUB_C
+                    || next->code == H5Z_XFORM_INSTR_CSUB)) {
+            prog->instrs[j].code = H5Z_XFORM_INSTR_AFFINE;
+            prog->instrs[j].s = (next->code == H5Z_XFORM_INSTR_CSUB) ? -1.0 : 1.0;
+            prog->instrs[j].b = (next->code == H5Z_XFORM_INSTR_SUB_C) ? -next->a : next->a;
+            i++;
+        } /* end if */
+    } /* end for */
+    prog->ninstrs = j;
+
+    /* Set return value */
+    ret_value = prog;
+
+done:
+    if(!ret_value && prog)
+        H5Z_xform_destroy_prog(prog);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5Z_xform_compile() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Z_xform_compile_node
+ * Purpose:     Appends the instructions for the subtree TREE to PROG,
+ *              leaving its value in register REG.  A subtree that uses
+ *              "x" on both sides evaluates its right side in the next
+ *              register up.
+ * Return:      TRUE if the subtree was compiled, FALSE if not.
+ *
+ *-------------------------------------------------------------------------
+ */
+static hbool_t
+H5Z_xform_compile_node(const H5Z_node *tree, unsigned reg, H5Z_xform_prog_t *prog)
+{
+    H5Z_xform_instr_t ins;              /* Instruction for this node */
+    hbool_t ret_value = TRUE;           /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    HDmemset(&ins, 0, sizeof(ins));
+    ins.dst = reg;
+    if(reg + 1 > prog->nregs)
+        prog->nregs = reg + 1;
+
+    if(tree->type == H5Z_XFORM_SYMBOL) {
+        ins.code = H5Z_XFORM_INSTR_LOAD;
+        prog->nloads++;
+    } /* end if */
+    else if(tree->type == H5Z_XFORM_PLUS || tree->type == H5Z_XFORM_MINUS
+            || tree->type == H5Z_XFORM_MULT || tree->type == H5Z_XFORM_DIVIDE) {
+        const H5Z_node *l = tree->lchild;
+        const H5Z_node *r = tree->rchild;
+        hbool_t lnum, rnum;             /* Whether each side is a number */
+
+        if(!r)
+            HGOTO_DONE(FALSE)
+        lnum = (!l || l->type == H5Z_XFORM_INTEGER || l->type == H5Z_XFORM_FLOAT);
+        rnum = (r->type == H5Z_XFORM_INTEGER || r->type == H5Z_XFORM_FLOAT);
+
+        /* Two numbers should have been folded by H5Z_xform_reduce_tree */
+        if(lnum && rnum)
+            HGOTO_DONE(FALSE)
+        else if(lnum) {
+            /* Number (or nothing, as in -x) on the left */
+            if(!H5Z_xform_compile_node(r, reg, prog))
+                HGOTO_DONE(FALSE)
+            if(!l)
+                ins.a = 0.0;
+            else
+                ins.a = (l->type == H5Z_XFORM_INTEGER ? (double)l->value.int_val : l->value.float_val);
+            ins.code = (tree->type == H5Z_XFORM_PLUS ? H5Z_XFORM_INSTR_ADD_C :
+                    tree->type == H5Z_XFORM_MINUS ? H5Z_XFORM_INSTR_CSUB :
+                    tree->type == H5Z_XFORM_MULT ? H5Z_XFORM_INSTR_MUL_C : H5Z_XFORM_INSTR_CDIV);
+        } /* end if */
+        else if(rnum) {
+            /* Number on the right */
+            if(!H5Z_xform_compile_node(l, reg, prog))
+                HGOTO_DONE(FALSE)
+            ins.a = (r->type == H5Z_XFORM_INTEGER ? (double)r->value.int_val : r->value.float_val);
+            ins.code = (tree->type == H5Z_XFORM_PLUS ? H5Z_XFORM_INSTR_ADD_C :
+                    tree->type == H5Z_XFORM_MINUS ? H5Z_XFORM_INSTR_SUB_C :
+                    tree->type == H5Z_XFORM_MULT ? H5Z_XFORM_INSTR_MUL_C : H5Z_XFORM_INSTR_DIV_C);
+        } /* end if */
+        else {
+            /* "x" on both sides */
+            if(!H5Z_xform_compile_node(l, reg, prog) || !H5Z_xform_compile_node(r, reg + 1, prog))
+                HGOTO_DONE(FALSE)
+            ins.src = reg + 1;
+            ins.code = (tree->type == H5Z_XFORM_PLUS ? H5Z_XFORM_INSTR_ADD :
+                    tree->type == H5Z_XFORM_MINUS ? H5Z_XFORM_INSTR_SUB :
+                    tree->type == H5Z_XFORM_MULT ? H5Z_XFORM_INSTR_MUL : H5Z_XFORM_INSTR_DIV);
+        } /* end else */
+    } /* end if */
+    else
+        HGOTO_DONE(FALSE)
+
+    prog->instrs[prog->ninstrs++] = ins;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5Z_xform_compile_node() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Z_xform_destroy_prog
+ * Purpose:     Frees a compiled transform program.
+ * Return:      None.
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5Z_xform_destroy_prog(H5Z_xform_prog_t *prog)
+{
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    if(prog) {
+        H5MM_xfree(prog->instrs);
+        H5MM_xfree(prog);
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5Z_xform_destroy_prog() */
+
+
 /*-------------------------------------------------------------------------
  * Function:    H5Z_find_type
  * Return:      Native type of datatype that is passed in
@@ -1583,6 +1966,9 @@ H5Z_xform_create(const char *expr)
     if(count != data_xform_prop->dat_val_pointers->num_ptrs)
          HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, NULL, "error copying the parse tree, did not find correct number of \"variables\"")
 
+    /* Compile the parse tree (if this fails, evaluation walks the tree instead) */
+    data_xform_prop->prog = H5Z_xform_compile(data_xform_prop->parse_root);
+
     /* Assign return value */
     ret_value=data_xform_prop;
 
@@ -1632,8 +2018,9 @@ H5Z_xform_destroy(H5Z_data_xform_t *data_xform_prop)
     FUNC_ENTER_NOAPI_NOINIT_NOERR
 
     if(data_xform_prop) {
-	/* Destroy the parse tree */
+	/* Destroy the parse tree and its compiled form */
         H5Z_xform_destroy_parse_tree(data_xform_prop->parse_root);
+        H5Z_xform_destroy_prog(data_xform_prop->prog);
 
         /* Free the expression */
         H5MM_xfree(data_xform_prop->xform_exp);
@@ -1715,6 +2102,9 @@ H5Z_xform_copy(H5Z_data_xform_t **data_xform_prop)
 	if(count != new_data_xform_prop->dat_val_pointers->num_ptrs)
             HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "error copying the parse tree, did not find correct number of \"variables\"")
 
+        /* Compile the new parse tree */
+        new_data_xform_prop->prog = H5Z_xform_compile(new_data_xform_prop->parse_root);
+
         /* Copy new information on top of old information */
         *data_xform_prop=new_data_xform_prop;
     } /* end if */
@@ -41,6 +41,25 @@
 /* (same as the IEEE 802.3 (Ethernet) quotient) */
 #define H5_CRC_QUOTIENT 0x04C11DB7
 
+/* Number of 16-bit words summed by H5_checksum_fletcher32() between
+ * reductions of its 64-bit running sums.  (Well below the point where
+ * 'sum2' could overflow, which is past 2^23 words)
+ */
+#define H5_FLETCHER32_BLOCK     65536
+
+/* Reduce a fletcher running sum modulo 65535, keeping a non-zero sum
+ * non-zero, so that the result doesn't depend on how often it's done
+ */
+#define H5_FLETCHER32_REDUCE(s) (s) = ((s) & 0xffff) + ((s) >> 16)
+
+/* Load big-endian 16-bit and little-endian 32-bit words from a byte
+ * buffer with any alignment.  (Written so that compilers turn them into
+ * single loads)
+ */
+#define H5_LOAD16BE(p)  ((uint32_t)(((uint32_t)(p)[0] << 8) | (uint32_t)(p)[1]))
+#define H5_LOAD32LE(p)  ((uint32_t)(p)[0] | ((uint32_t)(p)[1] << 8) |     \
+                         ((uint32_t)(p)[2] << 16) | ((uint32_t)(p)[3] << 24))
+
 
 /******************/
 /* Local Typedefs */
@@ -111,7 +130,7 @@ H5_checksum_fletcher32(const void *_data, size_t _len)
 {
     const uint8_t *data = (const uint8_t *)_data;  /* Pointer to the data to be summed */
     size_t len = _len / 2;      /* Length in 16-bit words */
-    uint32_t sum1 = 0, sum2 = 0;
+    uint64_t sum1 = 0, sum2 = 0;
 
     FUNC_ENTER_NOAPI_NOINIT_NOERR
 
@@ -120,34 +139,53 @@ H5_checksum_fletcher32(const void *_data, size_t _len)
     HDassert(_len > 0);
 
     /* Compute checksum for pairs of bytes */
-    /* (the magic "360" value is is the largest number of sums that can be
-     *  performed without numeric overflow)
+    /* (64-bit sums allow long runs between reductions.  Since reducing
+     *  preserves the sums modulo 65535 and never turns a non-zero sum into
+     *  zero, the result is the same as reducing every 360 words)
      */
     while (len) {
-        size_t tlen = len > 360 ? 360 : len;
+        size_t tlen = len > H5_FLETCHER32_BLOCK ? H5_FLETCHER32_BLOCK : len;
         len -= tlen;
-        do {
-            sum1 += (uint32_t)(((uint16_t)data[0]) << 8) | ((uint16_t)data[1]);
+
+        /* Four words per step, to break the dependency between the sums */
+        while (tlen >= 4) {
+            uint64_t w0 = H5_LOAD16BE(data);
+            uint64_t w1 = H5_LOAD16BE(data + 2);
+            uint64_t w2 = H5_LOAD16BE(data + 4);
+            uint64_t w3 = H5_LOAD16BE(data + 6);
+
+            sum2 += 4 * sum1 + 4 * w0 + 3 * w1 + 2 * w2 + w3;
+            sum1 += w0 + w1 + w2 + w3;
+            data += 8;
+            tlen -= 4;
+        }
+        while (tlen) {
+            sum1 += H5_LOAD16BE(data);
             data += 2;
             sum2 += sum1;
-        } while (--tlen);
-        sum1 = (sum1 & 0xffff) + (sum1 >> 16);
-        sum2 = (sum2 & 0xffff) + (sum2 >> 16);
+            tlen--;
+        }
+        H5_FLETCHER32_REDUCE(sum1);
+        H5_FLETCHER32_REDUCE(sum2);
+        H5_FLETCHER32_REDUCE(sum1);
+        H5_FLETCHER32_REDUCE(sum2);
     }
 
     /* Check for odd # of bytes */
     if(_len % 2) {
         sum1 += (uint32_t)(((uint16_t)*data) << 8);
         sum2 += sum1;
-        sum1 = (sum1 & 0xffff) + (sum1 >> 16);
-        sum2 = (sum2 & 0xffff) + (sum2 >> 16);
+        H5_FLETCHER32_REDUCE(sum1);
+        H5_FLETCHER32_REDUCE(sum2);
     } /* end if */
 
     /* Second reduction step to reduce sums to 16 bits */
-    sum1 = (sum1 & 0xffff) + (sum1 >> 16);
-    sum2 = (sum2 & 0xffff) + (sum2 >> 16);
+    while (sum1 > 0xffff)
+        H5_FLETCHER32_REDUCE(sum1);
+    while (sum2 > 0xffff)
+        H5_FLETCHER32_REDUCE(sum2);
 
-    FUNC_LEAVE_NOAPI((sum2 << 16) | sum1)
+    FUNC_LEAVE_NOAPI((uint32_t)((sum2 << 16) | sum1))
 } /* end H5_checksum_fletcher32() */
 
 
@@ -386,18 +424,9 @@ H5_checksum_lookup3(const void *key, size_t length, uint32_t initval)
     /*--------------- all but the last block: affect some 32 bits of (a,b,c) */
     while (length > 12)
     {
-      a += k[0];
-      a += ((uint32_t)k[1])<<8;
-      a += ((uint32_t)k[2])<<16;
-      a += ((uint32_t)k[3])<<24;
-      b += k[4];
-      b += ((uint32_t)k[5])<<8;
-      b += ((uint32_t)k[6])<<16;
-      b += ((uint32_t)k[7])<<24;
-      c += k[8];
-      c += ((uint32_t)k[9])<<8;
-      c += ((uint32_t)k[10])<<16;
-      c += ((uint32_t)k[11])<<24;
+      a += H5_LOAD32LE(k);
+      b += H5_LOAD32LE(k + 4);
+      c += H5_LOAD32LE(k + 8);
       H5_lookup3_mix(a, b, c);
       length -= 12;
       k += 12;
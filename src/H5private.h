@@ -1933,6 +1933,15 @@ typedef struct H5_api_struct {
 #define H5_API_UNLOCK                                                         \
      H5TS_mutex_unlock(&H5_g.init_lock);
 
+/* Macros for letting other threads into the library while a thread waits
+ * on I/O that doesn't touch library state (the lock is only released when
+ * it isn't held recursively)
+ */
+#define H5_API_LOCK_TRY_RELEASE                                               \
+     H5TS_mutex_try_release(&H5_g.init_lock)
+#define H5_API_LOCK_REACQUIRE                                                 \
+     H5TS_mutex_lock(&H5_g.init_lock);
+
 /* Macros for thread cancellation-safe mechanism */
 #define H5_API_UNSET_CANCEL                                                   \
     H5TS_cancel_count_inc();
@@ -1950,6 +1959,8 @@ extern H5_api_t H5_g;
 /* disable locks (sequential version) */
 #define H5_API_LOCK
 #define H5_API_UNLOCK
+#define H5_API_LOCK_TRY_RELEASE FALSE
+#define H5_API_LOCK_REACQUIRE
 
 /* disable cancelability (sequential version) */
 #define H5_API_UNSET_CANCEL
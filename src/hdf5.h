@@ -48,6 +48,7 @@
 #include "H5FDmulti.h"          /* Usage-partitioned file family                */
 #include "H5FDsec2.h"           /* POSIX unbuffered file I/O                    */
 #include "H5FDstdio.h"          /* Standard C buffered I/O                      */
+#include "H5FDtrace.h"          /* Per-operation I/O tracing                    */
 #ifdef H5_HAVE_WINDOWS
 #include "H5FDwindows.h"        /* Win32 I/O                                    */
 #endif
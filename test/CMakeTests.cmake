@@ -414,6 +414,7 @@ set (test_CLEANFILES
     efc4.h5
     efc5.h5
     log_vfd_out.log
+    trace_vfd_out.trc
     new_multi_file_v16-r.h5
     new_multi_file_v16-s.h5
     split_get_file_image_test-m.h5
@@ -58,6 +58,7 @@ unsigned test_read_after(H5F_t *f);
 unsigned test_free(H5F_t *f);
 unsigned test_big(H5F_t *f);
 unsigned test_random_write(H5F_t *f);
+unsigned test_multi_region(H5F_t *f);
 unsigned test_swmr_write_big(hbool_t newest_format);
 
 /* Helper Function Prototypes */
@@ -138,6 +139,7 @@ main(void)
     nerrors += test_free(f);
     nerrors += test_big(f);
     nerrors += test_random_write(f);
+    nerrors += test_multi_region(f);
 
     /* Pop API context */
     if(api_ctx_pushed && H5CX_pop() < 0) FAIL_STACK_ERROR
@@ -1378,6 +1380,7 @@ unsigned
 test_big(H5F_t *f)
 {
     uint8_t *wbuf, *wbuf2, *rbuf, *zbuf;        /* Buffers for reading & writing, etc */
+    H5F_accum_stats_t stats;            /* Accumulator statistics */
     unsigned u;                         /* Local index variable */
 
     /* Allocate space for the write & read buffers */
@@ -1402,11 +1405,16 @@ test_big(H5F_t *f)
     if(accum_write(0, BIG_BUF_SIZE, wbuf) < 0) FAIL_STACK_ERROR;
 
     /* Read entire segment back from file */
+    if(H5F__accum_reset_stats(f) < 0) FAIL_STACK_ERROR;
     if(accum_read(0, BIG_BUF_SIZE, rbuf) < 0) FAIL_STACK_ERROR;
 
     /* Verify data read */
     if(HDmemcmp(wbuf, rbuf, (size_t)BIG_BUF_SIZE) != 0) TEST_ERROR;
 
+    /* A read larger than the accumulator should be counted as a miss */
+    if(H5F__accum_get_stats(f, &stats) < 0) FAIL_STACK_ERROR;
+    if(stats.read_hits != 0 || stats.read_misses != 1) TEST_ERROR;
+
 
     /* Reset data in file back to zeros & reset the read buffer */
     if(accum_write(0, BIG_BUF_SIZE, zbuf) < 0) FAIL_STACK_ERROR;
@@ -1806,6 +1814,120 @@ error:
     return 1;
 } /* end test_random_write() */
 
+/*-------------------------------------------------------------------------
+ * Function:    test_multi_region
+ *
+ * Purpose:     This test interleaves metadata writes & reads between
+ *		several distant regions of the file, checking that the
+ *		regions displaced from the accumulator are parked, reused
+ *		and evicted correctly.
+ *
+ * Return:      Success: SUCCEED
+ *              Failure: FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+#define MULTI_REGION_NREGIONS   6
+#define MULTI_REGION_SIZE       1024
+#define MULTI_REGION_STRIDE     (256 * 1024)
+unsigned
+test_multi_region(H5F_t *f)
+{
+    uint8_t *wbuf = NULL, *rbuf = NULL;
+    H5F_accum_stats_t stats;
+    unsigned u, v;
+
+    TESTING("metadata accumulator with multiple regions");
+
+    /* Allocate buffers */
+    if(NULL == (wbuf = (uint8_t *)HDmalloc((size_t)(MULTI_REGION_NREGIONS * 2 * MULTI_REGION_SIZE)))) FAIL_STACK_ERROR;
+    if(NULL == (rbuf = (uint8_t *)HDmalloc((size_t)(2 * MULTI_REGION_SIZE)))) FAIL_STACK_ERROR;
+
+    /* Each region gets its own pattern */
+    for(u = 0; u < MULTI_REGION_NREGIONS; u++)
+        for(v = 0; v < (2 * MULTI_REGION_SIZE); v++)
+            wbuf[(u * 2 * MULTI_REGION_SIZE) + v] = (uint8_t)(u + v);
+
+    if(accum_reset(f) < 0) FAIL_STACK_ERROR;
+    if(H5F__accum_reset_stats(f) < 0) FAIL_STACK_ERROR;
+
+    /* Write the first half of three distant regions */
+    for(u = 0; u < 3; u++)
+        if(accum_write(u * MULTI_REGION_STRIDE, MULTI_REGION_SIZE, wbuf + (u * 2 * MULTI_REGION_SIZE)) < 0) FAIL_STACK_ERROR;
+
+    /* The first two regions should have been parked */
+    if(f->shared->accum_nparked != 2) TEST_ERROR;
+
+    /* Reading the parked regions should hit */
+    for(u = 0; u < 3; u++) {
+        if(accum_read(u * MULTI_REGION_STRIDE, MULTI_REGION_SIZE, rbuf) < 0) FAIL_STACK_ERROR;
+        if(HDmemcmp(wbuf + (u * 2 * MULTI_REGION_SIZE), rbuf, (size_t)MULTI_REGION_SIZE) != 0) TEST_ERROR;
+    } /* end for */
+    if(H5F__accum_get_stats(f, &stats) < 0) FAIL_STACK_ERROR;
+    if(stats.read_hits != 3 || stats.read_misses != 0) TEST_ERROR;
+    if(stats.parks != 2 || stats.write_misses != 3) TEST_ERROR;
+
+    /* Append to the first region, which should reactivate it */
+    if(accum_write(MULTI_REGION_SIZE, MULTI_REGION_SIZE, wbuf + MULTI_REGION_SIZE) < 0) FAIL_STACK_ERROR;
+    if(H5F__accum_get_stats(f, &stats) < 0) FAIL_STACK_ERROR;
+    if(stats.reactivations != 1 || stats.write_hits != 1) TEST_ERROR;
+    if(f->shared->accum.loc != 0 || f->shared->accum.size != (2 * MULTI_REGION_SIZE)) TEST_ERROR;
+
+    /* Overwrite part of a parked region, then check it's still consistent */
+    if(accum_write((2 * MULTI_REGION_STRIDE) + 16, 16, wbuf) < 0) FAIL_STACK_ERROR;
+    if(accum_read(2 * MULTI_REGION_STRIDE, MULTI_REGION_SIZE, rbuf) < 0) FAIL_STACK_ERROR;
+    if(HDmemcmp(wbuf + (2 * 2 * MULTI_REGION_SIZE), rbuf, (size_t)16) != 0) TEST_ERROR;
+    if(HDmemcmp(wbuf, rbuf + 16, (size_t)16) != 0) TEST_ERROR;
+    if(HDmemcmp(wbuf + (2 * 2 * MULTI_REGION_SIZE) + 32, rbuf + 32, (size_t)(MULTI_REGION_SIZE - 32)) != 0) TEST_ERROR;
+    if(accum_write((2 * MULTI_REGION_STRIDE) + 16, 16, wbuf + (2 * 2 * MULTI_REGION_SIZE) + 16) < 0) FAIL_STACK_ERROR;
+
+    /* Freeing space should drop parked regions that overlap it */
+    if(accum_write(MULTI_REGION_STRIDE, MULTI_REGION_SIZE, wbuf + (2 * MULTI_REGION_SIZE)) < 0) FAIL_STACK_ERROR;
+    for(u = 0; u < f->shared->accum_nparked; u++)
+        if(f->shared->accum_lru[u].loc == 0)
+            break;
+    if(u == f->shared->accum_nparked) TEST_ERROR;
+    if(accum_free(f, 0, 2 * MULTI_REGION_SIZE) < 0) FAIL_STACK_ERROR;
+    for(u = 0; u < f->shared->accum_nparked; u++)
+        if(f->shared->accum_lru[u].loc == 0)
+            TEST_ERROR;
+    if(accum_write(0, 2 * MULTI_REGION_SIZE, wbuf) < 0) FAIL_STACK_ERROR;
+
+    /* Write both halves of all the regions, forcing evictions */
+    for(u = 0; u < MULTI_REGION_NREGIONS; u++)
+        if(accum_write(u * MULTI_REGION_STRIDE, 2 * MULTI_REGION_SIZE, wbuf + (u * 2 * MULTI_REGION_SIZE)) < 0) FAIL_STACK_ERROR;
+    if(H5F__accum_get_stats(f, &stats) < 0) FAIL_STACK_ERROR;
+    if(stats.evictions == 0) TEST_ERROR;
+    if(f->shared->accum_nparked > H5F_ACCUM_NPARKED) TEST_ERROR;
+
+    /* Verify all the regions, through the accumulator and from the file */
+    for(v = 0; v < 2; v++) {
+        for(u = 0; u < MULTI_REGION_NREGIONS; u++) {
+            if(accum_read(u * MULTI_REGION_STRIDE, 2 * MULTI_REGION_SIZE, rbuf) < 0) FAIL_STACK_ERROR;
+            if(HDmemcmp(wbuf + (u * 2 * MULTI_REGION_SIZE), rbuf, (size_t)(2 * MULTI_REGION_SIZE)) != 0) TEST_ERROR;
+        } /* end for */
+
+        if(accum_reset(f) < 0) FAIL_STACK_ERROR;
+        if(f->shared->accum_nparked != 0) TEST_ERROR;
+    } /* end for */
+
+    PASSED();
+
+    HDfree(wbuf);
+    HDfree(rbuf);
+
+    return 0;
+
+error:
+    if(wbuf)
+        HDfree(wbuf);
+    if(rbuf)
+        HDfree(rbuf);
+
+    return 1;
+} /* end test_multi_region() */
+
+
 /*-------------------------------------------------------------------------
  * Function:    test_swmr_write_big
  * 
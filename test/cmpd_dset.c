@@ -29,6 +29,7 @@ const char *FILENAME[] = {
     "cmpd_dset",
     "src_subset",
     "dst_subset",
+    "copy_plan",
     NULL
 };
 
@@ -2188,6 +2189,208 @@ error:
 } /* test_ooo_order */
 
 
+typedef struct plan_inner_t {
+    int         x;
+    double      y;
+} plan_inner_t;
+
+typedef struct plan_file_t {
+    int         a;
+    plan_inner_t n;
+    plan_inner_t arr[3];
+    long long   z;
+} plan_file_t;
+
+typedef struct plan_mem_inner_t {
+    double      y;
+    int         x;
+} plan_mem_inner_t;
+
+typedef struct plan_mem_t {
+    plan_mem_inner_t arr[3];
+    plan_mem_inner_t n;
+    int         a;
+} plan_mem_t;
+
+#define PLAN_NELMTS     64
+
+
+/*-------------------------------------------------------------------------
+ * Function:    test_copy_plan
+ *
+ * Purpose:     Tests compound conversions whose members need no conversion
+ *              but are reordered, nested in compounds or in arrays of
+ *              compounds.  These conversions are done by copying the runs
+ *              of bytes in the conversion's copy plan.
+ *
+ * Return:      Success:        0
+ *
+ *              Failure:        1
+ *
+ *-------------------------------------------------------------------------
+ */
+static unsigned
+test_copy_plan(char *filename, hid_t fapl)
+{
+    hid_t       file = -1, space = -1, dset = -1;
+    hid_t       inner_tid = -1, file_tid = -1, arr_tid = -1;
+    hid_t       mem_inner_tid = -1, mem_tid = -1, mem_arr_tid = -1;
+    hid_t       src_tid = -1, dst_tid = -1;
+    hsize_t     dim = PLAN_NELMTS;
+    hsize_t     arr_dim = 3;
+    plan_file_t *wbuf = NULL;
+    plan_mem_t  *rbuf = NULL;
+    unsigned char *cbuf = NULL;
+    H5T_path_t  *tpath;
+    H5T_subset_info_t *subset;
+    int         i, j;
+
+    TESTING("compound conversion copy plans")
+
+    if(NULL == (wbuf = (plan_file_t *)HDcalloc(PLAN_NELMTS, sizeof(plan_file_t))))
+        TEST_ERROR
+    if(NULL == (rbuf = (plan_mem_t *)HDcalloc(PLAN_NELMTS, sizeof(plan_mem_t))))
+        TEST_ERROR
+    if(NULL == (cbuf = (unsigned char *)HDcalloc(PLAN_NELMTS, 14)))
+        TEST_ERROR
+
+    /* Datatypes in the file */
+    if((inner_tid = H5Tcreate(H5T_COMPOUND, sizeof(plan_inner_t))) < 0) TEST_ERROR
+    if(H5Tinsert(inner_tid, "x", HOFFSET(plan_inner_t, x), H5T_NATIVE_INT) < 0) TEST_ERROR
+    if(H5Tinsert(inner_tid, "y", HOFFSET(plan_inner_t, y), H5T_NATIVE_DOUBLE) < 0) TEST_ERROR
+    if((arr_tid = H5Tarray_create2(inner_tid, 1, &arr_dim)) < 0) TEST_ERROR
+    if((file_tid = H5Tcreate(H5T_COMPOUND, sizeof(plan_file_t))) < 0) TEST_ERROR
+    if(H5Tinsert(file_tid, "a", HOFFSET(plan_file_t, a), H5T_NATIVE_INT) < 0) TEST_ERROR
+    if(H5Tinsert(file_tid, "n", HOFFSET(plan_file_t, n), inner_tid) < 0) TEST_ERROR
+    if(H5Tinsert(file_tid, "arr", HOFFSET(plan_file_t, arr), arr_tid) < 0) TEST_ERROR
+    if(H5Tinsert(file_tid, "z", HOFFSET(plan_file_t, z), H5T_NATIVE_LLONG) < 0) TEST_ERROR
+
+    /* Datatypes in memory: a reordered subset of the file datatype */
+    if((mem_inner_tid = H5Tcreate(H5T_COMPOUND, sizeof(plan_mem_inner_t))) < 0) TEST_ERROR
+    if(H5Tinsert(mem_inner_tid, "y", HOFFSET(plan_mem_inner_t, y), H5T_NATIVE_DOUBLE) < 0) TEST_ERROR
+    if(H5Tinsert(mem_inner_tid, "x", HOFFSET(plan_mem_inner_t, x), H5T_NATIVE_INT) < 0) TEST_ERROR
+    if((mem_arr_tid = H5Tarray_create2(mem_inner_tid, 1, &arr_dim)) < 0) TEST_ERROR
+    if((mem_tid = H5Tcreate(H5T_COMPOUND, sizeof(plan_mem_t))) < 0) TEST_ERROR
+    if(H5Tinsert(mem_tid, "arr", HOFFSET(plan_mem_t, arr), mem_arr_tid) < 0) TEST_ERROR
+    if(H5Tinsert(mem_tid, "n", HOFFSET(plan_mem_t, n), mem_inner_tid) < 0) TEST_ERROR
+    if(H5Tinsert(mem_tid, "a", HOFFSET(plan_mem_t, a), H5T_NATIVE_INT) < 0) TEST_ERROR
+
+    /* The conversion should only copy runs of bytes */
+    if(NULL == (tpath = H5T_path_find((H5T_t *)H5I_object(file_tid), (H5T_t *)H5I_object(mem_tid))))
+        TEST_ERROR
+    if(NULL == (subset = H5T_path_compound_subset(tpath)))
+        TEST_ERROR
+    if(H5T_SUBSET_RUNS != subset->subset || 0 == subset->nruns)
+        TEST_ERROR
+
+    /* Write the dataset, then read it back through the copy plan */
+    for(i = 0; i < PLAN_NELMTS; i++) {
+        wbuf[i].a = i;
+        wbuf[i].n.x = i * 10;
+        wbuf[i].n.y = i * 0.5;
+        for(j = 0; j < 3; j++) {
+            wbuf[i].arr[j].x = i * 100 + j;
+            wbuf[i].arr[j].y = i * 0.25 + j;
+        } /* end for */
+        wbuf[i].z = (long long)i * 1000;
+    } /* end for */
+
+    if((file = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0) TEST_ERROR
+    if((space = H5Screate_simple(1, &dim, NULL)) < 0) TEST_ERROR
+    if((dset = H5Dcreate2(file, "copy_plan", file_tid, space, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0)
+        TEST_ERROR
+    if(H5Dwrite(dset, file_tid, H5S_ALL, H5S_ALL, H5P_DEFAULT, wbuf) < 0) TEST_ERROR
+    if(H5Dread(dset, mem_tid, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf) < 0) TEST_ERROR
+
+    for(i = 0; i < PLAN_NELMTS; i++) {
+        if(rbuf[i].a != wbuf[i].a || rbuf[i].n.x != wbuf[i].n.x || !H5_DBL_ABS_EQUAL(rbuf[i].n.y, wbuf[i].n.y))
+            FAIL_PUTS_ERROR("incorrect value read for scalar or nested member")
+        for(j = 0; j < 3; j++)
+            if(rbuf[i].arr[j].x != wbuf[i].arr[j].x || !H5_DBL_ABS_EQUAL(rbuf[i].arr[j].y, wbuf[i].arr[j].y))
+                FAIL_PUTS_ERROR("incorrect value read for array member")
+    } /* end for */
+
+    /* Convert in place without a background buffer between two packed
+     * compounds with the same members in a different order */
+    if((src_tid = H5Tcreate(H5T_COMPOUND, (size_t)14)) < 0) TEST_ERROR
+    if(H5Tinsert(src_tid, "a", (size_t)0, H5T_NATIVE_INT) < 0) TEST_ERROR
+    if(H5Tinsert(src_tid, "b", (size_t)4, H5T_NATIVE_DOUBLE) < 0) TEST_ERROR
+    if(H5Tinsert(src_tid, "c", (size_t)12, H5T_NATIVE_SHORT) < 0) TEST_ERROR
+    if((dst_tid = H5Tcreate(H5T_COMPOUND, (size_t)14)) < 0) TEST_ERROR
+    if(H5Tinsert(dst_tid, "c", (size_t)0, H5T_NATIVE_SHORT) < 0) TEST_ERROR
+    if(H5Tinsert(dst_tid, "b", (size_t)2, H5T_NATIVE_DOUBLE) < 0) TEST_ERROR
+    if(H5Tinsert(dst_tid, "a", (size_t)10, H5T_NATIVE_INT) < 0) TEST_ERROR
+
+    if(NULL == (tpath = H5T_path_find((H5T_t *)H5I_object(src_tid), (H5T_t *)H5I_object(dst_tid))))
+        TEST_ERROR
+    if(H5T_BKG_NO != tpath->cdata.need_bkg)
+        FAIL_PUTS_ERROR("background buffer requested for a conversion that copies every byte")
+
+    for(i = 0; i < PLAN_NELMTS; i++) {
+        int a = i;
+        double b = i * 1.5;
+        short c = (short)(i - 7);
+
+        HDmemcpy(cbuf + i * 14, &a, sizeof(int));
+        HDmemcpy(cbuf + i * 14 + 4, &b, sizeof(double));
+        HDmemcpy(cbuf + i * 14 + 12, &c, sizeof(short));
+    } /* end for */
+    if(H5Tconvert(src_tid, dst_tid, (size_t)PLAN_NELMTS, cbuf, NULL, H5P_DEFAULT) < 0)
+        TEST_ERROR
+    for(i = 0; i < PLAN_NELMTS; i++) {
+        int a;
+        double b;
+        short c;
+
+        HDmemcpy(&c, cbuf + i * 14, sizeof(short));
+        HDmemcpy(&b, cbuf + i * 14 + 2, sizeof(double));
+        HDmemcpy(&a, cbuf + i * 14 + 10, sizeof(int));
+        if(a != i || !H5_DBL_ABS_EQUAL(b, i * 1.5) || c != (short)(i - 7))
+            FAIL_PUTS_ERROR("incorrect value after in-place conversion")
+    } /* end for */
+
+    if(H5Dclose(dset) < 0) TEST_ERROR
+    if(H5Sclose(space) < 0) TEST_ERROR
+    if(H5Fclose(file) < 0) TEST_ERROR
+    if(H5Tclose(src_tid) < 0) TEST_ERROR
+    if(H5Tclose(dst_tid) < 0) TEST_ERROR
+    if(H5Tclose(mem_tid) < 0) TEST_ERROR
+    if(H5Tclose(mem_arr_tid) < 0) TEST_ERROR
+    if(H5Tclose(mem_inner_tid) < 0) TEST_ERROR
+    if(H5Tclose(file_tid) < 0) TEST_ERROR
+    if(H5Tclose(arr_tid) < 0) TEST_ERROR
+    if(H5Tclose(inner_tid) < 0) TEST_ERROR
+    HDfree(wbuf);
+    HDfree(rbuf);
+    HDfree(cbuf);
+
+    PASSED();
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Dclose(dset);
+        H5Sclose(space);
+        H5Fclose(file);
+        H5Tclose(src_tid);
+        H5Tclose(dst_tid);
+        H5Tclose(mem_tid);
+        H5Tclose(mem_arr_tid);
+        H5Tclose(mem_inner_tid);
+        H5Tclose(file_tid);
+        H5Tclose(arr_tid);
+        H5Tclose(inner_tid);
+    } H5E_END_TRY
+    if(wbuf)
+        HDfree(wbuf);
+    if(rbuf)
+        HDfree(rbuf);
+    if(cbuf)
+        HDfree(cbuf);
+    return 1;
+} /* test_copy_plan */
+
+
 /*-------------------------------------------------------------------------
  * Function:	main
  *
@@ -2244,6 +2447,10 @@ main (int argc, char *argv[])
     puts("Testing compound member ordering:");
     nerrors += test_ooo_order(fname, fapl_id);
 
+    puts("Testing compound conversions that only copy members:");
+    h5_fixname(FILENAME[3], fapl_id, fname, sizeof(fname));
+    nerrors += test_copy_plan(fname, fapl_id);
+
     /* Verify symbol table messages are cached */
     nerrors += (h5_verify_cached_stabs(FILENAME, fapl_id) < 0 ? 1 : 0);
 
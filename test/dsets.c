@@ -83,6 +83,8 @@ const char *FILENAME[] = {
     "dls_01_strings",   /* 23 */
     "power2up",         /* 24 */
     "version_bounds",   /* 25 */
+    "multi_io",         /* 26 */
+    "chunk_stream",     /* 27 */
     NULL
 };
 
@@ -270,6 +272,29 @@ const char *FILENAME[] = {
 #define STORAGE_SIZE_CHUNK_DIM1 5
 #define STORAGE_SIZE_CHUNK_DIM2 5
 
+/* Parameters for multi-dataset I/O tests */
+#define MULTI_IO_NDSETS         8
+#define MULTI_IO_DIM            16
+#define MULTI_IO_SEL_START      4
+#define MULTI_IO_SEL_COUNT      8
+
+/* Parameters for chunked I/O on regular selections */
+#define CHUNK_STREAM_DIM0       40
+#define CHUNK_STREAM_DIM1       30
+#define CHUNK_STREAM_CHUNK0     6
+#define CHUNK_STREAM_CHUNK1     7
+#define CHUNK_STREAM_MEM_OFF0   2
+#define CHUNK_STREAM_MEM_OFF1   1
+
+/* Regular selection for chunked I/O tests */
+typedef struct chunk_stream_sel_t {
+    hsize_t     start[2];
+    hsize_t     stride[2];
+    hsize_t     count[2];
+    hsize_t     block[2];
+    hbool_t     streams;        /* Whether chunk selections can be computed as needed */
+} chunk_stream_sel_t;
+
 /* Shared global arrays */
 #define DSET_DIM1       100
 #define DSET_DIM2       200
@@ -5196,6 +5221,345 @@ error:
 } /* end test_scaleoffset_double_2() */
 
 
+/* Kinds of encoded-bytes test cases */
+typedef enum {
+    ENC_NBIT,                   /* N-bit, integer */
+    ENC_SO_INT,                 /* Scale-offset, integer */
+    ENC_SO_FLOAT                /* Scale-offset, floating-point D-scaling */
+} enc_kind_t;
+
+/* One encoded-bytes test case */
+typedef struct {
+    enc_kind_t          kind;
+    const char         *name;           /* Dataset name */
+    int                 size;           /* Size of the type, in bytes */
+    int                 sign;           /* Whether an integer type is signed */
+    H5T_order_t         order;          /* Byte order of the type */
+    size_t              precision;      /* N-bit: precision */
+    size_t              offset;         /* N-bit: offset */
+    int                 scale;          /* Scale-offset: scale factor */
+    long long           base;           /* Scale-offset: smallest value */
+    unsigned long long  range;          /* Range of the values */
+    size_t              nelmts;         /* Number of elements (odd) */
+    const unsigned char *expect;        /* Expected encoded chunk */
+    size_t              expect_size;    /* Size of the expected chunk */
+} enc_case_t;
+
+/* Encoded chunks written by the N-bit and scale-offset filters for the
+ * cases in enc_cases_g.  These are the bytes the filters have always
+ * written; any change to them breaks existing files.
+ */
+static const unsigned char enc_nbit_i32le_g[] = {
+    0x6c, 0x88, 0x74, 0xe6, 0x23, 0x19, 0x39, 0xe7, 0x00
+};
+static const unsigned char enc_nbit_i32be_g[] = {
+    0x79, 0xb0, 0xcb, 0x82, 0x0a, 0x73, 0xd2, 0x36, 0x7c, 0x8a, 0xe3, 0x04,
+    0x75, 0x93, 0x7e, 0x31, 0xeb, 0x9c
+};
+static const unsigned char enc_nbit_i16le_g[] = {
+    0xde, 0x69, 0x0c, 0x9e, 0x09, 0x8a, 0x70, 0xf4, 0xa3, 0x65, 0xf2, 0x20
+};
+static const unsigned char enc_nbit_i16be_g[] = {
+    0xe6, 0x8c, 0xa0, 0x8a, 0x7f, 0x4b, 0x67, 0x22, 0xe3, 0x11, 0x80
+};
+static const unsigned char enc_nbit_u8_g[] = {
+    0xaa, 0x72, 0x4b, 0x72, 0x00
+};
+static const unsigned char enc_nbit_u32be_g[] = {
+    0x4c, 0xa2, 0xfb, 0xcd, 0xfe, 0x8f, 0x44, 0x32, 0x7f, 0x2d, 0xef, 0x04
+};
+static const unsigned char enc_nbit_i64le_g[] = {
+    0x7e, 0xa6, 0x51, 0x7d, 0xe6, 0xb1, 0xff, 0xa3, 0xd1, 0x0c, 0xa6, 0xcf,
+    0xe5, 0xbd, 0xe0, 0x99, 0xb6, 0x06, 0x5d, 0x8a, 0x79, 0x31, 0xe9, 0x0c,
+    0x0f, 0x48
+};
+static const unsigned char enc_nbit_i64be_g[] = {
+    0x43, 0x4c, 0xfd, 0x4c, 0xa2, 0xfb, 0xcd, 0x5c, 0xca, 0xc7, 0xfe, 0x8f,
+    0x44, 0x32, 0x1c, 0x5f, 0x36, 0x7f, 0x2d, 0xef, 0x04, 0x44, 0x57, 0x9b,
+    0x60, 0x65, 0xd8, 0xa7, 0xcc, 0x99, 0x26, 0x3d, 0x21, 0x81, 0xe9, 0x68,
+    0x2d, 0xc8, 0x44, 0xc1, 0xc8, 0xd9, 0xae, 0x0b, 0xff, 0x11, 0x1e, 0x0f,
+    0x91, 0x00
+};
+static const unsigned char enc_so_i32le_g[] = {
+    0x0a, 0x00, 0x00, 0x00, 0x08, 0x17, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0xb8, 0xfb,
+    0xa5, 0x0c, 0xd5, 0xb3, 0xec, 0xf8, 0x00, 0x30, 0x04, 0x96, 0xe7, 0x2b,
+    0x94, 0xc0
+};
+static const unsigned char enc_so_i32be_g[] = {
+    0x0a, 0x00, 0x00, 0x00, 0x08, 0x17, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0xb8, 0xfb,
+    0xa5, 0x0c, 0xd5, 0xb3, 0xec, 0xf8, 0x00, 0x30, 0x04, 0x96, 0xe7, 0x2b,
+    0x94, 0xc0
+};
+static const unsigned char enc_so_i16be_g[] = {
+    0x06, 0x00, 0x00, 0x00, 0x08, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x30, 0xda,
+    0x32, 0x69, 0x88, 0x00
+};
+static const unsigned char enc_so_u8_g[] = {
+    0x04, 0x00, 0x00, 0x00, 0x08, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0xd5, 0x06,
+    0x0d, 0x72, 0xc0
+};
+static const unsigned char enc_so_i64le_g[] = {
+    0x28, 0x00, 0x00, 0x00, 0x08, 0xe4, 0x81, 0x21, 0x3d, 0x26, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd7, 0x0f, 0x81,
+    0x79, 0xe4, 0xa1, 0xc1, 0x6d, 0xc2, 0x49, 0x10, 0x42, 0x0c, 0x6d, 0x1b,
+    0x75, 0x23, 0x44, 0x56, 0xbe, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa2, 0x07,
+    0xa0, 0x46, 0xf0, 0xd8, 0xd3, 0xfc, 0x8d, 0xa8, 0x00
+};
+static const unsigned char enc_so_u64be_g[] = {
+    0x14, 0x00, 0x00, 0x00, 0x08, 0xe9, 0x81, 0x01, 0x00, 0x02, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x9e, 0x4d,
+    0xc2, 0x49, 0xc6, 0xd1, 0xb4, 0x56, 0xbe, 0x00, 0x00, 0x00
+};
+static const unsigned char enc_so_f32le_g[] = {
+    0x0f, 0x00, 0x00, 0x00, 0x08, 0x00, 0xc8, 0xa1, 0xc2, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0xb8, 0x00,
+    0x03, 0x76, 0xae, 0xbb, 0xd5, 0x97, 0x09, 0x86, 0x0f, 0x9a, 0x39, 0xde,
+    0xc4, 0x46, 0xc8, 0x50, 0xc0, 0xb8, 0x3e, 0x08, 0x6d, 0x60
+};
+static const unsigned char enc_so_f32be_g[] = {
+    0x13, 0x00, 0x00, 0x00, 0x08, 0x00, 0xc8, 0xa1, 0xc2, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0xb3, 0x80,
+    0x00, 0x02, 0x2a, 0x2b, 0x43, 0x56, 0x53, 0x7e, 0x68, 0x5f, 0x3b, 0x09,
+    0xc0, 0x18
+};
+static const unsigned char enc_so_f64le_g[] = {
+    0x16, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0x54,
+    0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0xa0, 0x58,
+    0x00, 0x00, 0x0a, 0xd2, 0xd8, 0x2a, 0x15, 0xed, 0x45, 0xe0, 0x30, 0xee,
+    0x13, 0x43, 0x0c, 0x07, 0x96, 0x9a, 0xbe, 0x99, 0x57, 0x60
+};
+static const unsigned char enc_so_f64be_g[] = {
+    0x0c, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0x54,
+    0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5b, 0xc0, 0x00,
+    0xb1, 0x5a, 0xc6, 0x47, 0x93, 0xcf, 0x31, 0xf5, 0xc9, 0x9d, 0x05, 0x02,
+    0x26, 0x90
+};
+
+static const enc_case_t enc_cases_g[] = {
+    {ENC_NBIT,     "nbit_i32le",  4, 1, H5T_ORDER_LE,  5, 0, 0, 0, 0, 13, enc_nbit_i32le_g, sizeof(enc_nbit_i32le_g)},
+    {ENC_NBIT,     "nbit_i32be",  4, 1, H5T_ORDER_BE, 11, 3, 0, 0, 0, 13, enc_nbit_i32be_g, sizeof(enc_nbit_i32be_g)},
+    {ENC_NBIT,     "nbit_i16le",  2, 1, H5T_ORDER_LE, 13, 2, 0, 0, 0,  7, enc_nbit_i16le_g, sizeof(enc_nbit_i16le_g)},
+    {ENC_NBIT,     "nbit_i16be",  2, 1, H5T_ORDER_BE,  9, 7, 0, 0, 0,  9, enc_nbit_i16be_g, sizeof(enc_nbit_i16be_g)},
+    {ENC_NBIT,     "nbit_u8",     1, 0, H5T_ORDER_LE,  3, 4, 0, 0, 0, 11, enc_nbit_u8_g, sizeof(enc_nbit_u8_g)},
+    {ENC_NBIT,     "nbit_u32be",  4, 0, H5T_ORDER_BE, 32, 0, 0, 0, 0,  3, enc_nbit_u32be_g, sizeof(enc_nbit_u32be_g)},
+    {ENC_NBIT,     "nbit_i64le",  8, 1, H5T_ORDER_LE, 41, 9, 0, 0, 0,  5, enc_nbit_i64le_g, sizeof(enc_nbit_i64le_g)},
+    {ENC_NBIT,     "nbit_i64be",  8, 1, H5T_ORDER_BE, 56, 8, 0, 0, 0,  7, enc_nbit_i64be_g, sizeof(enc_nbit_i64be_g)},
+    {ENC_SO_INT,   "so_i32le",    4, 1, H5T_ORDER_LE, 0, 0, 0, -300, 1000, 13, enc_so_i32le_g, sizeof(enc_so_i32le_g)},
+    {ENC_SO_INT,   "so_i32be",    4, 1, H5T_ORDER_BE, 0, 0, 0, -300, 1000, 13, enc_so_i32be_g, sizeof(enc_so_i32be_g)},
+    {ENC_SO_INT,   "so_i16be",    2, 1, H5T_ORDER_BE, 0, 0, 0, 7, 50, 9, enc_so_i16be_g, sizeof(enc_so_i16be_g)},
+    {ENC_SO_INT,   "so_u8",       1, 0, H5T_ORDER_LE, 0, 0, 0, 100, 17, 11, enc_so_u8_g, sizeof(enc_so_u8_g)},
+    {ENC_SO_INT,   "so_i64le",    8, 1, H5T_ORDER_LE, 0, 0, 0, -5, 1ULL << 40, 7, enc_so_i64le_g, sizeof(enc_so_i64le_g)},
+    {ENC_SO_INT,   "so_u64be",    8, 0, H5T_ORDER_BE, 0, 0, 0, 1LL << 33, 1ULL << 20, 5, enc_so_u64be_g, sizeof(enc_so_u64be_g)},
+    {ENC_SO_FLOAT, "so_f32le",    4, 1, H5T_ORDER_LE, 0, 0, 2, 0, 0, 13, enc_so_f32le_g, sizeof(enc_so_f32le_g)},
+    {ENC_SO_FLOAT, "so_f32be",    4, 1, H5T_ORDER_BE, 0, 0, 3, 0, 0,  7, enc_so_f32be_g, sizeof(enc_so_f32be_g)},
+    {ENC_SO_FLOAT, "so_f64le",    8, 1, H5T_ORDER_LE, 0, 0, 4, 0, 0,  9, enc_so_f64le_g, sizeof(enc_so_f64le_g)},
+    {ENC_SO_FLOAT, "so_f64be",    8, 1, H5T_ORDER_BE, 0, 0, 1, 0, 0, 11, enc_so_f64be_g, sizeof(enc_so_f64be_g)}
+};
+
+
+/*-------------------------------------------------------------------------
+ * Function:    enc_store
+ *
+ * Purpose:     Stores the SIZE low bytes of VAL at P, in byte order ORDER.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+enc_store(unsigned char *p, size_t size, H5T_order_t order, unsigned long long val)
+{
+    size_t u;
+
+    for(u = 0; u < size; u++, val >>= 8)
+        p[H5T_ORDER_LE == order ? u : size - u - 1] = (unsigned char)(val & 0xff);
+} /* end enc_store() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    enc_write_chunk
+ *
+ * Purpose:     Creates the dataset for one encoded-bytes test case, writes
+ *              its data as one chunk and reads the chunk back, still
+ *              encoded.  The data is written in the file type, so the
+ *              filter sees exactly the bytes built here.
+ *
+ * Return:      Success:    Size of the encoded chunk
+ *
+ *              Failure:    0
+ *
+ *-------------------------------------------------------------------------
+ */
+static size_t
+enc_write_chunk(hid_t file, const enc_case_t *c, unsigned char *chunk, size_t chunk_size)
+{
+    hid_t               dtype = -1, space = -1, dc = -1, dset = -1;
+    hsize_t             dims[1];
+    hsize_t             offset[1] = {0};
+    hsize_t             nbytes;
+    uint32_t            filter_mask = 0;
+    unsigned char      *buf = NULL;
+    unsigned long long  seed = 0x1234567ULL;
+    H5T_order_t         native_order;
+    size_t              u, v;
+
+    dims[0] = (hsize_t)c->nelmts;
+    if(NULL == (buf = (unsigned char *)HDcalloc(c->nelmts, (size_t)c->size)))
+        goto error;
+
+    /* Create the file type */
+    if(ENC_SO_FLOAT == c->kind)
+        dtype = H5Tcopy(4 == c->size ? H5T_NATIVE_FLOAT : H5T_NATIVE_DOUBLE);
+    else if(1 == c->size)
+        dtype = H5Tcopy(c->sign ? H5T_NATIVE_SCHAR : H5T_NATIVE_UCHAR);
+    else if(2 == c->size)
+        dtype = H5Tcopy(c->sign ? H5T_NATIVE_SHORT : H5T_NATIVE_USHORT);
+    else if(4 == c->size)
+        dtype = H5Tcopy(c->sign ? H5T_NATIVE_INT32 : H5T_NATIVE_UINT32);
+    else
+        dtype = H5Tcopy(c->sign ? H5T_NATIVE_INT64 : H5T_NATIVE_UINT64);
+    if(dtype < 0) goto error;
+    if((native_order = H5Tget_order(dtype)) < 0) goto error;
+    if(H5Tset_order(dtype, c->order) < 0) goto error;
+    if(ENC_NBIT == c->kind) {
+        if(H5Tset_precision(dtype, c->precision) < 0) goto error;
+        if(H5Tset_offset(dtype, c->offset) < 0) goto error;
+    } /* end if */
+
+    /* Build the data, already in the file's byte order */
+    for(u = 0; u < c->nelmts; u++) {
+        unsigned char *p = buf + u * (size_t)c->size;
+
+        seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+        if(ENC_NBIT == c->kind) {
+            unsigned long long mask = (64 == c->precision) ? ~0ULL : ((1ULL << c->precision) - 1);
+
+            enc_store(p, (size_t)c->size, c->order, ((seed >> 8) & mask) << c->offset);
+        } /* end if */
+        else if(ENC_SO_INT == c->kind)
+            enc_store(p, (size_t)c->size, c->order,
+                    (unsigned long long)c->base + (seed >> 8) % c->range);
+        else {
+            double  d = (double)((seed >> 40) % 20000) / 64.0 - 100.0;
+            float   f = (float)d;
+
+            if(4 == c->size)
+                HDmemcpy(p, &f, sizeof(f));
+            else
+                HDmemcpy(p, &d, sizeof(d));
+            if(native_order != c->order)
+                for(v = 0; v < (size_t)c->size / 2; v++) {
+                    unsigned char tmp = p[v];
+
+                    p[v] = p[(size_t)c->size - v - 1];
+                    p[(size_t)c->size - v - 1] = tmp;
+                } /* end for */
+        } /* end else */
+    } /* end for */
+
+    /* Create the dataset, with the whole dataset in one chunk */
+    if((space = H5Screate_simple(1, dims, NULL)) < 0) goto error;
+    if((dc = H5Pcreate(H5P_DATASET_CREATE)) < 0) goto error;
+    if(H5Pset_chunk(dc, 1, dims) < 0) goto error;
+    if(ENC_NBIT == c->kind) {
+        if(H5Pset_nbit(dc) < 0) goto error;
+    } /* end if */
+    else if(ENC_SO_INT == c->kind) {
+        if(H5Pset_scaleoffset(dc, H5Z_SO_INT, H5Z_SO_INT_MINBITS_DEFAULT) < 0) goto error;
+    } /* end if */
+    else
+        if(H5Pset_scaleoffset(dc, H5Z_SO_FLOAT_DSCALE, c->scale) < 0) goto error;
+    if((dset = H5Dcreate2(file, c->name, dtype, space, H5P_DEFAULT, dc, H5P_DEFAULT)) < 0)
+        goto error;
+    if(H5Dwrite(dset, dtype, H5S_ALL, H5S_ALL, H5P_DEFAULT, buf) < 0) goto error;
+
+    /* Read the encoded chunk */
+    if(H5Dget_chunk_storage_size(dset, offset, &nbytes) < 0) goto error;
+    if(nbytes == 0 || nbytes > (hsize_t)chunk_size) goto error;
+    if(H5Dread_chunk(dset, H5P_DEFAULT, offset, &filter_mask, chunk) < 0) goto error;
+    if(filter_mask != 0) goto error;
+
+    if(H5Dclose(dset) < 0) goto error;
+    if(H5Pclose(dc) < 0) goto error;
+    if(H5Sclose(space) < 0) goto error;
+    if(H5Tclose(dtype) < 0) goto error;
+    HDfree(buf);
+
+    return (size_t)nbytes;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Dclose(dset);
+        H5Pclose(dc);
+        H5Sclose(space);
+        H5Tclose(dtype);
+    } H5E_END_TRY;
+    if(buf)
+        HDfree(buf);
+
+    return 0;
+} /* end enc_write_chunk() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    test_encoded_bytes
+ *
+ * Purpose:     Tests that the N-bit and scale-offset filters write the
+ *              same bytes they always have, for several precisions,
+ *              offsets, sizes, byte orders and odd element counts.
+ *
+ * Return:      Success:    0
+ *
+ *              Failure:    -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+test_encoded_bytes(hid_t file)
+{
+    unsigned char   chunk[256];
+    size_t          nbytes;
+    size_t          u, v;
+
+    TESTING("encoded bytes of nbit and scaleoffset filters");
+
+    for(u = 0; u < sizeof(enc_cases_g) / sizeof(enc_cases_g[0]); u++) {
+        const enc_case_t *c = &enc_cases_g[u];
+
+        HDmemset(chunk, 0, sizeof(chunk));
+        if(0 == (nbytes = enc_write_chunk(file, c, chunk, sizeof(chunk)))) {
+            H5_FAILED();
+            printf("    Couldn't write dataset \"%s\"\n", c->name);
+            goto error;
+        } /* end if */
+        if(nbytes != c->expect_size) {
+            H5_FAILED();
+            printf("    Dataset \"%s\": encoded chunk is %lu bytes, expected %lu\n",
+                    c->name, (unsigned long)nbytes, (unsigned long)c->expect_size);
+            goto error;
+        } /* end if */
+        for(v = 0; v < nbytes; v++)
+            if(chunk[v] != c->expect[v]) {
+                H5_FAILED();
+                printf("    Dataset \"%s\": encoded byte %lu is 0x%02x, expected 0x%02x\n",
+                        c->name, (unsigned long)v, (unsigned)chunk[v], (unsigned)c->expect[v]);
+                goto error;
+            } /* end if */
+    } /* end for */
+
+    PASSED();
+
+    return SUCCEED;
+
+error:
+    return FAIL;
+} /* end test_encoded_bytes() */
+
+
 /*-------------------------------------------------------------------------
  * Function:    test_multiopen
  *
@@ -11492,6 +11856,422 @@ error:
 } /* end test_power2up() */
 
 
+/*-------------------------------------------------------------------------
+ * Function:    test_multi_io_check
+ *
+ * Purpose:     Helper for test_multi_io(): reads each dataset on its own
+ *              and checks it against the values written from BASE.
+ *
+ * Return:      Success: 0
+ *              Failure: -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+test_multi_io_check(const hid_t dset[], int base)
+{
+    int         rbuf[MULTI_IO_DIM];
+    int         i, j;
+
+    for(i = 0; i < MULTI_IO_NDSETS; i++) {
+        HDmemset(rbuf, 0, sizeof(rbuf));
+        if(H5Dread(dset[i], H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf) < 0)
+            FAIL_STACK_ERROR
+
+        for(j = 0; j < MULTI_IO_DIM; j++) {
+            int expect = base + i * MULTI_IO_DIM + j;
+
+            /* The last dataset only has its middle elements written */
+            if(i == MULTI_IO_NDSETS - 1 && (j < MULTI_IO_SEL_START || j >= MULTI_IO_SEL_START + MULTI_IO_SEL_COUNT))
+                expect = 0;
+            if(rbuf[j] != expect) {
+                H5_FAILED();
+                HDprintf("    dataset %d element %d: read %d, expected %d\n", i, j, rbuf[j], expect);
+                goto error;
+            } /* end if */
+        } /* end for */
+    } /* end for */
+
+    return SUCCEED;
+
+error:
+    return FAIL;
+} /* end test_multi_io_check() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    test_multi_io
+ *
+ * Purpose:     Tests H5Dread_multi() and H5Dwrite_multi() on a mix of
+ *              datasets: contiguous with early and late allocation,
+ *              chunked, contiguous with type conversion and contiguous
+ *              with a partial selection.  Also checks that a write
+ *              through H5Dwrite_multi() is seen after the datasets'
+ *              sieve buffers were filled by H5Dread().
+ *
+ * Return:      Success: 0
+ *              Failure: -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+test_multi_io(hid_t fapl)
+{
+    char        filename[FILENAME_BUF_SIZE];
+    char        dset_name[32];
+    hid_t       fid = -1;                       /* File ID */
+    hid_t       sid = -1;                       /* Dataspace ID for the datasets */
+    hid_t       sel_sid = -1;                   /* Dataspace ID with a partial selection */
+    hid_t       mem_sid = -1;                   /* Memory dataspace ID for the partial selection */
+    hid_t       dcpl_early = -1, dcpl_chunk = -1;   /* Dataset creation property list IDs */
+    hid_t       dset[MULTI_IO_NDSETS];          /* Dataset IDs */
+    hid_t       mem_type[MULTI_IO_NDSETS];      /* Memory datatypes */
+    hid_t       mem_space[MULTI_IO_NDSETS];     /* Memory dataspaces */
+    hid_t       file_space[MULTI_IO_NDSETS];    /* File dataspaces */
+    int         wdata[MULTI_IO_NDSETS][MULTI_IO_DIM];
+    int         rdata[MULTI_IO_NDSETS][MULTI_IO_DIM];
+    void        *rbuf[MULTI_IO_NDSETS];
+    const void  *wbuf[MULTI_IO_NDSETS];
+    hsize_t     dims[1] = {MULTI_IO_DIM};
+    hsize_t     chunk_dims[1] = {MULTI_IO_DIM / 4};
+    hsize_t     start[1] = {MULTI_IO_SEL_START};
+    hsize_t     count[1] = {MULTI_IO_SEL_COUNT};
+    herr_t      status;
+    int         i, j;
+
+    TESTING("multi-dataset I/O");
+
+    for(i = 0; i < MULTI_IO_NDSETS; i++)
+        dset[i] = -1;
+
+    h5_fixname(FILENAME[26], fapl, filename, sizeof filename);
+
+    /* Create file */
+    if((fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0) FAIL_STACK_ERROR
+
+    /* Create dataset creation property lists */
+    if((dcpl_early = H5Pcreate(H5P_DATASET_CREATE)) < 0) FAIL_STACK_ERROR
+    if(H5Pset_alloc_time(dcpl_early, H5D_ALLOC_TIME_EARLY) < 0) FAIL_STACK_ERROR
+    if((dcpl_chunk = H5Pcreate(H5P_DATASET_CREATE)) < 0) FAIL_STACK_ERROR
+    if(H5Pset_chunk(dcpl_chunk, 1, chunk_dims) < 0) FAIL_STACK_ERROR
+
+    /* Create the dataspaces */
+    if((sid = H5Screate_simple(1, dims, NULL)) < 0) FAIL_STACK_ERROR
+    if((sel_sid = H5Screate_simple(1, dims, NULL)) < 0) FAIL_STACK_ERROR
+    if(H5Sselect_hyperslab(sel_sid, H5S_SELECT_SET, start, NULL, count, NULL) < 0) FAIL_STACK_ERROR
+    if((mem_sid = H5Scopy(sel_sid)) < 0) FAIL_STACK_ERROR
+
+    /* Create the datasets:
+     *  0-3: contiguous, allocated early, so they are next to each other in the file
+     *  4:   contiguous, allocated on the first write
+     *  5:   chunked
+     *  6:   contiguous, with a file datatype that needs conversion
+     *  7:   contiguous, allocated early, with only part of it selected
+     */
+    for(i = 0; i < MULTI_IO_NDSETS; i++) {
+        hid_t dcpl = H5P_DEFAULT;
+        hid_t type = H5T_NATIVE_INT;
+
+        if(i < 4 || i == 7)
+            dcpl = dcpl_early;
+        else if(i == 5)
+            dcpl = dcpl_chunk;
+        else if(i == 6)
+            type = H5T_STD_I64BE;
+
+        HDsprintf(dset_name, "dset%d", i);
+        if((dset[i] = H5Dcreate2(fid, dset_name, type, sid, H5P_DEFAULT, dcpl, H5P_DEFAULT)) < 0)
+            FAIL_STACK_ERROR
+
+        mem_type[i] = H5T_NATIVE_INT;
+        mem_space[i] = (i == 7) ? mem_sid : H5S_ALL;
+        file_space[i] = (i == 7) ? sel_sid : H5S_ALL;
+        rbuf[i] = rdata[i];
+        wbuf[i] = wdata[i];
+    } /* end for */
+
+    /* Nothing is done for an empty list */
+    if(H5Dwrite_multi(0, NULL, NULL, NULL, NULL, H5P_DEFAULT, NULL) < 0) FAIL_STACK_ERROR
+    if(H5Dread_multi(0, NULL, NULL, NULL, NULL, H5P_DEFAULT, NULL) < 0) FAIL_STACK_ERROR
+
+    /* Write the datasets, and check them one at a time */
+    for(i = 0; i < MULTI_IO_NDSETS; i++)
+        for(j = 0; j < MULTI_IO_DIM; j++)
+            wdata[i][j] = i * MULTI_IO_DIM + j;
+    if(H5Dwrite_multi(MULTI_IO_NDSETS, dset, mem_type, mem_space, file_space, H5P_DEFAULT, wbuf) < 0)
+        FAIL_STACK_ERROR
+    if(test_multi_io_check(dset, 0) < 0)
+        TEST_ERROR
+
+    /* Write again, after H5Dread() has filled the datasets' sieve buffers */
+    for(i = 0; i < MULTI_IO_NDSETS; i++)
+        for(j = 0; j < MULTI_IO_DIM; j++)
+            wdata[i][j] = 1000 + i * MULTI_IO_DIM + j;
+    if(H5Dwrite_multi(MULTI_IO_NDSETS, dset, mem_type, mem_space, file_space, H5P_DEFAULT, wbuf) < 0)
+        FAIL_STACK_ERROR
+    if(test_multi_io_check(dset, 1000) < 0)
+        TEST_ERROR
+
+    /* Read the datasets all at once */
+    HDmemset(rdata, 0, sizeof(rdata));
+    if(H5Dread_multi(MULTI_IO_NDSETS, dset, mem_type, mem_space, file_space, H5P_DEFAULT, rbuf) < 0)
+        FAIL_STACK_ERROR
+    for(i = 0; i < MULTI_IO_NDSETS; i++)
+        for(j = 0; j < MULTI_IO_DIM; j++) {
+            int expect = 1000 + i * MULTI_IO_DIM + j;
+
+            /* Only the selected part of the last buffer is filled in */
+            if(i == MULTI_IO_NDSETS - 1 && (j < MULTI_IO_SEL_START || j >= MULTI_IO_SEL_START + MULTI_IO_SEL_COUNT))
+                expect = 0;
+            if(rdata[i][j] != expect)
+                TEST_ERROR
+        } /* end for */
+
+    /* Invalid arguments are rejected */
+    H5E_BEGIN_TRY {
+        status = H5Dread_multi(MULTI_IO_NDSETS, dset, mem_type, mem_space, file_space, H5P_DEFAULT, NULL);
+    } H5E_END_TRY;
+    if(status >= 0)
+        TEST_ERROR
+    mem_space[2] = sel_sid;
+    H5E_BEGIN_TRY {
+        status = H5Dread_multi(MULTI_IO_NDSETS, dset, mem_type, mem_space, file_space, H5P_DEFAULT, rbuf);
+    } H5E_END_TRY;
+    if(status >= 0)
+        TEST_ERROR
+    mem_space[2] = H5S_ALL;
+
+    /* Closing */
+    for(i = 0; i < MULTI_IO_NDSETS; i++)
+        if(H5Dclose(dset[i]) < 0) FAIL_STACK_ERROR
+    if(H5Sclose(sid) < 0) FAIL_STACK_ERROR
+    if(H5Sclose(sel_sid) < 0) FAIL_STACK_ERROR
+    if(H5Sclose(mem_sid) < 0) FAIL_STACK_ERROR
+    if(H5Pclose(dcpl_early) < 0) FAIL_STACK_ERROR
+    if(H5Pclose(dcpl_chunk) < 0) FAIL_STACK_ERROR
+    if(H5Fclose(fid) < 0) FAIL_STACK_ERROR
+
+    PASSED();
+
+    return SUCCEED;
+
+error:
+    H5E_BEGIN_TRY {
+        for(i = 0; i < MULTI_IO_NDSETS; i++)
+            H5Dclose(dset[i]);
+        H5Sclose(sid);
+        H5Sclose(sel_sid);
+        H5Sclose(mem_sid);
+        H5Pclose(dcpl_early);
+        H5Pclose(dcpl_chunk);
+        H5Fclose(fid);
+    } H5E_END_TRY;
+    return FAIL;
+} /* end test_multi_io() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    test_chunk_stream_selected
+ *
+ * Purpose:     Helper for test_chunk_stream(): checks whether an element
+ *              is in one of the test's regular selections.
+ *
+ * Return:      TRUE/FALSE
+ *
+ *-------------------------------------------------------------------------
+ */
+static hbool_t
+test_chunk_stream_selected(const chunk_stream_sel_t *sel, const hsize_t coord[2])
+{
+    unsigned    u;
+
+    for(u = 0; u < 2; u++) {
+        hsize_t off;        /* Offset from the start of the selection */
+
+        if(coord[u] < sel->start[u])
+            return FALSE;
+        off = coord[u] - sel->start[u];
+
+        /* (The stride of a single block doesn't matter) */
+        if(sel->count[u] == 1) {
+            if(off >= sel->block[u])
+                return FALSE;
+        } /* end if */
+        else if(off / sel->stride[u] >= sel->count[u] || off % sel->stride[u] >= sel->block[u])
+            return FALSE;
+    } /* end for */
+
+    return TRUE;
+} /* end test_chunk_stream_selected() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    test_chunk_stream
+ *
+ * Purpose:     Tests chunked I/O on regular selections whose stride is
+ *              not a multiple of the chunk size, or whose blocks cross
+ *              chunk boundaries, with the chunk selections computed as
+ *              they are needed and built up front.  The memory selection
+ *              is offset from the file selection.
+ *
+ * Return:      Success: 0
+ *              Failure: -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+test_chunk_stream(hid_t fapl)
+{
+    /* The selections, and whether their chunk selections can be computed
+     * as they are needed */
+    static const chunk_stream_sel_t sels[] = {
+        /* Strides that aren't multiples of the chunk size */
+        {{1, 1}, {4, 9}, {9, 4}, {1, 2}, TRUE},
+        /* Blocks crossing chunk boundaries in the first dimension */
+        {{2, 0}, {5, 1}, {7, 1}, {3, 30}, FALSE},
+        /* Single blocks covering several chunks */
+        {{3, 5}, {1, 1}, {1, 1}, {20, 17}, TRUE},
+        /* Adjoining blocks, and single elements */
+        {{0, 4}, {2, 3}, {20, 8}, {2, 1}, TRUE},
+        /* Blocks crossing chunk boundaries in the second dimension */
+        {{0, 3}, {12, 5}, {3, 5}, {6, 3}, FALSE}
+    };
+    char        filename[FILENAME_BUF_SIZE];
+    hid_t       fid = -1;                       /* File ID */
+    hid_t       dcpl = -1;                      /* Dataset creation property list ID */
+    hid_t       sid = -1;                       /* Dataspace ID for the dataset */
+    hid_t       mem_sid = -1;                   /* Memory dataspace ID */
+    hid_t       did = -1;                       /* Dataset ID */
+    hsize_t     dims[2] = {CHUNK_STREAM_DIM0, CHUNK_STREAM_DIM1};
+    hsize_t     mem_dims[2] = {CHUNK_STREAM_DIM0 + CHUNK_STREAM_MEM_OFF0, CHUNK_STREAM_DIM1 + CHUNK_STREAM_MEM_OFF1};
+    hsize_t     chunk_dims[2] = {CHUNK_STREAM_CHUNK0, CHUNK_STREAM_CHUNK1};
+    hsize_t     mem_start[2];
+    hsize_t     coord[2];
+    int         orig[CHUNK_STREAM_DIM0][CHUNK_STREAM_DIM1];     /* Data the dataset is reset to */
+    int         fdata[CHUNK_STREAM_DIM0][CHUNK_STREAM_DIM1];    /* Data read from the whole dataset */
+    int         mdata[CHUNK_STREAM_DIM0 + CHUNK_STREAM_MEM_OFF0][CHUNK_STREAM_DIM1 + CHUNK_STREAM_MEM_OFF1];
+    unsigned    nstreams_before, nstreams_after;
+    unsigned    enable, expect_stream;
+    size_t      i, j, s;
+
+    TESTING("chunked I/O on regular selections");
+
+    h5_fixname(FILENAME[27], fapl, filename, sizeof filename);
+
+    /* Create file, and the chunked dataset */
+    if((fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0) FAIL_STACK_ERROR
+    if((dcpl = H5Pcreate(H5P_DATASET_CREATE)) < 0) FAIL_STACK_ERROR
+    if(H5Pset_chunk(dcpl, 2, chunk_dims) < 0) FAIL_STACK_ERROR
+    if((sid = H5Screate_simple(2, dims, NULL)) < 0) FAIL_STACK_ERROR
+    if((mem_sid = H5Screate_simple(2, mem_dims, NULL)) < 0) FAIL_STACK_ERROR
+    if((did = H5Dcreate2(fid, "dset", H5T_NATIVE_INT, sid, H5P_DEFAULT, dcpl, H5P_DEFAULT)) < 0)
+        FAIL_STACK_ERROR
+
+    for(i = 0; i < CHUNK_STREAM_DIM0; i++)
+        for(j = 0; j < CHUNK_STREAM_DIM1; j++)
+            orig[i][j] = (int)(i * 100 + j);
+
+    for(enable = 0; enable < 2; enable++)
+        for(s = 0; s < NELMTS(sels); s++) {
+            expect_stream = (enable && sels[s].streams) ? 1 : 0;
+            if(H5D__chunk_stream_test((hbool_t)enable, NULL) < 0) TEST_ERROR
+
+            /* Reset the dataset */
+            if(H5Dwrite(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, orig) < 0)
+                FAIL_STACK_ERROR
+
+            /* Select the same pattern in the file and, offset, in memory */
+            mem_start[0] = sels[s].start[0] + CHUNK_STREAM_MEM_OFF0;
+            mem_start[1] = sels[s].start[1] + CHUNK_STREAM_MEM_OFF1;
+            if(H5Sselect_hyperslab(sid, H5S_SELECT_SET, sels[s].start, sels[s].stride, sels[s].count, sels[s].block) < 0)
+                FAIL_STACK_ERROR
+            if(H5Sselect_hyperslab(mem_sid, H5S_SELECT_SET, mem_start, sels[s].stride, sels[s].count, sels[s].block) < 0)
+                FAIL_STACK_ERROR
+
+            /* Write the selection */
+            for(i = 0; i < mem_dims[0]; i++)
+                for(j = 0; j < mem_dims[1]; j++)
+                    mdata[i][j] = -(int)(i * 100 + j) - 1;
+            if(H5D__chunk_stream_test((hbool_t)enable, &nstreams_before) < 0) TEST_ERROR
+            if(H5Dwrite(did, H5T_NATIVE_INT, mem_sid, sid, H5P_DEFAULT, mdata) < 0)
+                FAIL_STACK_ERROR
+            if(H5D__chunk_stream_test((hbool_t)enable, &nstreams_after) < 0) TEST_ERROR
+            if(nstreams_after - nstreams_before != expect_stream)
+                TEST_ERROR
+
+            /* Check the whole dataset */
+            HDmemset(fdata, 0, sizeof(fdata));
+            if(H5Dread(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, fdata) < 0)
+                FAIL_STACK_ERROR
+            for(i = 0; i < CHUNK_STREAM_DIM0; i++)
+                for(j = 0; j < CHUNK_STREAM_DIM1; j++) {
+                    int expect = orig[i][j];
+
+                    coord[0] = i;
+                    coord[1] = j;
+                    if(test_chunk_stream_selected(&sels[s], coord))
+                        expect = mdata[i + CHUNK_STREAM_MEM_OFF0][j + CHUNK_STREAM_MEM_OFF1];
+                    if(fdata[i][j] != expect) {
+                        H5_FAILED();
+                        HDprintf("    selection %zu, %s: element [%zu][%zu] is %d, expected %d\n",
+                                s, enable ? "streamed" : "not streamed", i, j, fdata[i][j], expect);
+                        goto error;
+                    } /* end if */
+                } /* end for */
+
+            /* Read the selection back */
+            HDmemset(mdata, 0, sizeof(mdata));
+            if(H5D__chunk_stream_test((hbool_t)enable, &nstreams_before) < 0) TEST_ERROR
+            if(H5Dread(did, H5T_NATIVE_INT, mem_sid, sid, H5P_DEFAULT, mdata) < 0)
+                FAIL_STACK_ERROR
+            if(H5D__chunk_stream_test((hbool_t)enable, &nstreams_after) < 0) TEST_ERROR
+            if(nstreams_after - nstreams_before != expect_stream)
+                TEST_ERROR
+            for(i = 0; i < mem_dims[0]; i++)
+                for(j = 0; j < mem_dims[1]; j++) {
+                    int expect = 0;
+
+                    if(i >= CHUNK_STREAM_MEM_OFF0 && j >= CHUNK_STREAM_MEM_OFF1) {
+                        coord[0] = i - CHUNK_STREAM_MEM_OFF0;
+                        coord[1] = j - CHUNK_STREAM_MEM_OFF1;
+                        if(test_chunk_stream_selected(&sels[s], coord))
+                            expect = fdata[coord[0]][coord[1]];
+                    } /* end if */
+                    if(mdata[i][j] != expect) {
+                        H5_FAILED();
+                        HDprintf("    selection %zu, %s: memory element [%zu][%zu] is %d, expected %d\n",
+                                s, enable ? "streamed" : "not streamed", i, j, mdata[i][j], expect);
+                        goto error;
+                    } /* end if */
+                } /* end for */
+        } /* end for */
+
+    if(H5D__chunk_stream_test(TRUE, NULL) < 0) TEST_ERROR
+
+    /* Closing */
+    if(H5Dclose(did) < 0) FAIL_STACK_ERROR
+    if(H5Sclose(mem_sid) < 0) FAIL_STACK_ERROR
+    if(H5Sclose(sid) < 0) FAIL_STACK_ERROR
+    if(H5Pclose(dcpl) < 0) FAIL_STACK_ERROR
+    if(H5Fclose(fid) < 0) FAIL_STACK_ERROR
+
+    PASSED();
+
+    return SUCCEED;
+
+error:
+    H5D__chunk_stream_test(TRUE, NULL);
+    H5E_BEGIN_TRY {
+        H5Dclose(did);
+        H5Sclose(mem_sid);
+        H5Sclose(sid);
+        H5Pclose(dcpl);
+        H5Fclose(fid);
+    } H5E_END_TRY;
+    return FAIL;
+} /* end test_chunk_stream() */
+
+
 /*-------------------------------------------------------------------------
  * Function:    test_scatter
  *
@@ -13303,6 +14083,7 @@ main(void)
             nerrors += (test_scaleoffset_float_2(file) < 0             ? 1 : 0);
             nerrors += (test_scaleoffset_double(file) < 0             ? 1 : 0);
             nerrors += (test_scaleoffset_double_2(file) < 0     ? 1 : 0);
+            nerrors += (test_encoded_bytes(file) < 0             ? 1 : 0);
             nerrors += (test_multiopen (file) < 0                ? 1 : 0);
             nerrors += (test_types(file) < 0                       ? 1 : 0);
             nerrors += (test_userblock_offset(envval, my_fapl, new_format) < 0  ? 1 : 0);
@@ -13339,6 +14120,8 @@ main(void)
             nerrors += (test_zero_dim_dset(my_fapl) < 0             ? 1 : 0);
             nerrors += (test_storage_size(my_fapl) < 0              ? 1 : 0);
             nerrors += (test_power2up(my_fapl) < 0                  ? 1 : 0);
+            nerrors += (test_multi_io(my_fapl) < 0                  ? 1 : 0);
+            nerrors += (test_chunk_stream(my_fapl) < 0              ? 1 : 0);
 
             nerrors += (test_swmr_non_latest(envval, my_fapl) < 0   ? 1 : 0);
             nerrors += (test_earray_hdr_fd(envval, my_fapl) < 0     ? 1 : 0);
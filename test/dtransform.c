@@ -22,6 +22,7 @@ static int test_copy(const hid_t dxpl_id_c_to_f_copy, const hid_t dxpl_id_polyno
 static int test_trivial(const hid_t dxpl_id_simple);
 static int test_poly(const hid_t dxpl_id_polynomial);
 static int test_specials(hid_t file);
+static int test_blocks(hid_t file);
 static int test_set(void);
 static int test_getset(const hid_t dxpl_id_simple);
 
@@ -325,6 +326,7 @@ int main(void)
     if(test_poly(dxpl_id_polynomial) < 0) TEST_ERROR;
     if(test_getset(dxpl_id_c_to_f) < 0) TEST_ERROR;
     if(test_specials(file_id) < 0) TEST_ERROR;
+    if(test_blocks(file_id) < 0) TEST_ERROR;
 
     /* Close the objects we opened/created */
     if(H5Dclose(dset_id_int) < 0) TEST_ERROR;
@@ -857,3 +859,90 @@ error:
     return -1;
 }
 
+static int
+test_blocks(hid_t file)
+{
+    hid_t dxpl_id = -1, dset_id = -1, dataspace = -1;
+    hsize_t dim = 5000;   /* More than a few blocks of a compiled transform */
+    double *data = NULL, *read_buf = NULL;
+    const char* affine = "2.5*x-1";
+    const char* poly = "(x+1)*x-x/2";
+    size_t i;
+
+    TESTING("data transform of a large buffer")
+
+    if(NULL == (data = (double *)HDmalloc((size_t)dim * sizeof(double))))
+        TEST_ERROR
+    if(NULL == (read_buf = (double *)HDmalloc((size_t)dim * sizeof(double))))
+        TEST_ERROR
+    for(i = 0; i < (size_t)dim; i++)
+        data[i] = (double)i * 0.25;
+
+    if((dataspace = H5Screate_simple(1, &dim, NULL)) < 0)
+        TEST_ERROR
+    if((dxpl_id = H5Pcreate(H5P_DATASET_XFER)) < 0) TEST_ERROR;
+
+    /*-----------------------------
+     * Multiply-add: 2.5*x-1
+     *----------------------------*/
+    if(H5Pset_data_transform(dxpl_id, affine) < 0) TEST_ERROR;
+    if((dset_id = H5Dcreate2(file, "/blocks1", H5T_NATIVE_DOUBLE,
+            dataspace, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0)
+        TEST_ERROR
+    if(H5Dwrite(dset_id, H5T_NATIVE_DOUBLE, H5S_ALL, H5S_ALL,
+            dxpl_id, data) < 0)
+        TEST_ERROR
+    if(H5Dread(dset_id, H5T_NATIVE_DOUBLE, H5S_ALL, H5S_ALL,
+            H5P_DEFAULT, read_buf) < 0)
+        TEST_ERROR
+    for(i = 0; i < (size_t)dim; i++)
+        if(!H5_DBL_ABS_EQUAL(read_buf[i], 2.5 * data[i] - 1)) {
+            H5_FAILED();
+            fprintf(stderr, "    ERROR: data  failed to match computed data\n");
+            goto error;
+        }
+    if(H5Dclose(dset_id) < 0)
+        TEST_ERROR
+
+    /*-----------------------------
+     * Polynomial: (x+1)*x-x/2
+     *----------------------------*/
+    if(H5Pset_data_transform(dxpl_id, poly) < 0) TEST_ERROR;
+    if((dset_id = H5Dcreate2(file, "/blocks2", H5T_NATIVE_DOUBLE,
+            dataspace, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0)
+        TEST_ERROR
+    if(H5Dwrite(dset_id, H5T_NATIVE_DOUBLE, H5S_ALL, H5S_ALL,
+            dxpl_id, data) < 0)
+        TEST_ERROR
+    if(H5Dread(dset_id, H5T_NATIVE_DOUBLE, H5S_ALL, H5S_ALL,
+            H5P_DEFAULT, read_buf) < 0)
+        TEST_ERROR
+    for(i = 0; i < (size_t)dim; i++)
+        if(!H5_DBL_ABS_EQUAL(read_buf[i], (data[i] + 1) * data[i] - data[i] / 2)) {
+            H5_FAILED();
+            fprintf(stderr, "    ERROR: data  failed to match computed data\n");
+            goto error;
+        }
+    if(H5Dclose(dset_id) < 0)
+        TEST_ERROR
+
+    if(H5Pclose(dxpl_id) < 0)
+        TEST_ERROR
+    if(H5Sclose(dataspace) < 0)
+        TEST_ERROR
+    HDfree(data);
+    HDfree(read_buf);
+
+    PASSED();
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Dclose(dset_id);
+        H5Pclose(dxpl_id);
+        H5Sclose(dataspace);
+    } H5E_END_TRY
+    HDfree(data);
+    HDfree(read_buf);
+    return -1;
+}
@@ -3431,6 +3431,126 @@ error:
     return 1;
 } /* end test_compound_18() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    test_compound_19
+ *
+ * Purpose:     Tests conversions to a packed compound datatype whose
+ *              members are the leading members of the source.  The
+ *              background buffer is only passed in when the conversion
+ *              path asks for one, as the library's own callers do.
+ *
+ * Return:      Success:        0
+ *              Failure:        number of errors
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+test_compound_19(void)
+{
+    typedef struct {
+        int a;
+        int b;
+    } full_struct;
+    full_struct full_buf[4];
+    full_struct fill = {7, 9};
+    int         part_buf[4];
+    hid_t       file = -1;
+    hid_t       full_tid = -1, part_tid = -1;
+    hid_t       sid = -1;
+    hid_t       dcpl = -1;
+    hid_t       did = -1;
+    hsize_t     dim = 4;
+    H5T_cdata_t *cdata = NULL;
+    void        *bkg = NULL;
+    char        filename[1024];
+    unsigned    u;
+
+    TESTING("conversion to a packed compound subset");
+
+    /* Create the full and the packed subset compound datatypes */
+    if((full_tid = H5Tcreate(H5T_COMPOUND, sizeof(full_struct))) < 0) TEST_ERROR
+    if(H5Tinsert(full_tid, "a", HOFFSET(full_struct, a), H5T_NATIVE_INT) < 0) TEST_ERROR
+    if(H5Tinsert(full_tid, "b", HOFFSET(full_struct, b), H5T_NATIVE_INT) < 0) TEST_ERROR
+    if((part_tid = H5Tcreate(H5T_COMPOUND, sizeof(int))) < 0) TEST_ERROR
+    if(H5Tinsert(part_tid, "a", (size_t)0, H5T_NATIVE_INT) < 0) TEST_ERROR
+
+    /* Convert in place, passing a background buffer only if it's needed */
+    for(u = 0; u < 4; u++) {
+        full_buf[u].a = (int)u;
+        full_buf[u].b = (int)u + 100;
+    } /* end for */
+    if(NULL == H5Tfind(full_tid, part_tid, &cdata)) TEST_ERROR
+    if(cdata->need_bkg && NULL == (bkg = HDcalloc((size_t)4, sizeof(int)))) TEST_ERROR
+    if(H5Tconvert(full_tid, part_tid, (size_t)4, full_buf, bkg, H5P_DEFAULT) < 0) TEST_ERROR
+    HDmemcpy(part_buf, full_buf, sizeof(part_buf));
+    for(u = 0; u < 4; u++)
+        if(part_buf[u] != (int)u) {
+            H5_FAILED(); AT();
+            HDprintf("element %u is %d, expected %u\n", u, part_buf[u], u);
+            goto error;
+        } /* end if */
+    if(bkg) {
+        HDfree(bkg);
+        bkg = NULL;
+    } /* end if */
+
+    /* Create File */
+    h5_fixname(FILENAME[3], H5P_DEFAULT, filename, sizeof filename);
+    if((file = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, H5P_DEFAULT)) < 0) FAIL_STACK_ERROR
+    if((sid = H5Screate_simple(1, &dim, NULL)) < 0) FAIL_STACK_ERROR
+
+    /* The fill value is converted to the dataset's packed datatype */
+    if((dcpl = H5Pcreate(H5P_DATASET_CREATE)) < 0) FAIL_STACK_ERROR
+    if(H5Pset_fill_value(dcpl, full_tid, &fill) < 0) FAIL_STACK_ERROR
+    if((did = H5Dcreate2(file, "part", part_tid, sid, H5P_DEFAULT, dcpl, H5P_DEFAULT)) < 0) FAIL_STACK_ERROR
+    HDmemset(part_buf, 0, sizeof(part_buf));
+    if(H5Dread(did, part_tid, H5S_ALL, H5S_ALL, H5P_DEFAULT, part_buf) < 0) FAIL_STACK_ERROR
+    for(u = 0; u < 4; u++)
+        if(part_buf[u] != fill.a) {
+            H5_FAILED(); AT();
+            HDprintf("element %u of \"part\" is %d, expected %d\n", u, part_buf[u], fill.a);
+            goto error;
+        } /* end if */
+    if(H5Dclose(did) < 0) FAIL_STACK_ERROR
+
+    /* The fill value of an unallocated dataset is converted to the packed
+     * memory datatype when it's read */
+    if((did = H5Dcreate2(file, "full", full_tid, sid, H5P_DEFAULT, dcpl, H5P_DEFAULT)) < 0) FAIL_STACK_ERROR
+    HDmemset(part_buf, 0, sizeof(part_buf));
+    if(H5Dread(did, part_tid, H5S_ALL, H5S_ALL, H5P_DEFAULT, part_buf) < 0) FAIL_STACK_ERROR
+    for(u = 0; u < 4; u++)
+        if(part_buf[u] != fill.a) {
+            H5_FAILED(); AT();
+            HDprintf("element %u of \"full\" is %d, expected %d\n", u, part_buf[u], fill.a);
+            goto error;
+        } /* end if */
+
+    /* Close IDs */
+    if(H5Dclose(did) < 0) FAIL_STACK_ERROR
+    if(H5Pclose(dcpl) < 0) FAIL_STACK_ERROR
+    if(H5Sclose(sid) < 0) FAIL_STACK_ERROR
+    if(H5Tclose(part_tid) < 0) FAIL_STACK_ERROR
+    if(H5Tclose(full_tid) < 0) FAIL_STACK_ERROR
+    if(H5Fclose(file) < 0) FAIL_STACK_ERROR
+
+    PASSED();
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Dclose(did);
+        H5Pclose(dcpl);
+        H5Sclose(sid);
+        H5Tclose(part_tid);
+        H5Tclose(full_tid);
+        H5Fclose(file);
+    } H5E_END_TRY;
+    if(bkg)
+        HDfree(bkg);
+    return 1;
+} /* end test_compound_19() */
+
 
 /*-------------------------------------------------------------------------
  * Function:    test_query
@@ -5008,6 +5128,98 @@ convert_opaque(hid_t H5_ATTR_UNUSED st, hid_t H5_ATTR_UNUSED dt, H5T_cdata_t *cd
 }
 
 
+/*-------------------------------------------------------------------------
+ * Function:    convert_path_cache
+ *
+ * Purpose:     A conversion function which does nothing, for checking
+ *              which conversion path is found for a pair of datatypes.
+ *
+ * Return:      Success:        0
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+convert_path_cache(hid_t H5_ATTR_UNUSED st, hid_t H5_ATTR_UNUSED dt, H5T_cdata_t *cdata,
+    size_t H5_ATTR_UNUSED nelmts, size_t H5_ATTR_UNUSED buf_stride,
+    size_t H5_ATTR_UNUSED bkg_stride, void H5_ATTR_UNUSED *_buf,
+    void H5_ATTR_UNUSED *bkg, hid_t H5_ATTR_UNUSED dset_xfer_plid)
+{
+    if(H5T_CONV_INIT == cdata->command)
+        cdata->need_bkg = H5T_BKG_NO;
+    return 0;
+}
+
+
+/*-------------------------------------------------------------------------
+ * Function:    test_path_cache
+ *
+ * Purpose:     Tests that conversion path lookups find the right path
+ *              after paths are registered and unregistered, and after a
+ *              datatype which was looked up is changed.
+ *
+ * Return:      Success:        0
+ *
+ *              Failure:        number of errors
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+test_path_cache(void)
+{
+    hid_t       src = -1, dst = -1, tmp = -1;
+    H5T_cdata_t *cdata = NULL;
+    H5T_conv_t  func, func2;
+
+    TESTING("conversion path lookups");
+
+    if((src = H5Tcreate(H5T_COMPOUND, (size_t)8)) < 0) TEST_ERROR
+    if(H5Tinsert(src, "a", (size_t)0, H5T_NATIVE_INT) < 0) TEST_ERROR
+    if(H5Tinsert(src, "b", (size_t)4, H5T_NATIVE_FLOAT) < 0) TEST_ERROR
+    if((dst = H5Tcreate(H5T_COMPOUND, (size_t)8)) < 0) TEST_ERROR
+    if(H5Tinsert(dst, "b", (size_t)0, H5T_NATIVE_FLOAT) < 0) TEST_ERROR
+    if(H5Tinsert(dst, "a", (size_t)4, H5T_NATIVE_INT) < 0) TEST_ERROR
+
+    /* Repeated lookups find the same path */
+    if(NULL == (func = H5Tfind(src, dst, &cdata))) TEST_ERROR
+    if(func != H5Tfind(src, dst, &cdata)) TEST_ERROR
+
+    /* A new hard conversion is found for the datatypes and for copies of them */
+    if(H5Tregister(H5T_PERS_HARD, "path_cache", src, dst, convert_path_cache) < 0) TEST_ERROR
+    if(convert_path_cache != H5Tfind(src, dst, &cdata)) TEST_ERROR
+    if((tmp = H5Tcopy(src)) < 0) TEST_ERROR
+    if(convert_path_cache != H5Tfind(tmp, dst, &cdata)) TEST_ERROR
+
+    /* Changing a datatype changes the path found for it */
+    if(H5Tset_size(tmp, (size_t)12) < 0) TEST_ERROR
+    if(NULL == (func2 = H5Tfind(tmp, dst, &cdata))) TEST_ERROR
+    if(convert_path_cache == func2) TEST_ERROR
+
+    /* The previous path is found again once the conversion is unregistered */
+    if(H5Tunregister(H5T_PERS_HARD, "path_cache", src, dst, convert_path_cache) < 0) TEST_ERROR
+    if(func != H5Tfind(src, dst, &cdata)) TEST_ERROR
+
+    /* Paths between predefined datatypes */
+    if(NULL == (func = H5Tfind(H5T_NATIVE_INT, H5T_STD_I64BE, &cdata))) TEST_ERROR
+    if(func != H5Tfind(H5T_NATIVE_INT, H5T_STD_I64BE, &cdata)) TEST_ERROR
+    if(func == H5Tfind(H5T_NATIVE_INT, H5T_NATIVE_INT, &cdata)) TEST_ERROR
+
+    if(H5Tclose(tmp) < 0) TEST_ERROR
+    if(H5Tclose(src) < 0) TEST_ERROR
+    if(H5Tclose(dst) < 0) TEST_ERROR
+
+    PASSED();
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Tclose(tmp);
+        H5Tclose(src);
+        H5Tclose(dst);
+    } H5E_END_TRY;
+    return 1;
+} /* end test_path_cache() */
+
+
 /*-------------------------------------------------------------------------
  * Function:	test_opaque
  *
@@ -7891,11 +8103,13 @@ main(void)
     nerrors += test_compound_16();
     nerrors += test_compound_17();
     nerrors += test_compound_18();
+    nerrors += test_compound_19();
     nerrors += test_conv_enum_1();
     nerrors += test_conv_enum_2();
     nerrors += test_conv_bitfield();
     nerrors += test_bitfield_funcs();
     nerrors += test_opaque();
+    nerrors += test_path_cache();
     nerrors += test_set_order();
     nerrors += test_utf_ascii_conv();
     nerrors += test_versionbounds();
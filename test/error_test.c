@@ -77,6 +77,17 @@ hid_t   ERR_MIN_GETNUM;
 
 #define DSET_FILTER_NAME    "dataset_with_filter"
 
+#define MISSING_NAME        "missing_dataset"
+#define RECORDS_SIZE        4096
+
+/* Error records gathered by records_cb() */
+typedef struct records_t {
+    char        text[RECORDS_SIZE];     /* Text of the records */
+    size_t      len;                    /* Length of the text */
+    unsigned    nrecords;               /* Number of records */
+    unsigned    nbad;                   /* Number of records with a missing string */
+} records_t;
+
 static herr_t custom_print_cb(unsigned n, const H5E_error2_t *err_desc,
     void *client_data);
 
@@ -385,6 +396,122 @@ error:
 #pragma GCC diagnostic pop
 
 
+/*-------------------------------------------------------------------------
+ * Function:    records_cb
+ *
+ * Purpose:     Callback to gather the text of each error record
+ *
+ * Return:      Success:    0
+ *              Failure:    -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+records_cb(unsigned H5_ATTR_UNUSED n, const H5E_error2_t *err_desc, void *client_data)
+{
+    records_t   *records = (records_t *)client_data;
+    int         len;
+
+    if (NULL == err_desc->func_name || '\0' == err_desc->func_name[0] ||
+            NULL == err_desc->file_name || '\0' == err_desc->file_name[0] ||
+            NULL == err_desc->desc || '\0' == err_desc->desc[0])
+        records->nbad++;
+    else {
+        len = HDsnprintf(records->text + records->len, RECORDS_SIZE - records->len, "%s:%u %s: %s\n",
+                err_desc->file_name, err_desc->line, err_desc->func_name, err_desc->desc);
+        if (len < 0 || (size_t)len >= RECORDS_SIZE - records->len)
+            return -1;
+        records->len += (size_t)len;
+    }
+    records->nrecords++;
+
+    return 0;
+} /* end records_cb() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    test_library_desc
+ *
+ * Purpose:     Test the error records the library pushes, with and without
+ *              formatted descriptions, through copies of the error stack
+ *
+ * Return:      Success:    0
+ *              Failure:    -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+test_library_desc(hid_t file)
+{
+    records_t   *records = NULL;        /* Records from the default stack */
+    records_t   *copy_records = NULL;   /* Records from the copies */
+    hid_t       estack_id = -1;         /* Error stack ID */
+    hid_t       dataset = -1;
+
+    if (NULL == (records = (records_t *)HDcalloc(1, sizeof(records_t))))
+        TEST_ERROR;
+    if (NULL == (copy_records = (records_t *)HDcalloc(1, sizeof(records_t))))
+        TEST_ERROR;
+
+    /* Fail to open a dataset, leaving the library's errors on the stack */
+    if (H5Eclear2(H5E_DEFAULT) < 0)
+        TEST_ERROR;
+    H5E_BEGIN_TRY {
+        dataset = H5Dopen2(file, MISSING_NAME, H5P_DEFAULT);
+    } H5E_END_TRY;
+    if (dataset >= 0)
+        TEST_ERROR;
+
+    /* Every record has all its strings, and the name was formatted into one */
+    if (H5Ewalk2(H5E_DEFAULT, H5E_WALK_UPWARD, records_cb, records) < 0)
+        TEST_ERROR;
+    if (records->nrecords < 2 || records->nbad != 0)
+        TEST_ERROR;
+    if (NULL == HDstrstr(records->text, MISSING_NAME))
+        TEST_ERROR;
+
+    /* A copy of the stack has the same records */
+    if ((estack_id = H5Eget_current_stack()) < 0)
+        TEST_ERROR;
+    if (H5Eget_num(H5E_DEFAULT) != 0)
+        TEST_ERROR;
+    if (H5Ewalk2(estack_id, H5E_WALK_UPWARD, records_cb, copy_records) < 0)
+        TEST_ERROR;
+    if (copy_records->nrecords != records->nrecords || copy_records->nbad != 0 ||
+            HDstrcmp(copy_records->text, records->text) != 0)
+        TEST_ERROR;
+
+    /* And so does the default stack, after the copy is put back */
+    if (H5Eset_current_stack(estack_id) < 0)
+        TEST_ERROR;
+    estack_id = -1;
+    HDmemset(copy_records, 0, sizeof(records_t));
+    if (H5Ewalk2(H5E_DEFAULT, H5E_WALK_UPWARD, records_cb, copy_records) < 0)
+        TEST_ERROR;
+    if (copy_records->nrecords != records->nrecords || copy_records->nbad != 0 ||
+            HDstrcmp(copy_records->text, records->text) != 0)
+        TEST_ERROR;
+
+    if (H5Eclear2(H5E_DEFAULT) < 0)
+        TEST_ERROR;
+
+    HDfree(records);
+    HDfree(copy_records);
+
+    return 0;
+
+error:
+    if (estack_id >= 0)
+        H5Eclose_stack(estack_id);
+    if (records)
+        HDfree(records);
+    if (copy_records)
+        HDfree(copy_records);
+
+    return -1;
+} /* end test_library_desc() */
+
+
 /*-------------------------------------------------------------------------
  * Function:    dump_error
  *
@@ -730,6 +857,10 @@ main(void)
     if (test_long_desc() < 0)
         TEST_ERROR;
 
+    /* Test the library's error records */
+    if (test_library_desc(file) < 0)
+        TEST_ERROR;
+
     /* Test creating a new error stack */
     if (test_create() < 0)
         TEST_ERROR;
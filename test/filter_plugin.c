@@ -20,6 +20,7 @@
  * This file needs to access private datatypes from the H5Z and H5PL package.
  */
 #define H5PL_FRIEND
+#define H5PL_TESTING
 #include "H5PLpkg.h"
 #define H5Z_FRIEND
 #include "H5Zpkg.h"
@@ -66,6 +67,11 @@ const hsize_t chunk_sizes_g[2] = {CHUNK_DIM1, CHUNK_DIM2};              /* Chunk
 #define SUBGROUP_PREFIX         "subgroup_"
 #define TOP_LEVEL_GROUP_NAME    "top-level group"
 
+/* Things used in the missing plugins test */
+#define MAX_SAVED_PATHS         8
+#define INDEX_DIR_NAME          "filter_plugin_index"
+#define MISSING_FILTER_ID       300
+
 /* Global arrays in which to save data */
 int **orig_deflate_g  = NULL;
 int **orig_dynlib1_g  = NULL;
@@ -936,6 +942,269 @@ error:
 
 
 
+/*-------------------------------------------------------------------------
+ * Function:  set_paths
+ *
+ * Purpose:   Replaces the plugin search paths with the given ones
+ *
+ * Return:    SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+set_paths(char paths[][FILENAME_BUF_SIZE], unsigned int n_paths)
+{
+    unsigned int u;
+
+    if (H5PLsize(&u) < 0)
+        TEST_ERROR;
+    for (; u > 0; u--)
+        if (H5PLremove(u - 1) < 0)
+            TEST_ERROR;
+    for (u = 0; u < n_paths; u++)
+        if (H5PLappend(paths[u]) < 0)
+            TEST_ERROR;
+
+    return SUCCEED;
+
+error:
+    return FAIL;
+} /* end set_paths() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:  write_index
+ *
+ * Purpose:   Writes the plugin index of the index test directory, with
+ *            the given line before one listing filter plugin 1
+ *
+ * Return:    SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+#ifndef H5_HAVE_WIN32_API
+static herr_t
+write_index(const char *index_name, const char *line, const char *lib_path)
+{
+    FILE   *index_file = NULL;
+
+    if (NULL == (index_file = HDfopen(index_name, "w")))
+        TEST_ERROR;
+    if (HDfprintf(index_file, "# Filter plugins\n\n%s\n%d %s\n", line, FILTER1_ID, lib_path) < 0)
+        TEST_ERROR;
+    if (HDfclose(index_file) < 0) {
+        index_file = NULL;
+        TEST_ERROR;
+    }
+
+    return SUCCEED;
+
+error:
+    if (index_file)
+        HDfclose(index_file);
+
+    return FAIL;
+} /* end write_index() */
+#endif /* H5_HAVE_WIN32_API */
+
+
+/*-------------------------------------------------------------------------
+ * Function:  test_missing_plugins
+ *
+ * Purpose:   Tests that filters that weren't found aren't searched for
+ *            again until the search paths or the loading state change,
+ *            that plugins are found through a directory's plugin index,
+ *            and that a directory with a bad index is searched instead.
+ *
+ * Return:    SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+test_missing_plugins(void)
+{
+    char            paths[MAX_SAVED_PATHS][FILENAME_BUF_SIZE];
+    unsigned int    n_paths = 0;
+    unsigned int    n_searches;
+    unsigned int    plugin_flags;
+    unsigned int    u;
+#ifndef H5_HAVE_WIN32_API
+    char            index_paths[2][FILENAME_BUF_SIZE];
+    char            lib_path[FILENAME_BUF_SIZE];
+    char            index_name[FILENAME_BUF_SIZE];
+    char           *bad_line = NULL;
+    DIR            *dirp = NULL;
+    struct dirent  *dp;
+#endif /* H5_HAVE_WIN32_API */
+
+    HDputs("Testing searches for missing filter plugins");
+
+    /* Unload the plugins, and save the search paths */
+    h5_reset();
+    if (H5PLsize(&n_paths) < 0)
+        TEST_ERROR;
+    if (n_paths == 0 || n_paths > MAX_SAVED_PATHS)
+        TEST_ERROR;
+    for (u = 0; u < n_paths; u++)
+        if (H5PLget(u, paths[u], (size_t)FILENAME_BUF_SIZE) <= 0)
+            TEST_ERROR;
+
+    TESTING("    missing filter isn't searched for again");
+
+    /* The first lookup searches every path, the second none */
+    n_searches = H5PL__get_num_dir_searches_test();
+    if (H5Zfilter_avail(MISSING_FILTER_ID) != FALSE)
+        TEST_ERROR;
+    if (H5PL__get_num_dir_searches_test() != n_searches + n_paths)
+        TEST_ERROR;
+    if (H5Zfilter_avail(MISSING_FILTER_ID) != FALSE)
+        TEST_ERROR;
+    if (H5PL__get_num_dir_searches_test() != n_searches + n_paths)
+        TEST_ERROR;
+
+    /* Setting the loading state searches again */
+    if (H5PLget_loading_state(&plugin_flags) < 0)
+        TEST_ERROR;
+    if (H5PLset_loading_state(plugin_flags) < 0)
+        TEST_ERROR;
+    if (H5Zfilter_avail(MISSING_FILTER_ID) != FALSE)
+        TEST_ERROR;
+    if (H5PL__get_num_dir_searches_test() != n_searches + 2 * n_paths)
+        TEST_ERROR;
+
+    PASSED();
+
+    TESTING("    missing filter found after a path is added");
+
+    /* Without any paths, the filter isn't found, and isn't found again */
+    if (set_paths(paths, 0) < 0)
+        TEST_ERROR;
+    if (H5Zfilter_avail(FILTER1_ID) != FALSE)
+        TEST_ERROR;
+    if (H5Zfilter_avail(FILTER1_ID) != FALSE)
+        TEST_ERROR;
+
+    /* Once the paths are back, it's found */
+    if (set_paths(paths, n_paths) < 0)
+        TEST_ERROR;
+    if (H5Zfilter_avail(FILTER1_ID) != TRUE)
+        TEST_ERROR;
+
+    PASSED();
+
+#ifndef H5_HAVE_WIN32_API
+    TESTING("    plugin index");
+
+    h5_restore_err();
+    h5_reset();
+
+    /* Find the library for filter plugin 1 */
+    lib_path[0] = '\0';
+    for (u = 0; u < n_paths && '\0' == lib_path[0]; u++) {
+        if (NULL == (dirp = HDopendir(paths[u])))
+            continue;
+        while (NULL != (dp = HDreaddir(dirp)))
+            if (HDstrstr(dp->d_name, "filter_plugin1_dsets")) {
+                if (HDsnprintf(lib_path, sizeof(lib_path), "%s/%s", paths[u], dp->d_name) >= (int)sizeof(lib_path))
+                    TEST_ERROR;
+                break;
+            }
+        HDclosedir(dirp);
+        dirp = NULL;
+    }
+    if ('\0' == lib_path[0])
+        TEST_ERROR;
+
+    /* Create a directory with an index listing the library */
+    if (HDmkdir(INDEX_DIR_NAME, (mode_t)0755) < 0 && errno != EEXIST)
+        TEST_ERROR;
+    if (HDsnprintf(index_name, sizeof(index_name), "%s/%s", INDEX_DIR_NAME, H5PL_INDEX_FILE_NAME) >= (int)sizeof(index_name))
+        TEST_ERROR;
+    if (write_index(index_name, "", lib_path) < 0)
+        TEST_ERROR;
+
+    /* Filter 1 is found through the index, and the filters it doesn't
+     * list are searched for in the other paths only
+     */
+    HDstrcpy(index_paths[0], INDEX_DIR_NAME);
+    HDstrcpy(index_paths[1], paths[n_paths - 1]);
+    if (set_paths(index_paths, 1) < 0)
+        TEST_ERROR;
+    n_searches = H5PL__get_num_dir_searches_test();
+    if (H5Zfilter_avail(FILTER1_ID) != TRUE)
+        TEST_ERROR;
+    if (H5Zfilter_avail(FILTER2_ID) != FALSE)
+        TEST_ERROR;
+    if (H5PL__get_num_dir_searches_test() != n_searches)
+        TEST_ERROR;
+    if (set_paths(index_paths, 2) < 0)
+        TEST_ERROR;
+    if (H5Zfilter_avail(FILTER2_ID) != TRUE)
+        TEST_ERROR;
+    if (H5PL__get_num_dir_searches_test() != n_searches + 1)
+        TEST_ERROR;
+
+    PASSED();
+
+    TESTING("    bad plugin index");
+
+    /* A line that's too long for the library's buffer */
+    if (NULL == (bad_line = (char *)HDmalloc(2 * H5PL_INDEX_LINE_SIZE + 1)))
+        TEST_ERROR;
+    HDmemset(bad_line, 'x', 2 * H5PL_INDEX_LINE_SIZE);
+    bad_line[2 * H5PL_INDEX_LINE_SIZE] = '\0';
+
+    /* A directory whose index has a bad line is searched like one
+     * without an index
+     */
+    for (u = 0; u < 2; u++) {
+        h5_restore_err();
+        h5_reset();
+
+        if (write_index(index_name, u == 0 ? "not-an-id libfoo.so" : bad_line, lib_path) < 0)
+            TEST_ERROR;
+        if (set_paths(index_paths, 2) < 0)
+            TEST_ERROR;
+        n_searches = H5PL__get_num_dir_searches_test();
+        if (H5Zfilter_avail(FILTER2_ID) != TRUE)
+            TEST_ERROR;
+        if (H5PL__get_num_dir_searches_test() != n_searches + 2)
+            TEST_ERROR;
+    }
+
+    HDfree(bad_line);
+    bad_line = NULL;
+
+    /* Put the paths back */
+    if (set_paths(paths, n_paths) < 0)
+        TEST_ERROR;
+    HDremove(index_name);
+    HDrmdir(INDEX_DIR_NAME);
+
+    PASSED();
+#endif /* H5_HAVE_WIN32_API */
+
+    /* Restore the default error handler (set in h5_reset()) */
+    h5_restore_err();
+
+    return SUCCEED;
+
+error:
+    H5E_BEGIN_TRY {
+        set_paths(paths, n_paths);
+    } H5E_END_TRY
+    h5_restore_err();
+#ifndef H5_HAVE_WIN32_API
+    if (dirp)
+        HDclosedir(dirp);
+    if (bad_line)
+        HDfree(bad_line);
+#endif /* H5_HAVE_WIN32_API */
+
+    return FAIL;
+} /* end test_missing_plugins() */
+
+
 /*-------------------------------------------------------------------------
  * Function:  test_path_api_calls
  *
@@ -1529,6 +1798,9 @@ main(void)
     /* TEST THE FILTER PLUGIN API CALLS */
     /************************************/
 
+    /* Test searching for filter plugins that weren't found */
+    nerrors += (test_missing_plugins() < 0  ? 1 : 0);
+
     /* Test the APIs for access to the filter plugin path table */
     nerrors += (test_path_api_calls() < 0  ? 1 : 0);
 
@@ -54,6 +54,7 @@ const char *FILENAME[] = {
     "gheap3",
     "gheap4",
     "gheapooo",
+    "gheapcursor",
     NULL
 };
 
@@ -567,6 +568,134 @@ test_ooo_indices(hid_t fapl)
 } /* end test_ooo_indices */
 
 
+/*-------------------------------------------------------------------------
+ * Function:    test_cursor
+ *
+ * Purpose:     Inserts a run of small objects through a global heap cursor
+ *              and checks that they are packed into a single collection
+ *              sized for the whole run, then reads them back through a
+ *              cursor and removes them while the collection is pinned.
+ *
+ * Return:      Success:    0
+ *
+ *              Failure:    number of errors
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+test_cursor(hid_t fapl)
+{
+    hid_t       file = H5I_INVALID_HID;
+    H5F_t       *f = NULL;
+    H5HG_cursor_t cursor = H5HG_CURSOR_INIT;
+    H5HG_t      *obj = NULL;
+    H5HG_t      again;
+    unsigned    u, v;
+    int         nerrors = 0;
+    char        filename[1024];
+
+    TESTING("cursor inserts and reads");
+
+    if(NULL == (obj = (H5HG_t *)HDmalloc(GHEAP_TEST_NOBJS * sizeof(*obj))))
+        goto error;
+
+    /* Open a clean file */
+    h5_fixname(FILENAME[5], fapl, filename, sizeof filename);
+    if((file = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0)
+        goto error;
+    if(NULL == (f = (H5F_t *)H5VL_object(file))) {
+        H5_FAILED();
+        HDputs("    Unable to create file");
+        goto error;
+    }
+
+    /* Insert the objects through one cursor, after reserving room for all
+     * of them.  They fit in one collection, so they should all land in it.
+     */
+    if(H5HG_cursor_reserve(f, &cursor, (size_t)GHEAP_TEST_NOBJS, GHEAP_TEST_NOBJS * sizeof(u)) < 0)
+        goto error;
+    for(u = 0; u < GHEAP_TEST_NOBJS; u++) {
+        H5Eclear2(H5E_DEFAULT);
+        if(H5HG_cursor_insert(f, &cursor, sizeof(u), &u, &obj[u]) < 0)
+            GHEAP_REPEATED_ERR("    Unable to insert object into global heap")
+        else if(obj[u].addr != obj[0].addr)
+            GHEAP_REPEATED_ERR("    Objects not packed into one collection")
+    }
+    if(H5HG_cursor_release(&cursor) < 0)
+        goto error;
+
+    /* Read the objects back through a cursor, then without one */
+    for(u = 0; u < GHEAP_TEST_NOBJS; u++) {
+        H5Eclear2(H5E_DEFAULT);
+        if(NULL == H5HG_cursor_read(f, &cursor, &obj[u], &v, NULL) || u != v)
+            GHEAP_REPEATED_ERR("    Incorrect value read through cursor")
+    }
+    for(u = 0; u < GHEAP_TEST_NOBJS; u++) {
+        H5Eclear2(H5E_DEFAULT);
+        if(NULL == H5HG_read(f, &obj[u], &v, NULL) || u != v)
+            GHEAP_REPEATED_ERR("    Incorrect value read")
+    }
+
+    /* Remove all the objects while the collection is still pinned by the
+     * cursor.  The empty collection must not be freed under the cursor.
+     */
+    for(u = 0; u < GHEAP_TEST_NOBJS; u++) {
+        H5Eclear2(H5E_DEFAULT);
+        if(H5HG_remove(f, &obj[u]) < 0)
+            GHEAP_REPEATED_ERR("    Unable to remove object from global heap")
+    }
+    if(H5HG_cursor_release(&cursor) < 0)
+        goto error;
+
+    /* The collection should still be usable */
+    u = 42;
+    if(H5HG_cursor_insert(f, &cursor, sizeof(u), &u, &again) < 0)
+        goto error;
+    if(H5HG_cursor_release(&cursor) < 0)
+        goto error;
+    if(again.addr != obj[0].addr) {
+        H5_FAILED();
+        HDputs("    Emptied collection not reused");
+        nerrors++;
+    }
+
+    /* Reopen the file and check the object written last */
+    if(H5Fclose(file) < 0)
+        goto error;
+    if((file = H5Fopen(filename, H5F_ACC_RDWR, fapl)) < 0)
+        goto error;
+    if(NULL == (f = (H5F_t *)H5VL_object(file))) {
+        H5_FAILED();
+        HDputs("    Unable to open file");
+        goto error;
+    }
+    if(NULL == H5HG_read(f, &again, &v, NULL) || v != 42) {
+        H5_FAILED();
+        HDputs("    Incorrect read value");
+        nerrors++;
+    }
+
+    if(H5Fclose(file) < 0)
+        goto error;
+    if(nerrors)
+        goto error;
+    HDfree(obj);
+    obj = NULL;
+
+    PASSED();
+    return 0;
+
+ error:
+    H5HG_cursor_release(&cursor);
+    H5E_BEGIN_TRY {
+        H5Fclose(file);
+    } H5E_END_TRY;
+    if(obj)
+        HDfree(obj);
+    return MAX(1, nerrors);
+} /* end test_cursor */
+
+
 /*-------------------------------------------------------------------------
  * Function:	main
  *
@@ -596,6 +725,7 @@ main (void)
     nerrors += test_3(fapl_id);
     nerrors += test_4(fapl_id);
     nerrors += test_ooo_indices(fapl_id);
+    nerrors += test_cursor(fapl_id);
 
     /* Verify symbol table messages are cached */
     nerrors += (h5_verify_cached_stabs(FILENAME, fapl_id) < 0 ? 1 : 0);
@@ -57,6 +57,10 @@ const char *FILENAME[] = {
 #define DSET_NAME "COMPACT_DSET"
 #define OBJ_VERSION_LATEST 2
 
+/* Used for testing loading continuation chunks on demand */
+#define LAZY_NATTRS     4
+#define LAZY_ATTR_SIZE  64
+
 /*
  *  Verify that messages are moved forward into a "continuation message":
  *    Create an object header with several continuation chunks
@@ -165,6 +169,293 @@ error:
     return FAIL;
 } /* end test_cont() */
 
+/*
+ *  Verify that continuation chunks of an object header are loaded on demand:
+ *    Create datasets with enough attributes to need several chunks
+ *    Re-open the file and a dataset, which only needs the first chunk
+ *    Query the object header information, which needs all the chunks
+ *    Check that the attributes and data are intact, and that the object
+ *        header can still be modified after it was loaded partially
+ */
+static herr_t
+test_lazy_chunks(char *filename, hid_t fapl)
+{
+    hid_t       file = -1;              /* File ID */
+    hid_t       sid = -1;               /* Dataspace ID */
+    hid_t       dset[2] = {-1, -1};     /* Dataset IDs */
+    hid_t       dcpl = -1;              /* Dataset creation property list ID */
+    hid_t       attr = -1;              /* Attribute ID */
+    hsize_t     dims[1] = {LAZY_ATTR_SIZE};     /* Dimensions of datasets and attributes */
+    H5O_info_t  oinfo;                  /* Object info */
+    char        attrname[32];           /* Name of attribute */
+    int         wdata[LAZY_ATTR_SIZE];  /* Data written */
+    int         rdata[LAZY_ATTR_SIZE];  /* Data read */
+    size_t      nloaded, nunloaded;     /* # of chunks loaded and not loaded */
+    unsigned    u, v;                   /* Local index variables */
+
+    TESTING("loading object header continuation chunks on demand");
+
+    /* Create the file, with datasets whose attributes are stored compactly */
+    if((file = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0)
+        FAIL_STACK_ERROR
+    if((sid = H5Screate_simple(1, dims, NULL)) < 0)
+        FAIL_STACK_ERROR
+    if((dcpl = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+        FAIL_STACK_ERROR
+    if(H5Pset_attr_phase_change(dcpl, LAZY_NATTRS + 1, LAZY_NATTRS) < 0)
+        FAIL_STACK_ERROR
+    for(u = 0; u < 2; u++) {
+        HDsprintf(attrname, "dset%u", u);
+        if((dset[u] = H5Dcreate2(file, attrname, H5T_NATIVE_INT, sid, H5P_DEFAULT, dcpl, H5P_DEFAULT)) < 0)
+            FAIL_STACK_ERROR
+        for(v = 0; v < LAZY_ATTR_SIZE; v++)
+            wdata[v] = (int)(u * 100 + v);
+        if(H5Dwrite(dset[u], H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, wdata) < 0)
+            FAIL_STACK_ERROR
+    } /* end for */
+
+    /* Add attributes to both datasets in turn, so that neither object
+     * header can grow in place and continuation chunks are created.  (The
+     * attributes are too large for the free space in the first chunk, so
+     * each one goes in a new chunk and the dataset's own messages stay in
+     * the first chunk.)
+     */
+    for(u = 0; u < LAZY_NATTRS; u++)
+        for(v = 0; v < 2; v++) {
+            unsigned w;
+
+            HDsprintf(attrname, "attr %02u", u);
+            if((attr = H5Acreate2(dset[v], attrname, H5T_NATIVE_INT, sid, H5P_DEFAULT, H5P_DEFAULT)) < 0)
+                FAIL_STACK_ERROR
+            for(w = 0; w < LAZY_ATTR_SIZE; w++)
+                wdata[w] = (int)(u * 1000 + w);
+            if(H5Awrite(attr, H5T_NATIVE_INT, wdata) < 0)
+                FAIL_STACK_ERROR
+            if(H5Aclose(attr) < 0)
+                FAIL_STACK_ERROR
+        } /* end for */
+    for(u = 0; u < 2; u++)
+        if(H5Dclose(dset[u]) < 0)
+            FAIL_STACK_ERROR
+    if(H5Fclose(file) < 0)
+        FAIL_STACK_ERROR
+
+    /* Re-open the file read-only and open a dataset, then again read-write */
+    for(u = 0; u < 2; u++) {
+        if((file = H5Fopen(filename, (u ? H5F_ACC_RDWR : H5F_ACC_RDONLY), fapl)) < 0)
+            FAIL_STACK_ERROR
+        if((dset[0] = H5Dopen2(file, "dset0", H5P_DEFAULT)) < 0)
+            FAIL_STACK_ERROR
+
+        /* Opening the dataset should have left some chunks unloaded */
+        if(H5O__msg_chunks_loaded_test(dset[0], H5O_DTYPE_ID, &nloaded, &nunloaded) < 0)
+            FAIL_STACK_ERROR
+        if(0 == nunloaded)
+            TEST_ERROR
+
+        /* The data should be read correctly */
+        if(H5Dread(dset[0], H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rdata) < 0)
+            FAIL_STACK_ERROR
+        for(v = 0; v < LAZY_ATTR_SIZE; v++)
+            if(rdata[v] != (int)v)
+                TEST_ERROR
+
+        /* Querying the whole object header loads the rest of the chunks */
+        if(H5Oget_info2(dset[0], &oinfo, H5O_INFO_HDR | H5O_INFO_NUM_ATTRS) < 0)
+            FAIL_STACK_ERROR
+        if(oinfo.num_attrs != LAZY_NATTRS)
+            TEST_ERROR
+        if(oinfo.hdr.nchunks < nloaded + nunloaded)
+            TEST_ERROR
+        if(H5O__msg_chunks_loaded_test(dset[0], H5O_DTYPE_ID, &nloaded, &nunloaded) < 0)
+            FAIL_STACK_ERROR
+        if(nunloaded != 0 || nloaded != oinfo.hdr.nchunks)
+            TEST_ERROR
+
+        /* Check the last attribute */
+        HDsprintf(attrname, "attr %02u", LAZY_NATTRS - 1);
+        if((attr = H5Aopen(dset[0], attrname, H5P_DEFAULT)) < 0)
+            FAIL_STACK_ERROR
+        if(H5Aread(attr, H5T_NATIVE_INT, rdata) < 0)
+            FAIL_STACK_ERROR
+        if(H5Aclose(attr) < 0)
+            FAIL_STACK_ERROR
+        for(v = 0; v < LAZY_ATTR_SIZE; v++)
+            if(rdata[v] != (int)((LAZY_NATTRS - 1) * 1000 + v))
+                TEST_ERROR
+
+        /* Add one more attribute, when the file is writable */
+        if(u) {
+            if((attr = H5Acreate2(dset[0], "extra", H5T_NATIVE_INT, sid, H5P_DEFAULT, H5P_DEFAULT)) < 0)
+                FAIL_STACK_ERROR
+            if(H5Awrite(attr, H5T_NATIVE_INT, wdata) < 0)
+                FAIL_STACK_ERROR
+            if(H5Aclose(attr) < 0)
+                FAIL_STACK_ERROR
+        } /* end if */
+
+        if(H5Dclose(dset[0]) < 0)
+            FAIL_STACK_ERROR
+        if(H5Fclose(file) < 0)
+            FAIL_STACK_ERROR
+    } /* end for */
+
+    /* Check the attribute added */
+    if((file = H5Fopen(filename, H5F_ACC_RDONLY, fapl)) < 0)
+        FAIL_STACK_ERROR
+    if((dset[0] = H5Dopen2(file, "dset0", H5P_DEFAULT)) < 0)
+        FAIL_STACK_ERROR
+    if((attr = H5Aopen(dset[0], "extra", H5P_DEFAULT)) < 0)
+        FAIL_STACK_ERROR
+    if(H5Aread(attr, H5T_NATIVE_INT, rdata) < 0)
+        FAIL_STACK_ERROR
+    if(H5Aclose(attr) < 0)
+        FAIL_STACK_ERROR
+    for(v = 0; v < LAZY_ATTR_SIZE; v++)
+        if(rdata[v] != wdata[v])
+            TEST_ERROR
+    if(H5Dclose(dset[0]) < 0)
+        FAIL_STACK_ERROR
+    if(H5Fclose(file) < 0)
+        FAIL_STACK_ERROR
+
+    if(H5Pclose(dcpl) < 0)
+        FAIL_STACK_ERROR
+    if(H5Sclose(sid) < 0)
+        FAIL_STACK_ERROR
+
+    PASSED();
+
+    return SUCCEED;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Aclose(attr);
+        H5Dclose(dset[0]);
+        H5Dclose(dset[1]);
+        H5Pclose(dcpl);
+        H5Sclose(sid);
+        H5Fclose(file);
+    } H5E_END_TRY;
+
+    return FAIL;
+} /* end test_lazy_chunks() */
+
+/*
+ *  Verify that an object header whose continuation chunk fails to load
+ *  keeps failing cleanly:
+ *    Corrupt the signature of a continuation chunk written by
+ *        test_lazy_chunks(), keeping its checksum valid
+ *    Re-open the datasets and query their whole object headers twice
+ *    Both queries of the damaged header should fail, and the other
+ *        header should still load
+ */
+static herr_t
+test_lazy_chunk_error(char *filename, hid_t fapl)
+{
+    hid_t       file = -1;              /* File ID */
+    hid_t       dset = -1;              /* Dataset ID */
+    H5O_info_t  oinfo;                  /* Object info */
+    FILE        *fp = NULL;             /* File pointer for the HDF5 file */
+    uint8_t     *image = NULL;          /* Image of the whole file */
+    uint8_t     *p;                     /* Pointer into image */
+    long        file_size;              /* Size of the file */
+    size_t      chk_off, chk_end;       /* Offsets of chunk and its checksum */
+    uint32_t    chksum;                 /* Checksum of chunk */
+    char        dsetname[32];           /* Name of dataset */
+    herr_t      ret1, ret2;             /* Return values of the queries */
+    unsigned    nfailed = 0;            /* # of datasets whose header failed to load */
+    unsigned    u;                      /* Local index variable */
+
+    TESTING("continuation chunk that fails to load");
+
+    /* Read the file written by test_lazy_chunks() */
+    if(NULL == (fp = HDfopen(filename, "rb+")))
+        TEST_ERROR
+    if(HDfseek(fp, 0, SEEK_END) < 0 || (file_size = HDftell(fp)) <= 0)
+        TEST_ERROR
+    if(NULL == (image = (uint8_t *)HDmalloc((size_t)file_size)))
+        TEST_ERROR
+    if(HDfseek(fp, 0, SEEK_SET) < 0 || HDfread(image, (size_t)1, (size_t)file_size, fp) != (size_t)file_size)
+        TEST_ERROR
+
+    /* Find the first continuation chunk.  (Only version 2 object headers
+     * have signatures and checksums on their chunks.)
+     */
+    for(chk_off = 0; chk_off + H5_SIZEOF_MAGIC <= (size_t)file_size; chk_off++)
+        if(!HDmemcmp(image + chk_off, H5O_CHK_MAGIC, (size_t)H5_SIZEOF_MAGIC))
+            break;
+    if(chk_off + H5_SIZEOF_MAGIC > (size_t)file_size) {
+        HDfclose(fp);
+        HDfree(image);
+        SKIPPED();
+        HDputs("    No version 2 object header chunks in the file.");
+        return SUCCEED;
+    } /* end if */
+
+    /* Find the end of the chunk, where its checksum is stored */
+    for(chk_end = chk_off + H5_SIZEOF_MAGIC; chk_end + H5_SIZEOF_CHKSUM <= (size_t)file_size; chk_end++) {
+        p = image + chk_end;
+        UINT32DECODE(p, chksum);
+        if(chksum == H5_checksum_metadata(image + chk_off, chk_end - chk_off, 0))
+            break;
+    } /* end for */
+    if(chk_end + H5_SIZEOF_CHKSUM > (size_t)file_size)
+        TEST_ERROR
+
+    /* Damage the signature, with a checksum that matches */
+    image[chk_off] = 'X';
+    chksum = H5_checksum_metadata(image + chk_off, chk_end - chk_off, 0);
+    p = image + chk_end;
+    UINT32ENCODE(p, chksum);
+    if(HDfseek(fp, 0, SEEK_SET) < 0 || HDfwrite(image, (size_t)1, (size_t)file_size, fp) != (size_t)file_size)
+        TEST_ERROR
+    if(HDfclose(fp) < 0)
+        TEST_ERROR
+    fp = NULL;
+    HDfree(image);
+    image = NULL;
+
+    /* Query each dataset's whole object header twice */
+    if((file = H5Fopen(filename, H5F_ACC_RDONLY, fapl)) < 0)
+        FAIL_STACK_ERROR
+    for(u = 0; u < 2; u++) {
+        HDsprintf(dsetname, "dset%u", u);
+        if((dset = H5Dopen2(file, dsetname, H5P_DEFAULT)) < 0)
+            FAIL_STACK_ERROR
+        H5E_BEGIN_TRY {
+            ret1 = H5Oget_info2(dset, &oinfo, H5O_INFO_HDR | H5O_INFO_NUM_ATTRS);
+            ret2 = H5Oget_info2(dset, &oinfo, H5O_INFO_HDR | H5O_INFO_NUM_ATTRS);
+        } H5E_END_TRY;
+        if((ret1 < 0) != (ret2 < 0))
+            TEST_ERROR
+        if(ret1 < 0)
+            nfailed++;
+        if(H5Dclose(dset) < 0)
+            FAIL_STACK_ERROR
+    } /* end for */
+    if(nfailed != 1)
+        TEST_ERROR
+    if(H5Fclose(file) < 0)
+        FAIL_STACK_ERROR
+
+    PASSED();
+
+    return SUCCEED;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Dclose(dset);
+        H5Fclose(file);
+    } H5E_END_TRY;
+    if(fp)
+        HDfclose(fp);
+    if(image)
+        HDfree(image);
+
+    return FAIL;
+} /* end test_lazy_chunk_error() */
+
 /*
  *  Verify that object headers are held in the cache until they are linked
  *      to a location in the graph, or assigned an ID.  This is done by
@@ -1649,6 +1940,14 @@ main(void)
         if(test_cont(filename, fapl) < 0)
             TEST_ERROR
 
+        /* test on loading continuation chunks on demand */
+        if(test_lazy_chunks(filename, fapl) < 0)
+            TEST_ERROR
+        if(single_file_vfd) {
+            if(test_lazy_chunk_error(filename, fapl) < 0)
+                TEST_ERROR
+        } /* end if */
+
         /* Create the file to operate on */
         if((file = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0)
             FAIL_STACK_ERROR
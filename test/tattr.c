@@ -8378,6 +8378,188 @@ test_attr_create_by_name(hbool_t new_format, hid_t fcpl, hid_t fapl)
     CHECK(ret, FAIL, "H5Sclose");
 }   /* test_attr_create_by_name() */
 
+
+/****************************************************************
+**
+**  test_attr_read_bulk(): Test basic H5A (attribute) code.
+**      Tests reading many attributes at once with H5Aread_bulk
+**
+****************************************************************/
+static void
+test_attr_read_bulk(hbool_t new_format, hid_t fcpl, hid_t fapl)
+{
+    hid_t       fid;                    /* HDF5 File ID */
+    hid_t       dataset;                /* Dataset ID */
+    hid_t       sid;                    /* Dataspace ID */
+    hid_t       scalar_sid;             /* Scalar dataspace ID */
+    hid_t       vlstr_tid;              /* Variable-length string datatype ID */
+    hid_t       attr;                   /* Attribute ID */
+    hid_t       dcpl;                   /* Dataset creation property list ID */
+    hsize_t     dims[1] = {2};          /* Attribute dimensions */
+    char        attrname[NAME_BUF_SIZE];    /* Name of attribute */
+    const char  *vlstr = "variable-length";    /* Data for string attribute */
+    const char  *names[3];              /* Names of attributes to read */
+    H5A_bulk_info_t info[32];           /* Information about attributes read */
+    unsigned    max_compact;            /* Maximum # of attributes to store compactly */
+    unsigned    min_dense;              /* Minimum # of attributes to store "densely" */
+    unsigned    nattrs;                 /* Number of attributes to create */
+    void        *arena = NULL;          /* Arena for attribute data */
+    size_t      arena_size;             /* Size of arena */
+    size_t      small_size;             /* Size of too small arena */
+    ssize_t     nread;                  /* Number of attributes read */
+    int         data[2];                /* Attribute data */
+    unsigned    u, v;                   /* Local index variables */
+    herr_t      ret;                    /* Generic return value */
+
+    /* Output message about test being performed */
+    MESSAGE(5, ("Testing Reading Many Attributes at Once\n"));
+
+    /* Create dataspaces and datatype for attributes */
+    sid = H5Screate_simple(1, dims, NULL);
+    CHECK(sid, FAIL, "H5Screate_simple");
+    scalar_sid = H5Screate(H5S_SCALAR);
+    CHECK(scalar_sid, FAIL, "H5Screate");
+    vlstr_tid = H5Tcopy(H5T_C_S1);
+    CHECK(vlstr_tid, FAIL, "H5Tcopy");
+    ret = H5Tset_size(vlstr_tid, H5T_VARIABLE);
+    CHECK(ret, FAIL, "H5Tset_size");
+
+    /* Query the compact/dense storage thresholds */
+    dcpl = H5Pcreate(H5P_DATASET_CREATE);
+    CHECK(dcpl, FAIL, "H5Pcreate");
+    ret = H5Pget_attr_phase_change(dcpl, &max_compact, &min_dense);
+    CHECK(ret, FAIL, "H5Pget_attr_phase_change");
+
+    /* Try attributes in compact storage, then in dense storage (new format only) */
+    for(nattrs = 3; nattrs <= (new_format ? max_compact * 2 : 3); nattrs += max_compact * 2 - 3) {
+        fid = H5Fcreate(FILENAME, H5F_ACC_TRUNC, fcpl, fapl);
+        CHECK(fid, FAIL, "H5Fcreate");
+        dataset = H5Dcreate2(fid, DSET1_NAME, H5T_NATIVE_UCHAR, scalar_sid, H5P_DEFAULT, dcpl, H5P_DEFAULT);
+        CHECK(dataset, FAIL, "H5Dcreate2");
+
+        /* Create integer attributes, in reverse name order, and a string one */
+        for(u = nattrs; u > 0; u--) {
+            HDsprintf(attrname, "attr %02u", u - 1);
+            attr = H5Acreate2(dataset, attrname, H5T_NATIVE_INT, sid, H5P_DEFAULT, H5P_DEFAULT);
+            CHECK(attr, FAIL, "H5Acreate2");
+            data[0] = (int)(u - 1);
+            data[1] = -(int)(u - 1);
+            ret = H5Awrite(attr, H5T_NATIVE_INT, data);
+            CHECK(ret, FAIL, "H5Awrite");
+            ret = H5Aclose(attr);
+            CHECK(ret, FAIL, "H5Aclose");
+        } /* end for */
+        attr = H5Acreate2(dataset, "vlstr", vlstr_tid, scalar_sid, H5P_DEFAULT, H5P_DEFAULT);
+        CHECK(attr, FAIL, "H5Acreate2");
+        ret = H5Awrite(attr, vlstr_tid, &vlstr);
+        CHECK(ret, FAIL, "H5Awrite");
+        ret = H5Aclose(attr);
+        CHECK(ret, FAIL, "H5Aclose");
+
+        ret = H5Dclose(dataset);
+        CHECK(ret, FAIL, "H5Dclose");
+        ret = H5Fclose(fid);
+        CHECK(ret, FAIL, "H5Fclose");
+
+        fid = H5Fopen(FILENAME, H5F_ACC_RDONLY, fapl);
+        CHECK(fid, FAIL, "H5Fopen");
+        dataset = H5Dopen2(fid, DSET1_NAME, H5P_DEFAULT);
+        CHECK(dataset, FAIL, "H5Dopen2");
+
+        /* Query the size of the arena for all attributes */
+        arena_size = 0;
+        nread = H5Aread_bulk(dataset, NULL, 0, NULL, 0, NULL, &arena_size);
+        VERIFY(nread, (ssize_t)(nattrs + 1), "H5Aread_bulk");
+        CHECK(arena_size, 0, "H5Aread_bulk");
+
+        /* An arena that is too small is an error */
+        arena = HDmalloc(arena_size);
+        CHECK_PTR(arena, "HDmalloc");
+        small_size = arena_size - 1;
+        H5E_BEGIN_TRY {
+            nread = H5Aread_bulk(dataset, NULL, 0, info, (size_t)32, arena, &small_size);
+        } H5E_END_TRY;
+        VERIFY(nread, FAIL, "H5Aread_bulk");
+
+        /* Read all attributes */
+        nread = H5Aread_bulk(dataset, NULL, 0, info, (size_t)32, arena, &arena_size);
+        VERIFY(nread, (ssize_t)(nattrs + 1), "H5Aread_bulk");
+        for(u = 0; u < nattrs; u++) {
+            int *rdata = (int *)info[u].data;
+
+            HDsprintf(attrname, "attr %02u", u);
+            VERIFY_STR(info[u].name, attrname, "H5Aread_bulk");
+            VERIFY(info[u].nelmts, 2, "H5Aread_bulk");
+            VERIFY(info[u].data_size, 2 * sizeof(int), "H5Aread_bulk");
+            VERIFY(H5Tequal(info[u].type_id, H5T_NATIVE_INT), TRUE, "H5Tequal");
+            VERIFY(rdata[0], (int)u, "H5Aread_bulk");
+            VERIFY(rdata[1], -(int)u, "H5Aread_bulk");
+            ret = H5Tclose(info[u].type_id);
+            CHECK(ret, FAIL, "H5Tclose");
+        } /* end for */
+        VERIFY_STR(info[nattrs].name, "vlstr", "H5Aread_bulk");
+        VERIFY(H5Tis_variable_str(info[nattrs].type_id), TRUE, "H5Tis_variable_str");
+        VERIFY_STR(*(char **)info[nattrs].data, vlstr, "H5Aread_bulk");
+        H5free_memory(*(char **)info[nattrs].data);
+        ret = H5Tclose(info[nattrs].type_id);
+        CHECK(ret, FAIL, "H5Tclose");
+
+        /* Read a subset of the attributes, including one that doesn't exist */
+        names[0] = "vlstr";
+        names[1] = "no such attribute";
+        names[2] = "attr 01";
+        nread = H5Aread_bulk(dataset, names, (size_t)3, info, (size_t)3, arena, &arena_size);
+        VERIFY(nread, 2, "H5Aread_bulk");
+        VERIFY_STR(info[0].name, "vlstr", "H5Aread_bulk");
+        VERIFY_STR(*(char **)info[0].data, vlstr, "H5Aread_bulk");
+        H5free_memory(*(char **)info[0].data);
+        VERIFY(info[1].name, NULL, "H5Aread_bulk");
+        VERIFY(info[1].type_id, H5I_INVALID_HID, "H5Aread_bulk");
+        VERIFY_STR(info[2].name, "attr 01", "H5Aread_bulk");
+        VERIFY(((int *)info[2].data)[1], -1, "H5Aread_bulk");
+        for(v = 0; v < 3; v++)
+            if(info[v].type_id >= 0) {
+                ret = H5Tclose(info[v].type_id);
+                CHECK(ret, FAIL, "H5Tclose");
+            } /* end if */
+
+        /* Requesting the same name twice is an error */
+        names[1] = "vlstr";
+        H5E_BEGIN_TRY {
+            nread = H5Aread_bulk(dataset, names, (size_t)3, info, (size_t)3, arena, &arena_size);
+        } H5E_END_TRY;
+        VERIFY(nread, FAIL, "H5Aread_bulk");
+
+        /* An info array smaller than the list of names is an error, and
+         * the entries past its end are left alone */
+        names[1] = "no such attribute";
+        info[2].name = attrname;
+        info[2].type_id = H5I_INVALID_HID;
+        H5E_BEGIN_TRY {
+            nread = H5Aread_bulk(dataset, names, (size_t)3, info, (size_t)2, arena, &arena_size);
+        } H5E_END_TRY;
+        VERIFY(nread, FAIL, "H5Aread_bulk");
+        VERIFY(info[2].name, attrname, "H5Aread_bulk");
+
+        HDfree(arena);
+        arena = NULL;
+
+        ret = H5Dclose(dataset);
+        CHECK(ret, FAIL, "H5Dclose");
+        ret = H5Fclose(fid);
+        CHECK(ret, FAIL, "H5Fclose");
+    } /* end for */
+
+    ret = H5Pclose(dcpl);
+    CHECK(ret, FAIL, "H5Pclose");
+    ret = H5Tclose(vlstr_tid);
+    CHECK(ret, FAIL, "H5Tclose");
+    ret = H5Sclose(scalar_sid);
+    CHECK(ret, FAIL, "H5Sclose");
+    ret = H5Sclose(sid);
+    CHECK(ret, FAIL, "H5Sclose");
+}   /* test_attr_read_bulk() */
+
 /****************************************************************
 **
 **  test_attr_shared_write(): Test basic H5A (attribute) code.
@@ -11270,6 +11452,7 @@ test_attr(void)
                 test_attr_open_by_idx(new_format, my_fcpl, my_fapl);    /* Test opening attributes by index */
                 test_attr_open_by_name(new_format, my_fcpl, my_fapl);   /* Test opening attributes by name */
                 test_attr_create_by_name(new_format, my_fcpl, my_fapl); /* Test creating attributes by name */
+                test_attr_read_bulk(new_format, my_fcpl, my_fapl);      /* Test reading many attributes at once */
 
                 /* Tests that address specific bugs
                  */
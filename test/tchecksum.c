@@ -31,6 +31,7 @@
 /* Macros */
 /**********/
 #define BUF_LEN 3093    /* No particular value */
+#define LONG_BUF_LEN (1024 * 1024 + 7)  /* Spans several fletcher32 reduction blocks */
 
 /*******************/
 /* Local variables */
@@ -219,6 +220,90 @@ test_chksum_large(void)
 } /* test_chksum_large() */
 
 
+/****************************************************************
+**
+**  ref_fletcher32(): Straightforward fletcher32 checksum, reducing
+**      the sums every 360 words, for comparison with the library's
+**      version
+**
+****************************************************************/
+static uint32_t
+ref_fletcher32(const uint8_t *data, size_t _len)
+{
+    size_t len = _len / 2;
+    uint32_t sum1 = 0, sum2 = 0;
+
+    while(len) {
+        size_t tlen = len > 360 ? 360 : len;
+        len -= tlen;
+        do {
+            sum1 += (uint32_t)(((uint16_t)data[0]) << 8) | ((uint16_t)data[1]);
+            data += 2;
+            sum2 += sum1;
+        } while(--tlen);
+        sum1 = (sum1 & 0xffff) + (sum1 >> 16);
+        sum2 = (sum2 & 0xffff) + (sum2 >> 16);
+    }
+    if(_len % 2) {
+        sum1 += (uint32_t)(((uint16_t)*data) << 8);
+        sum2 += sum1;
+        sum1 = (sum1 & 0xffff) + (sum1 >> 16);
+        sum2 = (sum2 & 0xffff) + (sum2 >> 16);
+    }
+    sum1 = (sum1 & 0xffff) + (sum1 >> 16);
+    sum2 = (sum2 & 0xffff) + (sum2 >> 16);
+
+    return (sum2 << 16) | sum1;
+} /* ref_fletcher32() */
+
+
+/****************************************************************
+**
+**  test_chksum_sizes(): Checksum buffers of many lengths and
+**      alignments, comparing against the reference algorithm
+**
+****************************************************************/
+static void
+test_chksum_sizes(void)
+{
+    uint8_t *long_buf;          /* Buffer for checksum calculations */
+    uint8_t aligned[64 + 8];    /* Aligned copy of part of the buffer */
+    uint32_t chksum;            /* Checksum value */
+    size_t u, len, off;         /* Local index variables */
+    int fill;                   /* Which buffer contents */
+
+    /* Allocate the buffer */
+    long_buf = (uint8_t *)HDmalloc((size_t)LONG_BUF_LEN);
+    CHECK_PTR(long_buf, "HDmalloc");
+
+    /* All 0xff bytes make the sums hit multiples of 65535 */
+    for(fill = 0; fill < 2; fill++) {
+        for(u = 0; u < LONG_BUF_LEN; u++)
+            long_buf[u] = (uint8_t)(fill ? (u * 7 + (u >> 9)) : 0xff);
+
+        for(len = 1; len < 1500; len++)
+            for(off = 0; off < 3; off++) {
+                chksum = H5_checksum_fletcher32(long_buf + off, len);
+                VERIFY(chksum, ref_fletcher32(long_buf + off, len), "H5_checksum_fletcher32");
+            } /* end for */
+
+        chksum = H5_checksum_fletcher32(long_buf, (size_t)LONG_BUF_LEN);
+        VERIFY(chksum, ref_fletcher32(long_buf, (size_t)LONG_BUF_LEN), "H5_checksum_fletcher32");
+
+        /* lookup3 must not depend on the alignment of the buffer */
+        for(len = 1; len <= 64; len++)
+            for(off = 1; off < 8; off++) {
+                HDmemcpy(aligned, long_buf + off, len);
+                chksum = H5_checksum_lookup3(long_buf + off, len, (uint32_t)off);
+                VERIFY(chksum, H5_checksum_lookup3(aligned, len, (uint32_t)off), "H5_checksum_lookup3");
+            } /* end for */
+    } /* end for */
+
+    /* Release memory for buffer */
+    HDfree(long_buf);
+} /* test_chksum_sizes() */
+
+
 /****************************************************************
 **
 **  test_checksum(): Main checksum testing routine.
@@ -236,6 +321,7 @@ test_checksum(void)
     test_chksum_size_three();		/* Test buffer w/only 3 bytes */
     test_chksum_size_four();		/* Test buffer w/only 4 bytes */
     test_chksum_large();		/* Test buffer w/larger # of bytes */
+    test_chksum_sizes();		/* Test buffers of many sizes */
 
 } /* test_checksum() */
 
@@ -7464,6 +7464,393 @@ test_incr_filesize(void)
     }
 } /* end test_incr_filesize() */
 
+/****************************************************************
+**
+**  test_file_compact():
+**    Verify that H5Fcompact() moves raw data into free space
+**    released earlier in the file, so that the file shrinks
+**    without changing the data.
+**
+****************************************************************/
+#define FILE_COMPACT            "tfile_compact"
+#define FILE_COMPACT_NELMTS     (64 * 1024)
+#define FILE_COMPACT_CHUNK      1024
+static void
+test_file_compact(const char *env_h5_drvr)
+{
+    hid_t    fid = -1;                  /* File ID */
+    hid_t    fcpl = -1;                 /* File creation property list */
+    hid_t    fapl = -1;                 /* File access property list */
+    hid_t    dspace = -1;               /* Dataspace ID */
+    hid_t    dcpl = -1;                 /* Dataset creation property list */
+    hid_t    dset = -1;                 /* Dataset ID */
+    hsize_t  dims[1] = {FILE_COMPACT_NELMTS};   /* Dataset dimensions */
+    hsize_t  chunk_dims[1] = {FILE_COMPACT_CHUNK};  /* Chunk dimensions */
+    hsize_t  moved;                     /* Number of bytes moved */
+    h5_stat_size_t size_before;         /* File size before compaction */
+    h5_stat_size_t size_after;          /* File size after compaction */
+    char     filename[FILENAME_LEN];    /* Filename to use */
+    unsigned *wbuf = NULL;              /* Data written */
+    unsigned *rbuf = NULL;              /* Data read */
+    unsigned u;                         /* Local index variable */
+    herr_t   ret;                       /* Generic return value */
+
+    /* Output message about test being performed */
+    MESSAGE(5, ("Testing compacting a file with H5Fcompact()\n"));
+
+    /* Raw data isn't in the same address space as the rest of the file */
+    if(!HDstrcmp(env_h5_drvr, "split") || !HDstrcmp(env_h5_drvr, "multi") || !HDstrcmp(env_h5_drvr, "family"))
+        return;
+
+    wbuf = (unsigned *)HDmalloc(FILE_COMPACT_NELMTS * sizeof(unsigned));
+    CHECK_PTR(wbuf, "HDmalloc");
+    rbuf = (unsigned *)HDmalloc(FILE_COMPACT_NELMTS * sizeof(unsigned));
+    CHECK_PTR(rbuf, "HDmalloc");
+    for(u = 0; u < FILE_COMPACT_NELMTS; u++)
+        wbuf[u] = u;
+
+    fapl = h5_fileaccess();
+    CHECK(fapl, FAIL, "h5_fileaccess");
+    h5_fixname(FILE_COMPACT, fapl, filename, sizeof filename);
+
+    /* Keep track of free space across file opens */
+    fcpl = H5Pcreate(H5P_FILE_CREATE);
+    CHECK(fcpl, FAIL, "H5Pcreate");
+    ret = H5Pset_file_space_strategy(fcpl, H5F_FSPACE_STRATEGY_FSM_AGGR, TRUE, (hsize_t)1);
+    CHECK(ret, FAIL, "H5Pset_file_space_strategy");
+
+    fid = H5Fcreate(filename, H5F_ACC_TRUNC, fcpl, fapl);
+    CHECK(fid, FAIL, "H5Fcreate");
+
+    dspace = H5Screate_simple(1, dims, NULL);
+    CHECK(dspace, FAIL, "H5Screate_simple");
+
+    /* Create a contiguous dataset that will be deleted, then one that
+     * will be moved into its space
+     */
+    dset = H5Dcreate2(fid, "doomed", H5T_NATIVE_UINT, dspace, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+    CHECK(dset, FAIL, "H5Dcreate2");
+    ret = H5Dwrite(dset, H5T_NATIVE_UINT, H5S_ALL, H5S_ALL, H5P_DEFAULT, wbuf);
+    CHECK(ret, FAIL, "H5Dwrite");
+    ret = H5Dclose(dset);
+    CHECK(ret, FAIL, "H5Dclose");
+
+    dset = H5Dcreate2(fid, "contig", H5T_NATIVE_UINT, dspace, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+    CHECK(dset, FAIL, "H5Dcreate2");
+    ret = H5Dwrite(dset, H5T_NATIVE_UINT, H5S_ALL, H5S_ALL, H5P_DEFAULT, wbuf);
+    CHECK(ret, FAIL, "H5Dwrite");
+    ret = H5Dclose(dset);
+    CHECK(ret, FAIL, "H5Dclose");
+
+    /* Create a chunked dataset after them */
+    dcpl = H5Pcreate(H5P_DATASET_CREATE);
+    CHECK(dcpl, FAIL, "H5Pcreate");
+    ret = H5Pset_chunk(dcpl, 1, chunk_dims);
+    CHECK(ret, FAIL, "H5Pset_chunk");
+    dset = H5Dcreate2(fid, "chunked", H5T_NATIVE_UINT, dspace, H5P_DEFAULT, dcpl, H5P_DEFAULT);
+    CHECK(dset, FAIL, "H5Dcreate2");
+    ret = H5Dwrite(dset, H5T_NATIVE_UINT, H5S_ALL, H5S_ALL, H5P_DEFAULT, wbuf);
+    CHECK(ret, FAIL, "H5Dwrite");
+
+    /* Compacting with a dataset open isn't allowed */
+    H5E_BEGIN_TRY {
+        ret = H5Fcompact(fid, (hsize_t)0, &moved);
+    } H5E_END_TRY;
+    VERIFY(ret, FAIL, "H5Fcompact");
+
+    ret = H5Dclose(dset);
+    CHECK(ret, FAIL, "H5Dclose");
+
+    /* Release the space of the first dataset */
+    ret = H5Ldelete(fid, "doomed", H5P_DEFAULT);
+    CHECK(ret, FAIL, "H5Ldelete");
+
+    ret = H5Fclose(fid);
+    CHECK(ret, FAIL, "H5Fclose");
+    size_before = h5_get_file_size(filename, fapl);
+    CHECK(size_before, FAIL, "h5_get_file_size");
+
+    fid = H5Fopen(filename, H5F_ACC_RDWR, fapl);
+    CHECK(fid, FAIL, "H5Fopen");
+
+    /* A limit smaller than any block moves nothing */
+    ret = H5Fcompact(fid, (hsize_t)1, &moved);
+    CHECK(ret, FAIL, "H5Fcompact");
+    VERIFY(moved, 0, "H5Fcompact");
+
+    /* Compact the file */
+    ret = H5Fcompact(fid, (hsize_t)0, &moved);
+    CHECK(ret, FAIL, "H5Fcompact");
+    if(moved < FILE_COMPACT_CHUNK * sizeof(unsigned))
+        TestErrPrintf("%d: no data was moved\n", __LINE__);
+
+    ret = H5Fclose(fid);
+    CHECK(ret, FAIL, "H5Fclose");
+    size_after = h5_get_file_size(filename, fapl);
+    CHECK(size_after, FAIL, "h5_get_file_size");
+    if(size_after >= size_before)
+        TestErrPrintf("%d: file didn't shrink: %lld bytes before, %lld bytes after\n", __LINE__, (long long)size_before, (long long)size_after);
+
+    /* Verify the data */
+    fid = H5Fopen(filename, H5F_ACC_RDONLY, fapl);
+    CHECK(fid, FAIL, "H5Fopen");
+    for(u = 0; u < 2; u++) {
+        dset = H5Dopen2(fid, u ? "chunked" : "contig", H5P_DEFAULT);
+        CHECK(dset, FAIL, "H5Dopen2");
+        HDmemset(rbuf, 0, FILE_COMPACT_NELMTS * sizeof(unsigned));
+        ret = H5Dread(dset, H5T_NATIVE_UINT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf);
+        CHECK(ret, FAIL, "H5Dread");
+        if(HDmemcmp(wbuf, rbuf, FILE_COMPACT_NELMTS * sizeof(unsigned)))
+            TestErrPrintf("%d: data in dataset %u is wrong after compaction\n", __LINE__, u);
+        ret = H5Dclose(dset);
+        CHECK(ret, FAIL, "H5Dclose");
+    } /* end for */
+    ret = H5Fclose(fid);
+    CHECK(ret, FAIL, "H5Fclose");
+
+    /* Compacting a read-only file isn't allowed */
+    fid = H5Fopen(filename, H5F_ACC_RDONLY, fapl);
+    CHECK(fid, FAIL, "H5Fopen");
+    H5E_BEGIN_TRY {
+        ret = H5Fcompact(fid, (hsize_t)0, NULL);
+    } H5E_END_TRY;
+    VERIFY(ret, FAIL, "H5Fcompact");
+    ret = H5Fclose(fid);
+    CHECK(ret, FAIL, "H5Fclose");
+
+    ret = H5Sclose(dspace);
+    CHECK(ret, FAIL, "H5Sclose");
+    ret = H5Pclose(dcpl);
+    CHECK(ret, FAIL, "H5Pclose");
+    ret = H5Pclose(fcpl);
+    CHECK(ret, FAIL, "H5Pclose");
+
+    h5_delete_test_file(FILE_COMPACT, fapl);
+    ret = H5Pclose(fapl);
+    CHECK(ret, FAIL, "H5Pclose");
+
+    HDfree(wbuf);
+    HDfree(rbuf);
+} /* end test_file_compact() */
+
+/****************************************************************
+**
+**  test_file_counters():
+**    Verify that H5Fstart_counters() and friends count the I/O,
+**    cache lookups, filters, conversions and selection iteration
+**    done for a file, and only while they are turned on.
+**
+****************************************************************/
+#define FILE_COUNTERS           "tfile_counters"
+#define FILE_COUNTERS_JSON      "tfile_counters.json"
+#define FILE_COUNTERS_NELMTS    (16 * 1024)
+#define FILE_COUNTERS_CHUNK     1024
+#define FILE_COUNTERS_CONV      "uint\"to\\ushort\t\001"
+#define FILE_COUNTERS_CONV_JSON "\"uint\\\"to\\\\ushort\\t\\u0001\""
+
+/* Converts unsigned ints to unsigned shorts, under a name that needs
+ * escaping in the JSON dump
+ */
+static herr_t
+file_counters_conv(hid_t H5_ATTR_UNUSED src_id, hid_t H5_ATTR_UNUSED dst_id, H5T_cdata_t *cdata,
+    size_t nelmts, size_t H5_ATTR_UNUSED buf_stride, size_t H5_ATTR_UNUSED bkg_stride, void *buf,
+    void H5_ATTR_UNUSED *bkg, hid_t H5_ATTR_UNUSED dxpl)
+{
+    unsigned       *src = (unsigned *)buf;
+    unsigned short *dst = (unsigned short *)buf;
+    size_t          u;
+
+    if(H5T_CONV_CONV == cdata->command)
+        for(u = 0; u < nelmts; u++)
+            dst[u] = (unsigned short)src[u];
+    cdata->need_bkg = H5T_BKG_NO;
+
+    return 0;
+} /* end file_counters_conv() */
+
+static void
+test_file_counters(void)
+{
+    hid_t    fid = -1;                  /* File ID */
+    hid_t    fapl = -1;                 /* File access property list */
+    hid_t    dspace = -1;               /* Dataspace ID */
+    hid_t    dcpl = -1;                 /* Dataset creation property list */
+    hid_t    dset = -1;                 /* Dataset ID */
+    hsize_t  dims[1] = {FILE_COUNTERS_NELMTS};  /* Dataset dimensions */
+    hsize_t  chunk_dims[1] = {FILE_COUNTERS_CHUNK}; /* Chunk dimensions */
+    H5F_counters_t counters;            /* Counters while collecting */
+    H5F_counters_t stopped;             /* Counters after collection stopped */
+    H5F_counters_t later;               /* Counters after more I/O */
+    char     filename[FILENAME_LEN];    /* Filename to use */
+    unsigned *wbuf = NULL;              /* Data written */
+    unsigned *rbuf = NULL;              /* Data read */
+    FILE     *json;                     /* Stream for the JSON dump */
+    char     *json_buf = NULL;          /* Contents of the JSON dump */
+    HDoff_t  json_size;                 /* Size of the JSON dump */
+    int      c;                         /* First character of the dump */
+    unsigned u;                         /* Local index variable */
+    herr_t   ret;                       /* Generic return value */
+
+    /* Output message about test being performed */
+    MESSAGE(5, ("Testing file profiling counters\n"));
+
+    wbuf = (unsigned *)HDmalloc(FILE_COUNTERS_NELMTS * sizeof(unsigned));
+    CHECK_PTR(wbuf, "HDmalloc");
+    rbuf = (unsigned *)HDmalloc(FILE_COUNTERS_NELMTS * sizeof(unsigned));
+    CHECK_PTR(rbuf, "HDmalloc");
+    for(u = 0; u < FILE_COUNTERS_NELMTS; u++)
+        wbuf[u] = u % 65536;
+
+    fapl = h5_fileaccess();
+    CHECK(fapl, FAIL, "h5_fileaccess");
+    h5_fixname(FILE_COUNTERS, fapl, filename, sizeof filename);
+
+    fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl);
+    CHECK(fid, FAIL, "H5Fcreate");
+
+    /* Nothing is counted before collection starts */
+    HDmemset(&counters, 0xff, sizeof(counters));
+    ret = H5Fget_counters(fid, &counters);
+    CHECK(ret, FAIL, "H5Fget_counters");
+    VERIFY(counters.read_calls[H5FD_MEM_DRAW], 0, "H5Fget_counters");
+    VERIFY(counters.mdc_hits, 0, "H5Fget_counters");
+
+    H5E_BEGIN_TRY {
+        ret = H5Fget_counters(fid, NULL);
+    } H5E_END_TRY;
+    VERIFY(ret, FAIL, "H5Fget_counters");
+
+    ret = H5Fstart_counters(fid);
+    CHECK(ret, FAIL, "H5Fstart_counters");
+
+    /* Write a filtered, chunked dataset, converting the data as it goes */
+    dspace = H5Screate_simple(1, dims, NULL);
+    CHECK(dspace, FAIL, "H5Screate_simple");
+    dcpl = H5Pcreate(H5P_DATASET_CREATE);
+    CHECK(dcpl, FAIL, "H5Pcreate");
+    ret = H5Pset_chunk(dcpl, 1, chunk_dims);
+    CHECK(ret, FAIL, "H5Pset_chunk");
+    ret = H5Pset_fletcher32(dcpl);
+    CHECK(ret, FAIL, "H5Pset_fletcher32");
+    dset = H5Dcreate2(fid, "dset", H5T_NATIVE_USHORT, dspace, H5P_DEFAULT, dcpl, H5P_DEFAULT);
+    CHECK(dset, FAIL, "H5Dcreate2");
+    ret = H5Tregister(H5T_PERS_HARD, FILE_COUNTERS_CONV, H5T_NATIVE_UINT, H5T_NATIVE_USHORT, file_counters_conv);
+    CHECK(ret, FAIL, "H5Tregister");
+    ret = H5Dwrite(dset, H5T_NATIVE_UINT, H5S_ALL, H5S_ALL, H5P_DEFAULT, wbuf);
+    CHECK(ret, FAIL, "H5Dwrite");
+    ret = H5Tunregister(H5T_PERS_HARD, FILE_COUNTERS_CONV, H5T_NATIVE_UINT, H5T_NATIVE_USHORT, file_counters_conv);
+    CHECK(ret, FAIL, "H5Tunregister");
+    ret = H5Dclose(dset);
+    CHECK(ret, FAIL, "H5Dclose");
+
+    /* Read it back twice, so the second read finds the chunks cached */
+    dset = H5Dopen2(fid, "dset", H5P_DEFAULT);
+    CHECK(dset, FAIL, "H5Dopen2");
+    for(u = 0; u < 2; u++) {
+        HDmemset(rbuf, 0, FILE_COUNTERS_NELMTS * sizeof(unsigned));
+        ret = H5Dread(dset, H5T_NATIVE_UINT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf);
+        CHECK(ret, FAIL, "H5Dread");
+        if(HDmemcmp(wbuf, rbuf, FILE_COUNTERS_NELMTS * sizeof(unsigned)))
+            TestErrPrintf("%d: data read is wrong\n", __LINE__);
+    } /* end for */
+    ret = H5Dclose(dset);
+    CHECK(ret, FAIL, "H5Dclose");
+
+    ret = H5Fget_counters(fid, &counters);
+    CHECK(ret, FAIL, "H5Fget_counters");
+    if(0 == counters.write_calls[H5FD_MEM_DRAW] || counters.write_bytes[H5FD_MEM_DRAW] < FILE_COUNTERS_NELMTS * sizeof(unsigned short))
+        TestErrPrintf("%d: raw data writes weren't counted\n", __LINE__);
+    if(0 == counters.read_calls[H5FD_MEM_DRAW] || counters.read_bytes[H5FD_MEM_DRAW] < FILE_COUNTERS_NELMTS * sizeof(unsigned short))
+        TestErrPrintf("%d: raw data reads weren't counted\n", __LINE__);
+    if(0 == counters.mdc_hits)
+        TestErrPrintf("%d: metadata cache hits weren't counted\n", __LINE__);
+    if(counters.chunk_misses < FILE_COUNTERS_NELMTS / FILE_COUNTERS_CHUNK)
+        TestErrPrintf("%d: chunk cache misses weren't counted\n", __LINE__);
+    if(counters.chunk_hits < FILE_COUNTERS_NELMTS / FILE_COUNTERS_CHUNK)
+        TestErrPrintf("%d: chunk cache hits weren't counted\n", __LINE__);
+    if(counters.filter_calls < 2 * FILE_COUNTERS_NELMTS / FILE_COUNTERS_CHUNK)
+        TestErrPrintf("%d: filters weren't counted\n", __LINE__);
+    if(counters.conv_calls < 3)
+        TestErrPrintf("%d: datatype conversions weren't counted\n", __LINE__);
+    if(0 == counters.select_calls)
+        TestErrPrintf("%d: selection iteration wasn't counted\n", __LINE__);
+    if(counters.filter_time < 0.0 || counters.conv_time < 0.0 || counters.select_time < 0.0)
+        TestErrPrintf("%d: times are negative\n", __LINE__);
+
+    /* Stopping collection keeps the counters as they were */
+    ret = H5Fstop_counters(fid);
+    CHECK(ret, FAIL, "H5Fstop_counters");
+    ret = H5Fget_counters(fid, &stopped);
+    CHECK(ret, FAIL, "H5Fget_counters");
+
+    dset = H5Dopen2(fid, "dset", H5P_DEFAULT);
+    CHECK(dset, FAIL, "H5Dopen2");
+    ret = H5Dread(dset, H5T_NATIVE_UINT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf);
+    CHECK(ret, FAIL, "H5Dread");
+    ret = H5Dclose(dset);
+    CHECK(ret, FAIL, "H5Dclose");
+
+    ret = H5Fget_counters(fid, &later);
+    CHECK(ret, FAIL, "H5Fget_counters");
+    if(HDmemcmp(&stopped, &later, sizeof(stopped)))
+        TestErrPrintf("%d: counters changed after collection stopped\n", __LINE__);
+
+    /* Dump the counters */
+    json = HDfopen(FILE_COUNTERS_JSON, "w+");
+    CHECK_PTR(json, "HDfopen");
+    ret = H5Fprint_counters(fid, json);
+    CHECK(ret, FAIL, "H5Fprint_counters");
+    HDrewind(json);
+    c = HDfgetc(json);
+    VERIFY(c, '{', "H5Fprint_counters");
+
+    /* The conversion's name is escaped */
+    ret = HDfseek(json, 0, SEEK_END);
+    CHECK(ret, FAIL, "HDfseek");
+    json_size = HDftell(json);
+    CHECK(json_size, FAIL, "HDftell");
+    json_buf = (char *)HDcalloc((size_t)json_size + 1, 1);
+    CHECK_PTR(json_buf, "HDcalloc");
+    HDrewind(json);
+    VERIFY(HDfread(json_buf, 1, (size_t)json_size, json), (size_t)json_size, "HDfread");
+    if(NULL == HDstrstr(json_buf, FILE_COUNTERS_CONV_JSON))
+        TestErrPrintf("%d: conversion name wasn't escaped\n", __LINE__);
+    if(HDstrchr(json_buf, '\t') || HDstrchr(json_buf, '\001'))
+        TestErrPrintf("%d: control characters weren't escaped\n", __LINE__);
+    HDfree(json_buf);
+    HDfclose(json);
+    HDremove(FILE_COUNTERS_JSON);
+
+    H5E_BEGIN_TRY {
+        ret = H5Fprint_counters(fid, NULL);
+    } H5E_END_TRY;
+    VERIFY(ret, FAIL, "H5Fprint_counters");
+
+    /* Starting again resets the counters */
+    ret = H5Fstart_counters(fid);
+    CHECK(ret, FAIL, "H5Fstart_counters");
+    ret = H5Fget_counters(fid, &counters);
+    CHECK(ret, FAIL, "H5Fget_counters");
+    VERIFY(counters.chunk_misses, 0, "H5Fget_counters");
+    VERIFY(counters.filter_calls, 0, "H5Fget_counters");
+
+    /* Closing the file with collection on frees the counters */
+    ret = H5Fclose(fid);
+    CHECK(ret, FAIL, "H5Fclose");
+
+    ret = H5Sclose(dspace);
+    CHECK(ret, FAIL, "H5Sclose");
+    ret = H5Pclose(dcpl);
+    CHECK(ret, FAIL, "H5Pclose");
+
+    h5_delete_test_file(FILE_COUNTERS, fapl);
+    ret = H5Pclose(fapl);
+    CHECK(ret, FAIL, "H5Pclose");
+
+    HDfree(wbuf);
+    HDfree(rbuf);
+} /* end test_file_counters() */
+
 /****************************************************************
 **
 **  test_min_dset_ohdr():
@@ -7884,6 +8271,8 @@ test_file(void)
     test_libver_macros();                       /* Test the macros for library version comparison */
     test_libver_macros2();                      /* Test the macros for library version comparison */
     test_incr_filesize();                       /* Test H5Fincrement_filesize() and H5Fget_eoa() */
+    test_file_compact(env_h5_drvr);             /* Test H5Fcompact() */
+    test_file_counters();                       /* Test file profiling counters */
     test_min_dset_ohdr();                       /* Test datset object header minimization */
 #ifndef H5_NO_DEPRECATED_SYMBOLS
     test_file_ishdf5(env_h5_drvr);              /* Test detecting HDF5 files correctly */
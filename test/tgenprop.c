@@ -1598,6 +1598,118 @@ test_genprop_list_add_remove_prop(void)
 
 } /* end test_genprop_list_add_remove_prop() */
 
+/****************************************************************
+**
+**  test_genprop_list_lookup(): Test that property lookups see the
+**  current property after it is set, removed, re-inserted or copied,
+**  and after its class changes.
+**
+****************************************************************/
+static void
+test_genprop_list_lookup(void)
+{
+    hid_t        cid1;        /* Generic Property class ID */
+    hid_t        lid1, lid2;  /* Generic Property list IDs */
+    int          prop1_value; /* Value for property #1 */
+    float        prop2_value; /* Value for property #2 */
+    int          new_value;   /* New value for property #1 */
+    herr_t       ret;         /* Generic return value */
+
+    /* Output message about test being performed */
+    MESSAGE(5, ("Testing Property Lookups After Changes\n"));
+
+    /* Create a class with two properties, and a list from it */
+    cid1 = H5Pcreate_class(H5P_ROOT, CLASS1_NAME, NULL, NULL, NULL, NULL, NULL, NULL);
+    CHECK_I(cid1, "H5Pcreate_class");
+    ret = H5Pregister2(cid1, PROP1_NAME, PROP1_SIZE, PROP1_DEF_VALUE, NULL, NULL, NULL, NULL, NULL, NULL, NULL);
+    CHECK_I(ret, "H5Pregister2");
+    ret = H5Pregister2(cid1, PROP2_NAME, PROP2_SIZE, PROP2_DEF_VALUE, NULL, NULL, NULL, NULL, NULL, NULL, NULL);
+    CHECK_I(ret, "H5Pregister2");
+    lid1 = H5Pcreate(cid1);
+    CHECK_I(lid1, "H5Pcreate");
+
+    /* Look up the class defaults, more than once */
+    ret = H5Pget(lid1, PROP1_NAME, &prop1_value);
+    CHECK_I(ret, "H5Pget");
+    VERIFY(prop1_value, *PROP1_DEF_VALUE, "H5Pget");
+    ret = H5Pget(lid1, PROP2_NAME, &prop2_value);
+    CHECK_I(ret, "H5Pget");
+    if(!H5_FLT_ABS_EQUAL(prop2_value, *PROP2_DEF_VALUE))
+        TestErrPrintf("Property #2 doesn't match!, line=%d\n", __LINE__);
+    ret = H5Pget(lid1, PROP1_NAME, &prop1_value);
+    CHECK_I(ret, "H5Pget");
+    VERIFY(prop1_value, *PROP1_DEF_VALUE, "H5Pget");
+
+    /* Setting the property moves it from the class into the list */
+    new_value = 20;
+    ret = H5Pset(lid1, PROP1_NAME, &new_value);
+    CHECK_I(ret, "H5Pset");
+    ret = H5Pget(lid1, PROP1_NAME, &prop1_value);
+    CHECK_I(ret, "H5Pget");
+    VERIFY(prop1_value, 20, "H5Pget");
+
+    /* A copy of the list has its own values */
+    lid2 = H5Pcopy(lid1);
+    CHECK_I(lid2, "H5Pcopy");
+    new_value = 30;
+    ret = H5Pset(lid2, PROP1_NAME, &new_value);
+    CHECK_I(ret, "H5Pset");
+    ret = H5Pget(lid2, PROP1_NAME, &prop1_value);
+    CHECK_I(ret, "H5Pget");
+    VERIFY(prop1_value, 30, "H5Pget");
+    ret = H5Pget(lid1, PROP1_NAME, &prop1_value);
+    CHECK_I(ret, "H5Pget");
+    VERIFY(prop1_value, 20, "H5Pget");
+
+    /* A removed property can't be found */
+    ret = H5Premove(lid1, PROP1_NAME);
+    CHECK_I(ret, "H5Premove");
+    ret = H5Pexist(lid1, PROP1_NAME);
+    VERIFY(ret, 0, "H5Pexist");
+    H5E_BEGIN_TRY {
+        ret = H5Pget(lid1, PROP1_NAME, &prop1_value);
+    } H5E_END_TRY;
+    VERIFY(ret, FAIL, "H5Pget");
+
+    /* ... until it is inserted again */
+    new_value = 40;
+    ret = H5Pinsert2(lid1, PROP1_NAME, PROP1_SIZE, &new_value, NULL, NULL, NULL, NULL, NULL, NULL);
+    CHECK_I(ret, "H5Pinsert2");
+    ret = H5Pget(lid1, PROP1_NAME, &prop1_value);
+    CHECK_I(ret, "H5Pget");
+    VERIFY(prop1_value, 40, "H5Pget");
+
+    /* Copying a property between lists replaces it */
+    ret = H5Pcopy_prop(lid1, lid2, PROP1_NAME);
+    CHECK_I(ret, "H5Pcopy_prop");
+    ret = H5Pget(lid1, PROP1_NAME, &prop1_value);
+    CHECK_I(ret, "H5Pget");
+    VERIFY(prop1_value, 30, "H5Pget");
+
+    /* Removing a property from the class doesn't leave stale lookups */
+    ret = H5Pget(lid2, PROP2_NAME, &prop2_value);
+    CHECK_I(ret, "H5Pget");
+    ret = H5Punregister(cid1, PROP2_NAME);
+    CHECK_I(ret, "H5Punregister");
+    ret = H5Pclose(lid2);
+    CHECK_I(ret, "H5Pclose");
+    lid2 = H5Pcreate(cid1);
+    CHECK_I(lid2, "H5Pcreate");
+    ret = H5Pexist(lid2, PROP2_NAME);
+    VERIFY(ret, 0, "H5Pexist");
+    ret = H5Pget(lid2, PROP1_NAME, &prop1_value);
+    CHECK_I(ret, "H5Pget");
+    VERIFY(prop1_value, *PROP1_DEF_VALUE, "H5Pget");
+
+    /* Close everything */
+    ret = H5Pclose(lid2);
+    CHECK_I(ret, "H5Pclose");
+    ret = H5Pclose(lid1);
+    CHECK_I(ret, "H5Pclose");
+    ret = H5Pclose_class(cid1);
+    CHECK_I(ret, "H5Pclose_class");
+} /* end test_genprop_list_lookup() */
+
 /****************************************************************
 **
 **  test_genprop_equal(): Test basic generic property list code.
@@ -2118,6 +2230,7 @@ test_genprop(void)
     test_genprop_class_addprop();   /* Test adding properties to HDF5 property class */
 
     test_genprop_list_add_remove_prop();  /* Test adding and removing the same property several times to HDF5 property list */
+    test_genprop_list_lookup();  /* Test property lookups after changes to the list or its class */
 
     test_genprop_equal();       /* Tests for more H5Pequal verification */
     test_genprop_path();        /* Tests for class path verification */
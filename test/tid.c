@@ -749,6 +749,107 @@ out:
     return -1;
 } /* end test_remove_clear_type() */
 
+    /* Test lookups among many IDs */
+
+/* Registers enough IDs that the type's hash index has to grow several
+ * times, removes some of them, and checks that every lookup still finds
+ * the right object (or nothing, for the removed IDs).  The second pass
+ * asks H5Iregister_type() for a large index up front.
+ */
+#define TEST_MANY_NIDS 10000
+
+static int test_many_ids(void)
+{
+    H5I_type_t obj_type = H5I_BADID;
+    static int objs[TEST_MANY_NIDS];
+    static hid_t ids[TEST_MANY_NIDS];
+    hsize_t nmembers;
+    size_t hash_size;
+    void *obj;
+    int pass;
+    int i;
+    herr_t ret;
+
+    for(pass = 0; pass < 2; pass++) {
+        hash_size = pass ? (size_t)TEST_MANY_NIDS : (size_t)8;
+
+        obj_type = H5Iregister_type(hash_size, 0, NULL);
+        CHECK(obj_type, H5I_BADID, "H5Iregister_type");
+        if(obj_type == H5I_BADID)
+            goto out;
+
+        for(i = 0; i < TEST_MANY_NIDS; i++) {
+            objs[i] = i;
+            ids[i] = H5Iregister(obj_type, &objs[i]);
+            CHECK(ids[i], H5I_INVALID_HID, "H5Iregister");
+            if(ids[i] == H5I_INVALID_HID)
+                goto out;
+        } /* end for */
+
+        /* Look up the IDs, twice each, in an order unlike the registration order */
+        for(i = 0; i < TEST_MANY_NIDS; i++) {
+            int k = (int)(((long)i * 7919) % TEST_MANY_NIDS);
+
+            obj = H5Iobject_verify(ids[k], obj_type);
+            VERIFY(obj, &objs[k], "H5Iobject_verify");
+            if(obj != &objs[k])
+                goto out;
+            obj = H5Iobject_verify(ids[k], obj_type);
+            VERIFY(obj, &objs[k], "H5Iobject_verify");
+            if(obj != &objs[k])
+                goto out;
+        } /* end for */
+
+        /* Remove every third ID */
+        for(i = 0; i < TEST_MANY_NIDS; i += 3) {
+            obj = H5Iremove_verify(ids[i], obj_type);
+            VERIFY(obj, &objs[i], "H5Iremove_verify");
+            if(obj != &objs[i])
+                goto out;
+        } /* end for */
+
+        for(i = 0; i < TEST_MANY_NIDS; i++) {
+            H5E_BEGIN_TRY {
+                obj = H5Iobject_verify(ids[i], obj_type);
+            } H5E_END_TRY
+            if(i % 3 == 0) {
+                VERIFY(obj, NULL, "H5Iobject_verify");
+                if(obj != NULL)
+                    goto out;
+            } /* end if */
+            else {
+                VERIFY(obj, &objs[i], "H5Iobject_verify");
+                if(obj != &objs[i])
+                    goto out;
+            } /* end else */
+        } /* end for */
+
+        ret = H5Inmembers(obj_type, &nmembers);
+        CHECK(ret, FAIL, "H5Inmembers");
+        if(ret == FAIL)
+            goto out;
+        VERIFY(nmembers, (hsize_t)(TEST_MANY_NIDS - (TEST_MANY_NIDS + 2) / 3), "H5Inmembers");
+        if(nmembers != (hsize_t)(TEST_MANY_NIDS - (TEST_MANY_NIDS + 2) / 3))
+            goto out;
+
+        /* Destroy type */
+        ret = H5Idestroy_type(obj_type);
+        CHECK(ret, FAIL, "H5Idestroy_type");
+        if(ret == FAIL)
+            goto out;
+        obj_type = H5I_BADID;
+    } /* end for */
+
+    return 0;
+
+out:
+    /* Cleanup.  For simplicity, just destroy the type and ignore errors. */
+    H5E_BEGIN_TRY
+        H5Idestroy_type(obj_type);
+    H5E_END_TRY
+    return -1;
+} /* end test_many_ids() */
+
 void test_ids(void)
 {
     /* Set the random # seed */
@@ -760,5 +861,6 @@ void test_ids(void)
     if (test_get_type() < 0) TestErrPrintf("H5Iget_type test failed\n");
     if (test_id_type_list() < 0) TestErrPrintf("ID type list test failed\n");
     if (test_remove_clear_type() < 0) TestErrPrintf("ID remove during H5Iclear_type test failed\n");
+    if (test_many_ids() < 0) TestErrPrintf("Lookups among many IDs test failed\n");
 
 }
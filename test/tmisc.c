@@ -29,6 +29,7 @@
 #include "testhdf5.h"
 #include "H5srcdir.h"
 #include "H5Dpkg.h"         /* Datasets                 */
+#include "H5FLprivate.h"    /* Free Lists               */
 #include "H5MMprivate.h"    /* Memory                   */
 
 /* Definitions for misc. test #1 */
@@ -323,6 +324,19 @@ typedef struct
 /* and bad offset values are written to that file for testing */
 #define MISC33_FILE             "bad_offset.h5"
 
+/* Definitions for misc. test #35 */
+#define MISC35_FILE             "tmisc35.h5"
+#define MISC35_DSETNAME         "dset"
+#define MISC35_SPACE_DIM        1000
+#define MISC35_CHUNK_DIM        100
+
+/* Definitions for misc. test #36 */
+#define MISC36_FILE             "tmisc36.h5"
+#define MISC36_DSETNAME         "dset"
+#define MISC36_SPACE_DIM        10
+#define MISC36_NREADS           3
+#define MISC36_DEPTH            6
+
 /****************************************************************
 **
 **  test_misc1(): test unlinking a dataset from a group and immediately
@@ -5625,7 +5639,280 @@ test_misc34(void)
 
 } /* end test_misc34() */
 
+/* Totals of the free list statistics, by kind of list */
+typedef struct misc35_totals_t {
+    size_t mem[H5FL_KIND_FAC + 1];
+    int nbad;
+} misc35_totals_t;
+
+static herr_t
+misc35_stats_cb(const H5FL_stats_t *stats, void *_totals)
+{
+    misc35_totals_t *totals = (misc35_totals_t *)_totals;
+
+    totals->mem[stats->kind] += stats->list_mem;
+    if(stats->onlist > stats->allocated || (0 == stats->onlist) != (0 == stats->list_mem))
+        totals->nbad++;
+
+    return 0;
+} /* end misc35_stats_cb() */
+
+#ifndef H5_NO_BLK_FREE_LISTS
+/* Block free list for test #35 */
+H5FL_BLK_DEFINE_STATIC(misc35_blk);
+#endif /* H5_NO_BLK_FREE_LISTS */
+
+/****************************************************************
+**
+**  test_misc35(): Test the free list statistics, and that block
+**                  free lists re-use blocks of nearby sizes.
+**
+****************************************************************/
+static void
+test_misc35(void)
+{
+    hid_t   fid = -1;           /* File ID */
+    hid_t   sid = -1;           /* Dataspace ID */
+    hid_t   dcpl = -1;          /* Dataset creation property list ID */
+    hid_t   did = -1;           /* Dataset ID */
+    hsize_t dims[1] = {MISC35_SPACE_DIM};
+    hsize_t chunk_dims[1] = {MISC35_CHUNK_DIM};
+    int     data[MISC35_SPACE_DIM];     /* Data to write */
+    size_t  reg_size, arr_size, blk_size, fac_size;     /* Free list sizes */
+    misc35_totals_t totals;     /* Totals from the free list statistics */
+#ifndef H5_NO_BLK_FREE_LISTS
+    uint8_t *blk, *blk2;        /* Blocks from the test's free list */
+#endif /* H5_NO_BLK_FREE_LISTS */
+    int     i;                  /* Local index variable */
+    herr_t  ret;                /* Generic return value */
+
+    /* Output message about test being performed */
+    MESSAGE(5, ("Testing free list statistics"));
+
+    /* Garbage collection empties all the free lists */
+    ret = H5garbage_collect();
+    CHECK(ret, FAIL, "H5garbage_collect");
+    ret = H5get_free_list_sizes(&reg_size, &arr_size, &blk_size, &fac_size);
+    CHECK(ret, FAIL, "H5get_free_list_sizes");
+    VERIFY(reg_size, 0, "H5get_free_list_sizes");
+    VERIFY(arr_size, 0, "H5get_free_list_sizes");
+    VERIFY(blk_size, 0, "H5get_free_list_sizes");
+    VERIFY(fac_size, 0, "H5get_free_list_sizes");
+
+    /* Put some memory on the free lists, by creating objects and closing them */
+    for(i = 0; i < MISC35_SPACE_DIM; i++)
+        data[i] = i;
+    fid = H5Fcreate(MISC35_FILE, H5F_ACC_TRUNC, H5P_DEFAULT, H5P_DEFAULT);
+    CHECK(fid, FAIL, "H5Fcreate");
+    sid = H5Screate_simple(1, dims, NULL);
+    CHECK(sid, FAIL, "H5Screate_simple");
+    dcpl = H5Pcreate(H5P_DATASET_CREATE);
+    CHECK(dcpl, FAIL, "H5Pcreate");
+    ret = H5Pset_chunk(dcpl, 1, chunk_dims);
+    CHECK(ret, FAIL, "H5Pset_chunk");
+    did = H5Dcreate2(fid, MISC35_DSETNAME, H5T_NATIVE_INT, sid, H5P_DEFAULT, dcpl, H5P_DEFAULT);
+    CHECK(did, FAIL, "H5Dcreate2");
+    ret = H5Dwrite(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, data);
+    CHECK(ret, FAIL, "H5Dwrite");
+    ret = H5Dclose(did);
+    CHECK(ret, FAIL, "H5Dclose");
+    ret = H5Pclose(dcpl);
+    CHECK(ret, FAIL, "H5Pclose");
+    ret = H5Sclose(sid);
+    CHECK(ret, FAIL, "H5Sclose");
+    ret = H5Fclose(fid);
+    CHECK(ret, FAIL, "H5Fclose");
+
+    ret = H5get_free_list_sizes(&reg_size, &arr_size, &blk_size, &fac_size);
+    CHECK(ret, FAIL, "H5get_free_list_sizes");
+#ifndef H5_NO_REG_FREE_LISTS
+    CHECK(reg_size, 0, "H5get_free_list_sizes");
+#endif /* H5_NO_REG_FREE_LISTS */
+
+    /* The statistics for each list add up to the sizes for each kind.
+     * (Use the library's internal call for the sizes, since entering the
+     * API takes memory off the free lists.)
+     */
+    ret = H5FL_get_free_list_sizes(&reg_size, &arr_size, &blk_size, &fac_size);
+    CHECK(ret, FAIL, "H5FL_get_free_list_sizes");
+    HDmemset(&totals, 0, sizeof(totals));
+    ret = H5FL_iterate_stats(misc35_stats_cb, &totals);
+    CHECK(ret, FAIL, "H5FL_iterate_stats");
+    VERIFY(totals.nbad, 0, "H5FL_iterate_stats");
+    VERIFY(totals.mem[H5FL_KIND_REG], reg_size, "H5FL_iterate_stats");
+    VERIFY(totals.mem[H5FL_KIND_ARR], arr_size, "H5FL_iterate_stats");
+    VERIFY(totals.mem[H5FL_KIND_BLK], blk_size, "H5FL_iterate_stats");
+    VERIFY(totals.mem[H5FL_KIND_FAC], fac_size, "H5FL_iterate_stats");
+
+#ifndef H5_NO_BLK_FREE_LISTS
+    /* A freed block is re-used for a block of a slightly different size */
+    blk = H5FL_BLK_MALLOC(misc35_blk, 1000);
+    CHECK_PTR(blk, "H5FL_BLK_MALLOC");
+    blk = H5FL_BLK_FREE(misc35_blk, blk);
+    VERIFY(H5FL_BLK_AVAIL(misc35_blk, 1010), TRUE, "H5FL_BLK_AVAIL");
+    VERIFY(H5FL_BLK_AVAIL(misc35_blk, 2000), FALSE, "H5FL_BLK_AVAIL");
+    blk = H5FL_BLK_MALLOC(misc35_blk, 1010);
+    CHECK_PTR(blk, "H5FL_BLK_MALLOC");
+    VERIFY(H5FL_BLK_AVAIL(misc35_blk, 1000), FALSE, "H5FL_BLK_AVAIL");
+
+    /* Resizing a block within its size class keeps it in place */
+    blk2 = H5FL_BLK_REALLOC(misc35_blk, blk, 1020);
+    VERIFY((blk2 == blk), TRUE, "H5FL_BLK_REALLOC");
+    blk = H5FL_BLK_REALLOC(misc35_blk, blk2, 4000);
+    CHECK_PTR(blk, "H5FL_BLK_REALLOC");
+    blk = H5FL_BLK_FREE(misc35_blk, blk);
+#endif /* H5_NO_BLK_FREE_LISTS */
+
+    /* Garbage collection empties the free lists again */
+    ret = H5garbage_collect();
+    CHECK(ret, FAIL, "H5garbage_collect");
+    ret = H5get_free_list_sizes(&reg_size, &arr_size, &blk_size, &fac_size);
+    CHECK(ret, FAIL, "H5get_free_list_sizes");
+    VERIFY(reg_size, 0, "H5get_free_list_sizes");
+    VERIFY(arr_size, 0, "H5get_free_list_sizes");
+    VERIFY(blk_size, 0, "H5get_free_list_sizes");
+    VERIFY(fac_size, 0, "H5get_free_list_sizes");
+} /* end test_misc35() */
+
 
+/* Information for the nested reads in test #36 */
+typedef struct misc36_nest_t {
+    hid_t dxpl;                 /* DXPL for the reads */
+    unsigned depth;             /* Current nesting depth */
+    unsigned nbad;              /* Number of failed reads */
+} misc36_nest_t;
+
+/* Reads the dataset, checking that each value was scaled by SCALE and offset by OFFSET */
+static unsigned
+misc36_read(hid_t did, hid_t dxpl, int scale, int offset)
+{
+    int     rdata[MISC36_SPACE_DIM];    /* Data read in */
+    int     i;                  /* Local index variable */
+
+    if(H5Dread(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, dxpl, rdata) < 0)
+        return 1;
+    for(i = 0; i < MISC36_SPACE_DIM; i++)
+        if(rdata[i] != (i * scale) + offset)
+            return 1;
+
+    return 0;
+} /* end misc36_read() */
+
+/* Reads the dataset from inside nested link iteration callbacks */
+static herr_t
+misc36_nest_cb(hid_t group, const char *name, const H5L_info_t H5_ATTR_UNUSED *info,
+    void *_nest)
+{
+    misc36_nest_t *nest = (misc36_nest_t *)_nest;
+    hid_t did;
+
+    if((did = H5Dopen2(group, name, H5P_DEFAULT)) < 0)
+        return -1;
+    nest->nbad += misc36_read(did, nest->dxpl, 1, 1);
+    if(H5Dclose(did) < 0)
+        return -1;
+
+    if(++nest->depth < MISC36_DEPTH)
+        if(H5Literate(group, H5_INDEX_NAME, H5_ITER_INC, NULL, misc36_nest_cb, nest) < 0)
+            return -1;
+
+    return 0;
+} /* end misc36_nest_cb() */
+
+/****************************************************************
+**
+**  test_misc36(): Test that reads with the same DXPL see the
+**                  changes made to it between the reads.
+**
+****************************************************************/
+static void
+test_misc36(void)
+{
+    hid_t   fid = -1;           /* File ID */
+    hid_t   sid = -1;           /* Dataspace ID */
+    hid_t   did = -1;           /* Dataset ID */
+    hid_t   dxpl = -1;          /* Dataset transfer property list ID */
+    hid_t   dxpl2 = -1;         /* Copy of the DXPL */
+    hsize_t dims[1] = {MISC36_SPACE_DIM};
+    int     data[MISC36_SPACE_DIM];     /* Data to write */
+    misc36_nest_t nest;         /* Information for the nested reads */
+    unsigned nbad = 0;          /* Number of failed reads */
+    int     i;                  /* Local index variable */
+    herr_t  ret;                /* Generic return value */
+
+    /* Output message about test being performed */
+    MESSAGE(5, ("Testing reads with a re-used DXPL"));
+
+    for(i = 0; i < MISC36_SPACE_DIM; i++)
+        data[i] = i;
+    fid = H5Fcreate(MISC36_FILE, H5F_ACC_TRUNC, H5P_DEFAULT, H5P_DEFAULT);
+    CHECK(fid, FAIL, "H5Fcreate");
+    sid = H5Screate_simple(1, dims, NULL);
+    CHECK(sid, FAIL, "H5Screate_simple");
+    did = H5Dcreate2(fid, MISC36_DSETNAME, H5T_NATIVE_INT, sid, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+    CHECK(did, FAIL, "H5Dcreate2");
+    ret = H5Dwrite(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, data);
+    CHECK(ret, FAIL, "H5Dwrite");
+
+    /* Repeated reads with the same DXPL, changing it in between */
+    dxpl = H5Pcreate(H5P_DATASET_XFER);
+    CHECK(dxpl, FAIL, "H5Pcreate");
+    for(i = 0; i < MISC36_NREADS; i++)
+        nbad += misc36_read(did, dxpl, 1, 0);
+    ret = H5Pset_data_transform(dxpl, "x+1");
+    CHECK(ret, FAIL, "H5Pset_data_transform");
+    for(i = 0; i < MISC36_NREADS; i++)
+        nbad += misc36_read(did, dxpl, 1, 1);
+    ret = H5Pset_data_transform(dxpl, "x*2");
+    CHECK(ret, FAIL, "H5Pset_data_transform");
+    for(i = 0; i < MISC36_NREADS; i++)
+        nbad += misc36_read(did, dxpl, 2, 0);
+    VERIFY(nbad, 0, "H5Dread");
+
+    /* Alternate between the DXPL, a modified copy of it and the default DXPL */
+    dxpl2 = H5Pcopy(dxpl);
+    CHECK(dxpl2, FAIL, "H5Pcopy");
+    ret = H5Pset_data_transform(dxpl2, "x-1");
+    CHECK(ret, FAIL, "H5Pset_data_transform");
+    for(i = 0; i < MISC36_NREADS; i++) {
+        nbad += misc36_read(did, dxpl, 2, 0);
+        nbad += misc36_read(did, dxpl2, 1, -1);
+        nbad += misc36_read(did, H5P_DEFAULT, 1, 0);
+    } /* end for */
+    VERIFY(nbad, 0, "H5Dread");
+
+    /* A new DXPL doesn't see the values of the closed one */
+    ret = H5Pclose(dxpl2);
+    CHECK(ret, FAIL, "H5Pclose");
+    dxpl2 = H5Pcreate(H5P_DATASET_XFER);
+    CHECK(dxpl2, FAIL, "H5Pcreate");
+    nbad += misc36_read(did, dxpl2, 1, 0);
+    VERIFY(nbad, 0, "H5Dread");
+
+    ret = H5Dclose(did);
+    CHECK(ret, FAIL, "H5Dclose");
+
+    /* Reads from API calls nested deeper than the thread keeps contexts for */
+    ret = H5Pset_data_transform(dxpl2, "x+1");
+    CHECK(ret, FAIL, "H5Pset_data_transform");
+    nest.dxpl = dxpl2;
+    nest.depth = 0;
+    nest.nbad = 0;
+    ret = H5Literate(fid, H5_INDEX_NAME, H5_ITER_INC, NULL, misc36_nest_cb, &nest);
+    CHECK(ret, FAIL, "H5Literate");
+    VERIFY(nest.depth, MISC36_DEPTH, "H5Literate");
+    VERIFY(nest.nbad, 0, "H5Dread");
+
+    ret = H5Pclose(dxpl2);
+    CHECK(ret, FAIL, "H5Pclose");
+    ret = H5Pclose(dxpl);
+    CHECK(ret, FAIL, "H5Pclose");
+    ret = H5Sclose(sid);
+    CHECK(ret, FAIL, "H5Sclose");
+    ret = H5Fclose(fid);
+    CHECK(ret, FAIL, "H5Fclose");
+} /* end test_misc36() */
+
 /****************************************************************
 **
 **  test_misc(): Main misc. test routine.
@@ -5675,6 +5962,8 @@ test_misc(void)
     test_misc32();      /* Test filter memory allocation functions */
     test_misc33();      /* Test to verify that H5HL_offset_into() returns error if offset exceeds heap block */
     test_misc34();      /* Test behavior of 0 and NULL in H5MM API calls */
+    test_misc35();      /* Test free list statistics and block size classes */
+    test_misc36();      /* Test that reads see changes to a re-used DXPL */
 
 } /* test_misc() */
 
@@ -5729,5 +6018,7 @@ cleanup_misc(void)
     HDremove(MISC29_COPY_FILE);
     HDremove(MISC30_FILE);
     HDremove(MISC31_FILE);
+    HDremove(MISC35_FILE);
+    HDremove(MISC36_FILE);
 } /* end cleanup_misc() */
 
@@ -176,6 +176,10 @@
 /* Information for testing selection iterators */
 #define SEL_ITER_MAX_SEQ        256
 
+/* Number of elements and element size for testing strided runs */
+#define SEL_ITER_RUNS_NELMTS    (10 * 12 * 16)
+#define SEL_ITER_RUNS_ELMT      4
+
 
 /* Location comparison function */
 static int compare_size_t(const void *s1, const void *s2);
@@ -15189,6 +15193,186 @@ test_sel_iter(void)
     CHECK(ret, FAIL, "H5Sclose");
 }   /* test_sel_iter() */
 
+/****************************************************************
+**
+**  test_sel_iter_runs_verify(): Check that the strided runs from
+**      a selection iterator cover the same elements, in the same
+**      order, as its sequences.
+**
+****************************************************************/
+static void
+test_sel_iter_runs_verify(hid_t sid, size_t maxrun, size_t maxelem)
+{
+    hid_t       seq_iter_id;    /* Selection iterator for sequences */
+    hid_t       run_iter_id;    /* Selection iterator for runs */
+    hsize_t     seq_elmts[SEL_ITER_RUNS_NELMTS];    /* Element offsets from sequences */
+    hsize_t     run_elmts[SEL_ITER_RUNS_NELMTS];    /* Element offsets from runs */
+    size_t      nseq_elmts = 0, nrun_elmts = 0;     /* # of element offsets */
+    hssize_t    npoints;        /* # of elements selected */
+    hsize_t     off[SEL_ITER_MAX_SEQ];  /* Offsets for retrieved sequences */
+    size_t      len[SEL_ITER_MAX_SEQ];  /* Lengths for retrieved sequences */
+    H5S_sel_run_t run[SEL_ITER_MAX_SEQ];    /* Retrieved runs */
+    size_t      nseq, nrun;     /* # of sequences/runs retrieved */
+    size_t      nbytes, nelem;  /* # of bytes/elements retrieved */
+    size_t      u, v, w;        /* Local index variables */
+    htri_t      tri_ret;        /* Generic htri_t return value */
+    herr_t      ret;            /* Generic return value */
+
+    seq_iter_id = H5Ssel_iter_create(sid, (size_t)SEL_ITER_RUNS_ELMT, (unsigned)0);
+    CHECK(seq_iter_id, FAIL, "H5Ssel_iter_create");
+    run_iter_id = H5Ssel_iter_create(sid, (size_t)SEL_ITER_RUNS_ELMT, (unsigned)0);
+    CHECK(run_iter_id, FAIL, "H5Ssel_iter_create");
+
+    npoints = H5Sget_select_npoints(sid);
+    CHECK(npoints, FAIL, "H5Sget_select_npoints");
+
+    /* Retrieve all the sequences (the iterator mustn't be asked for more
+     * once it's used up) */
+    while(nseq_elmts < (size_t)npoints) {
+        ret = H5Ssel_iter_get_seq_list(seq_iter_id, (size_t)SEL_ITER_MAX_SEQ, (size_t)SEL_ITER_RUNS_NELMTS * SEL_ITER_RUNS_ELMT, &nseq, &nbytes, off, len);
+        CHECK(ret, FAIL, "H5Ssel_iter_get_seq_list");
+        for(u = 0; u < nseq; u++)
+            for(v = 0; v < len[u]; v += SEL_ITER_RUNS_ELMT)
+                seq_elmts[nseq_elmts++] = off[u] + v;
+        if(0 == nseq)
+            break;
+    } /* end while */
+
+    /* Retrieve all the runs, a few at a time */
+    while(nrun_elmts < nseq_elmts) {
+        size_t prev_nrun_elmts = nrun_elmts;    /* # of element offsets before this call */
+
+        tri_ret = H5S__sel_iter_get_run_list_test(run_iter_id, maxrun, maxelem, &nrun, &nelem, run);
+        VERIFY(tri_ret, TRUE, "H5S__sel_iter_get_run_list_test");
+        if(nrun > maxrun || nelem > maxelem)
+            ERROR("H5S__sel_iter_get_run_list_test");
+        for(u = 0; u < nrun; u++)
+            for(v = 0; v < run[u].count; v++)
+                for(w = 0; w < run[u].len; w += SEL_ITER_RUNS_ELMT)
+                    run_elmts[nrun_elmts++] = run[u].off + (v * run[u].stride) + w;
+        VERIFY(nrun_elmts - prev_nrun_elmts, nelem, "H5S__sel_iter_get_run_list_test");
+        if(0 == nelem)
+            break;
+    } /* end while */
+
+    /* Check that the elements are the same */
+    VERIFY(nrun_elmts, nseq_elmts, "H5S__sel_iter_get_run_list_test");
+    for(u = 0; u < nseq_elmts; u++)
+        if(run_elmts[u] != seq_elmts[u]) {
+            ERROR("H5S__sel_iter_get_run_list_test");
+            break;
+        } /* end if */
+
+    ret = H5Ssel_iter_close(seq_iter_id);
+    CHECK(ret, FAIL, "H5Ssel_iter_close");
+    ret = H5Ssel_iter_close(run_iter_id);
+    CHECK(ret, FAIL, "H5Ssel_iter_close");
+}   /* test_sel_iter_runs_verify() */
+
+/****************************************************************
+**
+**  test_sel_iter_runs(): Test strided runs from selection iterators.
+**
+****************************************************************/
+static void
+test_sel_iter_runs(void)
+{
+    hid_t       sid;            /* Dataspace ID */
+    hid_t       iter_id;        /* Dataspace selection iterator ID */
+    hsize_t     dims[] = {10, 12, 16};  /* 3-D dataspace dimensions */
+    hsize_t     coord[2][3] = {{0, 1, 2}, {3, 4, 5}};  /* Coordinates for point selection */
+    hsize_t     start[3];       /* Hyperslab start */
+    hsize_t     stride[3];      /* Hyperslab stride */
+    hsize_t     count[3];       /* Hyperslab block count */
+    hsize_t     block[3];       /* Hyperslab block size */
+    hssize_t    offset[3] = {1, 0, 0};  /* Selection offset */
+    H5S_sel_run_t run[SEL_ITER_MAX_SEQ];    /* Retrieved runs */
+    size_t      nrun, nelem;    /* # of runs/elements retrieved */
+    size_t      maxrun[] = {1, 2, SEL_ITER_MAX_SEQ};    /* Run limits to try */
+    size_t      maxelem[] = {1, 3, 7, SEL_ITER_RUNS_NELMTS};    /* Element limits to try */
+    unsigned    u, v;           /* Local index variables */
+    htri_t      tri_ret;        /* Generic htri_t return value */
+    herr_t      ret;            /* Generic return value */
+
+    /* Output message about test being performed */
+    MESSAGE(6, ("Testing Strided Runs from Dataspace Selection Iterators\n"));
+
+    sid = H5Screate_simple(3, dims, NULL);
+    CHECK(sid, FAIL, "H5Screate_simple");
+
+    /* One element in every four, in the fastest dimension */
+    start[0] = 1; start[1] = 0; start[2] = 2;
+    stride[0] = 3; stride[1] = 1; stride[2] = 4;
+    count[0] = 3; count[1] = 12; count[2] = 3;
+    block[0] = 2; block[1] = 1; block[2] = 1;
+    ret = H5Sselect_hyperslab(sid, H5S_SELECT_SET, start, stride, count, block);
+    CHECK(ret, FAIL, "H5Sselect_hyperslab");
+    for(u = 0; u < (sizeof(maxrun) / sizeof(maxrun[0])); u++)
+        for(v = 0; v < (sizeof(maxelem) / sizeof(maxelem[0])); v++)
+            test_sel_iter_runs_verify(sid, maxrun[u], maxelem[v]);
+
+    /* The same, moved by a selection offset */
+    ret = H5Soffset_simple(sid, offset);
+    CHECK(ret, FAIL, "H5Soffset_simple");
+    for(u = 0; u < (sizeof(maxrun) / sizeof(maxrun[0])); u++)
+        for(v = 0; v < (sizeof(maxelem) / sizeof(maxelem[0])); v++)
+            test_sel_iter_runs_verify(sid, maxrun[u], maxelem[v]);
+    offset[0] = 0;
+    ret = H5Soffset_simple(sid, offset);
+    CHECK(ret, FAIL, "H5Soffset_simple");
+
+    /* Blocks of several elements in each dimension */
+    start[0] = 0; start[1] = 1; start[2] = 0;
+    stride[0] = 4; stride[1] = 5; stride[2] = 5;
+    count[0] = 2; count[1] = 2; count[2] = 3;
+    block[0] = 3; block[1] = 2; block[2] = 3;
+    ret = H5Sselect_hyperslab(sid, H5S_SELECT_SET, start, stride, count, block);
+    CHECK(ret, FAIL, "H5Sselect_hyperslab");
+    for(u = 0; u < (sizeof(maxrun) / sizeof(maxrun[0])); u++)
+        for(v = 0; v < (sizeof(maxelem) / sizeof(maxelem[0])); v++)
+            test_sel_iter_runs_verify(sid, maxrun[u], maxelem[v]);
+
+    /* Whole planes, which the iterator "flattens" */
+    start[0] = 1; start[1] = 0; start[2] = 0;
+    stride[0] = 2; stride[1] = 1; stride[2] = 1;
+    count[0] = 4; count[1] = 1; count[2] = 1;
+    block[0] = 1; block[1] = 12; block[2] = 16;
+    ret = H5Sselect_hyperslab(sid, H5S_SELECT_SET, start, stride, count, block);
+    CHECK(ret, FAIL, "H5Sselect_hyperslab");
+    for(u = 0; u < (sizeof(maxrun) / sizeof(maxrun[0])); u++)
+        for(v = 0; v < (sizeof(maxelem) / sizeof(maxelem[0])); v++)
+            test_sel_iter_runs_verify(sid, maxrun[u], maxelem[v]);
+
+    /* Irregular hyperslab selections can't be described with runs */
+    start[0] = 0; start[1] = 0; start[2] = 0;
+    count[0] = 1; count[1] = 1; count[2] = 1;
+    block[0] = 2; block[1] = 2; block[2] = 2;
+    ret = H5Sselect_hyperslab(sid, H5S_SELECT_SET, start, NULL, count, block);
+    CHECK(ret, FAIL, "H5Sselect_hyperslab");
+    start[0] = 1; start[1] = 1; start[2] = 1;
+    ret = H5Sselect_hyperslab(sid, H5S_SELECT_OR, start, NULL, count, block);
+    CHECK(ret, FAIL, "H5Sselect_hyperslab");
+    iter_id = H5Ssel_iter_create(sid, (size_t)SEL_ITER_RUNS_ELMT, (unsigned)0);
+    CHECK(iter_id, FAIL, "H5Ssel_iter_create");
+    tri_ret = H5S__sel_iter_get_run_list_test(iter_id, (size_t)SEL_ITER_MAX_SEQ, (size_t)SEL_ITER_RUNS_NELMTS, &nrun, &nelem, run);
+    VERIFY(tri_ret, FALSE, "H5S__sel_iter_get_run_list_test");
+    ret = H5Ssel_iter_close(iter_id);
+    CHECK(ret, FAIL, "H5Ssel_iter_close");
+
+    /* Nor can point selections */
+    ret = H5Sselect_elements(sid, H5S_SELECT_SET, (size_t)2, (const hsize_t *)coord);
+    CHECK(ret, FAIL, "H5Sselect_elements");
+    iter_id = H5Ssel_iter_create(sid, (size_t)SEL_ITER_RUNS_ELMT, (unsigned)0);
+    CHECK(iter_id, FAIL, "H5Ssel_iter_create");
+    tri_ret = H5S__sel_iter_get_run_list_test(iter_id, (size_t)SEL_ITER_MAX_SEQ, (size_t)SEL_ITER_RUNS_NELMTS, &nrun, &nelem, run);
+    VERIFY(tri_ret, FALSE, "H5S__sel_iter_get_run_list_test");
+    ret = H5Ssel_iter_close(iter_id);
+    CHECK(ret, FAIL, "H5Ssel_iter_close");
+
+    ret = H5Sclose(sid);
+    CHECK(ret, FAIL, "H5Sclose");
+}   /* test_sel_iter_runs() */
+
 
 /****************************************************************
 **
@@ -15369,6 +15553,7 @@ test_select(void)
 
     /* Test selection iterators */
     test_sel_iter();
+    test_sel_iter_runs();
 }   /* test_select() */
 
 
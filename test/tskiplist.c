@@ -1750,6 +1750,161 @@ test_skiplist_remove_first_many(void)
 
 } /* end test_skiplist_remove_first() */
 
+/****************************************************************
+**
+**  test_skiplist_build(): Test H5SL (skip list) code.
+**      Tests building skip lists from sorted items in one pass.
+**
+****************************************************************/
+static void
+test_skiplist_build(void)
+{
+    H5SL_t  *slist;         /* Skip list created */
+    void    **items;        /* Items to build list from */
+    const void **keys;      /* Keys for items */
+    void    **half_items;   /* Every other item */
+    const void **half_keys; /* Keys for every other item */
+    size_t  sizes[] = {0, 1, 2, 3, 4, 5, 7, 8, 9, 16, 31, 100, NUM_ELEMS};
+    size_t  num;            /* Number of elements in skip list */
+    size_t  s, u;           /* Local index variables */
+    H5SL_node_t *node;      /* Skip list node */
+    int     *found_item;    /* Item found in skip list */
+    int     key;            /* Key of item to search for */
+    herr_t  ret;            /* Generic return value */
+
+    /* Output message about test being performed */
+    MESSAGE(7, ("Testing Skip List 'Build' Operation\n"));
+
+    items = (void **)HDmalloc(sizeof(void *) * NUM_ELEMS);
+    CHECK_PTR(items, "HDmalloc");
+    keys = (const void **)HDmalloc(sizeof(void *) * NUM_ELEMS);
+    CHECK_PTR(keys, "HDmalloc");
+    half_items = (void **)HDmalloc(sizeof(void *) * ((NUM_ELEMS + 1) / 2));
+    CHECK_PTR(half_items, "HDmalloc");
+    half_keys = (const void **)HDmalloc(sizeof(void *) * ((NUM_ELEMS + 1) / 2));
+    CHECK_PTR(half_keys, "HDmalloc");
+    for(u = 0; u < NUM_ELEMS; u++) {
+        items[u] = &sort_rand_num[u];
+        keys[u] = &sort_rand_num[u];
+    } /* end for */
+
+    /* Create a skip list */
+    slist = H5SL_create(H5SL_TYPE_INT, NULL);
+    CHECK_PTR(slist, "H5SL_create");
+
+    for(s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++) {
+        /* Build the list */
+        ret = H5SL_build(slist, sizes[s], items, keys);
+        CHECK(ret, FAIL, "H5SL_build");
+
+        /* Check that the skip list has correct # of elements */
+        num = H5SL_count(slist);
+        VERIFY(num, sizes[s], "H5SL_count");
+
+        /* Check the order of the nodes */
+        for(node = H5SL_first(slist), u = 0; node; node = H5SL_next(node), u++) {
+            found_item = (int *)H5SL_item(node);
+            VERIFY(*found_item, sort_rand_num[u], "H5SL_next");
+        } /* end for */
+        VERIFY(u, sizes[s], "H5SL_next");
+
+        /* Search for all objects in the skip list */
+        for(u = 0; u < sizes[s]; u++) {
+            found_item = (int *)H5SL_search(slist, &sort_rand_num[u]);
+            CHECK_PTR(found_item, "H5SL_search");
+            VERIFY(*found_item, sort_rand_num[u], "H5SL_search");
+        } /* end for */
+
+        /* Search for keys not in the list */
+        if(sizes[s] > 0) {
+            key = sort_rand_num[0] - 1;
+            found_item = (int *)H5SL_search(slist, &key);
+            CHECK_PTR_NULL(found_item, "H5SL_search");
+            key = sort_rand_num[sizes[s] - 1] + 1;
+            found_item = (int *)H5SL_search(slist, &key);
+            CHECK_PTR_NULL(found_item, "H5SL_search");
+        } /* end if */
+
+        /* Building a list that isn't empty should fail */
+        if(sizes[s] > 0) {
+            H5E_BEGIN_TRY {
+                ret = H5SL_build(slist, sizes[s], items, keys);
+            } H5E_END_TRY;
+            VERIFY(ret, FAIL, "H5SL_build");
+        } /* end if */
+
+        /* Remove every other object, then the rest, to check that the list
+         * can be rebalanced */
+        for(u = 0; u < sizes[s]; u += 2) {
+            found_item = (int *)H5SL_remove(slist, &sort_rand_num[u]);
+            CHECK_PTR(found_item, "H5SL_remove");
+            VERIFY(*found_item, sort_rand_num[u], "H5SL_remove");
+        } /* end for */
+        for(u = 1; u < sizes[s]; u += 2) {
+            found_item = (int *)H5SL_search(slist, &sort_rand_num[u]);
+            CHECK_PTR(found_item, "H5SL_search");
+            VERIFY(*found_item, sort_rand_num[u], "H5SL_search");
+        } /* end for */
+        for(u = 1; u < sizes[s]; u += 2) {
+            found_item = (int *)H5SL_remove(slist, &sort_rand_num[u]);
+            CHECK_PTR(found_item, "H5SL_remove");
+            VERIFY(*found_item, sort_rand_num[u], "H5SL_remove");
+        } /* end for */
+        num = H5SL_count(slist);
+        VERIFY(num, 0, "H5SL_count");
+
+        /* Build the list from every other object, insert the rest between
+         * them and remove all the objects from the front */
+        for(u = 0; u < sizes[s]; u += 2) {
+            half_items[u / 2] = items[u];
+            half_keys[u / 2] = keys[u];
+        } /* end for */
+        ret = H5SL_build(slist, (sizes[s] + 1) / 2, half_items, half_keys);
+        CHECK(ret, FAIL, "H5SL_build");
+        for(u = 1; u < sizes[s]; u += 2) {
+            ret = H5SL_insert(slist, &sort_rand_num[u], &sort_rand_num[u]);
+            CHECK(ret, FAIL, "H5SL_insert");
+        } /* end for */
+        num = H5SL_count(slist);
+        VERIFY(num, sizes[s], "H5SL_count");
+        for(u = 0; u < sizes[s]; u++) {
+            found_item = (int *)H5SL_remove_first(slist);
+            CHECK_PTR(found_item, "H5SL_remove_first");
+            VERIFY(*found_item, sort_rand_num[u], "H5SL_remove_first");
+        } /* end for */
+        num = H5SL_count(slist);
+        VERIFY(num, 0, "H5SL_count");
+    } /* end for */
+
+    /* Keys out of order should fail and leave the list empty */
+    keys[NUM_ELEMS / 2] = keys[0];
+    H5E_BEGIN_TRY {
+        ret = H5SL_build(slist, NUM_ELEMS, items, keys);
+    } H5E_END_TRY;
+    VERIFY(ret, FAIL, "H5SL_build");
+    num = H5SL_count(slist);
+    VERIFY(num, 0, "H5SL_count");
+    node = H5SL_first(slist);
+    CHECK_PTR_NULL(node, "H5SL_first");
+
+    /* The list should still be usable */
+    for(u = 0; u < NUM_ELEMS; u++) {
+        ret = H5SL_insert(slist, &rand_num[u], &rand_num[u]);
+        CHECK(ret, FAIL, "H5SL_insert");
+    } /* end for */
+    num = H5SL_count(slist);
+    VERIFY(num, NUM_ELEMS, "H5SL_count");
+
+    /* Close the skip list */
+    ret = H5SL_close(slist);
+    CHECK(ret, FAIL, "H5SL_close");
+
+    HDfree(half_keys);
+    HDfree(half_items);
+    HDfree(keys);
+    HDfree(items);
+} /* end test_skiplist_build() */
+
 /****************************************************************
 **
 **  test_skiplist_term(): Test H5SL (skiplist) code.
@@ -1807,6 +1962,7 @@ test_skiplist(void)
     test_skiplist_above();      /* Test 'above' operation */
     test_skiplist_remove_first();   /* Test 'remove first' operation */
     test_skiplist_remove_first_many();  /* Test 'remove first' operation on large skip lists */
+    test_skiplist_build();      /* Test 'build' operation */
 
     /* Release skip list testing data */
     test_skiplist_term();
@@ -111,6 +111,11 @@ int main(int argc, char *argv[])
     AddTest("cancel", tts_cancel, cleanup_cancel, "thread cancellation safety test", NULL);
 #endif /* H5_HAVE_PTHREAD_H */
     AddTest("acreate", tts_acreate, cleanup_acreate, "multi-attribute creation", NULL);
+    AddTest("rdonly", tts_rdonly, cleanup_rdonly, "concurrent reads from a read-only file", NULL);
+#ifdef H5_HAVE_PTHREAD_H
+    /* The lock is only ever released with pthreads */
+    AddTest("rdonly_guards", tts_rdonly_guards, cleanup_rdonly_guards, "guards on reads in progress", NULL);
+#endif /* H5_HAVE_PTHREAD_H */
 
 #else /* H5_HAVE_THREADSAFE */
 
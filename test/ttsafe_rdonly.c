@@ -0,0 +1,665 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://support.hdfgroup.org/ftp/HDF5/releases.  *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/********************************************************************
+ *
+ * Testing concurrent raw data reads from a read-only file
+ * -------------------------------------------------------
+ *
+ * Multiple threads read contiguous and chunked datasets from a file
+ * opened read-only, where the library lets other threads in while a
+ * thread waits on a raw data read.  The even-numbered threads share one
+ * pair of dataset IDs, and the odd-numbered threads open their own and
+ * close and re-open them between reads.  Every value read is checked.
+ *
+ * A second test stops a converting read inside a file driver that
+ * releases the library's lock, and checks from another thread that the
+ * lock really is released, that the read's IDs can be closed, and that
+ * closing the file with the "strong" degree, refreshing the dataset and
+ * changing the conversion paths are refused until the read is done.
+ *
+ * Temporary files generated:
+ *   ttsafe_rdonly.h5
+ *   ttsafe_rdonly_guards.h5
+ *
+ ********************************************************************/
+#include "ttsafe.h"
+#include "H5FDprivate.h"
+
+#ifdef H5_HAVE_THREADSAFE
+
+#define FILENAME        "ttsafe_rdonly.h5"
+#define CONTIG_NAME     "contig"
+#define CHUNKED_NAME    "chunked"
+#define NUM_THREAD      16
+#define NUM_READS       24
+#define DSET_NELMTS     (256 * 1024)    /* Larger than the sieve buffer */
+#define CHUNK_NELMTS    (16 * 1024)
+#define READ_NELMTS     (64 * 1024)
+
+void *tts_rdonly_reader(void *);
+
+typedef struct rdonly_info_t {
+    int id;                     /* Thread number */
+    hid_t file;                 /* File shared by the threads */
+    hid_t contig;               /* Contiguous dataset */
+    hid_t chunked;              /* Chunked dataset */
+    int nerrors;                /* Number of bad values or failed calls */
+} rdonly_info_t;
+
+static rdonly_info_t rdonly_info[NUM_THREAD];
+
+/*
+ * Reads READ_NELMTS values from a dataset, starting at START, and checks
+ * that each one is its own index.  Returns the number of errors.
+ */
+static int
+tts_rdonly_check(hid_t dset, hsize_t start, int *buf)
+{
+    hid_t mspace = H5I_INVALID_HID;
+    hid_t fspace = H5I_INVALID_HID;
+    hsize_t count = READ_NELMTS;
+    int nerrors = 0;
+    int i;
+
+    if((mspace = H5Screate_simple(1, &count, NULL)) < 0)
+        return 1;
+    if((fspace = H5Dget_space(dset)) < 0) {
+        H5Sclose(mspace);
+        return 1;
+    }
+
+    if(H5Sselect_hyperslab(fspace, H5S_SELECT_SET, &start, NULL, &count, NULL) < 0
+            || H5Dread(dset, H5T_NATIVE_INT, mspace, fspace, H5P_DEFAULT, buf) < 0)
+        nerrors++;
+    else
+        for(i = 0; i < READ_NELMTS; i++)
+            if(buf[i] != (int)start + i) {
+                nerrors++;
+                break;
+            }
+
+    H5Sclose(fspace);
+    H5Sclose(mspace);
+
+    return nerrors;
+} /* end tts_rdonly_check() */
+
+/*
+ **********************************************************************
+ * Thread safe test - concurrent reads from a read-only file
+ **********************************************************************
+ */
+void
+tts_rdonly(void)
+{
+    H5TS_thread_t threads[NUM_THREAD];
+    hid_t file = H5I_INVALID_HID;
+    hid_t fapl = H5I_INVALID_HID;
+    hid_t dcpl = H5I_INVALID_HID;
+    hid_t space = H5I_INVALID_HID;
+    hid_t dset = H5I_INVALID_HID;
+    hid_t dapl = H5I_INVALID_HID;
+    hid_t shared_contig = H5I_INVALID_HID;
+    hid_t shared_chunked = H5I_INVALID_HID;
+    hsize_t dims = DSET_NELMTS;
+    hsize_t chunk_dims = CHUNK_NELMTS;
+    int *data;
+    int nerrors = 0;
+    int i;
+    herr_t status;
+
+    /* Create the datasets, with each value equal to its index */
+    data = (int *)HDmalloc(DSET_NELMTS * sizeof(int));
+    CHECK_PTR(data, "HDmalloc");
+    for(i = 0; i < DSET_NELMTS; i++)
+        data[i] = i;
+
+    file = H5Fcreate(FILENAME, H5F_ACC_TRUNC, H5P_DEFAULT, H5P_DEFAULT);
+    CHECK(file, H5I_INVALID_HID, "H5Fcreate");
+    space = H5Screate_simple(1, &dims, NULL);
+    CHECK(space, H5I_INVALID_HID, "H5Screate_simple");
+
+    dset = H5Dcreate2(file, CONTIG_NAME, H5T_NATIVE_INT, space, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+    CHECK(dset, H5I_INVALID_HID, "H5Dcreate2");
+    status = H5Dwrite(dset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, data);
+    CHECK(status, FAIL, "H5Dwrite");
+    status = H5Dclose(dset);
+    CHECK(status, FAIL, "H5Dclose");
+
+    dcpl = H5Pcreate(H5P_DATASET_CREATE);
+    CHECK(dcpl, H5I_INVALID_HID, "H5Pcreate");
+    status = H5Pset_chunk(dcpl, 1, &chunk_dims);
+    CHECK(status, FAIL, "H5Pset_chunk");
+    dset = H5Dcreate2(file, CHUNKED_NAME, H5T_NATIVE_INT, space, H5P_DEFAULT, dcpl, H5P_DEFAULT);
+    CHECK(dset, H5I_INVALID_HID, "H5Dcreate2");
+    status = H5Dwrite(dset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, data);
+    CHECK(status, FAIL, "H5Dwrite");
+    status = H5Dclose(dset);
+    CHECK(status, FAIL, "H5Dclose");
+
+    status = H5Pclose(dcpl);
+    CHECK(status, FAIL, "H5Pclose");
+    status = H5Sclose(space);
+    CHECK(status, FAIL, "H5Sclose");
+    status = H5Fclose(file);
+    CHECK(status, FAIL, "H5Fclose");
+
+    /* Re-open the file read-only, with the strong close degree so closing
+     * it checks for reads still in progress
+     */
+    fapl = H5Pcreate(H5P_FILE_ACCESS);
+    CHECK(fapl, H5I_INVALID_HID, "H5Pcreate");
+    status = H5Pset_fclose_degree(fapl, H5F_CLOSE_STRONG);
+    CHECK(status, FAIL, "H5Pset_fclose_degree");
+    file = H5Fopen(FILENAME, H5F_ACC_RDONLY, fapl);
+    CHECK(file, H5I_INVALID_HID, "H5Fopen");
+
+    /* Turn off the chunk cache, so chunks are read straight into the
+     * threads' buffers
+     */
+    dapl = H5Pcreate(H5P_DATASET_ACCESS);
+    CHECK(dapl, H5I_INVALID_HID, "H5Pcreate");
+    status = H5Pset_chunk_cache(dapl, 0, 0, H5D_CHUNK_CACHE_W0_DEFAULT);
+    CHECK(status, FAIL, "H5Pset_chunk_cache");
+
+    /* The even-numbered threads share these IDs */
+    shared_contig = H5Dopen2(file, CONTIG_NAME, H5P_DEFAULT);
+    CHECK(shared_contig, H5I_INVALID_HID, "H5Dopen2");
+    shared_chunked = H5Dopen2(file, CHUNKED_NAME, dapl);
+    CHECK(shared_chunked, H5I_INVALID_HID, "H5Dopen2");
+
+    for(i = 0; i < NUM_THREAD; i++) {
+        rdonly_info[i].id = i;
+        rdonly_info[i].file = file;
+        if(i % 2) {
+            rdonly_info[i].contig = H5Dopen2(file, CONTIG_NAME, H5P_DEFAULT);
+            CHECK(rdonly_info[i].contig, H5I_INVALID_HID, "H5Dopen2");
+            rdonly_info[i].chunked = H5Dopen2(file, CHUNKED_NAME, dapl);
+            CHECK(rdonly_info[i].chunked, H5I_INVALID_HID, "H5Dopen2");
+        }
+        else {
+            rdonly_info[i].contig = shared_contig;
+            rdonly_info[i].chunked = shared_chunked;
+        }
+        rdonly_info[i].nerrors = 0;
+    }
+
+    /* Read from all the threads at once */
+    for(i = 0; i < NUM_THREAD; i++)
+        threads[i] = H5TS_create_thread(tts_rdonly_reader, NULL, &rdonly_info[i]);
+    for(i = 0; i < NUM_THREAD; i++)
+        H5TS_wait_for_thread(threads[i]);
+
+    for(i = 0; i < NUM_THREAD; i++) {
+        nerrors += rdonly_info[i].nerrors;
+        if(i % 2) {
+            status = H5Dclose(rdonly_info[i].contig);
+            CHECK(status, FAIL, "H5Dclose");
+            status = H5Dclose(rdonly_info[i].chunked);
+            CHECK(status, FAIL, "H5Dclose");
+        }
+    }
+    VERIFY(nerrors, 0, "concurrent reads");
+    status = H5Dclose(shared_contig);
+    CHECK(status, FAIL, "H5Dclose");
+    status = H5Dclose(shared_chunked);
+    CHECK(status, FAIL, "H5Dclose");
+
+    /* With no reads in progress, the file closes normally */
+    status = H5Pclose(dapl);
+    CHECK(status, FAIL, "H5Pclose");
+    status = H5Pclose(fapl);
+    CHECK(status, FAIL, "H5Pclose");
+    status = H5Fclose(file);
+    CHECK(status, FAIL, "H5Fclose");
+
+    HDfree(data);
+} /* end tts_rdonly() */
+
+void *
+tts_rdonly_reader(void *_info)
+{
+    rdonly_info_t *info = (rdonly_info_t *)_info;
+    hid_t dset_ids[2];
+    hid_t type_ids[2];
+    hid_t space_ids[2];
+    void *bufs[2];
+    int *buf;
+    int *whole;
+    int n, i;
+
+    buf = (int *)HDmalloc(READ_NELMTS * sizeof(int));
+    whole = (int *)HDmalloc(2 * DSET_NELMTS * sizeof(int));
+    if(NULL == buf || NULL == whole) {
+        info->nerrors++;
+        HDfree(buf);
+        HDfree(whole);
+        return NULL;
+    }
+
+    for(n = 0; n < NUM_READS; n++) {
+        hsize_t start = (hsize_t)(((info->id + n) * 7919) % (DSET_NELMTS - READ_NELMTS));
+
+        /* Partial reads */
+        info->nerrors += tts_rdonly_check(info->contig, start, buf);
+        info->nerrors += tts_rdonly_check(info->chunked, start, buf);
+
+        /* Whole-dataset reads of both datasets at once */
+        if(0 == n % 8) {
+            dset_ids[0] = info->contig;
+            dset_ids[1] = info->chunked;
+            type_ids[0] = type_ids[1] = H5T_NATIVE_INT;
+            space_ids[0] = space_ids[1] = H5S_ALL;
+            bufs[0] = whole;
+            bufs[1] = whole + DSET_NELMTS;
+            if(H5Dread_multi((size_t)2, dset_ids, type_ids, space_ids, space_ids, H5P_DEFAULT, bufs) < 0)
+                info->nerrors++;
+            else
+                for(i = 0; i < DSET_NELMTS; i++)
+                    if(whole[i] != i || whole[DSET_NELMTS + i] != i) {
+                        info->nerrors++;
+                        break;
+                    }
+        }
+
+        /* Odd threads close and re-open their datasets between reads */
+        if(info->id % 2) {
+            if(H5Dclose(info->contig) < 0)
+                info->nerrors++;
+            if((info->contig = H5Dopen2(info->file, CONTIG_NAME, H5P_DEFAULT)) < 0)
+                info->nerrors++;
+        }
+    }
+
+    HDfree(whole);
+    HDfree(buf);
+
+    return NULL;
+} /* end tts_rdonly_reader() */
+
+void
+cleanup_rdonly(void)
+{
+    HDunlink(FILENAME);
+}
+
+#ifdef H5_HAVE_PTHREAD_H
+
+#define GUARDS_FILENAME "ttsafe_rdonly_guards.h5"
+#define GUARDS_TIMEOUT  60              /* Seconds to wait for the reader */
+
+void *tts_rdonly_guards_reader(void *);
+
+/* A read-only file driver whose raw data reads release the library's
+ * lock and then wait at a gate, so the test can act while a read is in
+ * progress
+ */
+typedef struct rdonly_gate_file_t {
+    H5FD_t pub;                 /* Public part, must be first */
+    int fd;                     /* File descriptor */
+    haddr_t eoa;                /* End of allocated region */
+    haddr_t eof;                /* End of file */
+} rdonly_gate_file_t;
+
+/* The gate */
+static pthread_mutex_t gate_mutex_g = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t gate_cond_g = PTHREAD_COND_INITIALIZER;
+static hbool_t gate_closed_g = FALSE;   /* Whether reads wait at the gate */
+static int gate_nwaiting_g = 0;         /* Number of reads waiting */
+
+/* The read stopped at the gate */
+typedef struct rdonly_guards_info_t {
+    hid_t dset;                 /* Dataset */
+    hid_t mem_type;             /* Memory datatype (needs conversion) */
+    hid_t mem_space;            /* Memory dataspace */
+    hid_t file_space;           /* File dataspace */
+    double *buf;                /* Buffer read into */
+    herr_t status;              /* Result of the read */
+} rdonly_guards_info_t;
+
+static H5FD_t *
+gate_open(const char *name, unsigned flags, hid_t H5_ATTR_UNUSED fapl_id,
+    haddr_t H5_ATTR_UNUSED maxaddr)
+{
+    rdonly_gate_file_t *file;
+    h5_stat_t sb;
+    int fd;
+
+    if(flags & H5F_ACC_RDWR)
+        return NULL;
+    if((fd = HDopen(name, O_RDONLY, 0)) < 0)
+        return NULL;
+    if(HDfstat(fd, &sb) < 0 || NULL == (file = (rdonly_gate_file_t *)HDcalloc(1, sizeof(rdonly_gate_file_t)))) {
+        HDclose(fd);
+        return NULL;
+    }
+    file->fd = fd;
+    file->eof = (haddr_t)sb.st_size;
+
+    return (H5FD_t *)file;
+}
+
+static herr_t
+gate_close(H5FD_t *_file)
+{
+    rdonly_gate_file_t *file = (rdonly_gate_file_t *)_file;
+    herr_t ret_value = HDclose(file->fd) < 0 ? FAIL : SUCCEED;
+
+    HDfree(file);
+
+    return ret_value;
+}
+
+static herr_t
+gate_query(const H5FD_t H5_ATTR_UNUSED *_file, unsigned long *flags)
+{
+    *flags = H5FD_FEAT_CONCURRENT_READ;
+
+    return SUCCEED;
+}
+
+static haddr_t
+gate_get_eoa(const H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type)
+{
+    return ((const rdonly_gate_file_t *)_file)->eoa;
+}
+
+static herr_t
+gate_set_eoa(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, haddr_t addr)
+{
+    ((rdonly_gate_file_t *)_file)->eoa = addr;
+
+    return SUCCEED;
+}
+
+static haddr_t
+gate_get_eof(const H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type)
+{
+    return ((const rdonly_gate_file_t *)_file)->eof;
+}
+
+static herr_t
+gate_read(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, hid_t H5_ATTR_UNUSED dxpl_id,
+    haddr_t addr, size_t size, void *buf)
+{
+    rdonly_gate_file_t *file = (rdonly_gate_file_t *)_file;
+    hbool_t released;
+    herr_t ret_value = SUCCEED;
+
+    /* Wait at the gate, if the lock could be released */
+    if(TRUE == (released = H5FD_try_release_api_lock())) {
+        pthread_mutex_lock(&gate_mutex_g);
+        gate_nwaiting_g++;
+        pthread_cond_broadcast(&gate_cond_g);
+        while(gate_closed_g)
+            pthread_cond_wait(&gate_cond_g, &gate_mutex_g);
+        gate_nwaiting_g--;
+        pthread_mutex_unlock(&gate_mutex_g);
+    }
+
+    while(size > 0) {
+        ssize_t nread = HDpread(file->fd, buf, size, (HDoff_t)addr);
+
+        if(nread < 0 && EINTR == errno)
+            continue;
+        if(nread < 0) {
+            ret_value = FAIL;
+            break;
+        }
+        if(0 == nread) {
+            HDmemset(buf, 0, size);
+            break;
+        }
+        size -= (size_t)nread;
+        addr += (haddr_t)nread;
+        buf = (char *)buf + nread;
+    }
+
+    if(released)
+        H5FD_reacquire_api_lock();
+
+    return ret_value;
+}
+
+static herr_t
+gate_write(H5FD_t H5_ATTR_UNUSED *_file, H5FD_mem_t H5_ATTR_UNUSED type, hid_t H5_ATTR_UNUSED dxpl_id,
+    haddr_t H5_ATTR_UNUSED addr, size_t H5_ATTR_UNUSED size, const void H5_ATTR_UNUSED *buf)
+{
+    return FAIL;
+}
+
+static const H5FD_class_t rdonly_gate_g = {
+    "rdonly_gate",              /* name         */
+    (haddr_t)HADDR_MAX - 1,     /* maxaddr      */
+    H5F_CLOSE_WEAK,             /* fc_degree    */
+    NULL,                       /* terminate    */
+    NULL,                       /* sb_size      */
+    NULL,                       /* sb_encode    */
+    NULL,                       /* sb_decode    */
+    0,                          /* fapl_size    */
+    NULL,                       /* fapl_get     */
+    NULL,                       /* fapl_copy    */
+    NULL,                       /* fapl_free    */
+    0,                          /* dxpl_size    */
+    NULL,                       /* dxpl_copy    */
+    NULL,                       /* dxpl_free    */
+    gate_open,                  /* open         */
+    gate_close,                 /* close        */
+    NULL,                       /* cmp          */
+    gate_query,                 /* query        */
+    NULL,                       /* get_type_map */
+    NULL,                       /* alloc        */
+    NULL,                       /* free         */
+    gate_get_eoa,               /* get_eoa      */
+    gate_set_eoa,               /* set_eoa      */
+    gate_get_eof,               /* get_eof      */
+    NULL,                       /* get_handle   */
+    gate_read,                  /* read         */
+    gate_write,                 /* write        */
+    NULL,                       /* flush        */
+    NULL,                       /* truncate     */
+    NULL,                       /* lock         */
+    NULL,                       /* unlock       */
+    H5FD_FLMAP_DICHOTOMY        /* fl_map       */
+};
+
+/*
+ * A conversion function that never applies, for registering and
+ * unregistering
+ */
+static herr_t
+tts_rdonly_conv(hid_t H5_ATTR_UNUSED src_id, hid_t H5_ATTR_UNUSED dst_id, H5T_cdata_t H5_ATTR_UNUSED *cdata,
+    size_t H5_ATTR_UNUSED nelmts, size_t H5_ATTR_UNUSED buf_stride, size_t H5_ATTR_UNUSED bkg_stride,
+    void H5_ATTR_UNUSED *buf, void H5_ATTR_UNUSED *bkg, hid_t H5_ATTR_UNUSED dxpl_id)
+{
+    return FAIL;
+}
+
+/*
+ **********************************************************************
+ * Thread safe test - guards on reads in progress
+ **********************************************************************
+ */
+void
+tts_rdonly_guards(void)
+{
+    H5TS_thread_t thread;
+    rdonly_guards_info_t info;
+    struct timespec deadline;
+    hid_t driver = H5I_INVALID_HID;
+    hid_t file = H5I_INVALID_HID;
+    hid_t fapl = H5I_INVALID_HID;
+    hid_t space = H5I_INVALID_HID;
+    hid_t dset = H5I_INVALID_HID;
+    hsize_t dims = DSET_NELMTS;
+    int *data;
+    int waiting;
+    int i;
+    htri_t valid;
+    herr_t status;
+
+    /* Create a contiguous dataset, with each value equal to its index */
+    data = (int *)HDmalloc(DSET_NELMTS * sizeof(int));
+    CHECK_PTR(data, "HDmalloc");
+    for(i = 0; i < DSET_NELMTS; i++)
+        data[i] = i;
+
+    file = H5Fcreate(GUARDS_FILENAME, H5F_ACC_TRUNC, H5P_DEFAULT, H5P_DEFAULT);
+    CHECK(file, H5I_INVALID_HID, "H5Fcreate");
+    space = H5Screate_simple(1, &dims, NULL);
+    CHECK(space, H5I_INVALID_HID, "H5Screate_simple");
+    dset = H5Dcreate2(file, CONTIG_NAME, H5T_NATIVE_INT, space, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+    CHECK(dset, H5I_INVALID_HID, "H5Dcreate2");
+    status = H5Dwrite(dset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, data);
+    CHECK(status, FAIL, "H5Dwrite");
+    status = H5Dclose(dset);
+    CHECK(status, FAIL, "H5Dclose");
+    status = H5Sclose(space);
+    CHECK(status, FAIL, "H5Sclose");
+    status = H5Fclose(file);
+    CHECK(status, FAIL, "H5Fclose");
+    HDfree(data);
+
+    /* Re-open the file read-only through the gate driver, with the strong
+     * close degree
+     */
+    driver = H5FDregister(&rdonly_gate_g);
+    CHECK(driver, H5I_INVALID_HID, "H5FDregister");
+    fapl = H5Pcreate(H5P_FILE_ACCESS);
+    CHECK(fapl, H5I_INVALID_HID, "H5Pcreate");
+    status = H5Pset_driver(fapl, driver, NULL);
+    CHECK(status, FAIL, "H5Pset_driver");
+    status = H5Pset_fclose_degree(fapl, H5F_CLOSE_STRONG);
+    CHECK(status, FAIL, "H5Pset_fclose_degree");
+    file = H5Fopen(GUARDS_FILENAME, H5F_ACC_RDONLY, fapl);
+    CHECK(file, H5I_INVALID_HID, "H5Fopen");
+
+    /* Set up a read that converts the values to doubles, with IDs of its
+     * own that can be closed while it's in progress
+     */
+    info.dset = H5Dopen2(file, CONTIG_NAME, H5P_DEFAULT);
+    CHECK(info.dset, H5I_INVALID_HID, "H5Dopen2");
+    info.mem_type = H5Tcopy(H5T_NATIVE_DOUBLE);
+    CHECK(info.mem_type, H5I_INVALID_HID, "H5Tcopy");
+    info.mem_space = H5Screate_simple(1, &dims, NULL);
+    CHECK(info.mem_space, H5I_INVALID_HID, "H5Screate_simple");
+    info.file_space = H5Dget_space(info.dset);
+    CHECK(info.file_space, H5I_INVALID_HID, "H5Dget_space");
+    info.buf = (double *)HDcalloc(DSET_NELMTS, sizeof(double));
+    CHECK_PTR(info.buf, "HDcalloc");
+    info.status = FAIL;
+
+    /* Start the read and wait for it to reach the gate.  It only gets
+     * there after the library's lock has been released.
+     */
+    gate_closed_g = TRUE;
+    thread = H5TS_create_thread(tts_rdonly_guards_reader, NULL, &info);
+
+    deadline.tv_sec = HDtime(NULL) + GUARDS_TIMEOUT;
+    deadline.tv_nsec = 0;
+    pthread_mutex_lock(&gate_mutex_g);
+    while(0 == gate_nwaiting_g)
+        if(pthread_cond_timedwait(&gate_cond_g, &gate_mutex_g, &deadline))
+            break;
+    waiting = gate_nwaiting_g;
+    pthread_mutex_unlock(&gate_mutex_g);
+    VERIFY(waiting, 1, "read waiting with the lock released");
+
+    if(waiting) {
+        /* The file can't be closed with the strong degree */
+        H5E_BEGIN_TRY {
+            status = H5Fclose(file);
+        } H5E_END_TRY;
+        VERIFY(status, FAIL, "H5Fclose");
+
+        /* The dataset can't be refreshed */
+        H5E_BEGIN_TRY {
+            status = H5Drefresh(info.dset);
+        } H5E_END_TRY;
+        VERIFY(status, FAIL, "H5Drefresh");
+
+        /* The conversion paths can't be changed */
+        H5E_BEGIN_TRY {
+            status = H5Tregister(H5T_PERS_HARD, "rdonly", H5T_NATIVE_INT, H5T_NATIVE_DOUBLE, tts_rdonly_conv);
+        } H5E_END_TRY;
+        VERIFY(status, FAIL, "H5Tregister");
+        H5E_BEGIN_TRY {
+            status = H5Tregister(H5T_PERS_SOFT, "rdonly", H5T_NATIVE_INT, H5T_NATIVE_DOUBLE, tts_rdonly_conv);
+        } H5E_END_TRY;
+        VERIFY(status, FAIL, "H5Tregister");
+        H5E_BEGIN_TRY {
+            status = H5Tunregister(H5T_PERS_DONTCARE, NULL, H5T_NATIVE_INT, H5T_NATIVE_DOUBLE, NULL);
+        } H5E_END_TRY;
+        VERIFY(status, FAIL, "H5Tunregister");
+
+        /* The read's IDs can be closed */
+        status = H5Dclose(info.dset);
+        CHECK(status, FAIL, "H5Dclose");
+        status = H5Tclose(info.mem_type);
+        CHECK(status, FAIL, "H5Tclose");
+        status = H5Sclose(info.mem_space);
+        CHECK(status, FAIL, "H5Sclose");
+        status = H5Sclose(info.file_space);
+        CHECK(status, FAIL, "H5Sclose");
+        valid = H5Iis_valid(info.dset);
+        VERIFY(valid, FALSE, "H5Iis_valid");
+    }
+
+    /* Let the read finish */
+    pthread_mutex_lock(&gate_mutex_g);
+    gate_closed_g = FALSE;
+    pthread_cond_broadcast(&gate_cond_g);
+    pthread_mutex_unlock(&gate_mutex_g);
+    H5TS_wait_for_thread(thread);
+
+    VERIFY(info.status, SUCCEED, "H5Dread");
+    for(i = 0; i < DSET_NELMTS; i++)
+        if(info.buf[i] != (double)i) {
+            TestErrPrintf("value %d read as %f\n", i, info.buf[i]);
+            break;
+        }
+    HDfree(info.buf);
+
+    /* With the read done, the conversion paths can change again */
+    status = H5Tregister(H5T_PERS_SOFT, "rdonly", H5T_NATIVE_INT, H5T_NATIVE_DOUBLE, tts_rdonly_conv);
+    CHECK(status, FAIL, "H5Tregister");
+    status = H5Tunregister(H5T_PERS_SOFT, "rdonly", H5T_NATIVE_INT, H5T_NATIVE_DOUBLE, tts_rdonly_conv);
+    CHECK(status, FAIL, "H5Tunregister");
+
+    /* ... and the file closes */
+    status = H5Fclose(file);
+    CHECK(status, FAIL, "H5Fclose");
+    status = H5Pclose(fapl);
+    CHECK(status, FAIL, "H5Pclose");
+    status = H5FDunregister(driver);
+    CHECK(status, FAIL, "H5FDunregister");
+} /* end tts_rdonly_guards() */
+
+void *
+tts_rdonly_guards_reader(void *_info)
+{
+    rdonly_guards_info_t *info = (rdonly_guards_info_t *)_info;
+
+    info->status = H5Dread(info->dset, info->mem_type, info->mem_space, info->file_space, H5P_DEFAULT, info->buf);
+
+    return NULL;
+} /* end tts_rdonly_guards_reader() */
+
+void
+cleanup_rdonly_guards(void)
+{
+    HDunlink(GUARDS_FILENAME);
+}
+#endif /* H5_HAVE_PTHREAD_H */
+
+#endif /*H5_HAVE_THREADSAFE*/
@@ -3157,6 +3157,199 @@ test_vltypes_fill_value(void)
     HDfree(rbuf);
 } /* end test_vltypes_fill_value() */
 
+/****************************************************************
+**
+**  test_vltypes_vlen_arena(): Test reading VL data into an
+**      application-supplied arena with H5Pset_vlen_arena().
+**      Checks that nested sequences and strings are all placed in
+**      the arena, suitably aligned, that reclaiming them is a no-op,
+**      and that an arena which is too small makes the read fail.
+**
+****************************************************************/
+static void
+test_vltypes_vlen_arena(void)
+{
+    hvl_t wdata[SPACE1_DIM1];   /* Information to write */
+    hvl_t rdata[SPACE1_DIM1];   /* Information read in */
+    const char *wstr[SPACE1_DIM1] = {"one", "", "three, four", "a rather longer string to pack"};
+    char *rstr[SPACE1_DIM1];    /* Strings read in */
+    hvl_t *t1, *t2;             /* Temporary pointer to VL information */
+    unsigned char *arena;       /* Arena to read VL data into */
+    size_t arena_size = 1024;   /* Size of the arena */
+    void *ret_buf;              /* Arena buffer returned from the DXPL */
+    size_t ret_size;            /* Arena size returned from the DXPL */
+    hid_t fid1;                 /* HDF5 File IDs */
+    hid_t dataset, dataset2;    /* Dataset IDs */
+    hid_t sid1;                 /* Dataspace ID */
+    hid_t tid1, tid2, tid3;     /* Datatype IDs */
+    hid_t xfer_pid;             /* Dataset transfer property list ID */
+    hsize_t dims1[] = {SPACE1_DIM1};
+    hsize_t size;               /* Number of bytes which will be used */
+    unsigned i, j, k;           /* Counting variables */
+    herr_t ret;                 /* Generic return value */
+
+    /* Output message about test being performed */
+    MESSAGE(5, ("Testing Reading VL Data into an Arena\n"));
+
+    /* Allocate and initialize VL data to write */
+    for(i = 0; i < SPACE1_DIM1; i++) {
+        wdata[i].p = HDmalloc((i + 1) * sizeof(hvl_t));
+        CHECK_PTR(wdata[i].p, "HDmalloc");
+        wdata[i].len = i + 1;
+        for(t1 = (hvl_t *)(wdata[i].p), j = 0; j < (i + 1); j++, t1++) {
+            t1->p = HDmalloc((j + 1) * sizeof(double));
+            CHECK_PTR(t1->p, "HDmalloc");
+            t1->len = j + 1;
+            for(k = 0; k < (j + 1); k++)
+                ((double *)t1->p)[k] = (double)(i * 100 + j * 10 + k);
+        } /* end for */
+    } /* end for */
+
+    arena = (unsigned char *)HDmalloc(arena_size);
+    CHECK_PTR(arena, "HDmalloc");
+
+    /* Create file, with a dataset of nested sequences and one of strings */
+    fid1 = H5Fcreate(FILENAME, H5F_ACC_TRUNC, H5P_DEFAULT, H5P_DEFAULT);
+    CHECK(fid1, FAIL, "H5Fcreate");
+
+    sid1 = H5Screate_simple(SPACE1_RANK, dims1, NULL);
+    CHECK(sid1, FAIL, "H5Screate_simple");
+
+    tid1 = H5Tvlen_create(H5T_NATIVE_DOUBLE);
+    CHECK(tid1, FAIL, "H5Tvlen_create");
+    tid2 = H5Tvlen_create(tid1);
+    CHECK(tid2, FAIL, "H5Tvlen_create");
+    tid3 = H5Tcopy(H5T_C_S1);
+    CHECK(tid3, FAIL, "H5Tcopy");
+    ret = H5Tset_size(tid3, H5T_VARIABLE);
+    CHECK(ret, FAIL, "H5Tset_size");
+
+    dataset = H5Dcreate2(fid1, "Dataset1", tid2, sid1, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+    CHECK(dataset, FAIL, "H5Dcreate2");
+    ret = H5Dwrite(dataset, tid2, H5S_ALL, H5S_ALL, H5P_DEFAULT, wdata);
+    CHECK(ret, FAIL, "H5Dwrite");
+
+    dataset2 = H5Dcreate2(fid1, "Dataset2", tid3, sid1, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+    CHECK(dataset2, FAIL, "H5Dcreate2");
+    ret = H5Dwrite(dataset2, tid3, H5S_ALL, H5S_ALL, H5P_DEFAULT, wstr);
+    CHECK(ret, FAIL, "H5Dwrite");
+
+    /* Set up the arena */
+    xfer_pid = H5Pcreate(H5P_DATASET_XFER);
+    CHECK(xfer_pid, FAIL, "H5Pcreate");
+
+    ret = H5Pset_vlen_arena(xfer_pid, arena, arena_size);
+    CHECK(ret, FAIL, "H5Pset_vlen_arena");
+
+    ret = H5Pget_vlen_arena(xfer_pid, &ret_buf, &ret_size);
+    CHECK(ret, FAIL, "H5Pget_vlen_arena");
+    CHECK_PTR_EQ(ret_buf, (void *)arena, "H5Pget_vlen_arena");
+    VERIFY(ret_size, arena_size, "H5Pget_vlen_arena");
+
+    /* Make certain the arena is big enough */
+    ret = H5Dvlen_get_buf_size(dataset, tid2, sid1, &size);
+    CHECK(ret, FAIL, "H5Dvlen_get_buf_size");
+    if(size + 16 * ((SPACE1_DIM1 * (SPACE1_DIM1 + 3)) / 2) > (hsize_t)arena_size)
+        TestErrPrintf("%d: arena too small for test, size=%lu\n", __LINE__, (unsigned long)size);
+
+    /* Read the nested sequences into the arena */
+    ret = H5Dread(dataset, tid2, H5S_ALL, H5S_ALL, xfer_pid, rdata);
+    CHECK(ret, FAIL, "H5Dread");
+
+    /* Compare data read in, and check that it all lives in the arena */
+    for(i = 0; i < SPACE1_DIM1; i++) {
+        if(wdata[i].len != rdata[i].len) {
+            TestErrPrintf("%d: VL data length don't match!, wdata[%d].len=%d, rdata[%d].len=%d\n", __LINE__, (int)i, (int)wdata[i].len, (int)i, (int)rdata[i].len);
+            continue;
+        } /* end if */
+        if((unsigned char *)rdata[i].p < arena || (unsigned char *)rdata[i].p + rdata[i].len * sizeof(hvl_t) > arena + arena_size)
+            TestErrPrintf("%d: VL data not in arena!, i=%d\n", __LINE__, (int)i);
+        if((size_t)((unsigned char *)rdata[i].p - arena) % sizeof(void *))
+            TestErrPrintf("%d: VL data not aligned!, i=%d\n", __LINE__, (int)i);
+        for(t1 = (hvl_t *)wdata[i].p, t2 = (hvl_t *)(rdata[i].p), j = 0; j < rdata[i].len; j++, t1++, t2++) {
+            if(t1->len != t2->len) {
+                TestErrPrintf("%d: VL data length don't match!, i=%d, j=%d, t1->len=%d, t2->len=%d\n", __LINE__, (int)i, (int)j, (int)t1->len, (int)t2->len);
+                continue;
+            } /* end if */
+            if((unsigned char *)t2->p < arena || (unsigned char *)t2->p + t2->len * sizeof(double) > arena + arena_size)
+                TestErrPrintf("%d: VL data not in arena!, i=%d, j=%d\n", __LINE__, (int)i, (int)j);
+            if((size_t)((unsigned char *)t2->p - arena) % sizeof(double))
+                TestErrPrintf("%d: VL data not aligned!, i=%d, j=%d\n", __LINE__, (int)i, (int)j);
+            for(k = 0; k < t2->len; k++)
+                if(!H5_DBL_ABS_EQUAL(((double *)t1->p)[k], ((double *)t2->p)[k]))
+                    TestErrPrintf("VL data values don't match!, i=%d, j=%d, k=%d\n", (int)i, (int)j, (int)k);
+        } /* end for */
+    } /* end for */
+
+    /* Reclaiming with the arena set leaves the arena alone */
+    ret = H5Dvlen_reclaim(tid2, sid1, xfer_pid, rdata);
+    CHECK(ret, FAIL, "H5Dvlen_reclaim");
+
+    /* Read the strings into the arena, from its start again */
+    ret = H5Dread(dataset2, tid3, H5S_ALL, H5S_ALL, xfer_pid, rstr);
+    CHECK(ret, FAIL, "H5Dread");
+    for(i = 0; i < SPACE1_DIM1; i++) {
+        if(HDstrcmp(wstr[i], rstr[i]))
+            TestErrPrintf("%d: VL strings don't match!, wstr[%d]=%s, rstr[%d]=%s\n", __LINE__, (int)i, wstr[i], (int)i, rstr[i]);
+        if((unsigned char *)rstr[i] < arena || (unsigned char *)rstr[i] + HDstrlen(rstr[i]) + 1 > arena + arena_size)
+            TestErrPrintf("%d: VL string not in arena!, i=%d\n", __LINE__, (int)i);
+    } /* end for */
+    if((unsigned char *)rstr[0] != arena)
+        TestErrPrintf("%d: arena not restarted for new read\n", __LINE__);
+
+    /* An arena which is too small makes the read fail */
+    ret = H5Pset_vlen_arena(xfer_pid, arena, (size_t)8);
+    CHECK(ret, FAIL, "H5Pset_vlen_arena");
+    H5E_BEGIN_TRY {
+        ret = H5Dread(dataset, tid2, H5S_ALL, H5S_ALL, xfer_pid, rdata);
+    } H5E_END_TRY;
+    VERIFY(ret, FAIL, "H5Dread");
+
+    /* A positive size is required for an arena */
+    H5E_BEGIN_TRY {
+        ret = H5Pset_vlen_arena(xfer_pid, arena, (size_t)0);
+    } H5E_END_TRY;
+    VERIFY(ret, FAIL, "H5Pset_vlen_arena");
+
+    /* Removing the arena goes back to the VL memory manager */
+    ret = H5Pset_vlen_arena(xfer_pid, NULL, (size_t)0);
+    CHECK(ret, FAIL, "H5Pset_vlen_arena");
+    ret = H5Dread(dataset2, tid3, H5S_ALL, H5S_ALL, xfer_pid, rstr);
+    CHECK(ret, FAIL, "H5Dread");
+    for(i = 0; i < SPACE1_DIM1; i++) {
+        if(HDstrcmp(wstr[i], rstr[i]))
+            TestErrPrintf("%d: VL strings don't match!, wstr[%d]=%s, rstr[%d]=%s\n", __LINE__, (int)i, wstr[i], (int)i, rstr[i]);
+        if((unsigned char *)rstr[i] >= arena && (unsigned char *)rstr[i] < arena + arena_size)
+            TestErrPrintf("%d: VL string in arena!, i=%d\n", __LINE__, (int)i);
+    } /* end for */
+    ret = H5Dvlen_reclaim(tid3, sid1, xfer_pid, rstr);
+    CHECK(ret, FAIL, "H5Dvlen_reclaim");
+
+    /* Reclaim the write VL data */
+    ret = H5Dvlen_reclaim(tid2, sid1, H5P_DEFAULT, wdata);
+    CHECK(ret, FAIL, "H5Dvlen_reclaim");
+
+    /* Close everything */
+    ret = H5Pclose(xfer_pid);
+    CHECK(ret, FAIL, "H5Pclose");
+    ret = H5Dclose(dataset2);
+    CHECK(ret, FAIL, "H5Dclose");
+    ret = H5Dclose(dataset);
+    CHECK(ret, FAIL, "H5Dclose");
+    ret = H5Tclose(tid3);
+    CHECK(ret, FAIL, "H5Tclose");
+    ret = H5Tclose(tid2);
+    CHECK(ret, FAIL, "H5Tclose");
+    ret = H5Tclose(tid1);
+    CHECK(ret, FAIL, "H5Tclose");
+    ret = H5Sclose(sid1);
+    CHECK(ret, FAIL, "H5Sclose");
+    ret = H5Fclose(fid1);
+    CHECK(ret, FAIL, "H5Fclose");
+
+    HDfree(arena);
+} /* end test_vltypes_vlen_arena() */
+
 /****************************************************************
 **
 **  test_vltypes(): Main VL datatype testing routine.
@@ -3184,6 +3377,7 @@ test_vltypes(void)
     test_vltypes_compound_vlen_vlen();/* Test compound datatypes with VL atomic components */
     test_vltypes_compound_vlstr();    /* Test data rewritten of nested VL data */
     test_vltypes_fill_value();        /* Test fill value for VL data */
+    test_vltypes_vlen_arena();        /* Test reading VL data into an arena */
 }   /* test_vltypes() */
 
 
@@ -38,6 +38,7 @@ const char *FILENAME[] = {
     "resurrect_group",
     "unlink_chunked",
     "full_group",
+    "path_cache",
     NULL
 };
 
@@ -2138,6 +2139,103 @@ error:
 } /* end test_unlink_chunked_dataset() */
 
 
+/*-------------------------------------------------------------------------
+ * Function:    test_path_cache
+ *
+ * Purpose:     Tests that cached path resolutions don't outlive the links
+ *              they were resolved through
+ *
+ * Return:      Success:        0
+ *              Failure:        number of errors
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+test_path_cache(hid_t fapl)
+{
+    hid_t       file = -1, group = -1, group2 = -1;
+    char        filename[1024];
+    char        objname[64];                    /* Object name */
+    H5O_info_t  oinfo, oinfo2;                  /* Object info */
+    size_t      nents;                          /* # of cached paths */
+
+    TESTING("path cache invalidation");
+
+    /* Create file */
+    h5_fixname(FILENAME[11], fapl, filename, sizeof filename);
+    if((file = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0) FAIL_STACK_ERROR
+
+    /* Create a chain of groups */
+    if((group = H5Gcreate2(file, "a", H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) FAIL_STACK_ERROR
+    if(H5Gclose(group) < 0) FAIL_STACK_ERROR
+    if((group = H5Gcreate2(file, "a/b", H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) FAIL_STACK_ERROR
+    if(H5Gclose(group) < 0) FAIL_STACK_ERROR
+    if((group = H5Gcreate2(file, "a/b/c", H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) FAIL_STACK_ERROR
+    if(H5Oget_info2(group, &oinfo, H5O_INFO_BASIC) < 0) FAIL_STACK_ERROR
+    if(H5Gclose(group) < 0) FAIL_STACK_ERROR
+
+    /* Intermediate groups of the paths should be cached now */
+    if(H5G__pcache_nents_test(file, &nents) < 0) FAIL_STACK_ERROR
+    if(nents == 0) TEST_ERROR
+
+    /* Open the group through equivalent spellings of the path */
+    if((group = H5Gopen2(file, "a/b/c", H5P_DEFAULT)) < 0) FAIL_STACK_ERROR
+    if((group2 = H5Gopen2(file, "/./a//b/./c", H5P_DEFAULT)) < 0) FAIL_STACK_ERROR
+    if(H5Oget_info2(group2, &oinfo2, H5O_INFO_BASIC) < 0) FAIL_STACK_ERROR
+    if(oinfo.addr != oinfo2.addr) TEST_ERROR
+    if(H5Iget_name(group2, objname, sizeof(objname)) < 0) FAIL_STACK_ERROR
+    if(HDstrcmp(objname, "/a/b/c")) TEST_ERROR
+    if(H5Gclose(group2) < 0) FAIL_STACK_ERROR
+    if(H5Gclose(group) < 0) FAIL_STACK_ERROR
+
+    /* Move an intermediate group out of the way and replace it */
+    if(H5Lmove(file, "a/b", file, "z", H5P_DEFAULT, H5P_DEFAULT) < 0) FAIL_STACK_ERROR
+    if(H5G__pcache_nents_test(file, &nents) < 0) FAIL_STACK_ERROR
+    if(nents != 0) TEST_ERROR
+    if((group = H5Gcreate2(file, "a/b", H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) FAIL_STACK_ERROR
+    if(H5Gclose(group) < 0) FAIL_STACK_ERROR
+    if((group = H5Gcreate2(file, "a/b/d", H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) FAIL_STACK_ERROR
+    if(H5Gclose(group) < 0) FAIL_STACK_ERROR
+
+    /* The old path must not resolve through the moved group */
+    H5E_BEGIN_TRY {
+        group = H5Gopen2(file, "a/b/c", H5P_DEFAULT);
+    } H5E_END_TRY;
+    if(group >= 0) TEST_ERROR
+    if((group = H5Gopen2(file, "a/b/d", H5P_DEFAULT)) < 0) FAIL_STACK_ERROR
+    if(H5Gclose(group) < 0) FAIL_STACK_ERROR
+    if((group = H5Gopen2(file, "z/c", H5P_DEFAULT)) < 0) FAIL_STACK_ERROR
+    if(H5Oget_info2(group, &oinfo2, H5O_INFO_BASIC) < 0) FAIL_STACK_ERROR
+    if(oinfo.addr != oinfo2.addr) TEST_ERROR
+    if(H5Gclose(group) < 0) FAIL_STACK_ERROR
+
+    /* Delete an intermediate group */
+    if(H5G__pcache_nents_test(file, &nents) < 0) FAIL_STACK_ERROR
+    if(nents == 0) TEST_ERROR
+    if(H5Ldelete(file, "a/b", H5P_DEFAULT) < 0) FAIL_STACK_ERROR
+    if(H5G__pcache_nents_test(file, &nents) < 0) FAIL_STACK_ERROR
+    if(nents != 0) TEST_ERROR
+    H5E_BEGIN_TRY {
+        group = H5Gopen2(file, "a/b/d", H5P_DEFAULT);
+    } H5E_END_TRY;
+    if(group >= 0) TEST_ERROR
+
+    /* Close the file */
+    if(H5Fclose(file) < 0) FAIL_STACK_ERROR
+
+    PASSED();
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Gclose(group2);
+        H5Gclose(group);
+        H5Fclose(file);
+    } H5E_END_TRY;
+    return 1;
+} /* end test_path_cache() */
+
+
 /*-------------------------------------------------------------------------
  * Function:    test_full_group_compact
  *
@@ -2532,6 +2630,9 @@ main(void)
         /* Test unlinking chunked datasets */
         nerrors += test_unlink_chunked_dataset(my_fapl);
 
+        /* Test invalidating the path resolution cache */
+        nerrors += test_path_cache(my_fapl);
+
         /* Test unlinked groups which still have objects in them */
         /* (only for new format groups) */
         if(new_format) {
@@ -58,10 +58,12 @@ const char *FILENAME[] = {
     "stdio_file",        /*7*/
     "windows_file",      /*8*/
     "new_multi_file_v16",/*9*/
+    "trace_file",        /*10*/
     NULL
 };
 
 #define LOG_FILENAME "log_vfd_out.log"
+#define TRACE_FILENAME "trace_vfd_out.trc"
 
 #define COMPAT_BASENAME "family_v16_"
 #define MULTI_COMPAT_BASENAME "multi_file_v16"
@@ -113,6 +115,10 @@ test_sec2(void)
     if(!(driver_flags & H5FD_FEAT_POSIX_COMPAT_HANDLE))     TEST_ERROR
     if(!(driver_flags & H5FD_FEAT_SUPPORTS_SWMR_IO))        TEST_ERROR
     if(!(driver_flags & H5FD_FEAT_DEFAULT_VFD_COMPATIBLE))  TEST_ERROR
+#ifdef H5_HAVE_PREADWRITE
+    if(!(driver_flags & H5FD_FEAT_CONCURRENT_READ))         TEST_ERROR
+    driver_flags &= ~(unsigned long)H5FD_FEAT_CONCURRENT_READ;
+#endif /* H5_HAVE_PREADWRITE */
     /* Check for extra flags not accounted for above */
     if(driver_flags != (H5FD_FEAT_AGGREGATE_METADATA
                         | H5FD_FEAT_ACCUMULATE_METADATA
@@ -1690,6 +1696,209 @@ error:
 }
 
 
+/*-------------------------------------------------------------------------
+ * Function:    test_trace
+ *
+ * Purpose:     Tests the trace driver, stacked on the sec2 driver, and
+ *              checks the records it writes
+ *
+ * Return:      Success:        0
+ *              Failure:        -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+test_trace(void)
+{
+    hid_t        file            = -1;
+    hid_t        fapl            = -1;
+    hid_t        under_fapl      = -1;
+    hid_t        access_fapl     = -1;
+    hid_t        dset            = -1;
+    hid_t        space           = -1;
+    char         filename[1024];
+    char         trace_name[64];
+    int          *fhandle        = NULL;
+    hsize_t      dims[2]         = {DSET1_DIM1, DSET1_DIM2};
+    int          *buf            = NULL;
+    FILE         *fp             = NULL;
+    H5FD_trace_header_t header;
+    H5FD_trace_rec_t rec;
+    H5FD_trace_op_t last_op      = H5FD_TRACE_NOPS;
+    unsigned     nrecs[H5FD_TRACE_NOPS];
+    unsigned     open_file       = 0;
+    hsize_t      draw_written    = 0;
+    size_t       u;
+
+    TESTING("TRACE file driver");
+
+    /* Start with no trace file, as records are appended to it */
+    HDremove(TRACE_FILENAME);
+
+    /* Set property list and file name for trace driver */
+    if((under_fapl = H5Pcreate(H5P_FILE_ACCESS)) < 0)
+        TEST_ERROR;
+    if(H5Pset_fapl_sec2(under_fapl) < 0)
+        TEST_ERROR;
+    if((fapl = H5Pcreate(H5P_FILE_ACCESS)) < 0)
+        TEST_ERROR;
+    if(H5Pset_fapl_trace(fapl, TRACE_FILENAME, under_fapl) < 0)
+        TEST_ERROR;
+    if(H5Pclose(under_fapl) < 0)
+        TEST_ERROR;
+    h5_fixname(FILENAME[10], fapl, filename, sizeof filename);
+
+    /* Check the properties can be retrieved */
+    if(H5Pget_fapl_trace(fapl, trace_name, sizeof(trace_name), &under_fapl) < 0)
+        TEST_ERROR;
+    if(HDstrcmp(trace_name, TRACE_FILENAME))
+        TEST_ERROR;
+    if(H5FD_SEC2 != H5Pget_driver(under_fapl))
+        TEST_ERROR;
+    if(H5Pclose(under_fapl) < 0)
+        TEST_ERROR;
+
+    /* Create the test file and write a dataset to it */
+    if((file = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0)
+        TEST_ERROR;
+
+    if((access_fapl = H5Fget_access_plist(file)) < 0)
+        TEST_ERROR;
+    if(H5FD_TRACE != H5Pget_driver(access_fapl))
+        TEST_ERROR;
+    if(H5Pclose(access_fapl) < 0)
+        TEST_ERROR;
+
+    /* The file handle is the sec2 driver's */
+    if(H5Fget_vfd_handle(file, H5P_DEFAULT, (void **)&fhandle) < 0)
+        TEST_ERROR;
+    if(*fhandle < 0)
+        TEST_ERROR;
+
+    if(NULL == (buf = (int *)HDmalloc(DSET1_DIM1 * DSET1_DIM2 * sizeof(int))))
+        TEST_ERROR;
+    for(u = 0; u < DSET1_DIM1 * DSET1_DIM2; u++)
+        buf[u] = (int)u;
+    if((space = H5Screate_simple(2, dims, NULL)) < 0)
+        TEST_ERROR;
+    if((dset = H5Dcreate2(file, DSET1_NAME, H5T_NATIVE_INT, space, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0)
+        TEST_ERROR;
+    if(H5Dwrite(dset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, buf) < 0)
+        TEST_ERROR;
+    if(H5Dclose(dset) < 0)
+        TEST_ERROR;
+    if(H5Fclose(file) < 0)
+        TEST_ERROR;
+
+    /* Re-open the file and read the dataset back */
+    if((file = H5Fopen(filename, H5F_ACC_RDONLY, fapl)) < 0)
+        TEST_ERROR;
+    if((dset = H5Dopen2(file, DSET1_NAME, H5P_DEFAULT)) < 0)
+        TEST_ERROR;
+    HDmemset(buf, 0, DSET1_DIM1 * DSET1_DIM2 * sizeof(int));
+    if(H5Dread(dset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, buf) < 0)
+        TEST_ERROR;
+    for(u = 0; u < DSET1_DIM1 * DSET1_DIM2; u++)
+        if(buf[u] != (int)u)
+            TEST_ERROR;
+    if(H5Dclose(dset) < 0)
+        TEST_ERROR;
+    if(H5Fclose(file) < 0)
+        TEST_ERROR;
+
+    /* Check the trace: a header, then for each time the file was open, an
+     * open record, the file's I/O and a close record
+     */
+    HDmemset(nrecs, 0, sizeof(nrecs));
+    if(NULL == (fp = HDfopen(TRACE_FILENAME, "rb")))
+        TEST_ERROR;
+    if(1 != HDfread(&header, sizeof(header), (size_t)1, fp))
+        TEST_ERROR;
+    if(HDstrcmp(header.magic, H5FD_TRACE_MAGIC))
+        TEST_ERROR;
+    if(header.version != H5FD_TRACE_VERSION || header.rec_size != sizeof(H5FD_trace_rec_t))
+        TEST_ERROR;
+    while(1 == HDfread(&rec, sizeof(rec), (size_t)1, fp)) {
+        if(rec.op >= H5FD_TRACE_NOPS)
+            TEST_ERROR;
+
+        /* Only a close follows a close, and every file is opened first,
+         * with a new serial number that its records carry
+         */
+        if(rec.op == H5FD_TRACE_OPEN) {
+            if(last_op != H5FD_TRACE_NOPS && last_op != H5FD_TRACE_CLOSE)
+                TEST_ERROR;
+            if(0 == rec.file || rec.file == open_file)
+                TEST_ERROR;
+            open_file = rec.file;
+        } /* end if */
+        else {
+            if(last_op == H5FD_TRACE_NOPS || last_op == H5FD_TRACE_CLOSE)
+                TEST_ERROR;
+            if(rec.file != open_file)
+                TEST_ERROR;
+        } /* end else */
+
+        /* Everything the library does for the application happens in an
+         * API call
+         */
+        if(0 == rec.api_call || rec.elapsed < 0.0)
+            TEST_ERROR;
+
+        if(rec.op == H5FD_TRACE_WRITE && rec.type == H5FD_MEM_DRAW)
+            draw_written += rec.size;
+
+        nrecs[rec.op]++;
+        last_op = (H5FD_trace_op_t)rec.op;
+    } /* end while */
+    if(HDfclose(fp) < 0)
+        TEST_ERROR;
+    fp = NULL;
+
+    if(last_op != H5FD_TRACE_CLOSE)
+        TEST_ERROR;
+    if(nrecs[H5FD_TRACE_OPEN] != 2 || nrecs[H5FD_TRACE_CLOSE] != 2)
+        TEST_ERROR;
+    if(0 == nrecs[H5FD_TRACE_READ] || 0 == nrecs[H5FD_TRACE_WRITE])
+        TEST_ERROR;
+    if(draw_written != DSET1_DIM1 * DSET1_DIM2 * sizeof(int))
+        TEST_ERROR;
+
+    /* The file can be opened without the trace driver */
+    if((file = H5Fopen(filename, H5F_ACC_RDONLY, H5P_DEFAULT)) < 0)
+        TEST_ERROR;
+    if(H5Fclose(file) < 0)
+        TEST_ERROR;
+
+    /* Close and delete the files */
+    if(H5Sclose(space) < 0)
+        TEST_ERROR;
+    h5_delete_test_file(FILENAME[10], fapl);
+    HDremove(TRACE_FILENAME);
+    HDfree(buf);
+
+    /* Close the fapl */
+    if(H5Pclose(fapl) < 0)
+        TEST_ERROR;
+
+    PASSED();
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Dclose(dset);
+        H5Sclose(space);
+        H5Pclose(under_fapl);
+        H5Pclose(fapl);
+        H5Fclose(file);
+    } H5E_END_TRY;
+    if(fp)
+        HDfclose(fp);
+    HDfree(buf);
+    return -1;
+} /* end test_trace() */
+
+
 /*-------------------------------------------------------------------------
  * Function:    test_stdio
  *
@@ -1947,6 +2156,7 @@ main(void)
     nerrors += test_multi() < 0          ? 1 : 0;
     nerrors += test_multi_compat() < 0   ? 1 : 0;
     nerrors += test_log() < 0            ? 1 : 0;
+    nerrors += test_trace() < 0          ? 1 : 0;
     nerrors += test_stdio() < 0          ? 1 : 0;
     nerrors += test_windows() < 0        ? 1 : 0;
 
@@ -0,0 +1,334 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * Copyright by the Board of Trustees of the University of Illinois.         *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://support.hdfgroup.org/ftp/HDF5/releases.  *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+ * Purpose: A tool that shrinks a file in place, by moving raw data into
+ *          free space earlier in the file with H5Fcompact() and truncating
+ *          the file afterwards.
+ *
+ *          The work is done in steps of a bounded size, and the file is
+ *          consistent after each step, so an interrupted run can simply
+ *          be started again.
+ */
+#include "hdf5.h"
+#include "H5private.h"
+#include "h5tools.h"
+#include "h5tools_utils.h"
+
+/* Name of tool */
+#define PROGRAMNAME     "h5compact"
+
+/* Default step is 64 megabytes for the --step option */
+#define DEFAULT_STEP    (64 * 1024 * 1024)
+
+static char *fname_g = NULL;
+static hbool_t verbose_g = FALSE;
+static hsize_t step_g = DEFAULT_STEP;
+static hsize_t limit_g = 0;
+
+/*
+ * Command-line options: only publicize long options
+ */
+static const char *s_opts = "hVvs:l:";
+static struct long_options l_opts[] = {
+        { "help", no_arg, 'h' },
+        { "hel", no_arg, 'h'},
+        { "he", no_arg, 'h'},
+        { "version", no_arg, 'V' },
+        { "versio", no_arg, 'V' },
+        { "versi", no_arg, 'V' },
+        { "vers", no_arg, 'V' },
+        { "verbose", no_arg, 'v' },
+        { "verbos", no_arg, 'v' },
+        { "verbo", no_arg, 'v' },
+        { "verb", no_arg, 'v' },
+        { "step", require_arg, 's' },
+        { "ste", require_arg, 's' },
+        { "st", require_arg, 's' },
+        { "limit", require_arg, 'l' },
+        { "limi", require_arg, 'l' },
+        { "lim", require_arg, 'l' },
+        { "li", require_arg, 'l' },
+        { NULL, 0, '\0' }
+};
+
+
+
+/*-------------------------------------------------------------------------
+ * Function:    usage
+ *
+ * Purpose:     Prints a usage message
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void usage(const char *prog)
+{
+    HDfprintf(stdout, "usage: %s [OPTIONS] file_name\n", prog);
+    HDfprintf(stdout, "  OPTIONS\n");
+    HDfprintf(stdout, "   -h, --help                Print a usage message and exit\n");
+    HDfprintf(stdout, "   -V, --version             Print version number and exit\n");
+    HDfprintf(stdout, "   -v, --verbose             Print the progress of each step\n");
+    HDfprintf(stdout, "   -s S, --step=S            Move at most S bytes of raw data per step\n");
+    HDfprintf(stdout, "                             S is > 0 and defaults to 64M\n");
+    HDfprintf(stdout, "   -l L, --limit=L           Stop after moving L bytes of raw data in total\n");
+    HDfprintf(stdout, "                             L is > 0; there is no limit when not set\n");
+    HDfprintf(stdout, "\n");
+    HDfprintf(stdout, "Only raw data is moved, into space that the library knows is free:\n");
+    HDfprintf(stdout, "space tracked by a persistent free-space manager (see\n");
+    HDfprintf(stdout, "H5Pset_file_space_strategy).  The file is consistent after each step,\n");
+    HDfprintf(stdout, "so an interrupted run can be started again.\n");
+    HDfprintf(stdout, "\n");
+    HDfprintf(stdout, "Examples of use:\n");
+    HDfprintf(stdout, "\n");
+    HDfprintf(stdout, "h5compact file_name\n");
+    HDfprintf(stdout, "  Shrink the HDF5 file <file_name> as much as possible.\n");
+    HDfprintf(stdout, "\n");
+    HDfprintf(stdout, "h5compact --limit=1073741824 file_name\n");
+    HDfprintf(stdout, "  Shrink the HDF5 file <file_name>, moving at most 1G of raw data.\n");
+} /* usage() */
+
+
+/*-------------------------------------------------------------------------
+ * Function: parse_size
+ *
+ * Purpose:  Parses a positive size given on the command line
+ *
+ * Return:   Success: 0
+ *
+ *           Failure: -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+parse_size(const char *str, hsize_t *size)
+{
+    char *end = NULL;
+    unsigned long long val;
+
+    if(NULL == str || '-' == *str)
+        return -1;
+    val = HDstrtoull(str, &end, 10);
+    if(end == str || *end != '\0' || 0 == val)
+        return -1;
+
+    *size = (hsize_t)val;
+    return 0;
+} /* parse_size() */
+
+
+/*-------------------------------------------------------------------------
+ * Function: parse_command_line
+ *
+ * Purpose: Parses command line and sets up global variable to control output
+ *
+ * Return:  Success: 0
+ *
+ *          Failure: -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+parse_command_line(int argc, const char **argv)
+{
+    int opt;
+
+     /* no arguments */
+    if (argc == 1) {
+        usage(h5tools_getprogname());
+        h5tools_setstatus(EXIT_FAILURE);
+        goto error;
+    }
+
+    /* parse command line options */
+    while((opt = get_option(argc, argv, s_opts, l_opts)) != EOF) {
+        switch((char)opt) {
+            case 'h':
+                usage(h5tools_getprogname());
+                h5tools_setstatus(EXIT_SUCCESS);
+                goto done;
+
+            case 'V':
+                print_version(h5tools_getprogname());
+                h5tools_setstatus(EXIT_SUCCESS);
+                goto done;
+
+            case 'v':
+                verbose_g = TRUE;
+                break;
+
+            case 's':
+                if(parse_size(opt_arg, &step_g) < 0) {
+                    error_msg("invalid step size\n");
+                    usage(h5tools_getprogname());
+                    h5tools_setstatus(EXIT_FAILURE);
+                    goto error;
+                }
+                break;
+
+            case 'l':
+                if(parse_size(opt_arg, &limit_g) < 0) {
+                    error_msg("invalid limit\n");
+                    usage(h5tools_getprogname());
+                    h5tools_setstatus(EXIT_FAILURE);
+                    goto error;
+                }
+                break;
+
+            default:
+                usage(h5tools_getprogname());
+                h5tools_setstatus(EXIT_FAILURE);
+                goto error;
+        } /* end switch */
+    } /* end while */
+
+    /* check for file name to be processed */
+    if(argc <= opt_ind) {
+        error_msg("missing file name\n");
+        usage(h5tools_getprogname());
+        h5tools_setstatus(EXIT_FAILURE);
+        goto error;
+    } /* end if */
+
+    fname_g = HDstrdup(argv[opt_ind]);
+
+done:
+    return(0);
+
+error:
+    return -1;
+}
+
+/*-------------------------------------------------------------------------
+ * Function:    leave
+ *
+ * Purpose:     Close the tools library and exit
+ *
+ * Return:      Does not return
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+leave(int ret)
+{
+    h5tools_close();
+    HDexit(ret);
+} /* leave() */
+
+
+
+/*-------------------------------------------------------------------------
+ * Function:    main
+ *
+ * Purpose:     Compact the file one step at a time, until nothing more
+ *              can be moved or the limit is reached, and report how much
+ *              the file shrank.
+ *
+ * Return:      Success: 0
+ *              Failure: 1
+ *
+ *-------------------------------------------------------------------------
+ */
+int
+main (int argc, const char *argv[])
+{
+    hid_t fid = -1;                 /* File ID */
+    h5_stat_t st;                   /* Stat info call */
+    h5_stat_size_t size_before;     /* File size before compacting */
+    hsize_t total = 0;              /* Bytes moved so far */
+    unsigned nsteps = 0;            /* Number of steps taken */
+
+    h5tools_setprogname(PROGRAMNAME);
+    h5tools_setstatus(EXIT_SUCCESS);
+
+    /* Disable the HDF5 library's error reporting */
+    H5Eset_auto2(H5E_DEFAULT, NULL, NULL);
+
+    /* initialize h5tools lib */
+    h5tools_init();
+
+    /* Parse command line options */
+    if(parse_command_line(argc, argv) < 0)
+        goto done;
+
+    if(fname_g == NULL)
+        goto done;
+
+    if(HDstat(fname_g, &st) < 0) {
+        error_msg("unable to get size of file \"%s\"\n", fname_g);
+        h5tools_setstatus(EXIT_FAILURE);
+        goto done;
+    }
+    size_before = (h5_stat_size_t)st.st_size;
+
+    /* Open the file */
+    if((fid = h5tools_fopen(fname_g, H5F_ACC_RDWR, H5P_DEFAULT, NULL, NULL, (size_t)0)) < 0) {
+        error_msg("unable to open file \"%s\"\n", fname_g);
+        h5tools_setstatus(EXIT_FAILURE);
+        goto done;
+    }
+
+    /* Move raw data, one step at a time */
+    do {
+        hsize_t step = step_g;      /* Bytes to move in this step */
+        hsize_t moved = 0;          /* Bytes moved in this step */
+
+        if(limit_g > 0 && limit_g - total < step)
+            step = limit_g - total;
+
+        if(H5Fcompact(fid, step, &moved) < 0) {
+            error_msg("unable to compact file \"%s\"\n", fname_g);
+            h5tools_setstatus(EXIT_FAILURE);
+            goto done;
+        }
+        if(0 == moved)
+            break;
+
+        total += moved;
+        nsteps++;
+        if(verbose_g)
+            HDfprintf(stdout, "step %u: moved %Hu bytes (%Hu in total)\n", nsteps, moved, total);
+    } while(limit_g == 0 || total < limit_g);
+
+    /* Close the file, which truncates it */
+    if(H5Fclose(fid) < 0) {
+        error_msg("unable to close file \"%s\"\n", fname_g);
+        h5tools_setstatus(EXIT_FAILURE);
+        fid = -1;
+        goto done;
+    }
+    fid = -1;
+
+    if(verbose_g) {
+        if(HDstat(fname_g, &st) < 0) {
+            error_msg("unable to get size of file \"%s\"\n", fname_g);
+            h5tools_setstatus(EXIT_FAILURE);
+            goto done;
+        }
+        HDfprintf(stdout, "moved %Hu bytes; file size went from %Hu to %Hu bytes\n",
+                total, (hsize_t)size_before, (hsize_t)st.st_size);
+    }
+
+    h5tools_setstatus(EXIT_SUCCESS);
+
+done:
+    if(fname_g)
+        HDfree(fname_g);
+
+    H5E_BEGIN_TRY {
+        H5Fclose(fid);
+    } H5E_END_TRY
+
+    leave(h5tools_getstatus());
+} /* main() */
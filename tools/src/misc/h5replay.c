@@ -0,0 +1,686 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://support.hdfgroup.org/ftp/HDF5/releases.  *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+ * Purpose: A tool that replays the I/O recorded by the trace file driver
+ *          (see H5Pset_fapl_trace) against a file opened with another
+ *          driver, and compares the time each kind of operation took
+ *          when it was traced with the time it takes now.
+ *
+ *          Only the file driver operations are replayed, in the order
+ *          they were made and as fast as possible, so the library and
+ *          the application that made them aren't needed.  The records
+ *          of each time a file was opened are replayed separately, one
+ *          open after another, so a trace of several files that were
+ *          open at once can be replayed against a single target.
+ */
+#include "hdf5.h"
+#include "H5private.h"
+#include "h5tools.h"
+#include "h5tools_utils.h"
+
+/* Name of tool */
+#define PROGRAMNAME     "h5replay"
+
+/* Number of latency histogram buckets: under 1 microsecond, then powers
+ * of two up to about half an hour
+ */
+#define NBUCKETS        32
+
+/* Drivers the target file can be opened with */
+typedef enum replay_driver_t {
+    REPLAY_SEC2,
+    REPLAY_CORE,
+    REPLAY_MPIO
+} replay_driver_t;
+
+/* Statistics for one kind of operation */
+typedef struct replay_stats_t {
+    hsize_t calls;                      /* Number of operations */
+    hsize_t bytes;                      /* Bytes read or written */
+    double traced;                      /* Seconds spent when traced */
+    double replayed;                    /* Seconds spent when replayed */
+    hsize_t traced_hist[NBUCKETS];      /* Latencies when traced */
+    hsize_t replayed_hist[NBUCKETS];    /* Latencies when replayed */
+} replay_stats_t;
+
+static const char *op_names_g[H5FD_TRACE_NOPS] = {
+    "open", "close", "read", "write", "flush", "truncate"
+};
+
+static char *trace_fname_g = NULL;
+static char *target_fname_g = NULL;
+static replay_driver_t driver_g = REPLAY_SEC2;
+static hbool_t calls_g = FALSE;
+
+/*
+ * Command-line options: only publicize long options
+ */
+static const char *s_opts = "hVd:c";
+static struct long_options l_opts[] = {
+        { "help", no_arg, 'h' },
+        { "hel", no_arg, 'h'},
+        { "he", no_arg, 'h'},
+        { "version", no_arg, 'V' },
+        { "versio", no_arg, 'V' },
+        { "versi", no_arg, 'V' },
+        { "vers", no_arg, 'V' },
+        { "driver", require_arg, 'd' },
+        { "drive", require_arg, 'd' },
+        { "driv", require_arg, 'd' },
+        { "dri", require_arg, 'd' },
+        { "dr", require_arg, 'd' },
+        { "calls", no_arg, 'c' },
+        { "call", no_arg, 'c' },
+        { "cal", no_arg, 'c' },
+        { "ca", no_arg, 'c' },
+        { NULL, 0, '\0' }
+};
+
+
+
+/*-------------------------------------------------------------------------
+ * Function:    usage
+ *
+ * Purpose:     Prints a usage message
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void usage(const char *prog)
+{
+    HDfprintf(stdout, "usage: %s [OPTIONS] trace_file target_file\n", prog);
+    HDfprintf(stdout, "  OPTIONS\n");
+    HDfprintf(stdout, "   -h, --help                Print a usage message and exit\n");
+    HDfprintf(stdout, "   -V, --version             Print version number and exit\n");
+    HDfprintf(stdout, "   -d D, --driver=D          Open the target file with driver D, which is\n");
+#ifdef H5_HAVE_PARALLEL
+    HDfprintf(stdout, "                             one of sec2 (the default), core or mpio\n");
+#else /* H5_HAVE_PARALLEL */
+    HDfprintf(stdout, "                             one of sec2 (the default) or core\n");
+#endif /* H5_HAVE_PARALLEL */
+    HDfprintf(stdout, "   -c, --calls               Also print the I/O of each API call\n");
+    HDfprintf(stdout, "\n");
+    HDfprintf(stdout, "The reads, writes, flushes and truncations in the trace written by the\n");
+    HDfprintf(stdout, "trace file driver (see H5Pset_fapl_trace) are made on the target file,\n");
+    HDfprintf(stdout, "which is created if it doesn't exist.  If the trace has writes, the\n");
+    HDfprintf(stdout, "target file is modified, so replay against a copy of the file that was\n");
+    HDfprintf(stdout, "traced.  When the trace has several files, or one file opened several\n");
+    HDfprintf(stdout, "times, the I/O of each open is replayed in turn against the target.\n");
+    HDfprintf(stdout, "The time each kind of operation took when it was traced and\n");
+    HDfprintf(stdout, "when it was replayed is then printed, with histograms of the latencies.\n");
+    HDfprintf(stdout, "\n");
+    HDfprintf(stdout, "Examples of use:\n");
+    HDfprintf(stdout, "\n");
+    HDfprintf(stdout, "h5replay app.trc copy.h5\n");
+    HDfprintf(stdout, "  Replay the I/O in app.trc against copy.h5 with the sec2 driver.\n");
+    HDfprintf(stdout, "\n");
+    HDfprintf(stdout, "h5replay --driver=core --calls app.trc copy.h5\n");
+    HDfprintf(stdout, "  Replay the I/O against copy.h5 held in memory, and break it down\n");
+    HDfprintf(stdout, "  by API call.\n");
+} /* usage() */
+
+
+/*-------------------------------------------------------------------------
+ * Function: parse_command_line
+ *
+ * Purpose: Parses command line and sets up global variable to control output
+ *
+ * Return:  Success: 0
+ *
+ *          Failure: -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+parse_command_line(int argc, const char **argv)
+{
+    int opt;
+
+     /* no arguments */
+    if (argc == 1) {
+        usage(h5tools_getprogname());
+        h5tools_setstatus(EXIT_FAILURE);
+        goto error;
+    }
+
+    /* parse command line options */
+    while((opt = get_option(argc, argv, s_opts, l_opts)) != EOF) {
+        switch((char)opt) {
+            case 'h':
+                usage(h5tools_getprogname());
+                h5tools_setstatus(EXIT_SUCCESS);
+                goto done;
+
+            case 'V':
+                print_version(h5tools_getprogname());
+                h5tools_setstatus(EXIT_SUCCESS);
+                goto done;
+
+            case 'd':
+                if(!HDstrcmp(opt_arg, "sec2"))
+                    driver_g = REPLAY_SEC2;
+                else if(!HDstrcmp(opt_arg, "core"))
+                    driver_g = REPLAY_CORE;
+#ifdef H5_HAVE_PARALLEL
+                else if(!HDstrcmp(opt_arg, "mpio"))
+                    driver_g = REPLAY_MPIO;
+#endif /* H5_HAVE_PARALLEL */
+                else {
+                    error_msg("invalid driver \"%s\"\n", opt_arg);
+                    usage(h5tools_getprogname());
+                    h5tools_setstatus(EXIT_FAILURE);
+                    goto error;
+                }
+                break;
+
+            case 'c':
+                calls_g = TRUE;
+                break;
+
+            default:
+                usage(h5tools_getprogname());
+                h5tools_setstatus(EXIT_FAILURE);
+                goto error;
+        } /* end switch */
+    } /* end while */
+
+    /* check for file names to be processed */
+    if(argc <= opt_ind + 1) {
+        error_msg("missing file name\n");
+        usage(h5tools_getprogname());
+        h5tools_setstatus(EXIT_FAILURE);
+        goto error;
+    } /* end if */
+
+    trace_fname_g = HDstrdup(argv[opt_ind]);
+    target_fname_g = HDstrdup(argv[opt_ind + 1]);
+
+done:
+    return(0);
+
+error:
+    return -1;
+}
+
+/*-------------------------------------------------------------------------
+ * Function:    leave
+ *
+ * Purpose:     Close the tools library and exit
+ *
+ * Return:      Does not return
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+leave(int ret)
+{
+    h5tools_close();
+#ifdef H5_HAVE_PARALLEL
+    if(driver_g == REPLAY_MPIO)
+        MPI_Finalize();
+#endif /* H5_HAVE_PARALLEL */
+    HDexit(ret);
+} /* leave() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    read_trace
+ *
+ * Purpose:     Reads all the records in a trace file into memory, so
+ *              reading the trace doesn't add to the replayed times.
+ *
+ * Return:      Success: An array of *NRECS records, which the caller frees
+ *
+ *              Failure: NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+static H5FD_trace_rec_t *
+read_trace(const char *fname, size_t *nrecs)
+{
+    FILE *fp = NULL;
+    H5FD_trace_header_t header;
+    H5FD_trace_rec_t *recs = NULL;
+    size_t nalloc = 0;
+
+    *nrecs = 0;
+
+    if(NULL == (fp = HDfopen(fname, "rb"))) {
+        error_msg("unable to open trace file \"%s\"\n", fname);
+        goto error;
+    }
+    if(1 != HDfread(&header, sizeof(header), (size_t)1, fp)
+            || HDstrncmp(header.magic, H5FD_TRACE_MAGIC, sizeof(header.magic))) {
+        error_msg("\"%s\" is not a trace file\n", fname);
+        goto error;
+    }
+    if(header.version != H5FD_TRACE_VERSION || header.rec_size != sizeof(H5FD_trace_rec_t)) {
+        error_msg("trace file \"%s\" was written by another version of the library or on another platform\n", fname);
+        goto error;
+    }
+
+    while(1) {
+        if(*nrecs == nalloc) {
+            H5FD_trace_rec_t *x;
+
+            nalloc = MAX(1024, 2 * nalloc);
+            if(NULL == (x = (H5FD_trace_rec_t *)HDrealloc(recs, nalloc * sizeof(H5FD_trace_rec_t)))) {
+                error_msg("unable to allocate memory for the trace\n");
+                goto error;
+            }
+            recs = x;
+        }
+        if(1 != HDfread(&recs[*nrecs], sizeof(H5FD_trace_rec_t), (size_t)1, fp))
+            break;
+        (*nrecs)++;
+    }
+
+    HDfclose(fp);
+
+    return recs;
+
+error:
+    if(fp)
+        HDfclose(fp);
+    HDfree(recs);
+    *nrecs = 0;
+
+    return NULL;
+} /* read_trace() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    order_trace
+ *
+ * Purpose:     Orders the records of a trace by the open they belong to,
+ *              keeping the order of the records within each open, so
+ *              each open can be replayed separately.
+ *
+ * Return:      Success: An array of NRECS record indices, which the
+ *                       caller frees
+ *
+ *              Failure: NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+static size_t *
+order_trace(const H5FD_trace_rec_t *recs, size_t nrecs)
+{
+    size_t *order = NULL;           /* Record indices, in replay order */
+    size_t *first = NULL;           /* First place of each open's records */
+    unsigned max_file = 0;          /* Largest open serial number */
+    size_t u;
+
+    for(u = 0; u < nrecs; u++) {
+        if(0 == recs[u].file) {
+            error_msg("bad record %lu in trace file \"%s\"\n", (unsigned long)u, trace_fname_g);
+            goto error;
+        }
+        max_file = MAX(max_file, recs[u].file);
+    }
+
+    /* Count the records of each open, then place them */
+    if(NULL == (order = (size_t *)HDmalloc(MAX(nrecs, 1) * sizeof(size_t)))
+            || NULL == (first = (size_t *)HDcalloc((size_t)max_file + 1, sizeof(size_t)))) {
+        error_msg("unable to allocate memory for the trace\n");
+        goto error;
+    }
+    for(u = 0; u < nrecs; u++)
+        if(recs[u].file < max_file)
+            first[recs[u].file + 1]++;
+    for(u = 1; u <= max_file; u++)
+        first[u] += first[u - 1];
+    for(u = 0; u < nrecs; u++)
+        order[first[recs[u].file]++] = u;
+
+    HDfree(first);
+
+    return order;
+
+error:
+    HDfree(order);
+    HDfree(first);
+
+    return NULL;
+} /* order_trace() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    bucket
+ *
+ * Purpose:     Finds the latency histogram bucket for a time: bucket 0
+ *              is under 1 microsecond, and bucket N is under 2^N
+ *              microseconds.
+ *
+ * Return:      The bucket
+ *
+ *-------------------------------------------------------------------------
+ */
+static unsigned
+bucket(double seconds)
+{
+    double us = seconds * 1000000.0;
+    unsigned b = 0;
+
+    while(us >= 1.0 && b < NBUCKETS - 1) {
+        us /= 2.0;
+        b++;
+    }
+
+    return b;
+} /* bucket() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    rate
+ *
+ * Purpose:     Computes a transfer rate in megabytes per second
+ *
+ * Return:      The rate, or 0 if no time was taken
+ *
+ *-------------------------------------------------------------------------
+ */
+static double
+rate(hsize_t bytes, double seconds)
+{
+    return seconds > 0.0 ? ((double)bytes / (1024.0 * 1024.0)) / seconds : 0.0;
+} /* rate() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    print_stats
+ *
+ * Purpose:     Prints the traced and replayed totals and latency
+ *              histograms of each kind of operation
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+print_stats(const replay_stats_t *stats)
+{
+    unsigned op, b;
+
+    HDfprintf(stdout, "%-9s %10s %14s %12s %12s %12s %12s\n", "operation", "calls",
+            "bytes", "traced s", "replayed s", "traced MB/s", "replay MB/s");
+    for(op = 0; op < H5FD_TRACE_NOPS; op++)
+        if(stats[op].calls > 0)
+            HDfprintf(stdout, "%-9s %10Hu %14Hu %12.6f %12.6f %12.2f %12.2f\n",
+                    op_names_g[op], stats[op].calls, stats[op].bytes,
+                    stats[op].traced, stats[op].replayed,
+                    rate(stats[op].bytes, stats[op].traced),
+                    rate(stats[op].bytes, stats[op].replayed));
+
+    for(op = 0; op < H5FD_TRACE_NOPS; op++) {
+        if(0 == stats[op].calls)
+            continue;
+
+        HDfprintf(stdout, "\n%s latency (microseconds):\n", op_names_g[op]);
+        HDfprintf(stdout, "  %12s %10s %10s\n", "under", "traced", "replayed");
+        for(b = 0; b < NBUCKETS; b++)
+            if(stats[op].traced_hist[b] > 0 || stats[op].replayed_hist[b] > 0)
+                HDfprintf(stdout, "  %12Hu %10Hu %10Hu\n", (hsize_t)1 << b,
+                        stats[op].traced_hist[b], stats[op].replayed_hist[b]);
+    }
+} /* print_stats() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    main
+ *
+ * Purpose:     Replays the operations in a trace file against the target
+ *              file and prints how long they took.
+ *
+ * Return:      Success: 0
+ *              Failure: 1
+ *
+ *-------------------------------------------------------------------------
+ */
+int
+main (int argc, const char *argv[])
+{
+    H5FD_trace_rec_t *recs = NULL;  /* Records in the trace */
+    size_t nrecs = 0;               /* Number of records */
+    size_t *order = NULL;           /* Records in the order they're replayed */
+    replay_stats_t stats[H5FD_TRACE_NOPS];
+    H5FD_t *file = NULL;            /* Target file, when it's open */
+    hid_t fapl = -1;                /* File access property list for the target */
+    unsigned flags = H5F_ACC_RDONLY;    /* Flags to open the target with */
+    void *buf = NULL;               /* Buffer for reads and writes */
+    size_t buf_size = 0;            /* Size of the buffer */
+    hsize_t call_ops = 0;           /* Operations in the current API call */
+    hsize_t call_bytes = 0;         /* Bytes in the current API call */
+    double call_traced = 0.0;       /* Traced time of the current API call */
+    double call_replayed = 0.0;     /* Replayed time of the current API call */
+    int mpi_rank = 0;               /* Rank, when replaying with the mpio driver */
+    size_t u, v;
+
+    h5tools_setprogname(PROGRAMNAME);
+    h5tools_setstatus(EXIT_SUCCESS);
+
+    /* Disable the HDF5 library's error reporting */
+    H5Eset_auto2(H5E_DEFAULT, NULL, NULL);
+
+    /* initialize h5tools lib */
+    h5tools_init();
+
+    HDmemset(stats, 0, sizeof(stats));
+
+    /* Parse command line options */
+    if(parse_command_line(argc, argv) < 0)
+        goto done;
+
+    if(trace_fname_g == NULL || target_fname_g == NULL)
+        goto done;
+
+    if(NULL == (recs = read_trace(trace_fname_g, &nrecs))) {
+        h5tools_setstatus(EXIT_FAILURE);
+        goto done;
+    }
+    if(NULL == (order = order_trace(recs, nrecs))) {
+        h5tools_setstatus(EXIT_FAILURE);
+        goto done;
+    }
+
+    /* Open the target for writing only if the trace changes the file */
+    for(u = 0; u < nrecs; u++)
+        if(recs[u].op == H5FD_TRACE_WRITE || recs[u].op == H5FD_TRACE_TRUNCATE) {
+            flags = H5F_ACC_RDWR | H5F_ACC_CREAT;
+            break;
+        }
+
+    /* Set up the driver for the target */
+    if((fapl = H5Pcreate(H5P_FILE_ACCESS)) < 0) {
+        error_msg("unable to create file access property list\n");
+        h5tools_setstatus(EXIT_FAILURE);
+        goto done;
+    }
+    switch(driver_g) {
+        case REPLAY_CORE:
+            if(H5Pset_fapl_core(fapl, (size_t)(1024 * 1024), (hbool_t)(flags != H5F_ACC_RDONLY)) < 0) {
+                error_msg("unable to set core driver\n");
+                h5tools_setstatus(EXIT_FAILURE);
+                goto done;
+            }
+            break;
+
+        case REPLAY_MPIO:
+#ifdef H5_HAVE_PARALLEL
+            MPI_Init(&argc, (char ***)&argv);
+            MPI_Comm_rank(MPI_COMM_WORLD, &mpi_rank);
+            if(H5Pset_fapl_mpio(fapl, MPI_COMM_WORLD, MPI_INFO_NULL) < 0) {
+                error_msg("unable to set mpio driver\n");
+                h5tools_setstatus(EXIT_FAILURE);
+                goto done;
+            }
+#endif /* H5_HAVE_PARALLEL */
+            break;
+
+        case REPLAY_SEC2:
+        default:
+            if(H5Pset_fapl_sec2(fapl) < 0) {
+                error_msg("unable to set sec2 driver\n");
+                h5tools_setstatus(EXIT_FAILURE);
+                goto done;
+            }
+            break;
+    } /* end switch */
+
+    if(calls_g && 0 == mpi_rank)
+        HDfprintf(stdout, "%-6s %-10s %-32s %8s %14s %12s %12s\n", "file", "API call", "routine",
+                "ops", "bytes", "traced s", "replayed s");
+
+    /* Replay the records of each open in turn */
+    for(v = 0; v < nrecs; v++) {
+        const H5FD_trace_rec_t *rec = &recs[order[v]];
+        hbool_t last_of_file = (hbool_t)(v + 1 == nrecs || recs[order[v + 1]].file != rec->file);
+        H5FD_mem_t type = (H5FD_mem_t)rec->type;
+        double start = H5_get_time();
+        double elapsed;
+        herr_t status = SUCCEED;
+
+        if(rec->op >= H5FD_TRACE_NOPS) {
+            error_msg("bad record %lu in trace file \"%s\"\n", (unsigned long)order[v], trace_fname_g);
+            h5tools_setstatus(EXIT_FAILURE);
+            goto done;
+        }
+        if((rec->op == H5FD_TRACE_OPEN) != (NULL == file)) {
+            error_msg("record %lu in trace file \"%s\" %s\n", (unsigned long)order[v], trace_fname_g,
+                    file ? "opens a file that's already open" : "is for a file that isn't open");
+            h5tools_setstatus(EXIT_FAILURE);
+            goto done;
+        }
+
+        /* Make sure reads and writes are within the file's allocated space */
+        if(rec->op == H5FD_TRACE_READ || rec->op == H5FD_TRACE_WRITE) {
+            haddr_t end = rec->addr + rec->size;
+
+            if(buf_size < rec->size) {
+                HDfree(buf);
+                buf_size = (size_t)rec->size;
+                if(NULL == (buf = HDcalloc((size_t)1, buf_size))) {
+                    error_msg("unable to allocate %Hu byte buffer\n", rec->size);
+                    h5tools_setstatus(EXIT_FAILURE);
+                    goto done;
+                }
+            }
+            if(H5FDget_eoa(file, type) < end && H5FDset_eoa(file, type, end) < 0)
+                status = FAIL;
+            start = H5_get_time();
+        }
+
+        /* Replay the operation */
+        if(status >= 0)
+            switch((H5FD_trace_op_t)rec->op) {
+                case H5FD_TRACE_OPEN:
+                    if(NULL == (file = H5FDopen(target_fname_g, flags, fapl, HADDR_UNDEF)))
+                        status = FAIL;
+                    break;
+
+                case H5FD_TRACE_CLOSE:
+                    status = H5FDclose(file);
+                    file = NULL;
+                    break;
+
+                case H5FD_TRACE_READ:
+                    status = H5FDread(file, type, H5P_DEFAULT, rec->addr, (size_t)rec->size, buf);
+                    break;
+
+                case H5FD_TRACE_WRITE:
+                    status = H5FDwrite(file, type, H5P_DEFAULT, rec->addr, (size_t)rec->size, buf);
+                    break;
+
+                case H5FD_TRACE_FLUSH:
+                    status = H5FDflush(file, H5P_DEFAULT, FALSE);
+                    break;
+
+                case H5FD_TRACE_TRUNCATE:
+                    if(H5FDset_eoa(file, H5FD_MEM_DEFAULT, rec->addr) < 0)
+                        status = FAIL;
+                    else
+                        status = H5FDtruncate(file, H5P_DEFAULT, FALSE);
+                    break;
+
+                case H5FD_TRACE_NOPS:
+                default:
+                    HDassert(0 && "Unknown trace operation?!?");
+                    status = FAIL;
+                    break;
+            } /* end switch */
+        elapsed = H5_get_time() - start;
+        if(status < 0) {
+            error_msg("unable to %s target file \"%s\" (record %lu)\n", op_names_g[rec->op],
+                    target_fname_g, (unsigned long)order[v]);
+            h5tools_setstatus(EXIT_FAILURE);
+            goto done;
+        }
+
+        /* Accumulate the statistics */
+        stats[rec->op].calls++;
+        stats[rec->op].bytes += (rec->op == H5FD_TRACE_READ || rec->op == H5FD_TRACE_WRITE) ? rec->size : 0;
+        stats[rec->op].traced += rec->elapsed;
+        stats[rec->op].replayed += elapsed;
+        stats[rec->op].traced_hist[bucket(rec->elapsed)]++;
+        stats[rec->op].replayed_hist[bucket(elapsed)]++;
+
+        /* Print the totals of each API call when its last record is done */
+        if(calls_g) {
+            call_ops++;
+            call_bytes += (rec->op == H5FD_TRACE_READ || rec->op == H5FD_TRACE_WRITE) ? rec->size : 0;
+            call_traced += rec->elapsed;
+            call_replayed += elapsed;
+            if(last_of_file || recs[order[v + 1]].api_call != rec->api_call) {
+                if(0 == mpi_rank)
+                    HDfprintf(stdout, "%-6u %-10Hu %-32s %8Hu %14Hu %12.6f %12.6f\n", rec->file, rec->api_call,
+                            rec->api_name[0] ? rec->api_name : "-", call_ops, call_bytes,
+                            call_traced, call_replayed);
+                call_ops = call_bytes = 0;
+                call_traced = call_replayed = 0.0;
+            }
+        }
+
+        /* Close the target if the trace ends before the file was closed */
+        if(last_of_file && file) {
+            if(H5FDclose(file) < 0) {
+                error_msg("unable to close target file \"%s\"\n", target_fname_g);
+                h5tools_setstatus(EXIT_FAILURE);
+                file = NULL;
+                goto done;
+            }
+            file = NULL;
+        }
+    } /* end for */
+
+    if(0 == mpi_rank) {
+        if(calls_g)
+            HDfprintf(stdout, "\n");
+        print_stats(stats);
+    }
+
+done:
+    if(file)
+        H5FDclose(file);
+    if(fapl >= 0)
+        H5Pclose(fapl);
+    HDfree(buf);
+    HDfree(order);
+    HDfree(recs);
+    if(trace_fname_g)
+        HDfree(trace_fname_g);
+    if(target_fname_g)
+        HDfree(target_fname_g);
+
+    leave(h5tools_getstatus());
+} /* main() */
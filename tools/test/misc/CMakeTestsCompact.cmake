@@ -0,0 +1,54 @@
+#
+# Copyright by The HDF Group.
+# All rights reserved.
+#
+# This file is part of HDF5.  The full HDF5 copyright notice, including
+# terms governing use, modification, and redistribution, is contained in
+# the COPYING file, which can be found at the root of the source code
+# distribution tree, or in https://support.hdfgroup.org/ftp/HDF5/releases.
+# If you do not have access to either file, you may request a copy from
+# help@hdfgroup.org.
+#
+
+##############################################################################
+##############################################################################
+###           T H E   T E S T S                                            ###
+##############################################################################
+##############################################################################
+
+  if (NOT BUILD_SHARED_LIBS)
+    set (tgt_ext "")
+  else ()
+    set (tgt_ext "-shared")
+  endif ()
+
+  # Remove any output file left over from previous test run
+  add_test (
+    NAME H5COMPACT-clearall-objects
+    COMMAND    ${CMAKE_COMMAND}
+        -E remove
+        h5compact_test.h5
+  )
+  set_tests_properties (H5COMPACT-clearall-objects PROPERTIES FIXTURES_SETUP clear_testcompact)
+
+  # create a file with free space before its raw data
+  add_test (NAME H5COMPACT-create COMMAND $<TARGET_FILE:h5compact_test> create)
+  set_tests_properties (H5COMPACT-create PROPERTIES
+      FIXTURES_REQUIRED clear_testcompact
+  )
+
+  # compact it, 48K at a time
+  add_test (NAME H5COMPACT-h5compact COMMAND $<TARGET_FILE:h5compact${tgt_ext}> -v --step=49152 h5compact_test.h5)
+  set_tests_properties (H5COMPACT-h5compact PROPERTIES
+      DEPENDS H5COMPACT-create
+  )
+
+  # check that the file shrank and the data is unchanged
+  add_test (NAME H5COMPACT-verify COMMAND $<TARGET_FILE:h5compact_test> verify)
+  set_tests_properties (H5COMPACT-verify PROPERTIES
+      DEPENDS H5COMPACT-h5compact
+  )
+
+  set (H5_DEP_EXECUTABLES ${H5_DEP_EXECUTABLES}
+        h5compact_test
+  )
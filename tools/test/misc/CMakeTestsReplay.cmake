@@ -0,0 +1,95 @@
+#
+# Copyright by The HDF Group.
+# All rights reserved.
+#
+# This file is part of HDF5.  The full HDF5 copyright notice, including
+# terms governing use, modification, and redistribution, is contained in
+# the COPYING file, which can be found at the root of the source code
+# distribution tree, or in https://support.hdfgroup.org/ftp/HDF5/releases.
+# If you do not have access to either file, you may request a copy from
+# help@hdfgroup.org.
+#
+
+##############################################################################
+##############################################################################
+###           T H E   T E S T S  M A C R O S                               ###
+##############################################################################
+##############################################################################
+
+  if (NOT BUILD_SHARED_LIBS)
+    set (tgt_ext "")
+  else ()
+    set (tgt_ext "-shared")
+  endif ()
+
+  # Replay the trace, keeping the output for h5replay_test to check
+  macro (ADD_H5_REPLAY_TEST testname resultcode)
+    add_test (
+        NAME H5REPLAY-${testname}
+        COMMAND "${CMAKE_COMMAND}"
+            -D "TEST_PROGRAM=$<TARGET_FILE:h5replay${tgt_ext}>"
+            -D "TEST_ARGS:STRING=${ARGN}"
+            -D "TEST_FOLDER=${PROJECT_BINARY_DIR}"
+            -D "TEST_OUTPUT=h5replay_${testname}.out"
+            -D "TEST_EXPECT=${resultcode}"
+            -D "TEST_SKIP_COMPARE=TRUE"
+            -P "${HDF_RESOURCES_EXT_DIR}/runTest.cmake"
+    )
+    set_tests_properties (H5REPLAY-${testname} PROPERTIES
+        DEPENDS H5REPLAY-create
+    )
+  endmacro ()
+
+##############################################################################
+##############################################################################
+###           T H E   T E S T S                                            ###
+##############################################################################
+##############################################################################
+
+  # Remove any output file left over from previous test run
+  add_test (
+    NAME H5REPLAY-clearall-objects
+    COMMAND    ${CMAKE_COMMAND}
+        -E remove
+        h5replay_test.trc
+        h5replay_test_a.h5
+        h5replay_test_b.h5
+        h5replay_target.h5
+        h5replay_sec2.out
+        h5replay_sec2.out.err
+        h5replay_core.out
+        h5replay_core.out.err
+        h5replay_missing.out
+        h5replay_missing.out.err
+  )
+  set_tests_properties (H5REPLAY-clearall-objects PROPERTIES FIXTURES_SETUP clear_testreplay)
+
+  # trace two files that are open at the same time
+  add_test (NAME H5REPLAY-create COMMAND $<TARGET_FILE:h5replay_test> create)
+  set_tests_properties (H5REPLAY-create PROPERTIES
+      FIXTURES_REQUIRED clear_testreplay
+  )
+
+  # replay it with the sec2 driver, by API call
+  ADD_H5_REPLAY_TEST (sec2 0 --calls h5replay_test.trc h5replay_target.h5)
+  add_test (NAME H5REPLAY-sec2-check COMMAND $<TARGET_FILE:h5replay_test> check-calls h5replay_sec2.out)
+  set_tests_properties (H5REPLAY-sec2-check PROPERTIES
+      DEPENDS H5REPLAY-sec2
+  )
+
+  # replay it with the core driver
+  ADD_H5_REPLAY_TEST (core 0 --driver=core h5replay_test.trc h5replay_target.h5)
+  set_tests_properties (H5REPLAY-core PROPERTIES
+      DEPENDS H5REPLAY-sec2-check
+  )
+  add_test (NAME H5REPLAY-core-check COMMAND $<TARGET_FILE:h5replay_test> check h5replay_core.out)
+  set_tests_properties (H5REPLAY-core-check PROPERTIES
+      DEPENDS H5REPLAY-core
+  )
+
+  # a trace that doesn't exist
+  ADD_H5_REPLAY_TEST (missing 1 h5replay_missing.trc h5replay_target.h5)
+
+  set (H5_DEP_EXECUTABLES ${H5_DEP_EXECUTABLES}
+        h5replay_test
+  )
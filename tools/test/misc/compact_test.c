@@ -0,0 +1,320 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://support.hdfgroup.org/ftp/HDF5/releases.  *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+ * Purpose:     This program creates a fragmented file for h5compact and,
+ *              after h5compact has run, checks that the file shrank and
+ *              that its data is unchanged.
+ *
+ *              The file holds four blocks of raw data, in this order:
+ *
+ *                  A: 128K, deleted
+ *                  B:  48K, kept (also linked as "alias")
+ *                  C:  64K, deleted
+ *                  D:  16K, kept (chunked)
+ *
+ *              A best-fit search puts D into C, after which the rest of
+ *              C is the best fit for B, but lies after B.  B only ends
+ *              up in A if the search for free space skips the space
+ *              after each block.
+ *
+ *              Usage:  compact_test create|verify
+ */
+#include "hdf5.h"
+#include "H5private.h"
+
+#define KB                      1024
+#define FILENAME                "h5compact_test.h5"
+
+/* Sizes of the blocks, in unsigned ints */
+#define NELMTS_A                (128 * KB / sizeof(unsigned))
+#define NELMTS_B                (48 * KB / sizeof(unsigned))
+#define NELMTS_C                (64 * KB / sizeof(unsigned))
+#define NELMTS_D                (16 * KB / sizeof(unsigned))
+
+/* Total size of the raw data, before deleting A and C */
+#define SIZE_ALL                ((NELMTS_A + NELMTS_B + NELMTS_C + NELMTS_D) * sizeof(unsigned))
+
+herr_t create_file(void);
+herr_t verify_file(void);
+
+
+/*-------------------------------------------------------------------------
+ * Function:    write_dset
+ *
+ * Purpose:     Creates a dataset of NELMTS unsigned ints, filled with a
+ *              pattern that depends on SEED.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+write_dset(hid_t fid, const char *name, size_t nelmts, unsigned seed, hbool_t chunked)
+{
+    hid_t       sid = -1;
+    hid_t       dcpl = -1;
+    hid_t       did = -1;
+    hsize_t     dims[1];
+    unsigned    *buf = NULL;
+    size_t      u;
+
+    dims[0] = (hsize_t)nelmts;
+    if (NULL == (buf = (unsigned *)HDmalloc(nelmts * sizeof(unsigned))))
+        goto error;
+    for (u = 0; u < nelmts; u++)
+        buf[u] = (unsigned)u * seed;
+
+    if ((sid = H5Screate_simple(1, dims, NULL)) < 0)
+        goto error;
+    if ((dcpl = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+        goto error;
+    if (chunked && H5Pset_chunk(dcpl, 1, dims) < 0)
+        goto error;
+    if ((did = H5Dcreate2(fid, name, H5T_NATIVE_UINT, sid, H5P_DEFAULT, dcpl, H5P_DEFAULT)) < 0)
+        goto error;
+    if (H5Dwrite(did, H5T_NATIVE_UINT, H5S_ALL, H5S_ALL, H5P_DEFAULT, buf) < 0)
+        goto error;
+
+    if (H5Dclose(did) < 0)
+        goto error;
+    if (H5Pclose(dcpl) < 0)
+        goto error;
+    if (H5Sclose(sid) < 0)
+        goto error;
+    HDfree(buf);
+
+    return SUCCEED;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Dclose(did);
+        H5Pclose(dcpl);
+        H5Sclose(sid);
+    } H5E_END_TRY;
+    if (buf)
+        HDfree(buf);
+
+    return FAIL;
+} /* end write_dset() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    check_dset
+ *
+ * Purpose:     Checks the data written by write_dset().
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+check_dset(hid_t fid, const char *name, size_t nelmts, unsigned seed)
+{
+    hid_t       did = -1;
+    unsigned    *buf = NULL;
+    size_t      u;
+
+    if (NULL == (buf = (unsigned *)HDcalloc(nelmts, sizeof(unsigned))))
+        goto error;
+    if ((did = H5Dopen2(fid, name, H5P_DEFAULT)) < 0)
+        goto error;
+    if (H5Dread(did, H5T_NATIVE_UINT, H5S_ALL, H5S_ALL, H5P_DEFAULT, buf) < 0)
+        goto error;
+    for (u = 0; u < nelmts; u++)
+        if (buf[u] != (unsigned)u * seed) {
+            HDfprintf(stderr, "dataset \"%s\": element %zu is %u, expected %u\n",
+                    name, u, buf[u], (unsigned)u * seed);
+            goto error;
+        }
+
+    if (H5Dclose(did) < 0)
+        goto error;
+    HDfree(buf);
+
+    return SUCCEED;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Dclose(did);
+    } H5E_END_TRY;
+    if (buf)
+        HDfree(buf);
+
+    return FAIL;
+} /* end check_dset() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    create_file
+ *
+ * Purpose:     Creates the fragmented file.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+create_file(void)
+{
+    hid_t       fid = -1;
+    hid_t       fcpl = -1;
+    h5_stat_t   st;
+
+    /* Keep track of the free space across file opens */
+    if ((fcpl = H5Pcreate(H5P_FILE_CREATE)) < 0)
+        goto error;
+    if (H5Pset_file_space_strategy(fcpl, H5F_FSPACE_STRATEGY_FSM_AGGR, TRUE, (hsize_t)1) < 0)
+        goto error;
+    if ((fid = H5Fcreate(FILENAME, H5F_ACC_TRUNC, fcpl, H5P_DEFAULT)) < 0)
+        goto error;
+
+    if (write_dset(fid, "A", NELMTS_A, 1, FALSE) < 0)
+        goto error;
+    if (write_dset(fid, "B", NELMTS_B, 3, FALSE) < 0)
+        goto error;
+    if (write_dset(fid, "C", NELMTS_C, 5, FALSE) < 0)
+        goto error;
+    if (write_dset(fid, "D", NELMTS_D, 7, TRUE) < 0)
+        goto error;
+    if (H5Lcreate_hard(fid, "B", fid, "alias", H5P_DEFAULT, H5P_DEFAULT) < 0)
+        goto error;
+
+    /* Release the space of A and C */
+    if (H5Ldelete(fid, "A", H5P_DEFAULT) < 0)
+        goto error;
+    if (H5Ldelete(fid, "C", H5P_DEFAULT) < 0)
+        goto error;
+
+    if (H5Fclose(fid) < 0)
+        goto error;
+    if (H5Pclose(fcpl) < 0)
+        goto error;
+
+    /* The released space must still be part of the file */
+    if (HDstat(FILENAME, &st) < 0)
+        goto error;
+    if ((size_t)st.st_size < SIZE_ALL) {
+        HDfprintf(stderr, "file is only %zu bytes before compaction\n", (size_t)st.st_size);
+        goto error;
+    }
+
+    return SUCCEED;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Fclose(fid);
+        H5Pclose(fcpl);
+    } H5E_END_TRY;
+
+    return FAIL;
+} /* end create_file() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    verify_file
+ *
+ * Purpose:     Checks that the file shrank, that B was moved into the
+ *              space of A, and that the data is unchanged.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+verify_file(void)
+{
+    hid_t       fid = -1;
+    hid_t       did = -1;
+    haddr_t     addr;
+    h5_stat_t   st;
+
+    if (HDstat(FILENAME, &st) < 0)
+        goto error;
+    if ((size_t)st.st_size >= SIZE_ALL) {
+        HDfprintf(stderr, "file is still %zu bytes after compaction\n", (size_t)st.st_size);
+        goto error;
+    }
+
+    if ((fid = H5Fopen(FILENAME, H5F_ACC_RDONLY, H5P_DEFAULT)) < 0)
+        goto error;
+
+    /* B started after all of A, so it must have moved if it's now within
+     * the first 128K of the file
+     */
+    if ((did = H5Dopen2(fid, "B", H5P_DEFAULT)) < 0)
+        goto error;
+    if (HADDR_UNDEF == (addr = H5Dget_offset(did)))
+        goto error;
+    if (addr >= NELMTS_A * sizeof(unsigned)) {
+        HDfprintf(stderr, "B is still at address %a after compaction\n", addr);
+        goto error;
+    }
+    if (H5Dclose(did) < 0)
+        goto error;
+
+    if (check_dset(fid, "B", NELMTS_B, 3) < 0)
+        goto error;
+    if (check_dset(fid, "alias", NELMTS_B, 3) < 0)
+        goto error;
+    if (check_dset(fid, "D", NELMTS_D, 7) < 0)
+        goto error;
+    if (H5Fclose(fid) < 0)
+        goto error;
+
+    return SUCCEED;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Dclose(did);
+        H5Fclose(fid);
+    } H5E_END_TRY;
+
+    return FAIL;
+} /* end verify_file() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    main
+ *
+ * Purpose:     Creates or verifies the file for the h5compact tests
+ *
+ * Return:      EXIT_SUCCESS/EXIT_FAILURE
+ *
+ *-------------------------------------------------------------------------
+ */
+int
+main(int argc, char *argv[])
+{
+    herr_t  ret;
+
+    if (argc != 2)
+        goto error;
+
+    if (!HDstrcmp(argv[1], "create"))
+        ret = create_file();
+    else if (!HDstrcmp(argv[1], "verify"))
+        ret = verify_file();
+    else
+        goto error;
+
+    if (ret < 0) {
+        HDprintf("***** H5COMPACT %s FAILED! *****\n", argv[1]);
+        HDexit(EXIT_FAILURE);
+    }
+
+    HDexit(EXIT_SUCCESS);
+
+error:
+    HDfprintf(stderr, "usage: %s create|verify\n", argv[0]);
+    HDexit(EXIT_FAILURE);
+} /* end main() */
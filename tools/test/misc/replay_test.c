@@ -0,0 +1,429 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://support.hdfgroup.org/ftp/HDF5/releases.  *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+ * Purpose:     This program records a trace for h5replay and, after
+ *              h5replay has run, checks what it printed against the
+ *              trace.
+ *
+ *              The trace has two files that are open at the same time,
+ *              so their records are interleaved, and then the first file
+ *              opened again.
+ *
+ *              Usage:  replay_test create
+ *                      replay_test check|check-calls h5replay_output
+ *
+ *              "check" compares the number of operations and bytes of
+ *              each kind with the trace.  "check-calls" also compares
+ *              the I/O printed for each API call, which must be grouped
+ *              by file.
+ */
+#include "hdf5.h"
+#include "H5private.h"
+
+#define TRACE_NAME              "h5replay_test.trc"
+#define FILENAME_A              "h5replay_test_a.h5"
+#define FILENAME_B              "h5replay_test_b.h5"
+#define DSET_NELMTS             (16 * 1024)
+#define NDSETS                  3
+#define LINE_SIZE               1024
+
+/* Totals of one API call, or of one kind of operation */
+typedef struct replay_io_t {
+    unsigned    file;           /* Serial number of the file's open */
+    hsize_t     api_call;       /* Serial number of the API call */
+    hsize_t     ops;            /* Number of operations */
+    hsize_t     bytes;          /* Bytes read or written */
+} replay_io_t;
+
+static const char *op_names_g[H5FD_TRACE_NOPS] = {
+    "open", "close", "read", "write", "flush", "truncate"
+};
+
+herr_t create_trace(void);
+herr_t check_output(const char *output, hbool_t calls);
+
+
+/*-------------------------------------------------------------------------
+ * Function:    write_dset
+ *
+ * Purpose:     Creates and writes a dataset of DSET_NELMTS ints.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+write_dset(hid_t fid, const char *name, const int *buf)
+{
+    hid_t       sid = -1;
+    hid_t       did = -1;
+    hsize_t     dims[1] = {DSET_NELMTS};
+
+    if((sid = H5Screate_simple(1, dims, NULL)) < 0)
+        goto error;
+    if((did = H5Dcreate2(fid, name, H5T_NATIVE_INT, sid, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0)
+        goto error;
+    if(H5Dwrite(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, buf) < 0)
+        goto error;
+    if(H5Dclose(did) < 0)
+        goto error;
+    if(H5Sclose(sid) < 0)
+        goto error;
+
+    return SUCCEED;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Dclose(did);
+        H5Sclose(sid);
+    } H5E_END_TRY;
+
+    return FAIL;
+} /* end write_dset() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    create_trace
+ *
+ * Purpose:     Writes datasets to two files open at the same time, then
+ *              reads them back from the first, tracing all the I/O.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+create_trace(void)
+{
+    hid_t       fapl = -1;
+    hid_t       under_fapl = -1;
+    hid_t       fid_a = -1;
+    hid_t       fid_b = -1;
+    hid_t       did = -1;
+    char        name[32];
+    int         *buf = NULL;
+    unsigned    u;
+
+    /* Records are appended to an existing trace */
+    HDremove(TRACE_NAME);
+
+    if(NULL == (buf = (int *)HDmalloc(DSET_NELMTS * sizeof(int))))
+        goto error;
+    for(u = 0; u < DSET_NELMTS; u++)
+        buf[u] = (int)u;
+
+    if((under_fapl = H5Pcreate(H5P_FILE_ACCESS)) < 0)
+        goto error;
+    if(H5Pset_fapl_sec2(under_fapl) < 0)
+        goto error;
+    if((fapl = H5Pcreate(H5P_FILE_ACCESS)) < 0)
+        goto error;
+    if(H5Pset_fapl_trace(fapl, TRACE_NAME, under_fapl) < 0)
+        goto error;
+
+    /* Write to both files in turn */
+    if((fid_a = H5Fcreate(FILENAME_A, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0)
+        goto error;
+    if((fid_b = H5Fcreate(FILENAME_B, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0)
+        goto error;
+    for(u = 0; u < NDSETS; u++) {
+        HDsnprintf(name, sizeof(name), "dset%u", u);
+        if(write_dset(fid_a, name, buf) < 0)
+            goto error;
+        if(H5Fflush(fid_a, H5F_SCOPE_LOCAL) < 0)
+            goto error;
+        if(write_dset(fid_b, name, buf) < 0)
+            goto error;
+    }
+    if(H5Fclose(fid_a) < 0)
+        goto error;
+    fid_a = -1;
+    if(H5Fclose(fid_b) < 0)
+        goto error;
+    fid_b = -1;
+
+    /* Read the first file back */
+    if((fid_a = H5Fopen(FILENAME_A, H5F_ACC_RDONLY, fapl)) < 0)
+        goto error;
+    for(u = 0; u < NDSETS; u++) {
+        HDsnprintf(name, sizeof(name), "dset%u", u);
+        if((did = H5Dopen2(fid_a, name, H5P_DEFAULT)) < 0)
+            goto error;
+        if(H5Dread(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, buf) < 0)
+            goto error;
+        if(H5Dclose(did) < 0)
+            goto error;
+        did = -1;
+    }
+    if(H5Fclose(fid_a) < 0)
+        goto error;
+
+    if(H5Pclose(fapl) < 0)
+        goto error;
+    if(H5Pclose(under_fapl) < 0)
+        goto error;
+    HDfree(buf);
+
+    return SUCCEED;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Dclose(did);
+        H5Fclose(fid_a);
+        H5Fclose(fid_b);
+        H5Pclose(fapl);
+        H5Pclose(under_fapl);
+    } H5E_END_TRY;
+    if(buf)
+        HDfree(buf);
+
+    return FAIL;
+} /* end create_trace() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    read_trace
+ *
+ * Purpose:     Totals the records in the trace by kind of operation and,
+ *              for the records of each open in turn, by API call.
+ *
+ * Return:      Success: An array of *NCALLS API call totals, which the
+ *                       caller frees
+ *
+ *              Failure: NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+static replay_io_t *
+read_trace(replay_io_t *op_totals, size_t *ncalls)
+{
+    FILE                *fp = NULL;
+    H5FD_trace_header_t header;
+    H5FD_trace_rec_t    *recs = NULL;
+    replay_io_t         *calls = NULL;
+    size_t              nrecs = 0;
+    unsigned            max_file = 0;
+    unsigned            file;
+    h5_stat_t           st;
+    size_t              u;
+
+    *ncalls = 0;
+    HDmemset(op_totals, 0, H5FD_TRACE_NOPS * sizeof(replay_io_t));
+
+    if(HDstat(TRACE_NAME, &st) < 0 || (size_t)st.st_size < sizeof(header))
+        goto error;
+    nrecs = ((size_t)st.st_size - sizeof(header)) / sizeof(H5FD_trace_rec_t);
+    if(0 == nrecs)
+        goto error;
+    if(NULL == (recs = (H5FD_trace_rec_t *)HDmalloc(nrecs * sizeof(H5FD_trace_rec_t))))
+        goto error;
+    if(NULL == (calls = (replay_io_t *)HDcalloc(nrecs, sizeof(replay_io_t))))
+        goto error;
+
+    if(NULL == (fp = HDfopen(TRACE_NAME, "rb")))
+        goto error;
+    if(1 != HDfread(&header, sizeof(header), (size_t)1, fp))
+        goto error;
+    if(header.version != H5FD_TRACE_VERSION || header.rec_size != sizeof(H5FD_trace_rec_t))
+        goto error;
+    if(nrecs != HDfread(recs, sizeof(H5FD_trace_rec_t), nrecs, fp))
+        goto error;
+    HDfclose(fp);
+    fp = NULL;
+
+    /* Both files were open at once, so their records must be interleaved */
+    for(u = 0; u < nrecs; u++) {
+        if(recs[u].op >= H5FD_TRACE_NOPS || 0 == recs[u].file)
+            goto error;
+        max_file = MAX(max_file, recs[u].file);
+
+        op_totals[recs[u].op].ops++;
+        if(recs[u].op == H5FD_TRACE_READ || recs[u].op == H5FD_TRACE_WRITE)
+            op_totals[recs[u].op].bytes += recs[u].size;
+    }
+    if(max_file != 3) {
+        HDfprintf(stderr, "trace has %u opens, expected 3\n", max_file);
+        goto error;
+    }
+    for(u = 1; u < nrecs; u++)
+        if(recs[u].file == 1 && recs[u - 1].file == 2)
+            break;
+    if(u == nrecs) {
+        HDfprintf(stderr, "records of the two files aren't interleaved\n");
+        goto error;
+    }
+
+    /* Group the records of each open by API call */
+    for(file = 1; file <= max_file; file++)
+        for(u = 0; u < nrecs; u++) {
+            replay_io_t *call;
+
+            if(recs[u].file != file)
+                continue;
+            if(0 == *ncalls || calls[*ncalls - 1].file != file || calls[*ncalls - 1].api_call != recs[u].api_call) {
+                calls[*ncalls].file = file;
+                calls[*ncalls].api_call = recs[u].api_call;
+                (*ncalls)++;
+            }
+            call = &calls[*ncalls - 1];
+            call->ops++;
+            if(recs[u].op == H5FD_TRACE_READ || recs[u].op == H5FD_TRACE_WRITE)
+                call->bytes += recs[u].size;
+        }
+
+    HDfree(recs);
+
+    return calls;
+
+error:
+    if(fp)
+        HDfclose(fp);
+    if(recs)
+        HDfree(recs);
+    if(calls)
+        HDfree(calls);
+
+    return NULL;
+} /* end read_trace() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    check_output
+ *
+ * Purpose:     Checks what h5replay printed against the trace.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+check_output(const char *output, hbool_t calls_printed)
+{
+    FILE                *fp = NULL;
+    replay_io_t         op_totals[H5FD_TRACE_NOPS];
+    replay_io_t         *calls = NULL;
+    size_t              ncalls = 0;
+    char                line[LINE_SIZE];
+    char                op_name[32];
+    unsigned long long  api_call, ops, bytes;
+    unsigned            file;
+    unsigned            nops = 0;
+    unsigned            op;
+    size_t              u = 0;
+
+    if(NULL == (calls = read_trace(op_totals, &ncalls))) {
+        HDfprintf(stderr, "unable to read trace file \"%s\"\n", TRACE_NAME);
+        goto error;
+    }
+    if(NULL == (fp = HDfopen(output, "r"))) {
+        HDfprintf(stderr, "unable to open \"%s\"\n", output);
+        goto error;
+    }
+
+    /* The I/O of each API call, in the order the opens were replayed */
+    if(calls_printed) {
+        if(NULL == HDfgets(line, sizeof(line), fp) || HDstrncmp(line, "file", (size_t)4))
+            goto bad_line;
+        while(NULL != HDfgets(line, sizeof(line), fp) && '\n' != line[0]) {
+            if(4 != HDsscanf(line, "%u %llu %*s %llu %llu", &file, &api_call, &ops, &bytes))
+                goto bad_line;
+            if(u == ncalls || file != calls[u].file || (hsize_t)api_call != calls[u].api_call
+                    || (hsize_t)ops != calls[u].ops || (hsize_t)bytes != calls[u].bytes) {
+                HDfprintf(stderr, "API call %lu doesn't match the trace: %s", (unsigned long)u, line);
+                goto error;
+            }
+            u++;
+        }
+        if(u != ncalls) {
+            HDfprintf(stderr, "%lu API calls were printed, expected %lu\n", (unsigned long)u,
+                    (unsigned long)ncalls);
+            goto error;
+        }
+    }
+
+    /* The totals of each kind of operation */
+    if(NULL == HDfgets(line, sizeof(line), fp) || HDstrncmp(line, "operation", (size_t)9))
+        goto bad_line;
+    while(NULL != HDfgets(line, sizeof(line), fp) && '\n' != line[0]) {
+        if(3 != HDsscanf(line, "%31s %llu %llu", op_name, &ops, &bytes))
+            goto bad_line;
+        for(op = 0; op < H5FD_TRACE_NOPS; op++)
+            if(!HDstrcmp(op_name, op_names_g[op]))
+                break;
+        if(op == H5FD_TRACE_NOPS || (hsize_t)ops != op_totals[op].ops || (hsize_t)bytes != op_totals[op].bytes) {
+            HDfprintf(stderr, "operation totals don't match the trace: %s", line);
+            goto error;
+        }
+        nops++;
+    }
+    for(op = 0; op < H5FD_TRACE_NOPS; op++)
+        if(op_totals[op].ops > 0)
+            nops--;
+    if(nops != 0 || 0 == op_totals[H5FD_TRACE_READ].ops || 0 == op_totals[H5FD_TRACE_WRITE].ops) {
+        HDfprintf(stderr, "operations are missing from \"%s\"\n", output);
+        goto error;
+    }
+
+    HDfclose(fp);
+    HDfree(calls);
+
+    return SUCCEED;
+
+bad_line:
+    HDfprintf(stderr, "unexpected line in \"%s\": %s", output, line);
+
+error:
+    if(fp)
+        HDfclose(fp);
+    if(calls)
+        HDfree(calls);
+
+    return FAIL;
+} /* end check_output() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    main
+ *
+ * Purpose:     Creates the trace or checks h5replay's output for the
+ *              h5replay tests
+ *
+ * Return:      EXIT_SUCCESS/EXIT_FAILURE
+ *
+ *-------------------------------------------------------------------------
+ */
+int
+main(int argc, char *argv[])
+{
+    herr_t  ret;
+
+    if(argc == 2 && !HDstrcmp(argv[1], "create"))
+        ret = create_trace();
+    else if(argc == 3 && !HDstrcmp(argv[1], "check"))
+        ret = check_output(argv[2], FALSE);
+    else if(argc == 3 && !HDstrcmp(argv[1], "check-calls"))
+        ret = check_output(argv[2], TRUE);
+    else
+        goto error;
+
+    if(ret < 0) {
+        HDprintf("***** H5REPLAY %s FAILED! *****\n", argv[1]);
+        HDexit(EXIT_FAILURE);
+    }
+
+    HDexit(EXIT_SUCCESS);
+
+error:
+    HDfprintf(stderr, "usage: %s create | check h5replay_output | check-calls h5replay_output\n", argv[0]);
+    HDexit(EXIT_FAILURE);
+} /* end main() */
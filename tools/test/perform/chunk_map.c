@@ -0,0 +1,235 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * Copyright by the Board of Trustees of the University of Illinois.         *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://support.hdfgroup.org/ftp/HDF5/releases.  *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+ *  Purpose: check the cost of mapping a selection onto chunks, when a read
+ *          touches a large number of small chunks:
+ *          1. the whole dataset is read at once.
+ *          2. a regular hyperslab with one element per chunk is read.
+ *          3. a block of rows spanning a full row of chunks is read.
+ */
+#include "hdf5.h"
+#include "H5private.h"
+
+#define FILENAME    "chunk_map_perf.h5"
+
+#define RANK        2
+
+#define DSET_NAME   "small_chunks"
+#define DSET_DIM1   1000
+#define DSET_DIM2   1000
+#define CHUNK_DIM1  4
+#define CHUNK_DIM2  4
+
+#define NREADS      5
+
+/*---------------------------------------------------------------------------*/
+static double retrieve_time(void)
+{
+#ifdef H5_HAVE_GETTIMEOFDAY
+    struct timeval t;
+    HDgettimeofday(&t, NULL);
+    return ((double)t.tv_sec + (double)t.tv_usec / 1000000);
+#else
+    return 0.0;
+#endif
+}
+
+/*---------------------------------------------------------------------------*/
+static void
+cleanup (void)
+{
+    if (!getenv ("HDF5_NOCLEANUP")) {
+        remove (FILENAME);
+    }
+}
+
+/*---------------------------------------------------------------------------*/
+static void
+report (const char *label, double elapsed)
+{
+#ifdef H5_HAVE_GETTIMEOFDAY
+    printf("%s: average read time is %lf\n", label, elapsed / NREADS);
+#else
+    printf("%s: no read time because gettimeofday() is not available\n", label);
+    (void)elapsed;
+#endif
+}
+
+/*-------------------------------------------------------------------------------
+ *      Create a chunked dataset with many small chunks:
+ *          dataset dimension:  1000 x 1000
+ *          chunk dimension:    4 x 4
+ */
+static int create_dset(hid_t file, int *data)
+{
+    hid_t        dataspace = H5I_INVALID_HID, dataset = H5I_INVALID_HID;
+    hid_t        dcpl = H5I_INVALID_HID;
+    hsize_t      dims[RANK]  = {DSET_DIM1, DSET_DIM2};
+    hsize_t      chunk_dims[RANK] = {CHUNK_DIM1, CHUNK_DIM2};
+    int          i;
+
+    if((dataspace = H5Screate_simple (RANK, dims, NULL)) < 0)
+        goto error;
+    if((dcpl = H5Pcreate (H5P_DATASET_CREATE)) < 0)
+        goto error;
+    if(H5Pset_chunk (dcpl, RANK, chunk_dims) < 0)
+        goto error;
+
+    if((dataset = H5Dcreate2 (file, DSET_NAME, H5T_NATIVE_INT, dataspace,
+                H5P_DEFAULT, dcpl, H5P_DEFAULT)) < 0)
+        goto error;
+
+    for(i = 0; i < DSET_DIM1 * DSET_DIM2; i++)
+        data[i] = i;
+
+    if(H5Dwrite (dataset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, data) < 0)
+        goto error;
+
+    H5Sclose (dataspace);
+    H5Pclose (dcpl);
+    H5Dclose (dataset);
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Sclose (dataspace);
+        H5Pclose (dcpl);
+        H5Dclose (dataset);
+    } H5E_END_TRY;
+    return 1;
+}
+
+/*-------------------------------------------------------------------------------
+ *      Read the whole dataset, then a hyperslab with one element in every
+ *      chunk, then a block of rows.  Check the values read each time.
+ */
+static int check_chunk_map_perf(hid_t file, int *rdata)
+{
+    hid_t        dataset = H5I_INVALID_HID;
+    hid_t        filespace = H5I_INVALID_HID;
+    hid_t        memspace = H5I_INVALID_HID;
+    hsize_t      start[RANK] = {1, 1};
+    hsize_t      stride[RANK] = {CHUNK_DIM1, CHUNK_DIM2};
+    hsize_t      count[RANK] = {DSET_DIM1 / CHUNK_DIM1, DSET_DIM2 / CHUNK_DIM2};
+    hsize_t      mem_dims[1] = {(DSET_DIM1 / CHUNK_DIM1) * (DSET_DIM2 / CHUNK_DIM2)};
+    hsize_t      row_dims[RANK] = {CHUNK_DIM1, DSET_DIM2};
+    double       start_t, end_t;
+    int          n, i, j;
+
+    if((dataset = H5Dopen2 (file, DSET_NAME, H5P_DEFAULT)) < 0)
+        goto error;
+    if((filespace = H5Dget_space(dataset)) < 0)
+        goto error;
+
+    /* 1. Read the whole dataset */
+    start_t = retrieve_time();
+    for(n = 0; n < NREADS; n++)
+        if(H5Dread (dataset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rdata) < 0)
+            goto error;
+    end_t = retrieve_time();
+    for(i = 0; i < DSET_DIM1 * DSET_DIM2; i++)
+        if(rdata[i] != i)
+            goto error;
+    report("1. Whole dataset", end_t - start_t);
+
+    /* 2. Read one element from every chunk */
+    if(H5Sselect_hyperslab(filespace, H5S_SELECT_SET, start, stride, count, NULL) < 0)
+        goto error;
+    if((memspace = H5Screate_simple(1, mem_dims, NULL)) < 0)
+        goto error;
+    start_t = retrieve_time();
+    for(n = 0; n < NREADS; n++)
+        if(H5Dread (dataset, H5T_NATIVE_INT, memspace, filespace, H5P_DEFAULT, rdata) < 0)
+            goto error;
+    end_t = retrieve_time();
+    for(i = 0; i < (int)count[0]; i++)
+        for(j = 0; j < (int)count[1]; j++)
+            if(rdata[i * (int)count[1] + j] != (1 + i * CHUNK_DIM1) * DSET_DIM2 + 1 + j * CHUNK_DIM2)
+                goto error;
+    report("2. One element per chunk", end_t - start_t);
+    H5Sclose (memspace);
+    memspace = H5I_INVALID_HID;
+
+    /* 3. Read a block of rows, from the middle of the dataset */
+    start[0] = DSET_DIM1 / 2;
+    start[1] = 0;
+    if(H5Sselect_hyperslab(filespace, H5S_SELECT_SET, start, NULL, row_dims, NULL) < 0)
+        goto error;
+    if((memspace = H5Screate_simple(RANK, row_dims, NULL)) < 0)
+        goto error;
+    start_t = retrieve_time();
+    for(n = 0; n < NREADS; n++)
+        if(H5Dread (dataset, H5T_NATIVE_INT, memspace, filespace, H5P_DEFAULT, rdata) < 0)
+            goto error;
+    end_t = retrieve_time();
+    for(i = 0; i < CHUNK_DIM1 * DSET_DIM2; i++)
+        if(rdata[i] != (DSET_DIM1 / 2) * DSET_DIM2 + i)
+            goto error;
+    report("3. Row of chunks", end_t - start_t);
+
+    H5Dclose (dataset);
+    H5Sclose (filespace);
+    H5Sclose (memspace);
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Dclose (dataset);
+        H5Sclose (filespace);
+        H5Sclose (memspace);
+    } H5E_END_TRY;
+    return 1;
+}
+
+/*-------------------------------------------------------------------------------------
+ *  Purpose: check the performance of reads that touch many small chunks.
+ *-------------------------------------------------------------------------------------*/
+int
+main (void)
+{
+    hid_t        file;                          /* handles */
+    int          *data = NULL;                  /* buffer for writing and reading */
+    int          nerrors = 0;
+
+    if(NULL == (data = (int *)HDmalloc(sizeof(int) * DSET_DIM1 * DSET_DIM2)))
+        goto error;
+
+    /* Create a new file. If file exists its contents will be overwritten. */
+    if((file = H5Fcreate (FILENAME, H5F_ACC_TRUNC, H5P_DEFAULT, H5P_DEFAULT)) < 0)
+        goto error;
+
+    nerrors += create_dset(file, data);
+
+    if(H5Fclose (file) < 0)
+        goto error;
+
+    /* Re-open the file for testing performance. */
+    if((file = H5Fopen (FILENAME, H5F_ACC_RDONLY, H5P_DEFAULT)) < 0)
+        goto error;
+
+    nerrors += check_chunk_map_perf(file, data);
+
+    if(H5Fclose (file) < 0)
+        goto error;
+
+    if (nerrors>0) goto error;
+    HDfree(data);
+    cleanup();
+    return 0;
+
+error:
+    HDfree(data);
+    fprintf(stderr, "*** ERRORS DETECTED ***\n");
+    return 1;
+}